@@ -14,7 +14,7 @@
 #include <bcl/beerocks_logging.h>
 #include <bcl/beerocks_os_utils.h>
 #include <bcl/beerocks_timer_factory_impl.h>
-#include <bcl/beerocks_timer_manager_impl.h>
+#include <bcl/beerocks_timer_wheel_manager_impl.h>
 #include <bcl/beerocks_version.h>
 #include <mapf/common/utils.h>
 
@@ -257,7 +257,8 @@ int main(int argc, char *argv[])
     LOG_IF(!timer_factory, FATAL) << "Unable to create timer factory!";
 
     // Create timer manager to help using application timers.
-    auto timer_manager = std::make_shared<beerocks::TimerManagerImpl>(timer_factory, event_loop);
+    auto timer_manager =
+        std::make_shared<beerocks::TimerWheelManagerImpl>(timer_factory, event_loop);
     LOG_IF(!timer_manager, FATAL) << "Unable to create timer manager!";
 
     // Get Agent UDS file
@@ -10,7 +10,7 @@
 
 #include <bcl/beerocks_cmdu_client_factory_factory.h>
 #include <bcl/beerocks_timer_factory_impl.h>
-#include <bcl/beerocks_timer_manager_impl.h>
+#include <bcl/beerocks_timer_wheel_manager_impl.h>
 #include <bcl/network/network_utils.h>
 #include <bcl/network/sockets.h>
 #include <bcl/transaction.h>
@@ -51,7 +51,7 @@ Monitor::Monitor(const std::string &monitor_iface_,
                  beerocks::logging &logger_)
     : EventLoopThread(), monitor_iface(monitor_iface_), beerocks_slave_conf(beerocks_slave_conf_),
       bridge_iface(beerocks_slave_conf.bridge_iface), cmdu_tx(m_tx_buffer, sizeof(m_tx_buffer)),
-      logger(logger_), mon_rssi(cmdu_tx),
+      m_heartbeat(m_heartbeat_buffer, sizeof(m_heartbeat_buffer)), logger(logger_), mon_rssi(cmdu_tx),
 #ifdef FEATURE_PRE_ASSOCIATION_STEERING
       mon_pre_association_steering_hal(cmdu_tx),
 #endif
@@ -118,7 +118,8 @@ bool Monitor::thread_init()
     LOG_IF(!timer_factory, FATAL) << "Unable to create timer factory!";
 
     // Create timer manager to help using application timers.
-    m_timer_manager = std::make_shared<beerocks::TimerManagerImpl>(timer_factory, m_event_loop);
+    m_timer_manager =
+        std::make_shared<beerocks::TimerWheelManagerImpl>(timer_factory, m_event_loop);
     LOG_IF(!m_timer_manager, FATAL) << "Unable to create timer manager!";
 
     if (m_slave_client) {
@@ -2314,15 +2315,16 @@ void Monitor::send_heartbeat()
     }
 
     //LOG(DEBUG) << "sending HEARTBEAT notification";
-    auto request =
-        message_com::create_vs_message<beerocks_message::cACTION_MONITOR_HEARTBEAT_NOTIFICATION>(
-            cmdu_tx);
-    if (request == nullptr) {
-        LOG(ERROR) << "Failed building message!";
-        return;
+    if (!m_heartbeat.is_frozen()) {
+        auto request = message_com::create_vs_message<
+            beerocks_message::cACTION_MONITOR_HEARTBEAT_NOTIFICATION>(m_heartbeat);
+        if (request == nullptr || !m_heartbeat.freeze()) {
+            LOG(ERROR) << "Failed building message!";
+            return;
+        }
     }
 
-    send_cmdu(cmdu_tx);
+    send_cmdu(m_heartbeat);
 }
 
 void Monitor::update_vaps_in_db()
@@ -22,6 +22,7 @@
 #include <bcl/beerocks_timer_manager.h>
 #include <bcl/network/file_descriptor.h>
 #include <beerocks/tlvf/beerocks_message_monitor.h>
+#include <tlvf/CmduTemplate.h>
 
 // Monitor HAL
 #include <bwl/mon_wlan_hal.h>
@@ -118,6 +119,8 @@ private:
     beerocks::config_file::sConfigSlave &beerocks_slave_conf;
     std::string bridge_iface;
 
+    static constexpr size_t HEARTBEAT_BUFFER_LENGTH = 128;
+
     /**
      * Buffer to hold CMDU to be transmitted.
      */
@@ -128,6 +131,13 @@ private:
      */
     ieee1905_1::CmduMessageTx cmdu_tx;
 
+    /**
+     * Heartbeat notification, sent on every poll cycle. Its content never changes, so it is
+     * built once and sent as is.
+     */
+    uint8_t m_heartbeat_buffer[HEARTBEAT_BUFFER_LENGTH];
+    ieee1905_1::CmduTemplate m_heartbeat;
+
     /** 
      * File descriptor of the ARP socket. 
      */
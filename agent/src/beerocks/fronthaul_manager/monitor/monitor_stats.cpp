@@ -25,7 +25,9 @@ using namespace beerocks;
 using namespace net;
 using namespace son;
 
-monitor_stats::monitor_stats(ieee1905_1::CmduMessageTx &cmdu_tx_) : cmdu_tx(cmdu_tx_)
+monitor_stats::monitor_stats(ieee1905_1::CmduMessageTx &cmdu_tx_)
+    : cmdu_tx(cmdu_tx_),
+      m_load_notification(m_load_notification_buffer, sizeof(m_load_notification_buffer))
 {
     mon_db = nullptr;
 }
@@ -75,16 +77,12 @@ void monitor_stats::send_hostap_measurements(const sMeasurementsRequest &request
         return;
     }
 
-    if (!response->alloc_ap_stats()) {
+    auto ap_stats_list = response->reserve_ap_stats(1);
+    if (!ap_stats_list) {
         LOG(ERROR) << "tx_buffer overflow!";
-    }
-
-    auto ap_stats_tuple = response->ap_stats(0);
-    if (!std::get<0>(ap_stats_tuple)) {
-        LOG(ERROR) << "Failed to get element";
         return;
     }
-    auto &ap_stats_msg = std::get<1>(ap_stats_tuple);
+    auto &ap_stats_msg = ap_stats_list[0];
 
     ap_stats_msg.stats_delta_ms         = radio_stats.delta_ms;
     ap_stats_msg.rx_packets             = radio_stats.hal_stats.rx_packets;
@@ -104,22 +102,29 @@ void monitor_stats::send_hostap_measurements(const sMeasurementsRequest &request
     auto total_sta_count = mon_db->get_sta_count();
     size_t elements_to_allocate;
     uint32_t sta_count;
+    beerocks_message::sStaStatsParams *sta_stats_list;
 
+    // Reserve the elements of all the stations that fit in the message at once, and fill them in
+    // place
     auto allocate_sta_stats_elements = [&]() {
         elements_to_allocate =
             cmdu_tx.elements_in_message(sizeof(beerocks_message::sStaStatsParams));
 
         elements_to_allocate = std::min(total_sta_count, elements_to_allocate);
 
-        if (!response->alloc_sta_stats(elements_to_allocate)) {
+        sta_stats_list = response->reserve_sta_stats(elements_to_allocate);
+        if (!sta_stats_list) {
             LOG(ERROR) << "tx_buffer overflow! elements_to_allocate=" << int(elements_to_allocate);
-            return;
+            return false;
         }
 
         sta_count = 0;
+        return true;
     };
 
-    allocate_sta_stats_elements();
+    if (!allocate_sta_stats_elements()) {
+        return;
+    }
 
     for (auto it = mon_db->sta_begin(); it != mon_db->sta_end(); ++it) {
         auto sta_mac  = it->first;
@@ -141,10 +146,12 @@ void monitor_stats::send_hostap_measurements(const sMeasurementsRequest &request
             }
 
             total_sta_count -= sta_count;
-            allocate_sta_stats_elements();
+            if (!allocate_sta_stats_elements()) {
+                return;
+            }
         }
 
-        auto &sta_stats_msg = std::get<1>(response->sta_stats(sta_count));
+        auto &sta_stats_msg = sta_stats_list[sta_count];
 
         sta_stats_msg.mac               = tlvf::mac_from_string(sta_mac);
         sta_stats_msg.rx_packets        = sta_stats.hal_stats.rx_packets;
@@ -194,7 +201,8 @@ void monitor_stats::send_associated_sta_link_metrics(const sMeasurementsRequest
     }
 
     // there is exactly 1 BSSID per STA
-    if (!sta_metrics->alloc_bssid_info_list(1)) {
+    auto bss_info_list = sta_metrics->reserve_bssid_info_list(1);
+    if (!bss_info_list) {
         LOG(ERROR) << "Failed allocate_bssid_info_list";
         return;
     }
@@ -202,7 +210,7 @@ void monitor_stats::send_associated_sta_link_metrics(const sMeasurementsRequest
 
     sta_metrics->sta_mac() = request.mac;
 
-    beerocks_message::sBssidInfo &bss_info = std::get<1>(sta_metrics->bssid_info_list(0));
+    beerocks_message::sBssidInfo &bss_info = bss_info_list[0];
 
     bss_info.earliest_measurement_delta = sta_stats.delta_ms;
 
@@ -422,24 +430,45 @@ void monitor_stats::process(bool instant_handling)
     }
 
     if (send_notification) {
+        // client_count is not reported
+        beerocks_message::sApLoadNotificationParams params = {};
+
+        params.stats_delta_ms         = radio_stats.delta_ms;
+        params.active_client_count    = radio_stats.active_client_count_curr;
+        params.client_tx_load_percent = radio_stats.client_tx_load_tot_curr;
+        params.client_rx_load_percent = radio_stats.client_rx_load_tot_curr;
+        params.channel_load_percent   = radio_stats.channel_load_tot_curr;
+
+        send_load_measurement_notification(params);
+    }
+
+    // Clear stats_requested
+    stats_requested = false;
+}
+
+void monitor_stats::send_load_measurement_notification(
+    const beerocks_message::sApLoadNotificationParams &params)
+{
+    if (!m_load_notification.is_frozen()) {
         auto notification = message_com::create_vs_message<
-            beerocks_message::cACTION_MONITOR_HOSTAP_LOAD_MEASUREMENT_NOTIFICATION>(cmdu_tx);
+            beerocks_message::cACTION_MONITOR_HOSTAP_LOAD_MEASUREMENT_NOTIFICATION>(
+            m_load_notification);
         if (!notification) {
             LOG(ERROR)
                 << "Failed building cACTION_MONITOR_HOSTAP_LOAD_MEASUREMENT_NOTIFICATION message!";
             return;
         }
-        notification->params().stats_delta_ms         = radio_stats.delta_ms;
-        notification->params().active_client_count    = radio_stats.active_client_count_curr;
-        notification->params().client_tx_load_percent = radio_stats.client_tx_load_tot_curr;
-        notification->params().client_rx_load_percent = radio_stats.client_rx_load_tot_curr;
-        notification->params().channel_load_percent   = radio_stats.channel_load_tot_curr;
+        m_load_notification_params = &notification->params();
 
-        m_slave_client->send_cmdu(cmdu_tx);
+        if (!m_load_notification.freeze()) {
+            LOG(ERROR)
+                << "Failed building cACTION_MONITOR_HOSTAP_LOAD_MEASUREMENT_NOTIFICATION message!";
+            return;
+        }
     }
+    m_load_notification.set(*m_load_notification_params, params);
 
-    // Clear stats_requested
-    stats_requested = false;
+    m_slave_client->send_cmdu(m_load_notification);
 }
 
 bool monitor_stats::add_ap_metrics(ieee1905_1::CmduMessageTx &cmdu_tx,
@@ -547,14 +576,15 @@ bool monitor_stats::add_ap_assoc_sta_link_metric(ieee1905_1::CmduMessageTx &cmdu
 
     // Every STA is associated with exactly one BSS in our model, so there is always a single
     // bssid_info.
-    if (!ap_assoc_sta_link_metric_tlv->alloc_bssid_info_list()) {
+    auto bss_info_list = ap_assoc_sta_link_metric_tlv->reserve_bssid_info_list(1);
+    if (!bss_info_list) {
         LOG(ERROR) << "Failed allocate_bssid_info_list";
         return false;
     }
 
-    const auto &sta_stats = sta_node.get_stats();
-    auto &bss_info        = std::get<1>(ap_assoc_sta_link_metric_tlv->bssid_info_list(0));
-    bss_info.bssid        = bssid;
+    const auto &sta_stats               = sta_node.get_stats();
+    auto &bss_info                      = bss_info_list[0];
+    bss_info.bssid                      = bssid;
     bss_info.earliest_measurement_delta = sta_stats.delta_ms;
 
     // TODO: MAC data rate and Phy rate are not necessarily the same
@@ -581,15 +611,15 @@ bool monitor_stats::add_ap_assoc_wifi_6_sta_status_report(ieee1905_1::CmduMessag
 
     const auto &sta_qos_ctrl_params = sta_node.get_qos_ctrl_params();
 
-    if (!ap_assoc_wifi_6_sta_status_report_tlv->alloc_tid_queue_size_list(
-            IEEE80211_QOS_TID_MAX_UP)) {
+    auto tid_queue_size_list = ap_assoc_wifi_6_sta_status_report_tlv->reserve_tid_queue_size_list(
+        IEEE80211_QOS_TID_MAX_UP);
+    if (!tid_queue_size_list) {
         LOG(ERROR) << "alloc_tid_queue_size_list() has failed!";
         return false;
     }
 
     for (uint8_t n = 0; n < IEEE80211_QOS_TID_MAX_UP; n++) {
-        auto &ap_assoc_wifi_6_sta_status_report =
-            std::get<1>(ap_assoc_wifi_6_sta_status_report_tlv->tid_queue_size_list(n));
+        auto &ap_assoc_wifi_6_sta_status_report      = tid_queue_size_list[n];
         ap_assoc_wifi_6_sta_status_report.tid        = n;
         ap_assoc_wifi_6_sta_status_report.queue_size = sta_qos_ctrl_params.tid_queue_size[n];
     }
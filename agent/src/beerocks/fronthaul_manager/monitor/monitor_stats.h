@@ -16,7 +16,9 @@
 #include <bcl/network/network_utils.h>
 
 #include <bwl/mon_wlan_hal.h>
+#include <beerocks/tlvf/beerocks_message_common.h>
 #include <tlvf/CmduMessageTx.h>
+#include <tlvf/CmduTemplate.h>
 
 namespace son {
 class monitor_stats {
@@ -90,7 +92,22 @@ private:
                                   const monitor_radio_node::SRadioStats &radio_stats);
     void send_associated_sta_link_metrics(const sMeasurementsRequest &request);
 
+    /**
+     * @brief Send the load measurement notification with the given parameters.
+     */
+    void send_load_measurement_notification(
+        const beerocks_message::sApLoadNotificationParams &params);
+
     ieee1905_1::CmduMessageTx &cmdu_tx;
+
+    /**
+     * Load measurement notification, sent on every measurement period the load changes. Only its
+     * parameters change, so it is built once and they are updated in place.
+     */
+    static constexpr size_t LOAD_NOTIFICATION_BUFFER_LENGTH = 128;
+    uint8_t m_load_notification_buffer[LOAD_NOTIFICATION_BUFFER_LENGTH];
+    ieee1905_1::CmduTemplate m_load_notification;
+    beerocks_message::sApLoadNotificationParams *m_load_notification_params = nullptr;
 };
 
 } // namespace son
@@ -170,6 +170,7 @@ public:
         wfa_map::tlvProfile2MultiApProfile::eMultiApProfile certification_profile =
             wfa_map::tlvProfile2MultiApProfile::eMultiApProfile::PRPLMESH_PROFILE_UNKNOWN;
         int on_boot_scan;
+        bool transport_rx_ring = false;
         uint8_t max_num_mlds = 3; // Arbitrary
     } device_conf;
 
@@ -18,7 +18,7 @@
 #include <bcl/beerocks_cmdu_client_factory_factory.h>
 #include <bcl/beerocks_cmdu_server_factory.h>
 #include <bcl/beerocks_timer_factory_impl.h>
-#include <bcl/beerocks_timer_manager_impl.h>
+#include <bcl/beerocks_timer_wheel_manager_impl.h>
 #include <bcl/beerocks_ucc_server_factory.h>
 #include <bcl/beerocks_utils.h>
 #include <bcl/beerocks_wifi_channel.h>
@@ -199,10 +199,11 @@ bool BackhaulManager::thread_init()
     LOG_IF(!m_platform_manager_cmdu_client_factory, FATAL)
         << "Unable to create CMDU client factory!";
 
-    // Create broker client factory to create broker clients when requested
+    // Create broker client factory to create broker clients when requested (the clients receive
+    // CMDUs through the broker shared memory if the transport supports it)
     std::string broker_uds_path = m_beerocks_temp_path + std::string(BEEROCKS_BROKER_UDS);
     m_broker_client_factory =
-        beerocks::btl::create_broker_client_factory(broker_uds_path, m_event_loop);
+        beerocks::btl::create_broker_client_factory(broker_uds_path, m_event_loop, true);
     LOG_IF(!m_broker_client_factory, FATAL) << "Unable to create broker client factory!";
 
     // Create timer factory to create instances of timers.
@@ -210,7 +211,8 @@ bool BackhaulManager::thread_init()
     LOG_IF(!timer_factory, FATAL) << "Unable to create timer factory!";
 
     // Create timer manager to help using application timers.
-    m_timer_manager = std::make_shared<beerocks::TimerManagerImpl>(timer_factory, m_event_loop);
+    m_timer_manager =
+        std::make_shared<beerocks::TimerWheelManagerImpl>(timer_factory, m_event_loop);
     LOG_IF(!m_timer_manager, FATAL) << "Unable to create timer manager!";
     // In case of error in one of the steps of this method, we have to undo all the previous steps
     // (like when rolling back a database transaction, where either all steps get executed or none
@@ -28,7 +28,7 @@ static std::shared_ptr<beerocks::nbapi::Amxrt> guarantee = nullptr;
 #include <bcl/beerocks_event_loop_impl.h>
 #include <bcl/beerocks_logging.h>
 #include <bcl/beerocks_timer_factory_impl.h>
-#include <bcl/beerocks_timer_manager_impl.h>
+#include <bcl/beerocks_timer_wheel_manager_impl.h>
 #include <bcl/beerocks_utils.h>
 #include <bcl/beerocks_version.h>
 #include <bcl/network/network_utils.h>
@@ -371,7 +371,8 @@ static int run_beerocks_slave(beerocks::config_file::sConfigSlave &beerocks_slav
     LOG_IF(!timer_factory, FATAL) << "Unable to create timer factory!";
 
     // Create timer manager to help using application timers.
-    auto timer_manager = std::make_shared<beerocks::TimerManagerImpl>(timer_factory, event_loop);
+    auto timer_manager =
+        std::make_shared<beerocks::TimerWheelManagerImpl>(timer_factory, event_loop);
     LOG_IF(!timer_manager, FATAL) << "Unable to create timer manager!";
 
     // Create UDS address where the server socket will listen for incoming connection requests.
@@ -412,7 +413,8 @@ static int run_beerocks_slave(beerocks::config_file::sConfigSlave &beerocks_slav
     {
         auto db           = beerocks::AgentDB::get();
         auto on_boot_scan = beerocks::string_utils::stoi(beerocks_slave_conf.on_boot_scan);
-        db->device_conf.on_boot_scan = on_boot_scan;
+        db->device_conf.on_boot_scan      = on_boot_scan;
+        db->device_conf.transport_rx_ring = (beerocks_slave_conf.transport_rx_ring == "1");
         db->init_data_model(amb_dm_obj);
 
         auto management_mode = beerocks::bpl::cfg_get_management_mode();
@@ -44,6 +44,11 @@ constexpr std::chrono::milliseconds clean_old_arp_entries_timer_interval(ARP_CLE
  */
 constexpr std::chrono::milliseconds check_wlan_params_changed_timer_interval(5000);
 
+/**
+ * Number of threads to run the blocking calls to the platform.
+ */
+constexpr size_t THREAD_POOL_SIZE = 2;
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////// Local Module Functions ///////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -211,12 +216,9 @@ bool PlatformManager::start()
         }
     }
 
-    // Start the async work queue
+    // Start the thread pool
     m_should_stop = false;
-    if (!work_queue.start()) {
-        LOG(ERROR) << "Failed starting asynchronous work queue";
-        return false;
-    }
+    m_thread_pool = std::make_unique<beerocks::ThreadPool>(THREAD_POOL_SIZE, m_event_loop);
 
     transaction.commit();
 
@@ -227,9 +229,9 @@ bool PlatformManager::stop()
 {
     bool result = true;
 
-    LOG(DEBUG) << "Stopping asynchronous work queue...";
+    LOG(DEBUG) << "Stopping thread pool...";
     m_should_stop = true;
-    work_queue.stop(true);
+    m_thread_pool.reset();
 
     // Stop the DHCP Monitor
     stop_dhcp_monitor();
@@ -288,12 +290,13 @@ void PlatformManager::load_iface_params(const std::string &strIface, beerocks::e
     m_mapIfaces[strIface] = {eType}; // Struct initialization
 }
 
-std::string PlatformManager::bridge_iface_from_mac(const sMacAddr &sMac)
+std::string PlatformManager::bridge_iface_from_mac(const std::string &bridge_iface,
+                                                   const sMacAddr &sMac)
 {
     char iface_name[BPL_ARP_IFACE_NAME_LEN];
 
     // Read the interface name using BPL
-    if (bpl::arp_get_bridge_iface(config.bridge_iface.c_str(), sMac.oct, iface_name) == -1) {
+    if (bpl::arp_get_bridge_iface(bridge_iface.c_str(), sMac.oct, iface_name) == -1) {
         return {};
     }
 
@@ -711,11 +714,15 @@ bool PlatformManager::handle_cmdu(int fd, ieee1905_1::CmduMessageRx &cmdu_rx)
             break;
         }
 
-        LOG(INFO) << "Set onboarding to " << std::to_string(request->params().onboarding);
-        bpl::cfg_set_onboarding(int(request->params().onboarding));
+        int onboarding = request->params().onboarding;
+        LOG(INFO) << "Set onboarding to " << onboarding;
+
+        // Writing the UCI configuration is blocking, and no response message is needed
+        m_thread_pool->post([onboarding]() {
+            bpl::cfg_set_onboarding(onboarding);
 
-        LOG(INFO) << "Success onboarding " << std::to_string(bpl::cfg_is_onboarding());
-        // No response message is needed
+            LOG(INFO) << "Success onboarding " << std::to_string(bpl::cfg_is_onboarding());
+        });
     } break;
 
     case beerocks_message::ACTION_PLATFORM_WPS_ONBOARDING_REQUEST: {
@@ -730,12 +737,9 @@ bool PlatformManager::handle_cmdu(int fd, ieee1905_1::CmduMessageRx &cmdu_rx)
 
         std::string iface = request->iface_name(message::IFACE_NAME_LENGTH);
 
-        work_queue.enqueue<void>(
-            [this](std::string iface) {
-                bpl::cfg_notify_onboarding_completed("SSID", "PASSWORD", "SECURITY", iface.c_str(),
-                                                     0);
-            },
-            iface);
+        m_thread_pool->post([iface]() {
+            bpl::cfg_notify_onboarding_completed("SSID", "PASSWORD", "SECURITY", iface.c_str(), 0);
+        });
     } break;
 
     case beerocks_message::ACTION_PLATFORM_ERROR_NOTIFICATION: {
@@ -750,7 +754,7 @@ bool PlatformManager::handle_cmdu(int fd, ieee1905_1::CmduMessageRx &cmdu_rx)
         std::string error_data(error->data(0));
 
         // Notify the SL asynchronously
-        work_queue.enqueue<void>([error_code, error_data]() {
+        m_thread_pool->post([error_code, error_data]() {
             LOG(DEBUG) << "PLATFORM ERROR NOTIFICATION - Code: " << error_code
                        << ", Data: " << error_data;
 
@@ -905,6 +909,27 @@ bool PlatformManager::handle_arp_raw()
         return false;
     }
 
+    // Reading the forwarding database of the bridge is blocking, so the interface of the client is
+    // looked up in the thread pool and the response is sent once it is found
+    auto bridge_iface = config.bridge_iface;
+    auto iface        = std::make_shared<std::string>();
+    return m_thread_pool->post(
+        [bridge_iface, entry, iface]() {
+            *iface = bridge_iface_from_mac(bridge_iface, tlvf::mac_from_array(entry.mac));
+        },
+        [this, task_id, entry, iface]() {
+            if (!send_arp_query_response(task_id, entry, *iface)) {
+                LOG(ERROR) << "send_arp_query_response failed, restarting ARP monitor";
+                if (!restart_arp_monitor()) {
+                    LOG(ERROR) << "failed to restart ARP monitor";
+                }
+            }
+        });
+}
+
+bool PlatformManager::send_arp_query_response(int task_id, const bpl::BPL_ARP_MON_ENTRY &entry,
+                                              const std::string &strIface)
+{
     auto arp_resp =
         message_com::create_vs_message<beerocks_message::cACTION_PLATFORM_ARP_QUERY_RESPONSE>(
             m_cmdu_tx, task_id);
@@ -921,8 +946,6 @@ bool PlatformManager::handle_arp_raw()
     arp_resp->params().state     = entry.state;
     arp_resp->params().source    = entry.source;
 
-    std::string strIface = bridge_iface_from_mac(arp_resp->params().mac);
-
     if (strIface.empty())
         return (false);
 
@@ -9,11 +9,11 @@
 #ifndef _PLATFORM_MANAGER_H
 #define _PLATFORM_MANAGER_H
 
-#include <bcl/beerocks_async_work_queue.h>
 #include <bcl/beerocks_cmdu_server.h>
 #include <bcl/beerocks_config_file.h>
 #include <bcl/beerocks_event_loop.h>
 #include <bcl/beerocks_logging.h>
+#include <bcl/beerocks_thread_pool.h>
 #include <bcl/beerocks_timer_manager.h>
 #include <bcl/network/buffer_impl.h>
 #include <bcl/network/sockets.h>
@@ -103,7 +103,28 @@ private:
 
     int get_agent_socket();
     void load_iface_params(const std::string &strIface, beerocks::eArpSource eType);
-    std::string bridge_iface_from_mac(const sMacAddr &sMac);
+
+    /**
+     * @brief Looks up the bridge port a client is connected to (blocking).
+     *
+     * @param bridge_iface Name of the bridge.
+     * @param sMac MAC address of the client.
+     * @return Name of the interface, or an empty string if not found.
+     */
+    static std::string bridge_iface_from_mac(const std::string &bridge_iface,
+                                             const sMacAddr &sMac);
+
+    /**
+     * @brief Sends the response to an ARP query to the agent.
+     *
+     * @param task_id ID of the task that sent the query.
+     * @param entry ARP entry of the client.
+     * @param strIface Bridge port the client is connected to, as found by bridge_iface_from_mac().
+     * @return true on success and false otherwise.
+     */
+    bool send_arp_query_response(int task_id, const bpl::BPL_ARP_MON_ENTRY &entry,
+                                 const std::string &strIface);
+
     void send_dhcp_notification(const std::string &op, const std::string &mac,
                                 const std::string &ip, const std::string &hostname);
 
@@ -186,7 +207,10 @@ private:
     std::string master_version;
     std::string slave_version;
 
-    beerocks::async_work_queue work_queue;
+    /**
+     * Pool of threads to run the blocking calls to the platform off the event loop.
+     */
+    std::unique_ptr<beerocks::ThreadPool> m_thread_pool;
 
     std::unordered_map<std::string, std::shared_ptr<beerocks_message::sWlanSettings>>
         bpl_iface_wlan_params_map;
@@ -24,7 +24,7 @@
 #include <bcl/beerocks_cmdu_client_factory_factory.h>
 #include <bcl/beerocks_cmdu_server_factory.h>
 #include <bcl/beerocks_timer_factory_impl.h>
-#include <bcl/beerocks_timer_manager_impl.h>
+#include <bcl/beerocks_timer_wheel_manager_impl.h>
 #include <bcl/beerocks_utils.h>
 #include <bcl/beerocks_wifi_channel.h>
 #include <bcl/network/network_utils.h>
@@ -219,10 +219,11 @@ bool slave_thread::thread_init()
     }
     /**  Broker Client  **/
 
-    // Create broker client factory to create broker clients when requested
+    // Create broker client factory to create broker clients when requested (the clients receive
+    // CMDUs through the broker shared memory if the transport supports it)
     std::string broker_uds_path = config.temp_path + std::string(BEEROCKS_BROKER_UDS);
     m_broker_client_factory =
-        beerocks::btl::create_broker_client_factory(broker_uds_path, m_event_loop);
+        beerocks::btl::create_broker_client_factory(broker_uds_path, m_event_loop, true);
     LOG_IF(!m_broker_client_factory, FATAL) << "Unable to create broker client factory!";
 
     // Create an instance of a broker client connected to the broker server that is running in the
@@ -339,7 +340,8 @@ bool slave_thread::thread_init()
     LOG_IF(!timer_factory, FATAL) << "Unable to create timer factory!";
 
     // Create timer manager to help using application timers.
-    m_timer_manager = std::make_shared<beerocks::TimerManagerImpl>(timer_factory, m_event_loop);
+    m_timer_manager =
+        std::make_shared<beerocks::TimerWheelManagerImpl>(timer_factory, m_event_loop);
     LOG_IF(!m_timer_manager, FATAL) << "Unable to create timer manager!";
 
     // Create a timer to run the FSM periodically
@@ -370,7 +372,7 @@ bool slave_thread::thread_init()
         return false;
     }
 
-    m_task_pool.add_task(std::make_shared<ApAutoConfigurationTask>(*this, cmdu_tx));
+    m_task_pool.add_task(std::make_shared<ApAutoConfigurationTask>(*this, cmdu_tx, m_event_loop));
     m_task_pool.add_task(m_service_prioritization_task_configurator =
                              std::make_shared<ServicePrioritizationTask>(*this, cmdu_tx));
     m_task_pool.add_task(std::make_shared<ProxyAgentDppTask>(*this, cmdu_tx));
@@ -4628,7 +4630,8 @@ bool slave_thread::agent_fsm()
         if (!(db->device_conf.certification_mode && db->device_conf.local_controller)) {
             if (db->device_conf.management_mode != BPL_MGMT_MODE_NOT_MULTIAP) {
                 // Configure the transport process to use the network bridge
-                if (!m_broker_client->configure_interfaces(db->bridge.iface_name, {}, true, true)) {
+                if (!m_broker_client->configure_interfaces(db->bridge.iface_name, {}, true, true,
+                                                           db->device_conf.transport_rx_ring)) {
                     LOG(FATAL) << "Failed configuring transport process!";
                 }
             }
@@ -4663,7 +4666,8 @@ bool slave_thread::agent_fsm()
         if (db->device_conf.certification_mode && db->device_conf.local_controller) {
             if (db->device_conf.management_mode != BPL_MGMT_MODE_NOT_MULTIAP) {
                 // Configure the transport process to use the network bridge
-                if (!m_broker_client->configure_interfaces(db->bridge.iface_name, {}, true, true)) {
+                if (!m_broker_client->configure_interfaces(db->bridge.iface_name, {}, true, true,
+                                                           db->device_conf.transport_rx_ring)) {
                     LOG(FATAL) << "Failed configuring transport process!";
                     break;
                 }
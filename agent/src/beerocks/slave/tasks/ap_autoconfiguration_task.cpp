@@ -62,6 +62,11 @@ using namespace net;
 using namespace multi_vendor;
 
 static constexpr uint8_t AUTOCONFIG_DISCOVERY_TIMEOUT_SECONDS = 3;
+
+/**
+ * Number of Diffie-Hellman key pairs generated ahead of time (one is used per M1 message)
+ */
+static constexpr size_t DH_KEYS_PRECOMPUTED = 2;
 #define HANDLE_THIRD_PARTY_ENABLE "1"
 #define VENDOR_HIDE_SSID 0x80
 #define VENDOR_BSS_CFG 0x02
@@ -101,8 +106,13 @@ const std::string ApAutoConfigurationTask::fsm_state_to_string(eState status)
 }
 
 ApAutoConfigurationTask::ApAutoConfigurationTask(slave_thread &btl_ctx,
-                                                 ieee1905_1::CmduMessageTx &cmdu_tx)
-    : Task(eTaskType::AP_AUTOCONFIGURATION), m_btl_ctx(btl_ctx), m_cmdu_tx(cmdu_tx)
+                                                 ieee1905_1::CmduMessageTx &cmdu_tx,
+                                                 std::shared_ptr<EventLoop> event_loop)
+    : Task(eTaskType::AP_AUTOCONFIGURATION), m_btl_ctx(btl_ctx), m_cmdu_tx(cmdu_tx),
+      m_event_loop(event_loop), m_thread_pool(std::make_shared<ThreadPool>(1, event_loop)),
+      m_dh_keys(
+          m_thread_pool, []() { return std::make_unique<mapf::encryption::diffie_hellman>(); },
+          DH_KEYS_PRECOMPUTED)
 {
 }
 
@@ -239,7 +249,7 @@ void ApAutoConfigurationTask::handle_event(uint8_t event_enum_value, const void
 
         if (!m_traffic_separation_configurator) {
             m_traffic_separation_configurator =
-                std::make_unique<TrafficSeparation>(m_btl_ctx.m_broker_client);
+                std::make_unique<TrafficSeparation>(m_btl_ctx.m_broker_client, m_event_loop);
         }
 
         // Reset the traffic separation configuration as they will be reconfigured on
@@ -940,7 +950,11 @@ bool ApAutoConfigurationTask::add_wsc_m1_tlv(const std::string &radio_iface)
     cfg.msg_type = WSC::eWscMessageType::WSC_MSG_TYPE_M1;
     cfg.mac      = db->bridge.mac;
 
-    radio_conf_params.dh = std::make_unique<mapf::encryption::diffie_hellman>();
+    radio_conf_params.dh = m_dh_keys.take();
+    if (!radio_conf_params.dh) {
+        LOG(ERROR) << "Failed to generate Diffie-Hellman key pair";
+        return false;
+    }
 
     std::copy(radio_conf_params.dh->nonce(),
               radio_conf_params.dh->nonce() + radio_conf_params.dh->nonce_length(),
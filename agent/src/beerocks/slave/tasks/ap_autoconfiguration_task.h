@@ -12,6 +12,8 @@
 #include "../traffic_separation.h"
 #include "task.h"
 
+#include <bcl/beerocks_precomputed_queue.h>
+#include <bcl/beerocks_thread_pool.h>
 #include <mapf/common/encryption.h>
 #include <tlvf/CmduMessageTx.h>
 #include <tlvf/WSC/configData.h>
@@ -26,7 +28,8 @@ class slave_thread;
 
 class ApAutoConfigurationTask : public Task {
 public:
-    ApAutoConfigurationTask(slave_thread &btl_ctx, ieee1905_1::CmduMessageTx &cmdu_tx);
+    ApAutoConfigurationTask(slave_thread &btl_ctx, ieee1905_1::CmduMessageTx &cmdu_tx,
+                            std::shared_ptr<EventLoop> event_loop);
     ~ApAutoConfigurationTask() {}
 
     void work() override;
@@ -127,6 +130,22 @@ private:
     slave_thread &m_btl_ctx;
     ieee1905_1::CmduMessageTx &m_cmdu_tx;
 
+    /**
+     * Application event loop, to run the continuations of the thread pools in.
+     */
+    std::shared_ptr<EventLoop> m_event_loop;
+
+    /**
+     * Thread pool to generate the Diffie-Hellman key pairs in.
+     */
+    std::shared_ptr<ThreadPool> m_thread_pool;
+
+    /**
+     * Diffie-Hellman key pairs generated ahead of time, to build the WSC M1 messages without
+     * generating a key pair in the event loop.
+     */
+    PrecomputedQueue<mapf::encryption::diffie_hellman> m_dh_keys;
+
     /* Message handlers: */
 
     /**
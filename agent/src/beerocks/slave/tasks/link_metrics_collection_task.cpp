@@ -747,7 +747,8 @@ void LinkMetricsCollectionTask::handle_unassociated_sta_link_metrics_query(
                    "message!";
             return;
         }
-        if (!request_out->alloc_stations_list(total_number_stations)) {
+        auto stations_list = request_out->reserve_stations_list(total_number_stations);
+        if (!stations_list) {
             LOG(ERROR) << "tx_buffer overflow! elements_to_allocate=" << total_number_stations;
             continue;
         }
@@ -755,8 +756,8 @@ void LinkMetricsCollectionTask::handle_unassociated_sta_link_metrics_query(
         size_t count(0);
         for (auto &stations_per_channel : radio.second) {
             for (auto &single_station : stations_per_channel.second) {
-                std::get<1>(request_out->stations_list(count)).sta_mac = single_station;
-                std::get<1>(request_out->stations_list(count)).channel = stations_per_channel.first;
+                stations_list[count].sta_mac = single_station;
+                stations_list[count].channel = stations_per_channel.first;
                 count++;
             }
         }
@@ -846,7 +847,8 @@ bool LinkMetricsCollectionTask::send_ap_metric_query_message(
         auto bssid_query_size = bssid_query.size();
 
         // allocate enough bssids
-        if (!query->alloc_bssid_list(bssid_query_size)) {
+        auto bssid_list = query->reserve_bssid_list(bssid_query_size);
+        if (!bssid_list) {
             LOG(ERROR) << "Failed to allocate memory for bssid_list, required size: "
                        << bssid_query_size;
             return false;
@@ -854,11 +856,7 @@ bool LinkMetricsCollectionTask::send_ap_metric_query_message(
 
         // pack all bssids in the query
         for (size_t i = 0; i < bssid_query_size; ++i) {
-            auto list = query->bssid_list(i);
-            if (!std::get<0>(list)) {
-                LOG(ERROR) << "Failed to get element of bssid_list";
-            }
-            std::get<1>(list) = bssid_query[i];
+            bssid_list[i] = bssid_query[i];
 
             // responses are coming one by one - each bssid alone,
             // so we keep track of each bssid in the query
@@ -1272,13 +1270,12 @@ void LinkMetricsCollectionTask::handle_ap_metrics_response(ieee1905_1::CmduMessa
             }
 
             sta_link_metric_response_tlv->sta_mac() = link_metric.sta_mac;
-            if (!sta_link_metric_response_tlv->alloc_bssid_info_list(1)) {
+            auto bssid_info_list = sta_link_metric_response_tlv->reserve_bssid_info_list(1);
+            if (!bssid_info_list) {
                 LOG(ERROR) << "Failed alloc_bssid_info_list";
                 continue;
             }
-            auto &sta_link_metric_response =
-                std::get<1>(sta_link_metric_response_tlv->bssid_info_list(0));
-            sta_link_metric_response = link_metric.bssid_info;
+            bssid_info_list[0] = link_metric.bssid_info;
         }
 
         // For each station one "Associated Wifi 6 Sta Status tlv" is added to
@@ -1294,14 +1291,15 @@ void LinkMetricsCollectionTask::handle_ap_metrics_response(ieee1905_1::CmduMessa
             }
 
             sta_wifi6_status_report_response_tlv->sta_mac() = qos_control_params.sta_mac;
-            if (!sta_wifi6_status_report_response_tlv->alloc_tid_queue_size_list(
-                    IEEE80211_QOS_TID_MAX_UP)) {
+            auto tid_queue_size_list =
+                sta_wifi6_status_report_response_tlv->reserve_tid_queue_size_list(
+                    IEEE80211_QOS_TID_MAX_UP);
+            if (!tid_queue_size_list) {
                 LOG(ERROR) << "alloc_tid_queue_size_list() has failed!";
                 return;
             }
             for (uint8_t n = 0; n < IEEE80211_QOS_TID_MAX_UP; n++) {
-                auto &ap_assoc_wifi_6_sta_status_report =
-                    std::get<1>(sta_wifi6_status_report_response_tlv->tid_queue_size_list(n));
+                auto &ap_assoc_wifi_6_sta_status_report      = tid_queue_size_list[n];
                 ap_assoc_wifi_6_sta_status_report.tid        = n;
                 ap_assoc_wifi_6_sta_status_report.queue_size = qos_control_params.tid_queue_size[n];
             }
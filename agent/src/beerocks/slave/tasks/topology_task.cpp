@@ -62,7 +62,8 @@ uint8_t convert_bandwidth(eWiFiBandwidth bw)
 }
 
 TopologyTask::TopologyTask(BackhaulManager &btl_ctx, ieee1905_1::CmduMessageTx &cmdu_tx)
-    : Task(eTaskType::TOPOLOGY), m_btl_ctx(btl_ctx), m_cmdu_tx(cmdu_tx)
+    : Task(eTaskType::TOPOLOGY), m_btl_ctx(btl_ctx), m_cmdu_tx(cmdu_tx),
+      m_topology_discovery(m_topology_discovery_buffer, sizeof(m_topology_discovery_buffer))
 {
 }
 
@@ -422,31 +423,51 @@ void TopologyTask::send_topology_discovery()
 
         auto iface_mac = tlvf::mac_from_string(iface_mac_str);
 
-        auto cmdu_header =
-            m_cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_DISCOVERY_MESSAGE);
-        if (!cmdu_header) {
-            LOG(ERROR) << "Failed to create TOPOLOGY_DISCOVERY_MESSAGE cmdu";
-            return;
-        }
-        auto tlvAlMacAddress = m_cmdu_tx.addClass<ieee1905_1::tlvAlMacAddress>();
-        if (!tlvAlMacAddress) {
-            LOG(ERROR) << "Failed to create tlvAlMacAddress tlv";
-            return;
-        }
-        tlvAlMacAddress->mac() = db->bridge.mac;
-
-        auto tlvMacAddress = m_cmdu_tx.addClass<ieee1905_1::tlvMacAddress>();
-        if (!tlvMacAddress) {
-            LOG(ERROR) << "Failed to create tlvMacAddress tlv";
-            return;
+        if (!m_topology_discovery.is_frozen() || m_topology_discovery_al_mac != db->bridge.mac) {
+            if (!build_topology_discovery_template(db->bridge.mac)) {
+                return;
+            }
         }
-        tlvMacAddress->mac() = iface_mac;
+        m_topology_discovery.set(*m_topology_discovery_iface_mac, iface_mac);
 
         LOG(DEBUG) << "send_1905_topology_discovery_message, bridge_mac=" << db->bridge.mac
                    << ", iface=" << iface_name;
-        m_btl_ctx.send_cmdu_to_broker(m_cmdu_tx, network_utils::MULTICAST_1905_MAC_ADDR,
-                                      db->bridge.mac, iface_name);
+        m_btl_ctx.send_cmdu_to_broker(m_topology_discovery,
+                                      network_utils::MULTICAST_1905_MAC_ADDR, db->bridge.mac,
+                                      iface_name);
+    }
+}
+
+bool TopologyTask::build_topology_discovery_template(const sMacAddr &al_mac)
+{
+    auto cmdu_header =
+        m_topology_discovery.create(0, ieee1905_1::eMessageType::TOPOLOGY_DISCOVERY_MESSAGE);
+    if (!cmdu_header) {
+        LOG(ERROR) << "Failed to create TOPOLOGY_DISCOVERY_MESSAGE cmdu";
+        return false;
+    }
+    auto tlvAlMacAddress = m_topology_discovery.addClass<ieee1905_1::tlvAlMacAddress>();
+    if (!tlvAlMacAddress) {
+        LOG(ERROR) << "Failed to create tlvAlMacAddress tlv";
+        return false;
+    }
+    tlvAlMacAddress->mac() = al_mac;
+
+    auto tlvMacAddress = m_topology_discovery.addClass<ieee1905_1::tlvMacAddress>();
+    if (!tlvMacAddress) {
+        LOG(ERROR) << "Failed to create tlvMacAddress tlv";
+        return false;
+    }
+    // Set for each interface before sending
+    m_topology_discovery_iface_mac = &tlvMacAddress->mac();
+
+    if (!m_topology_discovery.freeze()) {
+        LOG(ERROR) << "Failed to finalize TOPOLOGY_DISCOVERY_MESSAGE cmdu";
+        return false;
     }
+    m_topology_discovery_al_mac = al_mac;
+
+    return true;
 }
 
 void TopologyTask::send_topology_notification()
@@ -13,6 +13,7 @@
 
 #include <beerocks/tlvf/beerocks_message_1905_vs.h>
 #include <tlvf/CmduMessageTx.h>
+#include <tlvf/CmduTemplate.h>
 
 namespace beerocks {
 
@@ -92,6 +93,15 @@ private:
 
     /* Helper functions */
     void send_topology_discovery();
+
+    /**
+     * @brief Build and freeze the Topology Discovery message template.
+     *
+     * @param al_mac AL MAC address to put in the message.
+     * @return true on success, otherwise false.
+     */
+    bool build_topology_discovery_template(const sMacAddr &al_mac);
+
     void send_topology_notification();
 
     /**
@@ -158,6 +168,17 @@ private:
 
     BackhaulManager &m_btl_ctx;
     ieee1905_1::CmduMessageTx &m_cmdu_tx;
+
+    /**
+     * Topology Discovery is sent on every interface every cycle, and the messages only differ by
+     * the MAC address of the interface. The message is therefore built once, and only that
+     * address is updated before each send.
+     */
+    static constexpr size_t TOPOLOGY_DISCOVERY_BUFFER_LENGTH = 64;
+    uint8_t m_topology_discovery_buffer[TOPOLOGY_DISCOVERY_BUFFER_LENGTH];
+    ieee1905_1::CmduTemplate m_topology_discovery;
+    sMacAddr m_topology_discovery_al_mac;
+    sMacAddr *m_topology_discovery_iface_mac = nullptr;
 };
 
 } // namespace beerocks
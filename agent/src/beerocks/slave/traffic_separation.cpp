@@ -20,11 +20,20 @@ int beerocks::net::TrafficSeparation::m_profile_x_disallow_override_unsupported_
 namespace beerocks {
 namespace net {
 
-TrafficSeparation::TrafficSeparation(std::shared_ptr<btl::BrokerClient> broker_client)
-    : m_broker_client(broker_client)
+TrafficSeparation::TrafficSeparation(std::shared_ptr<btl::BrokerClient> broker_client,
+                                     std::shared_ptr<EventLoop> event_loop)
+    : m_broker_client(broker_client),
+      m_command_thread(std::make_unique<ThreadPool>(1, event_loop))
 {
 }
 
+void TrafficSeparation::run_command(const std::function<void()> &command)
+{
+    if (!m_command_thread->post(command)) {
+        LOG(ERROR) << "Failed to post platform command!";
+    }
+}
+
 void TrafficSeparation::clear_configuration()
 {
     LOG(DEBUG) << "Clearing traffic separation policy!";
@@ -53,19 +62,25 @@ void TrafficSeparation::clear_configuration()
             auto vid = found_it->second;
 
             // Remove VLAN packet filter.
-            network_utils::set_vlan_packet_filter(false, bss_iface_name, vid);
+            run_command([bss_iface_name, vid]() {
+                network_utils::set_vlan_packet_filter(false, bss_iface_name, vid);
+            });
         }
     }
 
     for (auto &eth_port : db->ethernet.lan) {
-        network_utils::set_vlan_packet_filter(false, eth_port.iface_name);
+        auto iface_name = eth_port.iface_name;
+        run_command([iface_name]() { network_utils::set_vlan_packet_filter(false, iface_name); });
     }
-    network_utils::set_vlan_packet_filter(false, db->ethernet.wan.iface_name);
+    auto wan_iface_name = db->ethernet.wan.iface_name;
+    run_command(
+        [wan_iface_name]() { network_utils::set_vlan_packet_filter(false, wan_iface_name); });
 
     db->traffic_separation.primary_vlan_id = 0;
     db->traffic_separation.secondary_vlans_ids.clear();
     db->traffic_separation.ssid_vid_mapping.clear();
-    network_utils::set_vlan_filtering(db->bridge.iface_name, 0);
+    auto bridge_iface_name = db->bridge.iface_name;
+    run_command([bridge_iface_name]() { network_utils::set_vlan_filtering(bridge_iface_name, 0); });
 
     // Remove the Primary Vlan configuration in Transport process
     if (!m_broker_client->configure_primary_vlan_id(0, false)) {
@@ -73,7 +88,8 @@ void TrafficSeparation::clear_configuration()
     }
 
     // Reset the transport monitoring on bridge interfaces
-    if (!m_broker_client->configure_interfaces(db->bridge.iface_name, {}, true, true)) {
+    if (!m_broker_client->configure_interfaces(db->bridge.iface_name, {}, true, true,
+                                               db->device_conf.transport_rx_ring)) {
         LOG(ERROR) << "Failed configuring transport process!";
     }
 }
@@ -83,8 +99,11 @@ void TrafficSeparation::apply_policy(const std::string &radio_iface)
     // Since the following call is locking the database, thread safety is promised on this function.
     auto db = AgentDB::get();
 
-    network_utils::set_vlan_filtering(db->bridge.iface_name,
-                                      db->traffic_separation.primary_vlan_id);
+    auto bridge_iface_name = db->bridge.iface_name;
+    auto primary_vid       = db->traffic_separation.primary_vlan_id;
+    run_command([bridge_iface_name, primary_vid]() {
+        network_utils::set_vlan_filtering(bridge_iface_name, primary_vid);
+    });
 
     // If the primary VID has changed to zero, vlan filtering is disabled, so there is no point
     // modifying the VLAN policy on the platform interfaces.
@@ -249,9 +268,20 @@ void TrafficSeparation::apply_policy(const std::string &radio_iface)
     }
 
     // Create a VLAN interface linked to the bridge interface for each Secondary VLAN.
+    auto secondary_vids = db->traffic_separation.secondary_vlans_ids;
+    bool local_gw       = db->device_conf.local_gw;
+    run_command([bridge_iface_name, secondary_vids, local_gw]() {
+        configure_bridge_vlans(bridge_iface_name, secondary_vids, local_gw);
+    });
+}
+
+void TrafficSeparation::configure_bridge_vlans(const std::string &bridge_iface,
+                                               const std::unordered_set<uint16_t> &secondary_vids,
+                                               bool local_gw)
+{
     auto linux_ifaces = network_utils::linux_get_iface_list();
 
-    std::string bridge_vlan_base_str = db->bridge.iface_name + ".";
+    std::string bridge_vlan_base_str = bridge_iface + ".";
 
     std::list<sBridgeVlanInfo> bridge_vlan_interfaces;
     for (const auto &iface : linux_ifaces) {
@@ -266,8 +296,8 @@ void TrafficSeparation::apply_policy(const std::string &radio_iface)
 
     std::string ipv4_str;
     network_utils::iface_info bridge_iface_info;
-    if (network_utils::get_iface_info(bridge_iface_info, db->bridge.iface_name) != 0) {
-        LOG(ERROR) << "Failed to get iface info of bridge " << db->bridge.iface_name;
+    if (network_utils::get_iface_info(bridge_iface_info, bridge_iface) != 0) {
+        LOG(ERROR) << "Failed to get iface info of bridge " << bridge_iface;
         return;
     }
 
@@ -300,9 +330,9 @@ void TrafficSeparation::apply_policy(const std::string &radio_iface)
     // Create a VLAN interface linked to the bridge for each secondary VLAN, and to each one, set an
     // IP address on a different host if it running on the GW. On non GW platform the IP should be
     // set with DHCP flow.
-    for (auto secondary_vid : db->traffic_separation.secondary_vlans_ids) {
+    for (auto secondary_vid : secondary_vids) {
         auto vlan_iface_of_bridge =
-            network_utils::create_vlan_interface(db->bridge.iface_name, secondary_vid);
+            network_utils::create_vlan_interface(bridge_iface, secondary_vid);
 
         if (vlan_iface_of_bridge.empty()) {
             return;
@@ -315,7 +345,7 @@ void TrafficSeparation::apply_policy(const std::string &radio_iface)
         auto bridge_vlan_ipv4_str       = network_utils::ipv4_to_string(bridge_vlan_ipv4);
         auto bridge_vlan_subnetmask_str = subnetmasks.at(subnetmask_lsb);
 
-        if (db->device_conf.local_gw) {
+        if (local_gw) {
             subnetmask = network_utils::ipv4_from_string(bridge_vlan_subnetmask_str);
 
             // Find subnet
@@ -337,7 +367,7 @@ void TrafficSeparation::apply_policy(const std::string &radio_iface)
         }
     }
 
-    if (db->device_conf.local_gw) {
+    if (local_gw) {
         reconf_dhcp(bridge_vlan_interfaces);
     } else {
         assign_ip_to_vlan_iface(bridge_vlan_interfaces);
@@ -387,58 +417,65 @@ void TrafficSeparation::set_vlan_policy(const std::string &iface, ePortMode port
         return;
     }
 
-    // Helper variables to make the code more readable.
-    bool del = true; // First, remove all VIDs (vid=0).
-    bool pvid;
-    bool untagged;
-
-    network_utils::set_iface_vid_policy(iface, del, 0, is_bridge);
-
-    del = false;
+    auto db             = AgentDB::get();
+    auto primary_vid    = db->traffic_separation.primary_vlan_id;
+    auto secondary_vids = db->traffic_separation.secondary_vlans_ids;
+
+    run_command([iface, port_mode, is_bridge, untagged_port_vid, primary_vid,
+                 secondary_vids]() mutable {
+        // Helper variables to make the code more readable.
+        bool del = true; // First, remove all VIDs (vid=0).
+        bool pvid;
+        bool untagged;
+
+        network_utils::set_iface_vid_policy(iface, del, 0, is_bridge);
+
+        del = false;
+
+        if (port_mode == ePortMode::TAGGED_PORT_PRIMARY_UNTAGGED ||
+            port_mode == ePortMode::TAGGED_PORT_PRIMARY_TAGGED) {
+            if (port_mode == ePortMode::TAGGED_PORT_PRIMARY_UNTAGGED) {
+                // Set the new Primary VLAN with "PVID" and "Egress Untagged" policy.
+                pvid     = true;
+                untagged = true;
+            } else {
+                // Set the new Primary VLAN as Not "PVID" and Not "Egress Untagged" policy.
+                pvid     = false;
+                untagged = false;
+            }
+            network_utils::set_iface_vid_policy(iface, del, primary_vid, is_bridge, pvid,
+                                                untagged);
 
-    if (port_mode == ePortMode::TAGGED_PORT_PRIMARY_UNTAGGED ||
-        port_mode == ePortMode::TAGGED_PORT_PRIMARY_TAGGED) {
-        if (port_mode == ePortMode::TAGGED_PORT_PRIMARY_UNTAGGED) {
-            // Set the new Primary VLAN with "PVID" and "Egress Untagged" policy.
-            pvid     = true;
-            untagged = true;
-        } else {
-            // Set the new Primary VLAN as Not "PVID" and Not "Egress Untagged" policy.
+            // Add secondary VIDs.
             pvid     = false;
             untagged = false;
-        }
-        auto db = AgentDB::get();
-        network_utils::set_iface_vid_policy(iface, del, db->traffic_separation.primary_vlan_id,
-                                            is_bridge, pvid, untagged);
-
-        // Add secondary VIDs.
-        pvid     = false;
-        untagged = false;
-        for (const auto sec_vid : db->traffic_separation.secondary_vlans_ids) {
-            network_utils::set_iface_vid_policy(iface, del, sec_vid, is_bridge, pvid, untagged);
-        }
+            for (const auto sec_vid : secondary_vids) {
+                network_utils::set_iface_vid_policy(iface, del, sec_vid, is_bridge, pvid,
+                                                    untagged);
+            }
 
-        // Double tagged packets with S-Tag must be filtered on tagged ports.
-        if (!is_bridge) {
-            network_utils::set_vlan_packet_filter(true, iface);
+            // Double tagged packets with S-Tag must be filtered on tagged ports.
+            if (!is_bridge) {
+                network_utils::set_vlan_packet_filter(true, iface);
+            }
         }
-    }
-    // port_mode == UNTAGGED_PORT
-    else {
-        if (!untagged_port_vid) {
-            LOG(ERROR) << "Untagged Port VID was not set on port_mode of UNTAGGED_PORT";
-            return;
+        // port_mode == UNTAGGED_PORT
+        else {
+            if (!untagged_port_vid) {
+                LOG(ERROR) << "Untagged Port VID was not set on port_mode of UNTAGGED_PORT";
+                return;
+            }
+            // Set the new Primary VLAN with "PVID" and "Egress Untagged" policy.
+            pvid      = true;
+            untagged  = true;
+            is_bridge = false; // Untagged Port cannot be a bridge interface.
+            network_utils::set_iface_vid_policy(iface, del, untagged_port_vid, is_bridge, pvid,
+                                                untagged);
+
+            // Filter packets containing the VID of the Untagged Port.
+            network_utils::set_vlan_packet_filter(true, iface, untagged_port_vid);
         }
-        // Set the new Primary VLAN with "PVID" and "Egress Untagged" policy.
-        pvid      = true;
-        untagged  = true;
-        is_bridge = false; // Untagged Port cannot be a bridge interface.
-        network_utils::set_iface_vid_policy(iface, del, untagged_port_vid, is_bridge, pvid,
-                                            untagged);
-
-        // Filter packets containing the VID of the Untagged Port.
-        network_utils::set_vlan_packet_filter(true, iface, untagged_port_vid);
-    }
+    });
 }
 
 bool TrafficSeparation::reconf_dhcp(std::list<sBridgeVlanInfo> &vlans_of_bridge)
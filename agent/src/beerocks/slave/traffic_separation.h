@@ -9,9 +9,13 @@
 #ifndef _TRAFFIC_SEPARATION_H
 #define _TRAFFIC_SEPARATION_H
 
+#include <bcl/beerocks_thread_pool.h>
 #include <bcl/network/net_struct.h>
 #include <btl/broker_client.h>
 
+#include <list>
+#include <unordered_set>
+
 namespace beerocks {
 namespace net {
 
@@ -61,10 +65,18 @@ namespace net {
  *                  ID - The Primary VLAN or one of the Secondary VLANs.
  */
 
+/*
+ * The VLAN configuration of the platform is applied by running commands (bridge, ip, ebtables,
+ * dnsmasq, udhcpc...), which block until the command exits. So the decisions are taken in the
+ * calling thread (using the Agent DB), and the commands are run in a thread of their own, in the
+ * same order as they were issued. Commands not run yet when the object is destroyed are dropped,
+ * as the configuration is cleared and applied again on the next start.
+ */
 class TrafficSeparation final {
 
 public:
-    explicit TrafficSeparation(std::shared_ptr<btl::BrokerClient> broker_client);
+    TrafficSeparation(std::shared_ptr<btl::BrokerClient> broker_client,
+                      std::shared_ptr<EventLoop> event_loop);
 
     /**
      * @brief Apply traffic separation policy on the given radio interfaces, and all not
@@ -140,6 +152,27 @@ private:
     void set_vlan_policy(const std::string &iface, ePortMode port_mode, bool is_bridge,
                          uint16_t untagged_port_vid = 0);
 
+    /**
+     * @brief Run a platform command in the command thread, after the ones run before.
+     *
+     * @param command Function that runs the command, which must not use the Agent DB.
+     */
+    void run_command(const std::function<void()> &command);
+
+    /**
+     * @brief Create a VLAN interface linked to the bridge for each secondary VLAN, and set up
+     * the IP addresses on them (from the DHCP server on the GW, or with DHCP requests otherwise).
+     *
+     * @details Runs commands, so it should be run in the command thread.
+     *
+     * @param bridge_iface Bridge interface name.
+     * @param secondary_vids Secondary VLAN IDs.
+     * @param local_gw true if running on the GW.
+     */
+    static void configure_bridge_vlans(const std::string &bridge_iface,
+                                       const std::unordered_set<uint16_t> &secondary_vids,
+                                       bool local_gw);
+
     /**
      * @brief Reconfigure DHCP server with list of interfaces.
      * 
@@ -148,7 +181,7 @@ private:
      * @param vlans_of_bridge List of VLANs of the bridge information. 
      * @return true on success, false otherwise.
      */
-    bool reconf_dhcp(std::list<sBridgeVlanInfo> &vlans_of_bridge);
+    static bool reconf_dhcp(std::list<sBridgeVlanInfo> &vlans_of_bridge);
 
     /**
      * @brief Send DHCP request on each VLAN of the bridge and assigning the responded IP to the
@@ -158,7 +191,7 @@ private:
      * 
      * @param vlans_of_bridge List of VLANs of the bridge information. 
      */
-    void assign_ip_to_vlan_iface(const std::list<sBridgeVlanInfo> &vlans_of_bridge);
+    static void assign_ip_to_vlan_iface(const std::list<sBridgeVlanInfo> &vlans_of_bridge);
 
     /**
      * @brief Configure interface on the Transport.
@@ -173,6 +206,11 @@ private:
      * Broker client to exchange CMDU messages with broker server running in transport process.
      */
     std::shared_ptr<btl::BrokerClient> m_broker_client;
+
+    /**
+     * Thread to run the platform commands in (a pool of one thread runs them in order).
+     */
+    std::unique_ptr<ThreadPool> m_command_thread;
 };
 } // namespace net
 } // namespace beerocks
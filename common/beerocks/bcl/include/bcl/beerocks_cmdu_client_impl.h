@@ -14,7 +14,7 @@
 
 #include <bcl/beerocks_defines.h>
 #include <bcl/beerocks_event_loop.h>
-#include <bcl/network/buffer_impl.h>
+#include <bcl/network/ring_buffer_impl.h>
 
 namespace beerocks {
 
@@ -76,6 +76,24 @@ private:
      */
     void handle_read(int fd);
 
+    /**
+     * @brief Handles the write event in the connected socket.
+     *
+     * Sends the data queued because the socket was not ready for writing when it was sent. Stops
+     * monitoring the write event once all of it has been sent.
+     *
+     * Declared const, like send_cmdu(), as it only modifies the (mutable) send queue.
+     *
+     * @param fd File descriptor of the connected socket.
+     */
+    void handle_write(int fd) const;
+
+    /**
+     * @brief Monitors the write event in the connected socket if there is data queued to be sent
+     * through it.
+     */
+    void watch_send_queue() const;
+
     /**
      * @brief Handles the disconnect and error events in the connected socket.
      *
@@ -122,7 +140,14 @@ private:
      * If connection uses a message-oriented socket instead, this buffer and the code that
      * uses it is also valid.
      */
-    beerocks::net::BufferImpl<message::MESSAGE_BUFFER_LENGTH> m_buffer;
+    beerocks::net::RingBufferImpl m_buffer{message::MESSAGE_BUFFER_LENGTH};
+
+    /**
+     * Queue of the data not sent yet through the socket connection because the socket was not
+     * ready for writing.
+     * Mutable because sending a CMDU is a const operation.
+     */
+    mutable beerocks::net::SendQueue m_send_queue;
 };
 
 } // namespace beerocks
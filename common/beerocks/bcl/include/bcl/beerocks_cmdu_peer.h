@@ -12,6 +12,7 @@
 #include <bcl/network/buffer.h>
 #include <bcl/network/cmdu_parser.h>
 #include <bcl/network/cmdu_serializer.h>
+#include <bcl/network/send_queue.h>
 #include <bcl/network/sockets.h>
 
 #include <tlvf/CmduMessageRx.h>
@@ -59,14 +60,19 @@ public:
      * @brief Sends a CMDU message.
      *
      * Sends a CMDU message to a remote peer through the given socket connection. Uses the CMDU
-     * message serializer provided in constructor to serialize data to send.
+     * message serializer provided in constructor to serialize the frame header, which is sent
+     * together with the CMDU in a single vectored write, without copying the CMDU.
+     *
+     * Bytes that cannot be sent without blocking are stored in the given send queue, which the
+     * caller must flush when the socket is ready for writing again.
      *
      * @param connection Socket connection to send CMDU through.
+     * @param queue Queue of the data not sent yet through the socket connection.
      * @param cmdu_tx The CMDU message to send.
-     * @return true on success and false otherwise.
+     * @return true on success (CMDU sent or queued) and false otherwise.
      */
     bool send_cmdu(beerocks::net::Socket::Connection &connection,
-                   ieee1905_1::CmduMessageTx &cmdu_tx) const;
+                   beerocks::net::SendQueue &queue, ieee1905_1::CmduMessageTx &cmdu_tx) const;
 
     /**
      * @brief Forwards a CMDU message that was sent by a remote process.
@@ -77,13 +83,15 @@ public:
      * (interface index, source and destination MAC addresses provide routing information).
      *
      * @param connection Socket connection to send CMDU through.
+     * @param queue Queue of the data not sent yet through the socket connection.
      * @param iface_index Index of the network interface that the CMDU message was received on.
      * @param dst_mac Destination MAC address.
      * @param src_mac Source MAC address.
      * @param cmdu_rx The received CMDU message to forward.
-     * @return true on success and false otherwise.
+     * @return true on success (CMDU sent or queued) and false otherwise.
      */
-    bool forward_cmdu(beerocks::net::Socket::Connection &connection, uint32_t iface_index,
+    bool forward_cmdu(beerocks::net::Socket::Connection &connection,
+                      beerocks::net::SendQueue &queue, uint32_t iface_index,
                       const sMacAddr &dst_mac, const sMacAddr &src_mac,
                       ieee1905_1::CmduMessageRx &cmdu_rx);
 
@@ -108,6 +116,21 @@ public:
                        const CmduReceivedHandler &handler);
 
 private:
+    /**
+     * @brief Sends a frame made of the serialized header followed by the CMDU.
+     *
+     * @param connection Socket connection to send CMDU through.
+     * @param queue Queue of the data not sent yet through the socket connection.
+     * @param iface_index Index of the network interface that the CMDU message was received on.
+     * @param dst_mac Destination MAC address.
+     * @param src_mac Source MAC address.
+     * @param cmdu The CMDU message to send, already in network byte order.
+     * @return true on success (CMDU sent or queued) and false otherwise.
+     */
+    bool send_frame(beerocks::net::Socket::Connection &connection, beerocks::net::SendQueue &queue,
+                    uint32_t iface_index, const sMacAddr &dst_mac, const sMacAddr &src_mac,
+                    ieee1905_1::CmduMessage &cmdu) const;
+
     /**
      * CMDU parser used to get CMDU messages out of a byte array received through a socket
      * connection.
@@ -14,7 +14,7 @@
 
 #include <bcl/beerocks_defines.h>
 #include <bcl/beerocks_event_loop.h>
-#include <bcl/network/buffer_impl.h>
+#include <bcl/network/ring_buffer_impl.h>
 
 #include <unordered_map>
 
@@ -139,6 +139,25 @@ private:
      */
     void handle_read(int fd);
 
+    /**
+     * @brief Handles the write event in a client socket connected to the server socket.
+     *
+     * Sends the data queued because the socket was not ready for writing when it was sent. Stops
+     * monitoring the write event once all of it has been sent.
+     *
+     * @param fd File descriptor of the connected socket.
+     */
+    void handle_write(int fd);
+
+    /**
+     * @brief Monitors the write event in a client socket if there is data queued to be sent
+     * through it.
+     *
+     * @param fd File descriptor of the connected socket.
+     * @param send_queue Queue of the data not sent yet through the socket connection.
+     */
+    void watch_send_queue(int fd, const beerocks::net::SendQueue &send_queue);
+
     /**
      * @brief Handles the disconnect and error events in a client socket connected to the server
      * socket.
@@ -187,7 +206,13 @@ private:
          * If connection uses a message-oriented socket instead, this buffer and the code that
          * uses it is also valid.
          */
-        beerocks::net::BufferImpl<message::MESSAGE_BUFFER_LENGTH> buffer;
+        beerocks::net::RingBufferImpl buffer{message::MESSAGE_BUFFER_LENGTH};
+
+        /**
+         * Queue of the data not sent yet through the socket connection because the socket was
+         * not ready for writing.
+         */
+        beerocks::net::SendQueue send_queue;
 
         /**
          * @brief Struct constructor.
@@ -12,20 +12,38 @@
 #include <stddef.h>
 #include <stdint.h>
 
+namespace ieee1905_1 {
+class CmduMessageRx;
+}
+
 namespace beerocks {
 
 class CmduUtils {
 public:
     /**
-     * @brief Verifies if given byte array contains a valid CMDU.
+     * @brief Verifies a single TLV of a received CMDU.
+     *
+     * Vendor specific TLVs with the Intel OUI must start with the beerocks message magic, other
+     * TLVs are always valid. Meant to be given to CmduMessageRx::parse() in lazy mode, which
+     * verifies the TLVs while walking the TLV chain.
+     *
+     * @param tlv TLV, header included, in network byte order.
+     * @param length Length of the TLV, header included.
+     * @return true if the TLV is valid and false otherwise.
+     */
+    static bool verify_tlv(uint8_t *tlv, size_t length);
+
+    /**
+     * @brief Verifies the vendor specific TLVs of a parsed CMDU.
      *
-     * A valid CMDU message contains a CMDU header, 0 or more TLVs and an end-of-message TLV.
+     * Parsing a CMDU already checks its TLVs, this completes it with the check of the beerocks
+     * messages done by verify_tlv(): the vendor specific TLVs with the Intel OUI must start with
+     * the beerocks message magic.
      *
-     * @param data Array of bytes possibly containing a CMDU message.
-     * @param length Number of bytes in the array.
-     * @return true if given data contains a valid CMDU message and false otherwise.
+     * @param cmdu_rx Parsed CMDU message.
+     * @return true if the vendor specific TLVs are valid and false otherwise.
      */
-    static bool verify_cmdu(uint8_t *data, size_t length);
+    static bool verify_vendor_specific_tlvs(const ieee1905_1::CmduMessageRx &cmdu_rx);
 };
 
 } //namespace beerocks
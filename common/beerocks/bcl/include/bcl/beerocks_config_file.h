@@ -74,6 +74,7 @@ public:
         std::string roaming_sticky_client_rssi_threshold;
         std::string credentials_change_timeout_sec;
         std::string use_dataelements_vap_configs;
+        std::string event_loop_stall_threshold_ms;
 
         //[log]
         SConfigLog sLog;
@@ -94,6 +95,7 @@ public:
         std::string monitor_measurement_window_poll_count;
         std::string profile_x_disallow_override_unsupported_configuration;
         std::string on_boot_scan;
+        std::string transport_rx_ring;
         //[slaveX]
         std::string enable_repeater_mode[MAX_RADIOS_PER_AGENT];
         std::string hostap_iface_type[MAX_RADIOS_PER_AGENT];
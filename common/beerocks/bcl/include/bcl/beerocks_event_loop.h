@@ -9,6 +9,9 @@
 #ifndef _BEEROCKS_EVENT_LOOP_H_
 #define _BEEROCKS_EVENT_LOOP_H_
 
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -45,6 +48,25 @@ public:
      */
     using EventHandler = std::function<bool(int fd, EventLoop &loop)>;
 
+    /**
+     * @brief Data handler function definition.
+     *
+     * Parameters to the data handler function are:
+     * @param[in] fd The file descriptor of the socket the data was received on.
+     * @param[in] data Received data, in a buffer of the event loop. It is only valid until the
+     * handler returns, and may be modified in place (e.g. when parsing it).
+     * @param[in] length Number of bytes received (never 0).
+     * @param[in] loop The event loop where the data was received.
+     *
+     * @returns True on success or false otherwise
+     */
+    using DataHandler = std::function<bool(int fd, uint8_t *data, size_t length, EventLoop &loop)>;
+
+    /**
+     * Maximum number of bytes given to a data handler at once. Longer datagrams are truncated.
+     */
+    static constexpr size_t RECV_BUFFER_SIZE = 8192;
+
     /**
      * Set of event handler functions, one function to handle each possible event happened.
      * Handlers are grouped into a struct to facilitate passing them as a single parameter to the
@@ -86,6 +108,17 @@ public:
          * to be ready for a read or write operation.
          */
         EventHandler on_error;
+
+        /**
+         * Hook method that is called back by the event loop with the data received on a socket.
+         * When set, the event loop receives the data itself (with recv() or with a multishot
+         * receive, depending on the implementation) and on_read is not used. A stream socket
+         * that receives end of file is handled as disconnected, and a failed receive as an error,
+         * except for transient errors (see is_transient_receive_error()), which are only logged.
+         * Stream data may be split or merged arbitrarily between calls; each datagram is given
+         * in a single call.
+         */
+        DataHandler on_data;
     };
 
     /**
@@ -134,6 +167,35 @@ public:
      * @return true on success, otherwise false.
      */
     virtual bool set_handler_name(int fd, const std::string &name) = 0;
+
+    /**
+     * @brief Sets the write handler on registered @c EventHandlers with @a fd.
+     *
+     * Write events are only monitored while a write handler is set. A handler that sends data
+     * through a non-blocking socket can then wait for the socket to be ready for writing only
+     * when there is data that could not be sent yet.
+     *
+     * @param fd File Descriptor of EventHandler to update.
+     * @param on_write Write event handler, or nullptr to stop monitoring write events.
+     * @return true on success, otherwise false.
+     */
+    virtual bool set_write_handler(int fd, const EventHandler &on_write) = 0;
+
+protected:
+    /**
+     * @brief Checks if a receive error is transient, i.e. it does not make the socket unusable.
+     *
+     * Such errors (e.g. the network interface a packet socket is bound to going down) are only
+     * logged by the implementations, and the socket is kept in the poll.
+     *
+     * @param err Error number of the failed receive.
+     * @return true if the error is transient and false otherwise.
+     */
+    static bool is_transient_receive_error(int err)
+    {
+        return ENETDOWN == err || ENETUNREACH == err || EHOSTUNREACH == err || ENOBUFS == err ||
+               ENOMEM == err;
+    }
 };
 
 } // namespace beerocks
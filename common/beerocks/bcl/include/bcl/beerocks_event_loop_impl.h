@@ -13,6 +13,7 @@
 
 #include <chrono>
 #include <unordered_map>
+#include <vector>
 
 namespace beerocks {
 
@@ -54,6 +55,11 @@ public:
      */
     bool set_handler_name(int fd, const std::string &name) override;
 
+    /**
+     * @see EventLoop::set_write_handler
+     */
+    bool set_write_handler(int fd, const EventHandler &on_write) override;
+
     /**
      * @brief Main event loop method.
      * @see EventLoop::run
@@ -63,6 +69,15 @@ public:
     int run() override;
 
 private:
+    /**
+     * @brief Receives the data available on a socket and calls its data handler.
+     *
+     * @param fd File descriptor of the socket.
+     * @param handlers Event handlers registered for the socket.
+     * @return false if the called handler failed and true otherwise.
+     */
+    bool handle_data(int fd, const EventHandlers &handlers);
+
     /**
      * epoll file descriptor.
      */
@@ -79,6 +94,11 @@ private:
      * event handlers to deal with events occurred on that file descriptor.
      */
     std::unordered_map<int, EventHandlers> m_fd_to_event_handlers;
+
+    /**
+     * Buffer the data given to data handlers is received in, allocated on first use.
+     */
+    std::vector<uint8_t> m_recv_buffer;
 };
 
 } // namespace beerocks
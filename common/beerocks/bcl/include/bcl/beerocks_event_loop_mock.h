@@ -21,6 +21,7 @@ public:
     MOCK_METHOD(bool, remove_handlers, (int fd), (override));
     MOCK_METHOD(int, run, (), (override));
     MOCK_METHOD(bool, set_handler_name, (int fd, const std::string &name), (override));
+    MOCK_METHOD(bool, set_write_handler, (int fd, const EventHandler &on_write), (override));
 };
 
 } // namespace beerocks
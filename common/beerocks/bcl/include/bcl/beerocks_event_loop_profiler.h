@@ -0,0 +1,252 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_EVENT_LOOP_PROFILER_H_
+#define _BEEROCKS_EVENT_LOOP_PROFILER_H_
+
+#include "beerocks_event_loop.h"
+
+#include <pthread.h>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace beerocks {
+
+/**
+ * @brief Event loop decorator that profiles the event handlers.
+ * @see EventLoop
+ *
+ * This class wraps another EventLoop implementation and measures every call to the event
+ * handlers registered through it: number of calls, cumulative and maximum time spent, and a
+ * histogram of the durations in log2 buckets. Statistics are kept per handler name and file
+ * descriptor (handlers without a name are named after their file descriptor), also after the
+ * handlers are removed.
+ *
+ * A watchdog thread detects handlers that block the event loop for longer than a threshold, and
+ * logs their name and a backtrace of the event loop thread while they are still running.
+ *
+ * Profiling is opt-in: the application creates this class on top of its event loop and uses it
+ * instead. Event handlers are given the profiler as event loop, so that the handlers they register
+ * are profiled too.
+ */
+class EventLoopProfiler : public EventLoop {
+public:
+    /**
+     * Number of buckets in the histogram of handler durations. Bucket 0 counts the calls shorter
+     * than 1 microsecond and bucket i the calls from 2^(i-1) to 2^i microseconds, with the last
+     * bucket counting all the longer calls.
+     */
+    static constexpr size_t HISTOGRAM_BUCKETS = 24;
+
+    /**
+     * Key of the statistics of an event handler: handler name and file descriptor. Handlers that
+     * share a name (e.g. those of the sockets accepted by a server) are reported separately.
+     */
+    using HandlerKey = std::pair<std::string, int>;
+
+    /**
+     * Statistics of an event handler.
+     */
+    struct sHandlerStats {
+        /**
+         * Number of calls to the handler.
+         */
+        uint64_t calls = 0;
+
+        /**
+         * Total time spent in the handler.
+         */
+        std::chrono::nanoseconds total_time = std::chrono::nanoseconds::zero();
+
+        /**
+         * Longest time spent in a single call to the handler.
+         */
+        std::chrono::nanoseconds max_time = std::chrono::nanoseconds::zero();
+
+        /**
+         * Number of calls per duration bucket.
+         */
+        std::array<uint64_t, HISTOGRAM_BUCKETS> histogram{};
+    };
+
+    /**
+     * @brief Class constructor.
+     *
+     * @param event_loop Event loop to profile.
+     * @param stall_threshold Time after which a handler that has not returned is reported as
+     * blocking the event loop. Zero disables the watchdog.
+     */
+    EventLoopProfiler(std::shared_ptr<EventLoop> event_loop,
+                      std::chrono::milliseconds stall_threshold);
+
+    /**
+     * @brief Class destructor.
+     */
+    ~EventLoopProfiler() override;
+
+    /**
+     * @see EventLoop::register_handlers
+     *
+     * Registers the given handlers in the profiled event loop, wrapped in functions that measure
+     * them.
+     */
+    bool register_handlers(int fd, const EventHandlers &handlers) override;
+
+    /**
+     * @see EventLoop::remove_handlers
+     */
+    bool remove_handlers(int fd) override;
+
+    /**
+     * @see EventLoop::set_handler_name
+     */
+    bool set_handler_name(int fd, const std::string &name) override;
+
+    /**
+     * @see EventLoop::set_write_handler
+     */
+    bool set_write_handler(int fd, const EventHandler &on_write) override;
+
+    /**
+     * @see EventLoop::run
+     */
+    int run() override;
+
+    /**
+     * @brief Gets the statistics of all the handlers called so far, by handler name and file
+     * descriptor.
+     */
+    const std::map<HandlerKey, sHandlerStats> &get_stats() const { return m_stats; }
+
+    /**
+     * @brief Gets the number of times the event loop was run, and woken up by events.
+     */
+    uint64_t get_runs() const { return m_runs; }
+    uint64_t get_wakeups() const { return m_wakeups; }
+
+    /**
+     * @brief Formats the statistics, handlers with the highest total time first.
+     *
+     * @param separator Separator between the lines.
+     * @return Statistics in human readable form.
+     */
+    std::string to_string(const std::string &separator = "\n") const;
+
+    /**
+     * @brief Clears the statistics.
+     */
+    void reset();
+
+private:
+    /**
+     * Registration in the profiled event loop.
+     */
+    struct sRegistration {
+        /**
+         * Handler name (or FD number if the handler has no name).
+         */
+        std::string name;
+
+        /**
+         * Statistics of the handler (node of m_stats, which is never erased).
+         */
+        sHandlerStats *stats = nullptr;
+    };
+
+    /**
+     * @brief Wraps an event handler in a function that measures it.
+     *
+     * @param fd File descriptor the handler is registered for.
+     * @param handler Handler to wrap.
+     * @param removed Whether the event loop removes the handlers before calling this one (as it
+     * does for disconnect and error handlers).
+     * @return Wrapped handler, or an empty function if the handler is empty.
+     */
+    EventHandler wrap(int fd, const EventHandler &handler, bool removed = false);
+
+    /**
+     * @brief Wraps a data handler in a function that measures it.
+     */
+    DataHandler wrap(int fd, const DataHandler &handler);
+
+    /**
+     * @brief Records the start of a call to the handler of the given file descriptor.
+     *
+     * @return Statistics of the handler, nullptr if it was removed.
+     */
+    sHandlerStats *begin_call(int fd, std::chrono::steady_clock::time_point start);
+
+    /**
+     * @brief Records the end of a call to a handler.
+     */
+    void end_call(sHandlerStats *stats, std::chrono::steady_clock::time_point start);
+
+    /**
+     * @brief Binds a registration to the statistics of the given name and file descriptor.
+     */
+    void set_name(int fd, sRegistration &registration, const std::string &name);
+
+    /**
+     * @brief Watchdog thread main function.
+     */
+    void watchdog();
+
+    /**
+     * Profiled event loop.
+     */
+    std::shared_ptr<EventLoop> m_event_loop;
+
+    /**
+     * Registrations by file descriptor.
+     */
+    std::unordered_map<int, sRegistration> m_fd_to_registration;
+
+    /**
+     * Handler statistics by name and file descriptor.
+     */
+    std::map<HandlerKey, sHandlerStats> m_stats;
+
+    /**
+     * Number of calls to run(), and of those that handled events.
+     */
+    uint64_t m_runs    = 0;
+    uint64_t m_wakeups = 0;
+
+    /**
+     * Time after which a handler that has not returned is reported.
+     */
+    std::chrono::milliseconds m_stall_threshold;
+
+    /**
+     * Handler call in progress, shared with the watchdog thread (protected by m_mutex).
+     */
+    struct sCall {
+        bool active       = false;
+        uint64_t sequence = 0;
+        std::string name;
+        std::chrono::steady_clock::time_point start;
+        pthread_t thread = {};
+    } m_call;
+
+    std::mutex m_mutex;
+    std::condition_variable m_stop_condition;
+    bool m_stop = false;
+    std::thread m_watchdog;
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_EVENT_LOOP_PROFILER_H_
@@ -0,0 +1,174 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_EVENT_LOOP_URING_IMPL_H_
+#define _BEEROCKS_EVENT_LOOP_URING_IMPL_H_
+
+#include "beerocks_event_loop.h"
+
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+
+namespace beerocks {
+
+/**
+ * @brief io_uring based implementation of the EventLoop interface.
+ * @see EventLoop
+ *
+ * This class uses a Linux io_uring instance for monitoring the provided file descriptors for I/O
+ * operations, as a drop-in replacement of EventLoopImpl:
+ * - Read, write, disconnect and error events are detected with one-shot poll requests, re-armed
+ *   after each event so that they are level-triggered like in EventLoopImpl. The re-armed
+ *   requests are submitted with the wait for the next events, in a single system call.
+ * - For handlers with a data handler (EventHandlers::on_data), the data is received with a
+ *   multishot receive request into a ring of buffers provided to the kernel, so that no system
+ *   call at all is made per message received.
+ * - Removed handlers cancel their pending requests, also on the next system call.
+ *
+ * It needs Linux 6.0 or later (multishot receive), use is_supported() to check for it and fall
+ * back to EventLoopImpl otherwise. It is meant to live as long as the thread using it: the kernel
+ * interrupts that thread when the io_uring instance is closed, so a blocking system call it is in
+ * at that time may fail with EINTR.
+ */
+class EventLoopUringImpl : public EventLoop {
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * Initializes an io_uring instance.
+     *
+     * @param [in] timeout Sets the master timeout (in milliseconds) for the event loop.
+     */
+    explicit EventLoopUringImpl(
+        std::chrono::milliseconds timeout = std::chrono::milliseconds::min());
+
+    /**
+     * @brief Class destructor.
+     */
+    ~EventLoopUringImpl() override;
+
+    /**
+     * @brief Checks if io_uring is supported, both at build time and by the running kernel.
+     *
+     * @return true if this implementation can be used and false otherwise.
+     */
+    static bool is_supported();
+
+    /**
+     * @see EventLoop::register_handlers
+     */
+    bool register_handlers(int fd, const EventHandlers &handlers) override;
+
+    /**
+     * @see EventLoop::remove_handlers
+     */
+    bool remove_handlers(int fd) override;
+
+    /**
+     * @see EventLoop::set_handler_name
+     */
+    bool set_handler_name(int fd, const std::string &name) override;
+
+    /**
+     * @see EventLoop::set_write_handler
+     */
+    bool set_write_handler(int fd, const EventHandler &on_write) override;
+
+    /**
+     * @brief Main event loop method.
+     * @see EventLoop::run
+     *
+     * Submits the queued requests, waits for their completions and processes occurred events.
+     */
+    int run() override;
+
+private:
+    /**
+     * Registered event handlers, with the state of the requests submitted for them.
+     */
+    struct sRegistration {
+        EventHandlers handlers;
+
+        /**
+         * Number given to the registration, set in the requests so that the completions of the
+         * requests of a removed registration are told apart from the ones of a later registration
+         * of the same file descriptor.
+         */
+        uint32_t generation = 0;
+
+        /**
+         * Events polled for, or 0 if only receiving.
+         */
+        uint32_t poll_events = 0;
+
+        bool poll_armed = false;
+        bool recv_armed = false;
+    };
+
+    /**
+     * @brief Queues a poll request for the events of a registration.
+     */
+    bool arm_poll(int fd, sRegistration &registration);
+
+    /**
+     * @brief Queues a multishot receive request for a registration.
+     */
+    bool arm_recv(int fd, sRegistration &registration);
+
+    /**
+     * @brief Processes a completion.
+     *
+     * @param user_data User data of the completed request.
+     * @param res Result of the completed request.
+     * @param flags Flags of the completion.
+     * @param[out] num_events Incremented if an event was dispatched.
+     * @return false if the called handler failed and true otherwise.
+     */
+    bool handle_completion(uint64_t user_data, int32_t res, uint32_t flags, int &num_events);
+
+    /**
+     * @brief Processes the completion of a poll request.
+     * @see handle_completion
+     */
+    bool handle_poll(int fd, sRegistration &registration, int32_t res, int &num_events);
+
+    /**
+     * @brief Processes the completion of a receive request.
+     * @see handle_completion
+     */
+    bool handle_recv(int fd, sRegistration &registration, int32_t res, uint32_t flags,
+                     int &num_events);
+
+    /**
+     * io_uring instance: rings and provided buffers (defined in the implementation).
+     */
+    struct sUring;
+    std::unique_ptr<sUring> m_uring;
+
+    /**
+     * Event loop master timeout.
+     */
+    std::chrono::milliseconds m_timeout = std::chrono::milliseconds::min();
+
+    /**
+     * Map of registered event handlers.
+     * Key value is the file descriptor and value is the registration containing the event
+     * handlers to deal with events occurred on that file descriptor.
+     */
+    std::unordered_map<int, sRegistration> m_fd_to_registration;
+
+    /**
+     * Number given to the next registration.
+     */
+    uint32_t m_next_generation = 1;
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_EVENT_LOOP_URING_IMPL_H_
@@ -0,0 +1,215 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_MPSC_EVENT_QUEUE_H_
+#define _BEEROCKS_MPSC_EVENT_QUEUE_H_
+
+#include <bcl/beerocks_spsc_ring.h>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace beerocks {
+
+/**
+ * @brief Event queue for any number of producer threads and one consumer thread, with an eventfd
+ * to wake the consumer up.
+ *
+ * Events are stored by value in the slots of a spsc_ring, which are allocated once and reused.
+ * Producers are serialized with a mutex, so that they act as the single producer of the ring; the
+ * consumer does not take the mutex as long as the ring does not overflow.
+ *
+ * When the ring is full, events are kept in an overflow list (allocated on demand) until the
+ * consumer makes room for them in the ring. Once the overflow list is also full, events are
+ * dropped and counted.
+ *
+ * The eventfd becomes readable when events are pushed. It is meant to be registered in the
+ * consumer's EventLoop, with a read handler that calls pop_all(). Its counter is reset once per
+ * call to pop_all() instead of once per event, so a burst of events is handled with a single
+ * read() system call.
+ */
+template <typename T> class mpsc_event_queue {
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param capacity Maximum number of events queued in the ring (rounded up to a power of 2).
+     * @param overflow_capacity Maximum number of events queued in the overflow list.
+     */
+    mpsc_event_queue(size_t capacity, size_t overflow_capacity)
+        : m_ring(capacity), m_overflow_capacity(overflow_capacity),
+          m_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+    {
+    }
+
+    ~mpsc_event_queue()
+    {
+        if (m_fd >= 0) {
+            close(m_fd);
+        }
+    }
+
+    mpsc_event_queue(const mpsc_event_queue &) = delete;
+    mpsc_event_queue &operator=(const mpsc_event_queue &) = delete;
+
+    /**
+     * @brief Returns the file descriptor of the eventfd, or -1 if it could not be created.
+     */
+    int fd() const { return m_fd; }
+
+    size_t capacity() const { return m_ring.capacity(); }
+
+    /**
+     * @brief Returns the number of events dropped so far because the queue was full.
+     */
+    uint64_t dropped() const { return m_dropped; }
+
+    /**
+     * @brief Producer side: queues an event and wakes the consumer up.
+     *
+     * May be called from any thread.
+     *
+     * @param event Event to queue, moved into the queue unless it is dropped.
+     * @return true on success and false if the queue is full (the event is dropped) or the
+     * consumer could not be woken up.
+     */
+    bool push(T &&event)
+    {
+        std::lock_guard<std::mutex> lock(m_push_mutex);
+
+        // Once the ring overflows, events go to the overflow list until the consumer has moved
+        // all of them back to the ring, to keep them in order
+        if (!m_has_overflow) {
+            auto slot = m_ring.produce_slot();
+            if (slot) {
+                *slot = std::move(event);
+                m_ring.produce();
+                return signal();
+            }
+        }
+
+        if (m_overflow.size() >= m_overflow_capacity) {
+            m_dropped++;
+            return false;
+        }
+        m_overflow.push_back(std::move(event));
+        m_has_overflow = true;
+
+        return signal();
+    }
+
+    /**
+     * @brief Consumer side: handles the queued events, oldest first.
+     *
+     * Each event is handled in place: the reference given to the handler is only valid until it
+     * returns, and the slot is then reused for another event (the handler may move members out of
+     * the event or reset them to release their memory earlier).
+     *
+     * If not all the events are handled because of the given limit, the eventfd is left readable
+     * so that the rest are handled on the next call.
+     *
+     * @param handler Function called with each event, as `void(T &event)`.
+     * @param max_events Maximum number of events handled.
+     * @return Number of events handled.
+     */
+    template <typename F> size_t pop_all(F handler, size_t max_events = SIZE_MAX)
+    {
+        // Reset the counter before looking at the ring, so that events pushed from now on signal
+        // the eventfd again
+        uint64_t counter;
+        if (read(m_fd, &counter, sizeof(counter)) < 0 && errno != EAGAIN) {
+            return 0;
+        }
+
+        size_t count = 0;
+        while (count < max_events) {
+            auto slot = m_ring.consume_slot();
+            if (!slot) {
+                if (!m_has_overflow || !refill()) {
+                    return count;
+                }
+                continue;
+            }
+            handler(*slot);
+            m_ring.consume();
+            count++;
+        }
+
+        // Limit reached, wake up again if there are more events left
+        if (m_ring.consume_slot() || m_has_overflow) {
+            signal();
+        }
+
+        return count;
+    }
+
+private:
+    /**
+     * @brief Moves the events of the overflow list to the ring, as many as fit.
+     *
+     * Producers do not use the ring while the overflow list is not empty, so the consumer acts as
+     * its producer while holding the producer mutex.
+     *
+     * @return true if any event was moved.
+     */
+    bool refill()
+    {
+        std::lock_guard<std::mutex> lock(m_push_mutex);
+
+        bool moved = false;
+        while (!m_overflow.empty()) {
+            auto slot = m_ring.produce_slot();
+            if (!slot) {
+                break;
+            }
+            *slot = std::move(m_overflow.front());
+            m_ring.produce();
+            m_overflow.pop_front();
+            moved = true;
+        }
+        m_has_overflow = !m_overflow.empty();
+
+        return moved;
+    }
+
+    /**
+     * @brief Makes the eventfd readable.
+     */
+    bool signal()
+    {
+        uint64_t counter = 1;
+        return write(m_fd, &counter, sizeof(counter)) == sizeof(counter);
+    }
+
+    spsc_ring<T> m_ring;
+
+    /**
+     * Events that did not fit in the ring, and whether there are any (read by the consumer
+     * without the mutex). Protected by m_push_mutex.
+     */
+    std::deque<T> m_overflow;
+    std::atomic<bool> m_has_overflow{false};
+    size_t m_overflow_capacity;
+
+    std::atomic<uint64_t> m_dropped{0};
+
+    std::mutex m_push_mutex;
+
+    int m_fd = -1;
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_MPSC_EVENT_QUEUE_H_
@@ -0,0 +1,126 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_PRECOMPUTED_QUEUE_H_
+#define _BEEROCKS_PRECOMPUTED_QUEUE_H_
+
+#include <bcl/beerocks_thread_pool.h>
+
+#include <deque>
+#include <functional>
+#include <memory>
+
+namespace beerocks {
+
+/**
+ * @brief Queue of values computed ahead of time in a ThreadPool.
+ *
+ * Meant for values that are expensive to create but do not depend on the request they are used
+ * for (e.g. Diffie-Hellman key pairs), so that the event loop takes a ready one instead of
+ * computing it while handling the request. The queue is refilled in the pool up to its capacity
+ * every time a value is taken.
+ *
+ * This class must be created, used and destroyed in the thread of the event loop of the pool.
+ * The values are handed over in the continuations of the pool, so the state shared with the
+ * worker threads is kept alive by the jobs until they are done or cancelled.
+ */
+template <typename T> class PrecomputedQueue {
+public:
+    /**
+     * Function that creates a value, run in a worker thread (or in the event loop thread if no
+     * value is ready). Returns nullptr on error.
+     */
+    using Factory = std::function<std::unique_ptr<T>()>;
+
+    /**
+     * @brief Class constructor.
+     *
+     * Starts computing the first values.
+     *
+     * @param thread_pool Pool to compute the values in.
+     * @param factory Function to create a value.
+     * @param capacity Number of values to keep ready.
+     */
+    PrecomputedQueue(std::shared_ptr<ThreadPool> thread_pool, Factory factory, size_t capacity)
+        : m_thread_pool(thread_pool), m_state(std::make_shared<sState>())
+    {
+        m_state->factory  = factory;
+        m_state->capacity = capacity;
+        refill();
+    }
+
+    PrecomputedQueue(const PrecomputedQueue &) = delete;
+    PrecomputedQueue &operator=(const PrecomputedQueue &) = delete;
+
+    /**
+     * @brief Takes a value.
+     *
+     * If no value is ready yet, one is created in the calling thread.
+     *
+     * @return The value taken, or nullptr if it could not be created.
+     */
+    std::unique_ptr<T> take()
+    {
+        std::unique_ptr<T> value;
+        if (m_state->ready.empty()) {
+            value = m_state->factory();
+        } else {
+            value = std::move(m_state->ready.front());
+            m_state->ready.pop_front();
+        }
+
+        refill();
+
+        return value;
+    }
+
+    /**
+     * @brief Returns the number of values ready to be taken.
+     */
+    size_t ready() const { return m_state->ready.size(); }
+
+private:
+    /**
+     * State shared with the jobs posted to the pool. All members but the factory are only used
+     * in the event loop thread.
+     */
+    struct sState {
+        Factory factory;
+        size_t capacity = 0;
+        size_t pending  = 0; // values being computed
+        std::deque<std::unique_ptr<T>> ready;
+    };
+
+    /**
+     * @brief Posts as many jobs as values are missing.
+     */
+    void refill()
+    {
+        while (m_state->ready.size() + m_state->pending < m_state->capacity) {
+            auto state  = m_state;
+            auto result = std::make_shared<std::unique_ptr<T>>();
+            if (!m_thread_pool->post([state, result]() { *result = state->factory(); },
+                                     [state, result]() {
+                                         state->pending--;
+                                         if (*result) {
+                                             state->ready.push_back(std::move(*result));
+                                         }
+                                     })) {
+                return;
+            }
+            m_state->pending++;
+        }
+    }
+
+    std::shared_ptr<ThreadPool> m_thread_pool;
+    std::shared_ptr<sState> m_state;
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_PRECOMPUTED_QUEUE_H_
@@ -0,0 +1,153 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_SPSC_RING_H_
+#define _BEEROCKS_SPSC_RING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace beerocks {
+
+/**
+ * @brief Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ *
+ * The slots are allocated once (capacity is rounded up to a power of 2) and reused, so the items
+ * can be built and read in place with produce_slot()/produce() and consume_slot()/consume(),
+ * without copying them or allocating memory. Members allocated by an item (e.g. a vector) keep
+ * their capacity when the slot is reused.
+ *
+ * The producer only writes the tail index and the consumer only writes the head index, each one
+ * publishing the slots it is done with through a release store.
+ */
+template <typename T> class spsc_ring {
+public:
+    explicit spsc_ring(size_t capacity)
+        : m_slots(round_up_pow2(capacity)), m_mask(m_slots.size() - 1)
+    {
+    }
+
+    spsc_ring(const spsc_ring &) = delete;
+    spsc_ring &operator=(const spsc_ring &) = delete;
+
+    size_t capacity() const { return m_slots.size(); }
+
+    /**
+     * @brief Producer side: get the next free slot to fill in.
+     *
+     * @return Pointer to the slot or nullptr if the ring is full.
+     */
+    T *produce_slot()
+    {
+        auto tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cached_head == m_slots.size()) {
+            m_cached_head = m_head.load(std::memory_order_acquire);
+            if (tail - m_cached_head == m_slots.size()) {
+                return nullptr;
+            }
+        }
+        return &m_slots[tail & m_mask];
+    }
+
+    /**
+     * @brief Producer side: hand the slot returned by produce_slot() over to the consumer.
+     */
+    void produce()
+    {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Consumer side: get the oldest filled slot.
+     *
+     * @return Pointer to the slot or nullptr if the ring is empty.
+     */
+    T *consume_slot()
+    {
+        auto head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cached_tail) {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cached_tail) {
+                return nullptr;
+            }
+        }
+        return &m_slots[head & m_mask];
+    }
+
+    /**
+     * @brief Consumer side: give the slot returned by consume_slot() back to the producer.
+     */
+    void consume()
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Producer side: copy an item into the ring.
+     *
+     * @return true on success and false if the ring is full.
+     */
+    bool push(const T &item)
+    {
+        auto slot = produce_slot();
+        if (!slot) {
+            return false;
+        }
+        *slot = item;
+        produce();
+        return true;
+    }
+
+    /**
+     * @brief Consumer side: move the oldest item out of the ring.
+     *
+     * @return true on success and false if the ring is empty.
+     */
+    bool pop(T &item)
+    {
+        auto slot = consume_slot();
+        if (!slot) {
+            return false;
+        }
+        item = std::move(*slot);
+        consume();
+        return true;
+    }
+
+private:
+    static size_t round_up_pow2(size_t value)
+    {
+        size_t pow2 = 1;
+        while (pow2 < value) {
+            pow2 <<= 1;
+        }
+        return pow2;
+    }
+
+    static constexpr size_t kCacheLineSize = 64;
+
+    std::vector<T> m_slots;
+    const size_t m_mask;
+
+    // Written by the consumer (head) and by the producer (tail), kept on separate cache lines.
+    // Padding is used rather than alignas(), which heap allocations do not honor before C++17.
+    uint8_t m_pad0[kCacheLineSize];
+    std::atomic<size_t> m_head{0};
+    size_t m_cached_tail = 0; // consumer's last view of m_tail
+    uint8_t m_pad1[kCacheLineSize - 2 * sizeof(size_t)];
+
+    std::atomic<size_t> m_tail{0};
+    size_t m_cached_head = 0; // producer's last view of m_head
+    uint8_t m_pad2[kCacheLineSize - 2 * sizeof(size_t)];
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_SPSC_RING_H_
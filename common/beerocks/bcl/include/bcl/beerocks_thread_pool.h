@@ -0,0 +1,196 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_THREAD_POOL_H_
+#define _BEEROCKS_THREAD_POOL_H_
+
+#include <bcl/beerocks_event_loop.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace beerocks {
+
+/**
+ * @brief Pool of worker threads to run blocking or CPU-intensive work off the event loop.
+ *
+ * Each worker thread has its own queue (a deque). Work posted from outside the pool is spread
+ * among the queues round-robin, and work posted by a task running in the pool goes to the queue
+ * of its own worker. A worker takes the oldest work of its own queue and, when it is empty,
+ * steals the oldest work of the queues of the other workers, so that work is balanced without a
+ * single queue (and lock) shared by all the threads. Jobs are coarse blocking calls, so they are
+ * taken in order rather than most recent first: a pool of one thread runs the work in the order
+ * it is posted.
+ *
+ * An idle worker sleeps on its own condition variable. Posting work wakes up the worker of the
+ * queue it goes to if it is idle, or else another idle worker to steal it.
+ *
+ * Work can be given a continuation, which is run in the thread of the event loop given in
+ * constructor once the work is done. Continuations are handed over through an eventfd registered
+ * in the event loop, so they run as any other event handler and can safely use the state of the
+ * owner of the event loop.
+ *
+ * This class must be created, used and destroyed in the thread of the event loop (except for
+ * posting work from the tasks running in the pool). On destruction, the running work is waited
+ * for and everything else is cancelled: the work not started yet is dropped and the pending
+ * continuations are not run (see ~ThreadPool()).
+ */
+class ThreadPool {
+public:
+    /**
+     * Work to run in a worker thread, or continuation to run in the event loop thread.
+     */
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Class constructor.
+     *
+     * @param size Number of worker threads (0 to use the number of CPUs).
+     * @param event_loop Event loop to run continuations in.
+     */
+    ThreadPool(size_t size, std::shared_ptr<EventLoop> event_loop);
+
+    /**
+     * @brief Class destructor.
+     *
+     * Stops the worker threads once they are done with the work they are running, then cancels
+     * the work not started yet and the continuations not run yet. Cancelled functions are
+     * destroyed without being called, in the calling thread. Owners that need some work to be
+     * done before destroying the pool must wait for its continuation.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Posts work to run in a worker thread.
+     *
+     * @param work Work to run.
+     * @param continuation Optional function to run in the event loop thread after the work is
+     * done. Results of the work are usually handed over to it through state captured by both
+     * functions (e.g. a shared_ptr).
+     * @return true on success and false otherwise (i.e.: pool is being destroyed).
+     */
+    bool post(const Task &work, const Task &continuation = nullptr);
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    size_t size() const { return m_workers.size(); }
+
+private:
+    /**
+     * Work posted and its continuation.
+     */
+    struct sJob {
+        Task work;
+        Task continuation;
+    };
+
+    /**
+     * Worker thread, its queue of jobs and its wake-up state.
+     */
+    struct sWorker {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<sJob> jobs; // protected by mutex
+        bool wake = false;     // set to make the worker look for jobs to steal (protected by mutex)
+
+        /**
+         * Number of jobs in the queue and whether the worker is about to sleep or sleeping, read
+         * without the mutex to find jobs to steal and workers to wake up.
+         */
+        std::atomic<size_t> queued{0};
+        std::atomic<bool> idle{false};
+
+        std::thread thread;
+    };
+
+    /**
+     * @brief Main function of the worker threads.
+     *
+     * @param index Index of the worker in the pool.
+     */
+    void run_worker(size_t index);
+
+    /**
+     * @brief Takes the next job to run by a worker: from the back of its own queue or, if empty,
+     * from the front of the queue of another worker.
+     *
+     * @param index Index of the worker in the pool.
+     * @param[out] job Job taken.
+     * @return true if a job was taken and false if all queues are empty.
+     */
+    bool take_job(size_t index, sJob &job);
+
+    /**
+     * @brief Puts a worker to sleep until there is a job for it or the pool is stopped.
+     *
+     * @param index Index of the worker in the pool.
+     */
+    void wait_for_job(size_t index);
+
+    /**
+     * @brief Wakes up an idle worker, other than the given one, to steal a job.
+     *
+     * @param index Index of the worker the job was queued to.
+     */
+    void wake_idle_worker(size_t index);
+
+    /**
+     * @brief Hands a continuation over to the event loop thread.
+     */
+    void complete(Task &&continuation);
+
+    /**
+     * @brief Runs the continuations of the jobs done, in the event loop thread.
+     */
+    void handle_completions();
+
+    /**
+     * Worker threads and their queues.
+     */
+    std::vector<std::unique_ptr<sWorker>> m_workers;
+
+    /**
+     * Index of the worker queue to post the next job to, from outside the pool.
+     */
+    std::atomic<size_t> m_next_worker{0};
+
+    /**
+     * Flag to stop the worker threads.
+     */
+    std::atomic<bool> m_stop{false};
+
+    /**
+     * Event loop to run continuations in.
+     */
+    std::shared_ptr<EventLoop> m_event_loop;
+
+    /**
+     * eventfd registered in the event loop to signal that there are continuations to run.
+     */
+    int m_completions_fd = -1;
+
+    /**
+     * Continuations of the jobs done, not run yet.
+     */
+    std::mutex m_completions_mutex;
+    std::vector<Task> m_completions;
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_THREAD_POOL_H_
@@ -0,0 +1,240 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_TIMER_WHEEL_H_
+#define _BEEROCKS_TIMER_WHEEL_H_
+
+#include <bcl/beerocks_event_loop.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace beerocks {
+
+/**
+ * @brief Hierarchical timing wheel.
+ *
+ * Keeps track of any number of timers on a discrete time base (the tick, one millisecond for the
+ * TimerWheelManagerImpl), and calls the handler of each timer when the current tick reaches its
+ * expiry. The wheel does no I/O: its owner advances it to the current tick, and arms a single OS
+ * timer to the expiry returned by next_expiry().
+ *
+ * The wheel is made of LEVELS levels of SLOTS slots each. Level 0 has a slot per tick, and each
+ * slot of level L spans SLOTS^L ticks. A timer is stored in the slot of the lowest level whose
+ * span contains both the current tick and its expiry, and moves down (cascades) to a lower level
+ * when the current tick enters its slot. Timers further than SLOTS^LEVELS ticks away wait in an
+ * overflow list. Adding and removing a timer are O(1), and advancing the wheel is O(1) per timer
+ * expired or cascaded, as empty slots are skipped with a bitmap per level.
+ */
+class TimerWheel {
+public:
+    /**
+     * Number of bits of the tick used to select the slot of each level.
+     */
+    static constexpr int SLOT_BITS = 6;
+
+    /**
+     * Number of slots per level.
+     */
+    static constexpr int SLOTS = 1 << SLOT_BITS;
+
+    /**
+     * Number of levels.
+     */
+    static constexpr int LEVELS = 6;
+
+    /**
+     * Identifier of a timer, returned by add() when the timer cannot be added.
+     */
+    static constexpr int INVALID_ID = -1;
+
+    TimerWheel() = default;
+
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+
+    /**
+     * @brief Adds a timer.
+     *
+     * @param name Timer name, used in log messages.
+     * @param expiry Tick at which the timer elapses for the first time. Expiries not after the
+     * current tick are moved to the next tick.
+     * @param period Number of ticks between successive expirations. Set to 0 for a one-shot timer.
+     * @param handler Handler function called back when the timer elapses, with the timer
+     * identifier as file descriptor.
+     * @return Timer identifier (a positive number) on success and INVALID_ID otherwise.
+     */
+    int add(const std::string &name, uint64_t expiry, uint64_t period,
+            const EventLoop::EventHandler &handler);
+
+    /**
+     * @brief Removes a timer.
+     *
+     * Timers can be removed from any handler, including their own. A one-shot timer is kept
+     * (without further expirations) after it elapses, until it is removed.
+     *
+     * @param id Timer identifier, obtained when the timer was added.
+     * @return true on success and false if there is no such timer.
+     */
+    bool remove(int id);
+
+    /**
+     * @brief Advances the current tick, calling the handlers of the timers elapsed meanwhile.
+     *
+     * Handlers are called in expiry order. A periodic timer that elapsed more than once by the
+     * given tick is called once, and its overrun logged.
+     *
+     * @param tick New current tick. Ticks before the current one are ignored.
+     * @param loop Event loop given to the handlers.
+     * @return true if all handlers succeeded and false otherwise.
+     */
+    bool advance(uint64_t tick, EventLoop &loop);
+
+    /**
+     * @brief Gets the tick at which the next timer elapses.
+     *
+     * @param[out] expiry Expiry of the earliest timer.
+     * @return true on success and false if no timer is scheduled.
+     */
+    bool next_expiry(uint64_t &expiry) const;
+
+    /**
+     * @brief Gets the current tick.
+     */
+    uint64_t now() const { return m_now; }
+
+    /**
+     * @brief Gets the number of timers, including the one-shot timers that already elapsed.
+     */
+    size_t size() const { return m_timers.size(); }
+
+private:
+    /**
+     * Node of a circular doubly linked list of timers. Each slot (and the overflow list) is the
+     * sentinel node of the list of its timers, so that timers are linked and unlinked in O(1).
+     */
+    struct sLink {
+        sLink *prev = this;
+        sLink *next = this;
+
+        bool empty() const { return next == this; }
+    };
+
+    /**
+     * Timer slot index meaning that the timer is in the overflow list.
+     */
+    static constexpr int OVERFLOW_SLOT = -1;
+
+    /**
+     * Timer slot index meaning that the timer is not in the wheel (elapsed one-shot timers, and
+     * timers being expired).
+     */
+    static constexpr int NO_SLOT = -2;
+
+    struct sTimer : sLink {
+        int id;
+        std::string name;
+        uint64_t expiry;
+        uint64_t period;
+        EventLoop::EventHandler handler;
+
+        /**
+         * Index of the slot holding the timer (level * SLOTS + slot), OVERFLOW_SLOT or NO_SLOT.
+         */
+        int slot = NO_SLOT;
+    };
+
+    static void link(sLink &head, sLink &node);
+    static void unlink(sLink &node);
+
+    /**
+     * @brief Stores a timer in the slot matching its expiry.
+     */
+    void insert(sTimer &timer);
+
+    /**
+     * @brief Removes a timer from its slot, if any.
+     */
+    void detach(sTimer &timer);
+
+    /**
+     * @brief Moves all the timers of a list into the given list.
+     */
+    void splice(sLink &from, sLink &to);
+
+    /**
+     * @brief Gets the next tick at which timers elapse or cascade.
+     *
+     * @return Tick of the next event, or UINT64_MAX if the wheel is empty.
+     */
+    uint64_t next_event() const;
+
+    /**
+     * @brief Stores again the timers of a slot the current tick entered.
+     */
+    void cascade(sLink &head);
+
+    /**
+     * @brief Calls the handlers of the timers elapsed at the current tick.
+     *
+     * @param target Tick the wheel is being advanced to.
+     * @param loop Event loop given to the handlers.
+     * @return true if all handlers succeeded and false otherwise.
+     */
+    bool expire(uint64_t target, EventLoop &loop);
+
+    /**
+     * @brief Gets the slot of the given level holding the given tick.
+     */
+    static int slot_of(uint64_t tick, int level)
+    {
+        return (tick >> (SLOT_BITS * level)) & (SLOTS - 1);
+    }
+
+    /**
+     * Current tick.
+     */
+    uint64_t m_now = 0;
+
+    sLink m_slots[LEVELS][SLOTS];
+
+    /**
+     * Bitmap of the non-empty slots of each level.
+     */
+    uint64_t m_occupied[LEVELS] = {};
+
+    /**
+     * Timers further than the span of the highest level.
+     */
+    sLink m_overflow;
+
+    /**
+     * All the timers, indexed by identifier.
+     */
+    std::unordered_map<int, sTimer> m_timers;
+
+    /**
+     * Identifier given to the next timer.
+     */
+    int m_next_id = 1;
+
+    /**
+     * Timer whose handler is being called, if any.
+     */
+    sTimer *m_firing = nullptr;
+
+    /**
+     * Set when the timer whose handler is being called is removed by it.
+     */
+    bool m_firing_removed = false;
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_TIMER_WHEEL_H_
@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _BEEROCKS_TIMER_WHEEL_MANAGER_IMPL_H_
+#define _BEEROCKS_TIMER_WHEEL_MANAGER_IMPL_H_
+
+#include <bcl/beerocks_timer_factory.h>
+#include <bcl/beerocks_timer_manager.h>
+#include <bcl/beerocks_timer_wheel.h>
+
+#include <bcl/network/timer.h>
+
+#include <chrono>
+#include <memory>
+
+namespace beerocks {
+
+/**
+ * @brief Timer manager that multiplexes all its timers on a single OS timer.
+ *
+ * @see TimerManager
+ *
+ * TimerManagerImpl creates a timer (a file descriptor registered in the event loop) per call to
+ * add_timer(), which costs a few system calls per timer added or removed and a wakeup per timer
+ * elapsed. This implementation keeps its timers in a hierarchical timing wheel (@see TimerWheel)
+ * with a millisecond tick instead, and uses a single timer, created with the timer factory
+ * provided in constructor, armed to the expiry of the earliest one. Adding and removing a timer
+ * then takes no system call unless the earliest expiry changes, and timers elapsing at the same
+ * millisecond are handled in a single wakeup.
+ *
+ * The values returned by add_timer() are timer identifiers (positive numbers, given to the
+ * handlers as file descriptor) rather than file descriptors, so they must not be used with the
+ * event loop. Remaining timers are removed on destructor.
+ */
+class TimerWheelManagerImpl : public TimerManager {
+public:
+    /**
+     * @brief Class constructor
+     *
+     * @param timer_factory Timer factory used to create the timer all timers are multiplexed on.
+     * @param event_loop Application event loop used by the application to wait for I/O events.
+     */
+    TimerWheelManagerImpl(std::shared_ptr<TimerFactory> timer_factory,
+                          std::shared_ptr<EventLoop> event_loop);
+
+    /**
+     * Default destructor.
+     */
+    ~TimerWheelManagerImpl() override;
+
+    /**
+     * @brief Adds a new timer with given schedule.
+     *
+     * @see TimerManager::add_timer
+     *
+     * In this implementation, adding a new timer is a 3 step process:
+     * - Create the timer all timers are multiplexed on and register its handlers in the event
+     *   loop, on first use.
+     * - Add the timer to the timing wheel.
+     * - Arm the timer to the new timer expiry, if it is the earliest one.
+     */
+    int add_timer(const std::string &timer_name, std::chrono::milliseconds delay,
+                  std::chrono::milliseconds period,
+                  const EventLoop::EventHandler &handler) override;
+
+    /**
+     * @brief Removes previously created timer.
+     *
+     * The timer is removed from the timing wheel only: if it was the earliest one, the timer all
+     * timers are multiplexed on elapses for nothing and is then armed to the next expiry.
+     *
+     * @see TimerManager::remove_timer
+     */
+    bool remove_timer(int &fd) override;
+
+private:
+    /**
+     * @brief Creates the timer all timers are multiplexed on, and registers its handlers.
+     *
+     * @return true on success and false otherwise.
+     */
+    bool create_timer();
+
+    /**
+     * @brief Handles the read event in the elapsed timer.
+     *
+     * Advances the timing wheel to the current time, which calls the handlers of the elapsed
+     * timers, and arms the timer to the next expiry.
+     *
+     * @param loop Event loop given to the handlers.
+     * @return true if all handlers succeeded and false otherwise.
+     */
+    bool handle_read(EventLoop &loop);
+
+    /**
+     * @brief Arms the timer to the earliest expiry in the timing wheel, if not already done.
+     *
+     * @param now Current tick.
+     * @return true on success and false otherwise.
+     */
+    bool schedule_timer(uint64_t now);
+
+    /**
+     * @brief Gets the current tick: milliseconds elapsed since construction.
+     */
+    uint64_t now() const;
+
+    /**
+     * Timer factory used by the timer manager to create the timer.
+     */
+    std::shared_ptr<TimerFactory> m_timer_factory;
+
+    /**
+     * Application event loop used by the application to wait for I/O events.
+     */
+    std::shared_ptr<EventLoop> m_event_loop;
+
+    /**
+     * Timer all timers are multiplexed on, created on first use.
+     */
+    std::unique_ptr<beerocks::net::Timer<>> m_timer;
+
+    /**
+     * Time of the tick 0.
+     */
+    std::chrono::steady_clock::time_point m_start;
+
+    /**
+     * Timers currently being managed.
+     */
+    TimerWheel m_wheel;
+
+    /**
+     * Tick the timer is armed to, or UINT64_MAX if not armed.
+     */
+    uint64_t m_armed_expiry = UINT64_MAX;
+};
+
+} // namespace beerocks
+
+#endif // _BEEROCKS_TIMER_WHEEL_MANAGER_IMPL_H_
@@ -74,6 +74,17 @@ public:
      */
     virtual bool shift(size_t count) = 0;
 
+    /**
+     * @brief Checks if shifting leaves the remaining bytes in place.
+     *
+     * If so, the bytes shifted out are not overwritten until more data is appended to the buffer
+     * either, so data parsed in place out of the buffer remains valid after it is consumed.
+     *
+     * @return true if shifting only moves the start of the contents and false if it moves the
+     * contents themselves.
+     */
+    virtual bool is_shift_in_place() const { return false; }
+
     /**
      * @brief  Returns pointer to the raw data.
      *
@@ -69,7 +69,8 @@ public:
      * @param[out] iface_index Index of the network interface that the message was received on.
      * @param[out] dst_mac Destination MAC address.
      * @param[out] src_mac Source MAC address.
-     * @param[out] cmdu_rx Parsed CMDU message.
+     * @param[out] cmdu_rx Parsed CMDU message. It might have been parsed in place, in which case
+     * it is valid until more data is received into the buffer.
      * @return true if a CMDU could be parsed out of the buffer and false otherwise (i.e.: because
      * an incomplete or invalid CMDU was found).
      */
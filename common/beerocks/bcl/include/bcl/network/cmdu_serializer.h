@@ -40,6 +40,11 @@ public:
      */
     virtual ~CmduSerializer() = default;
 
+    /**
+     * Maximum length of the header that precedes a CMDU in the serialized message.
+     */
+    static constexpr size_t MAX_HEADER_LENGTH = 64;
+
     /**
      * @brief Serializes a CMDU to a byte buffer.
      *
@@ -54,6 +59,25 @@ public:
     virtual bool serialize_cmdu(uint32_t iface_index, const sMacAddr &dst_mac,
                                 const sMacAddr &src_mac, ieee1905_1::CmduMessage &cmdu,
                                 Buffer &buffer) = 0;
+
+    /**
+     * @brief Serializes the header that precedes a CMDU to a byte buffer.
+     *
+     * The serialized message is the header followed by the CMDU as is (i.e.: the contents of
+     * CmduMessage::getMessageBuff()). Serializing only the header allows sending the message
+     * without copying the CMDU into the buffer first.
+     *
+     * @param[in] iface_index Index of the network interface the message was received on.
+     * @param[in] dst_mac Destination MAC address.
+     * @param[in] src_mac Source MAC address.
+     * @param[in] cmdu CMDU message the header is for.
+     * @param[in,out] header Array of bytes containing the serialized header. Its size must be at
+     * least MAX_HEADER_LENGTH.
+     * @return true if the header could be serialized to the buffer and false otherwise.
+     */
+    virtual bool serialize_header(uint32_t iface_index, const sMacAddr &dst_mac,
+                                  const sMacAddr &src_mac, ieee1905_1::CmduMessage &cmdu,
+                                  Buffer &header) = 0;
 };
 
 } // namespace net
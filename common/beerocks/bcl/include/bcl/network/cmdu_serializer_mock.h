@@ -22,6 +22,10 @@ public:
                 (uint32_t iface_index, const sMacAddr &dst_mac, const sMacAddr &src_mac,
                  ieee1905_1::CmduMessage &cmdu, Buffer &buffer),
                 (override));
+    MOCK_METHOD(bool, serialize_header,
+                (uint32_t iface_index, const sMacAddr &dst_mac, const sMacAddr &src_mac,
+                 ieee1905_1::CmduMessage &cmdu, Buffer &header),
+                (override));
 };
 
 } // namespace net
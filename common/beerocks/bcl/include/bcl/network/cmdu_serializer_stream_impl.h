@@ -42,6 +42,16 @@ public:
      */
     bool serialize_cmdu(uint32_t iface_index, const sMacAddr &dst_mac, const sMacAddr &src_mac,
                         ieee1905_1::CmduMessage &cmdu, Buffer &buffer) override;
+
+    /**
+     * @brief Serializes the header that precedes a CMDU to a byte buffer.
+     *
+     * @see CmduSerializer::serialize_header
+     *
+     * The header is the beerocks::message::sUdsHeader described in serialize_cmdu().
+     */
+    bool serialize_header(uint32_t iface_index, const sMacAddr &dst_mac, const sMacAddr &src_mac,
+                          ieee1905_1::CmduMessage &cmdu, Buffer &header) override;
 };
 
 } // namespace net
@@ -0,0 +1,119 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef BCL_NETWORK_RING_BUFFER_IMPL_H_
+#define BCL_NETWORK_RING_BUFFER_IMPL_H_
+
+#include "buffer.h"
+
+namespace beerocks {
+namespace net {
+
+/**
+ * Buffer implementation where consuming bytes (shifting) does not move the remaining ones.
+ *
+ * Contents are stored in a ring, in memory that is mapped twice back to back so that they are
+ * always contiguous in the address space, also when they wrap around the end of the ring. Shifting
+ * is then only pointer arithmetic and the free space always starts right after the contents, as
+ * the Buffer interface requires.
+ *
+ * If the memory cannot be mapped twice, twice the size is allocated instead and the contents are
+ * moved to the beginning only when they cross the middle of the allocation, which is at most once
+ * per size() bytes consumed.
+ *
+ * In both cases, consumed bytes are not overwritten until more data is appended, so data parsed in
+ * place stays valid after it is shifted out.
+ */
+class RingBufferImpl : public Buffer {
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param size Minimum size of the buffer. The actual size is rounded up to a multiple of the
+     * memory page size.
+     */
+    explicit RingBufferImpl(size_t size);
+
+    /**
+     * @brief Class destructor.
+     */
+    ~RingBufferImpl() override;
+
+    RingBufferImpl(const RingBufferImpl &) = delete;
+    RingBufferImpl &operator=(const RingBufferImpl &) = delete;
+
+    /**
+     * @brief Move constructor.
+     */
+    RingBufferImpl(RingBufferImpl &&other);
+
+    const uint8_t *data() const override { return m_memory + m_head; }
+    const size_t &length() const override { return m_length; }
+    size_t size() const override { return m_size; }
+
+    /**
+     * @see Buffer::clear
+     *
+     * Contents are dropped without zeroing the memory.
+     */
+    void clear() override;
+
+    /**
+     * @see Buffer::append
+     */
+    bool append(const uint8_t *data, size_t length) override;
+
+    /**
+     * @see Buffer::shift
+     */
+    bool shift(size_t count) override;
+
+    /**
+     * @see Buffer::is_shift_in_place
+     */
+    bool is_shift_in_place() const override { return true; }
+
+    /**
+     * @brief Checks if the memory is mapped twice.
+     *
+     * @return true if contents wrap around the ring and false if they are moved back to the
+     * beginning of the memory instead.
+     */
+    bool is_mirrored() const { return m_mirrored; }
+
+private:
+    /**
+     * Memory holding the contents, of twice the buffer size.
+     */
+    uint8_t *m_memory = nullptr;
+
+    /**
+     * Buffer size.
+     */
+    size_t m_size = 0;
+
+    /**
+     * Offset of the contents in the memory, always less than the buffer size.
+     */
+    size_t m_head = 0;
+
+    /**
+     * Length of the contents.
+     */
+    size_t m_length = 0;
+
+    /**
+     * True if the second half of the memory maps the first one.
+     */
+    bool m_mirrored = false;
+};
+
+} // namespace net
+} // namespace beerocks
+
+#endif /* BCL_NETWORK_RING_BUFFER_IMPL_H_ */
@@ -0,0 +1,103 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef BCL_NETWORK_SEND_QUEUE_H_
+#define BCL_NETWORK_SEND_QUEUE_H_
+
+#include "sockets.h"
+
+#include <deque>
+#include <vector>
+
+namespace beerocks {
+namespace net {
+
+/**
+ * Queue of the data that could not be sent yet through a socket connection.
+ *
+ * Data is sent without blocking, gathered from the buffers it is in (e.g. a frame header and the
+ * message itself) so that it does not need to be copied into a single buffer first. The bytes that
+ * the socket does not accept are copied into the queue, and all the data sent later through the
+ * same connection is queued behind them to keep its order.
+ *
+ * The owner of the connection flushes the queue when the socket is ready for writing again (see
+ * EventLoop::set_write_handler). All the queued data is then sent at once, so a burst of small
+ * messages costs a single system call.
+ */
+class SendQueue {
+public:
+    /**
+     * Maximum number of bytes queued. Data that does not fit is dropped, as the peer is most
+     * likely stuck.
+     */
+    static constexpr size_t MAX_LENGTH = 1024 * 1024;
+
+    /**
+     * @brief Sends data, or queues it if it cannot be sent yet.
+     *
+     * Data queued before is sent first, if the socket is ready for writing.
+     *
+     * @param connection Socket connection to send the data through.
+     * @param chunks Buffers holding the data to send, in order.
+     * @param count Number of buffers.
+     * @return true if the data was sent or queued and false otherwise (i.e.: sending failed or
+     * the queue is full).
+     */
+    bool send(Socket::Connection &connection, const struct iovec *chunks, size_t count);
+
+    /**
+     * @brief Sends the queued data, as much as the socket accepts.
+     *
+     * @param connection Socket connection to send the data through.
+     * @return true on success (even if some data remains queued) and false if sending failed.
+     */
+    bool flush(Socket::Connection &connection);
+
+    /**
+     * @brief Checks if there is data queued.
+     *
+     * @return true if all the data has been sent and false otherwise.
+     */
+    bool empty() const { return 0 == m_length; }
+
+    /**
+     * @brief Returns the number of bytes queued.
+     */
+    size_t length() const { return m_length; }
+
+    /**
+     * @brief Drops the queued data.
+     */
+    void clear();
+
+private:
+    /**
+     * @brief Removes the given number of bytes from the front of the queue, once sent.
+     */
+    void consume(size_t count);
+
+    /**
+     * Chunks of data queued, each one holding the data not sent of a call to send().
+     */
+    std::deque<std::vector<uint8_t>> m_chunks;
+
+    /**
+     * Number of bytes of the first chunk already sent.
+     */
+    size_t m_offset = 0;
+
+    /**
+     * Number of bytes queued (not sent yet).
+     */
+    size_t m_length = 0;
+};
+
+} // namespace net
+} // namespace beerocks
+
+#endif /* BCL_NETWORK_SEND_QUEUE_H_ */
@@ -15,6 +15,7 @@
 #include <memory>
 #include <string>
 #include <sys/socket.h>
+#include <sys/uio.h>
 
 namespace beerocks {
 namespace net {
@@ -152,6 +153,19 @@ public:
          */
         virtual int send(const Buffer &buffer) = 0;
 
+        /**
+         * @brief Sends data gathered from several buffers through the socket connection.
+         *
+         * The call does not block: if the socket is not ready for writing, fewer bytes than given
+         * are sent, or none.
+         *
+         * @param[in] chunks Buffers holding the data to send, in order.
+         * @param[in] count Number of buffers.
+         * @return Number of bytes transmitted, -1 on failure (with errno set to EAGAIN or
+         * EWOULDBLOCK if the socket is not ready for writing).
+         */
+        virtual int send_vectored(const struct iovec *chunks, size_t count) = 0;
+
         /**
          * @brief Sends data through the socket connection.
          *
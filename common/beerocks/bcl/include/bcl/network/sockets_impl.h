@@ -368,6 +368,22 @@ public:
         return ::send(m_socket->fd(), buffer.data(), buffer.length(), MSG_NOSIGNAL);
     }
 
+    /**
+     * @brief Sends data gathered from several buffers through the socket connection.
+     *
+     * @see Connection::send_vectored
+     *
+     * This implementation uses the sendmsg() system call.
+     */
+    int send_vectored(const struct iovec *chunks, size_t count) override
+    {
+        msghdr message     = {};
+        message.msg_iov    = const_cast<struct iovec *>(chunks);
+        message.msg_iovlen = count;
+
+        return ::sendmsg(m_socket->fd(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+    }
+
     /**
      * @brief Sends data through the socket connection.
      *
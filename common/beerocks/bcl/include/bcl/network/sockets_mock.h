@@ -27,7 +27,22 @@ public:
     MOCK_METHOD(int, receive, (Buffer & buffer));
     MOCK_METHOD(int, receive_from, (Buffer & buffer, Socket::Address &address), (override));
     MOCK_METHOD(int, send, (const Buffer &buffer), (override));
+    MOCK_METHOD(int, send_vectored, (const struct iovec *chunks, size_t count), (override));
     MOCK_METHOD(int, send_to, (const Buffer &buffer, const Socket::Address &address), (override));
+
+    /**
+     * @brief Fake send_vectored() that emulates a socket connection accepting all the data given.
+     *
+     * To be used as `EXPECT_CALL(connection, send_vectored(_, _)).WillOnce(Invoke(send_all))`.
+     */
+    static int send_all(const struct iovec *chunks, size_t count)
+    {
+        int length = 0;
+        for (size_t i = 0; i < count; i++) {
+            length += chunks[i].iov_len;
+        }
+        return length;
+    }
 };
 
 class ServerSocketMock : public ServerSocket {
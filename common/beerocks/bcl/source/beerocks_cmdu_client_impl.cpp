@@ -66,7 +66,10 @@ bool CmduClientImpl::send_cmdu(ieee1905_1::CmduMessageTx &cmdu_tx) const
     }
 
     // Send given CMDU through the socket connection established with CMDU server
-    return m_peer.send_cmdu(*m_connection, cmdu_tx);
+    bool result = m_peer.send_cmdu(*m_connection, m_send_queue, cmdu_tx);
+    watch_send_queue();
+
+    return result;
 }
 
 bool CmduClientImpl::forward_cmdu(ieee1905_1::CmduMessageRx &cmdu_rx)
@@ -74,12 +77,16 @@ bool CmduClientImpl::forward_cmdu(ieee1905_1::CmduMessageRx &cmdu_rx)
     // Check if connection with server is still open
     if (!m_connection) {
         LOG(ERROR) << "Connection with server has been closed!";
+        return false;
     }
 
     /** 
      * Fill @a iface_index, @a dst_mac and @a arc_mac with empty values since they are irrelevant.
      */
-    return m_peer.forward_cmdu(*m_connection, 0, {}, {}, cmdu_rx);
+    bool result = m_peer.forward_cmdu(*m_connection, m_send_queue, 0, {}, {}, cmdu_rx);
+    watch_send_queue();
+
+    return result;
 }
 
 void CmduClientImpl::handle_read(int fd)
@@ -94,6 +101,33 @@ void CmduClientImpl::handle_read(int fd)
     m_peer.receive_cmdus(*m_connection, m_buffer, handler);
 }
 
+void CmduClientImpl::handle_write(int fd) const
+{
+    // Send queued data. On error, drop it: the connection will most likely be closed soon
+    if (!m_send_queue.flush(*m_connection)) {
+        LOG(ERROR) << "Failed to send queued data, dropping " << m_send_queue.length()
+                   << " bytes, fd = " << fd;
+        m_send_queue.clear();
+    }
+
+    // Stop monitoring the write event once all queued data has been sent
+    if (m_send_queue.empty()) {
+        m_event_loop->set_write_handler(fd, nullptr);
+    }
+}
+
+void CmduClientImpl::watch_send_queue() const
+{
+    if (m_send_queue.empty()) {
+        return;
+    }
+
+    m_event_loop->set_write_handler(m_connection->socket()->fd(), [&](int fd, EventLoop &loop) {
+        handle_write(fd);
+        return true;
+    });
+}
+
 void CmduClientImpl::handle_close(int fd)
 {
     // Close the connection. No need to remove handlers as they have already been removed by the
@@ -117,8 +151,9 @@ void CmduClientImpl::close_connection(bool remove_handlers)
             m_event_loop->remove_handlers(m_connection->socket()->fd());
         }
 
-        // Terminate the connection
+        // Terminate the connection, dropping the data not sent yet
         m_connection.reset();
+        m_send_queue.clear();
     }
 }
 
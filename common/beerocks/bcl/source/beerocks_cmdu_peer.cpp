@@ -26,7 +26,7 @@ CmduPeer::CmduPeer(std::shared_ptr<beerocks::net::CmduParser> cmdu_parser,
 }
 
 bool CmduPeer::send_cmdu(beerocks::net::Socket::Connection &connection,
-                         ieee1905_1::CmduMessageTx &cmdu_tx) const
+                         beerocks::net::SendQueue &queue, ieee1905_1::CmduMessageTx &cmdu_tx) const
 {
     // Finalize CMDU
     size_t cmdu_length = cmdu_tx.getMessageLength();
@@ -38,21 +38,15 @@ bool CmduPeer::send_cmdu(beerocks::net::Socket::Connection &connection,
         return false;
     }
 
-    // Serialize CMDU into a byte array
     uint32_t iface_index = 0;
     sMacAddr dst_mac     = beerocks::net::network_utils::ZERO_MAC;
     sMacAddr src_mac     = beerocks::net::network_utils::ZERO_MAC;
-    beerocks::net::BufferImpl<message::MESSAGE_BUFFER_LENGTH> buffer;
-    if (!m_cmdu_serializer->serialize_cmdu(iface_index, dst_mac, src_mac, cmdu_tx, buffer)) {
-        LOG(ERROR) << "Failed to serialize CMDU! fd = " << connection.socket()->fd();
-        return false;
-    }
 
-    // Send data
-    return connection.send(buffer) > 0;
+    return send_frame(connection, queue, iface_index, dst_mac, src_mac, cmdu_tx);
 }
 
-bool CmduPeer::forward_cmdu(beerocks::net::Socket::Connection &connection, uint32_t iface_index,
+bool CmduPeer::forward_cmdu(beerocks::net::Socket::Connection &connection,
+                            beerocks::net::SendQueue &queue, uint32_t iface_index,
                             const sMacAddr &dst_mac, const sMacAddr &src_mac,
                             ieee1905_1::CmduMessageRx &cmdu_rx)
 {
@@ -66,15 +60,28 @@ bool CmduPeer::forward_cmdu(beerocks::net::Socket::Connection &connection, uint3
         cmdu_rx.swap();
     });
 
-    // Serialize CMDU into a byte array
-    beerocks::net::BufferImpl<message::MESSAGE_BUFFER_LENGTH> buffer;
-    if (!m_cmdu_serializer->serialize_cmdu(iface_index, dst_mac, src_mac, cmdu_rx, buffer)) {
-        LOG(ERROR) << "Failed to serialize CMDU! fd = " << connection.socket()->fd();
+    return send_frame(connection, queue, iface_index, dst_mac, src_mac, cmdu_rx);
+}
+
+bool CmduPeer::send_frame(beerocks::net::Socket::Connection &connection,
+                          beerocks::net::SendQueue &queue, uint32_t iface_index,
+                          const sMacAddr &dst_mac, const sMacAddr &src_mac,
+                          ieee1905_1::CmduMessage &cmdu) const
+{
+    // Serialize only the frame header, the CMDU is sent from its own buffer
+    beerocks::net::BufferImpl<beerocks::net::CmduSerializer::MAX_HEADER_LENGTH> header;
+    if (!m_cmdu_serializer->serialize_header(iface_index, dst_mac, src_mac, cmdu, header)) {
+        LOG(ERROR) << "Failed to serialize CMDU header! fd = " << connection.socket()->fd();
         return false;
     }
 
-    // Send data
-    return connection.send(buffer);
+    // Send header and CMDU with a single system call
+    struct iovec chunks[] = {
+        {const_cast<uint8_t *>(header.data()), header.length()},
+        {cmdu.getMessageBuff(), cmdu.getMessageLength()},
+    };
+
+    return queue.send(connection, chunks, sizeof(chunks) / sizeof(chunks[0]));
 }
 
 void CmduPeer::receive_cmdus(beerocks::net::Socket::Connection &connection,
@@ -97,9 +97,12 @@ bool CmduServerImpl::send_cmdu(int fd, ieee1905_1::CmduMessageTx &cmdu_tx)
         return false;
     }
 
-    const auto &context = it->second;
+    auto &context = it->second;
+
+    bool result = m_peer.send_cmdu(*context.connection, context.send_queue, cmdu_tx);
+    watch_send_queue(fd, context.send_queue);
 
-    return m_peer.send_cmdu(*context.connection, cmdu_tx);
+    return result;
 }
 
 bool CmduServerImpl::forward_cmdu(int fd, uint32_t iface_index, const sMacAddr &dst_mac,
@@ -114,7 +117,11 @@ bool CmduServerImpl::forward_cmdu(int fd, uint32_t iface_index, const sMacAddr &
 
     auto &context = it->second;
 
-    return m_peer.forward_cmdu(*context.connection, iface_index, dst_mac, src_mac, cmdu_rx);
+    bool result = m_peer.forward_cmdu(*context.connection, context.send_queue, iface_index,
+                                      dst_mac, src_mac, cmdu_rx);
+    watch_send_queue(fd, context.send_queue);
+
+    return result;
 }
 
 bool CmduServerImpl::add_connection(int fd,
@@ -224,6 +231,42 @@ void CmduServerImpl::handle_read(int fd)
     m_peer.receive_cmdus(*context.connection, context.buffer, handler);
 }
 
+void CmduServerImpl::handle_write(int fd)
+{
+    // Find context information for given socket connection
+    auto it = m_connections.find(fd);
+    if (m_connections.end() == it) {
+        LOG(ERROR) << "Failed to find connection! fd = " << fd;
+        return;
+    }
+
+    auto &context = it->second;
+
+    // Send queued data. On error, drop it: the peer will most likely be disconnected soon
+    if (!context.send_queue.flush(*context.connection)) {
+        LOG(ERROR) << "Failed to send queued data, dropping " << context.send_queue.length()
+                   << " bytes, fd = " << fd;
+        context.send_queue.clear();
+    }
+
+    // Stop monitoring the write event once all queued data has been sent
+    if (context.send_queue.empty()) {
+        m_event_loop->set_write_handler(fd, nullptr);
+    }
+}
+
+void CmduServerImpl::watch_send_queue(int fd, const beerocks::net::SendQueue &send_queue)
+{
+    if (send_queue.empty()) {
+        return;
+    }
+
+    m_event_loop->set_write_handler(fd, [&](int fd, EventLoop &loop) {
+        handle_write(fd);
+        return true;
+    });
+}
+
 void CmduServerImpl::handle_close(int fd)
 {
     // Remove connection on the given client socket
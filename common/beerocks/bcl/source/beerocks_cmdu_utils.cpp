@@ -10,71 +10,75 @@
 
 #include <bcl/beerocks_message_structs.h>
 
-#include <tlvf/CmduMessage.h>
+#include <tlvf/CmduMessageRx.h>
 #include <tlvf/ieee_1905_1/tlvVendorSpecific.h>
 
 #include <easylogging++.h>
 
+#include <algorithm>
+
 namespace beerocks {
 
-bool CmduUtils::verify_cmdu(uint8_t *data, size_t length)
+/**
+ * @brief Checks that the payload of an Intel vendor specific TLV starts with the beerocks magic.
+ */
+static bool check_beerocks_magic(ieee1905_1::tlvVendorSpecific &tlv_vendor_specific)
 {
-    if (length < ieee1905_1::cCmduHeader::get_initial_size() + sizeof(ieee1905_1::sTlvHeader)) {
-        LOG(ERROR) << "Invalid CMDU length: " << length;
+    uint32_t beerocks_magic;
+    if (tlv_vendor_specific.payload_length() < sizeof(beerocks_magic)) {
+        LOG(WARNING) << "beerocks message too short: " << tlv_vendor_specific.payload_length();
         return false;
     }
 
-    auto tlv = reinterpret_cast<ieee1905_1::sTlvHeader *>(
-        data + ieee1905_1::cCmduHeader::get_initial_size());
-
-    do {
-
-        auto tlv_type = static_cast<ieee1905_1::eTlvType>(tlv->type);
-
-        uint16_t tlv_length = tlv->length;
-        swap_16(tlv_length);
-
-        if (tlv_type == ieee1905_1::eTlvType::TLV_VENDOR_SPECIFIC) {
-            auto tlv_vendor_specific =
-                ieee1905_1::tlvVendorSpecific(reinterpret_cast<uint8_t *>(tlv),
-                                              sizeof(ieee1905_1::sTlvHeader) + tlv_length, true);
-            if (!tlv_vendor_specific.isInitialized()) {
-                LOG(ERROR) << "tlvVendorSpecific init() failure";
-                break;
-            }
-
-            if (tlv_vendor_specific.vendor_oui() ==
-                ieee1905_1::tlvVendorSpecific::eVendorOUI::OUI_INTEL) {
-                // assuming that the magic is the first data on the beerocks header
-                auto beerocks_magic =
-                    *(reinterpret_cast<uint32_t *>(tlv_vendor_specific.payload()));
-                swap_32(beerocks_magic);
-                if (beerocks_magic != message::MESSAGE_MAGIC) {
-                    LOG(WARNING) << "mismatch magic " << std::hex << int(beerocks_magic)
-                                 << " != " << int(message::MESSAGE_MAGIC) << std::dec;
-                    break;
-                }
-
-            } else {
-                LOG(INFO) << "Not an Intel vendor specific message!";
-            }
-
-            // cancel the swap we did
-            tlv_vendor_specific.class_swap();
-        } else if ((tlv_type == ieee1905_1::eTlvType::TLV_END_OF_MESSAGE) && (0 == tlv_length)) {
-            return true;
-        }
+    // assuming that the magic is the first data on the beerocks header
+    std::copy_n(tlv_vendor_specific.payload(), sizeof(beerocks_magic),
+                reinterpret_cast<uint8_t *>(&beerocks_magic));
+    swap_32(beerocks_magic);
+    if (beerocks_magic != message::MESSAGE_MAGIC) {
+        LOG(WARNING) << "mismatch magic " << std::hex << int(beerocks_magic)
+                     << " != " << int(message::MESSAGE_MAGIC) << std::dec;
+        return false;
+    }
 
-        // set the next tlv
-        tlv = reinterpret_cast<ieee1905_1::sTlvHeader *>(
-            reinterpret_cast<uint8_t *>(tlv) + sizeof(ieee1905_1::sTlvHeader) + tlv_length);
+    return true;
+}
 
-    } while (reinterpret_cast<uint8_t *>(tlv) < (data + length));
+bool CmduUtils::verify_tlv(uint8_t *tlv, size_t length)
+{
+    if (static_cast<ieee1905_1::eTlvType>(tlv[0]) != ieee1905_1::eTlvType::TLV_VENDOR_SPECIFIC) {
+        return true;
+    }
 
-    LOG(ERROR) << "TLV end of message not found! tlv_type=" << tlv->type
-               << ", tlv_length=" << tlv->length;
+    auto tlv_vendor_specific = ieee1905_1::tlvVendorSpecific(tlv, length, true);
+    if (!tlv_vendor_specific.isInitialized()) {
+        LOG(ERROR) << "tlvVendorSpecific init() failure";
+        return false;
+    }
+
+    bool valid = true;
+    if (tlv_vendor_specific.vendor_oui() == ieee1905_1::tlvVendorSpecific::eVendorOUI::OUI_INTEL) {
+        valid = check_beerocks_magic(tlv_vendor_specific);
+    } else {
+        LOG(INFO) << "Not an Intel vendor specific message!";
+    }
+
+    // cancel the swap we did
+    tlv_vendor_specific.class_swap();
+
+    return valid;
+}
+
+bool CmduUtils::verify_vendor_specific_tlvs(const ieee1905_1::CmduMessageRx &cmdu_rx)
+{
+    for (const auto &tlv_vendor_specific : cmdu_rx.getClassList<ieee1905_1::tlvVendorSpecific>()) {
+        if (tlv_vendor_specific->vendor_oui() ==
+                ieee1905_1::tlvVendorSpecific::eVendorOUI::OUI_INTEL &&
+            !check_beerocks_magic(*tlv_vendor_specific)) {
+            return false;
+        }
+    }
 
-    return false;
+    return true;
 }
 
 } // namespace beerocks
@@ -115,6 +115,7 @@ bool config_file::read_master_config_file(const std::string &config_file_path, s
                         mandatory_master),
 
         std::make_tuple("use_dataelements_vap_configs=", &conf.use_dataelements_vap_configs, 0),
+        std::make_tuple("event_loop_stall_threshold_ms=", &conf.event_loop_stall_threshold_ms, 0),
     };
 
     bool ret_val = (read_config_file(config_file_path, master_conf_args, config_type) &&
@@ -146,6 +147,7 @@ bool config_file::read_slave_config_file(const std::string &config_file_path, sC
             std::make_tuple("profile_x_disallow_override_unsupported_configuration=",
                             &conf.profile_x_disallow_override_unsupported_configuration, 0),
             std::make_tuple("on_boot_scan=", &conf.on_boot_scan, 0),
+            std::make_tuple("transport_rx_ring=", &conf.transport_rx_ring, 0),
         };
         std::string config_type = "global";
         if (!read_config_file(config_file_path, slave_global_conf_args, config_type)) {
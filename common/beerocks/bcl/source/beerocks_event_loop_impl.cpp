@@ -9,6 +9,7 @@
 #include <bcl/beerocks_event_loop_impl.h>
 
 #include <sys/epoll.h>
+#include <sys/socket.h>
 #include <sys/timerfd.h>
 #include <unistd.h>
 
@@ -32,6 +33,35 @@ namespace beerocks {
 // Maximal number of events to process in a single epoll_wait call
 static constexpr int MAX_POLL_EVENTS = 17;
 
+// Definition of the interface constant (required when it is bound to a reference)
+constexpr size_t EventLoop::RECV_BUFFER_SIZE;
+
+/**
+ * @brief Gets the events to poll for a set of event handlers.
+ *
+ * EPOLLIN: The associated fd is available for read operations.
+ * EPOLLOUT: The associated fd is available for write operations.
+ * EPOLLRDHUP: Socket peer closed connection, or shut down writing half of connection.
+ * EPOLLERR: Error condition happened on the associated fd.
+ * EPOLLHUP: Hang up happened on the associated fd.
+ */
+static uint32_t get_poll_events(const EventLoop::EventHandlers &handlers)
+{
+    uint32_t events = EPOLLRDHUP | EPOLLERR | EPOLLHUP;
+
+    // If read or data handler was set, also listen for POLL-IN events
+    if (handlers.on_read || handlers.on_data) {
+        events |= EPOLLIN;
+    }
+
+    // If write handler was set, also listen for POLL-OUT events
+    if (handlers.on_write) {
+        events |= EPOLLOUT;
+    }
+
+    return events;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////////// Implementation ///////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -72,27 +102,12 @@ bool EventLoopImpl::register_handlers(int fd, const EventLoop::EventHandlers &ha
 
     LOG(INFO) << "Register handlers for FD (" << fd << ")" << get_fd_name_print(handlers.name);
 
-    // Helper lambda function for adding a fd to the poll, and register for the following
-    // events:
-    // EPOLLIN: The associated fd is available for read operations.
-    // EPOLLOUT: The associated fd is available for write operations.
-    // EPOLLRDHUP: Socket peer closed connection, or shut down writing half of connection.
-    // EPOLLERR: Error condition happened on the associated fd.
-    // EPOLLHUP: Hang up happened on the associated fd.
+    // Helper lambda function for adding a fd to the poll, and register for the events of the
+    // given handlers
     auto add_fd_to_epoll = [&](int fd) -> bool {
         epoll_event event = {};
         event.data.fd     = fd;
-        event.events      = EPOLLRDHUP | EPOLLERR | EPOLLHUP;
-
-        // If read handler was set, also listen for POLL-IN events
-        if (handlers.on_read) {
-            event.events |= EPOLLIN;
-        }
-
-        // If write handler was set, also listen for POLL-OUT events
-        if (handlers.on_write) {
-            event.events |= EPOLLOUT;
-        }
+        event.events      = get_poll_events(handlers);
 
         if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1) {
             LOG(ERROR) << "Failed adding FD (" << fd << ")" << get_fd_name_print(handlers.name)
@@ -158,6 +173,33 @@ bool EventLoopImpl::set_handler_name(int fd, const std::string &name)
     return true;
 }
 
+bool EventLoopImpl::set_write_handler(int fd, const EventHandler &on_write)
+{
+    auto it = m_fd_to_event_handlers.find(fd);
+    if (it == m_fd_to_event_handlers.end()) {
+        LOG(ERROR) << "Unable to find fd " << fd << " in the registered handlers";
+        return false;
+    }
+
+    // Only modify the poll when write events start or stop being monitored
+    bool was_set        = bool(it->second.on_write);
+    it->second.on_write = on_write;
+    if (was_set == bool(on_write)) {
+        return true;
+    }
+
+    epoll_event event = {};
+    event.data.fd     = fd;
+    event.events      = get_poll_events(it->second);
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, fd, &event) == -1) {
+        LOG(ERROR) << "Failed modifying FD (" << fd << ")" << get_fd_name_print(it->second.name)
+                   << " in the poll: " << strerror(errno);
+        return false;
+    }
+
+    return true;
+}
+
 int EventLoopImpl::run()
 {
     // Poll events
@@ -227,20 +269,34 @@ int EventLoopImpl::run()
                 return -1;
             }
 
+        } else if (events[i].events & (EPOLLIN | EPOLLOUT)) {
+
             // Handle incoming data
-        } else if (events[i].events & EPOLLIN) {
-            if (handlers.on_read && (!handlers.on_read(fd, *this))) {
-                LOG(ERROR) << "Read handler on FD (" << fd << ")"
-                           << get_fd_name_print(handlers.name) << " failed";
-                return -1;
+            if (events[i].events & EPOLLIN) {
+                if (handlers.on_data) {
+                    if (!handle_data(fd, handlers)) {
+                        return -1;
+                    }
+                } else if (handlers.on_read && (!handlers.on_read(fd, *this))) {
+                    LOG(ERROR) << "Read handler on FD (" << fd << ")"
+                               << get_fd_name_print(handlers.name) << " failed";
+                    return -1;
+                }
             }
 
-            // Handle write operations
-        } else if (events[i].events & EPOLLOUT) {
-            if (handlers.on_write && (!handlers.on_write(fd, *this))) {
-                LOG(ERROR) << "Write handler on FD (" << fd << ")"
-                           << get_fd_name_print(handlers.name) << " failed";
-                return -1;
+            // Handle write operations, also when data came in at the same time so that writes are
+            // not held back by a busy reader. The read handler might have changed the handlers.
+            if (events[i].events & EPOLLOUT) {
+                const auto &current = m_fd_to_event_handlers.find(fd);
+                if (current == m_fd_to_event_handlers.end()) {
+                    continue;
+                }
+                auto on_write = current->second.on_write;
+                if (on_write && (!on_write(fd, *this))) {
+                    LOG(ERROR) << "Write handler on FD (" << fd << ")"
+                               << get_fd_name_print(handlers.name) << " failed";
+                    return -1;
+                }
             }
 
         } else {
@@ -252,4 +308,58 @@ int EventLoopImpl::run()
     return num_events;
 }
 
+bool EventLoopImpl::handle_data(int fd, const EventHandlers &handlers)
+{
+    if (m_recv_buffer.empty()) {
+        m_recv_buffer.resize(RECV_BUFFER_SIZE);
+    }
+
+    ssize_t length = recv(fd, m_recv_buffer.data(), m_recv_buffer.size(), MSG_DONTWAIT);
+    int err        = errno; // Save errno before any logging
+
+    if (length > 0) {
+        if (!handlers.on_data(fd, m_recv_buffer.data(), length, *this)) {
+            LOG(ERROR) << "Data handler on FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                       << " failed";
+            return false;
+        }
+        return true;
+    }
+
+    if (length < 0 && (EAGAIN == err || EWOULDBLOCK == err || EINTR == err)) {
+        return true;
+    }
+
+    if (length < 0 && is_transient_receive_error(err)) {
+        LOG(WARNING) << "Failed receiving from FD (" << fd << ")"
+                     << get_fd_name_print(handlers.name) << ": " << strerror(err);
+        return true;
+    }
+
+    // Remove the file descriptor from the poll
+    remove_handlers(fd);
+
+    if (0 == length) {
+        LOG(DEBUG) << "Socket with FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                   << " disconnected";
+
+        if (handlers.on_disconnect && (!handlers.on_disconnect(fd, *this))) {
+            LOG(ERROR) << "Disconnect handler on FD (" << fd << ")"
+                       << get_fd_name_print(handlers.name) << " failed";
+            return false;
+        }
+        return true;
+    }
+
+    LOG(ERROR) << "Failed receiving from FD (" << fd << ")" << get_fd_name_print(handlers.name)
+               << ": " << strerror(err);
+
+    if (handlers.on_error && (!handlers.on_error(fd, *this))) {
+        LOG(ERROR) << "Error handler on FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                   << " failed";
+        return false;
+    }
+    return true;
+}
+
 } // namespace beerocks
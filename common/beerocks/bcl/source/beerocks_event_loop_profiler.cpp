@@ -0,0 +1,399 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_event_loop_profiler.h>
+
+#include <signal.h>
+
+// Not available with all C libraries (e.g. musl)
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define BEEROCKS_HAVE_BACKTRACE
+#endif
+
+#include <easylogging++.h>
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <vector>
+
+namespace beerocks {
+
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////// Local module definitions //////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t EventLoopProfiler::HISTOGRAM_BUCKETS;
+
+#ifdef BEEROCKS_HAVE_BACKTRACE
+
+// Maximum number of frames in the backtrace of a blocking handler
+static constexpr int MAX_BACKTRACE_FRAMES = 64;
+
+// Frames of the backtrace taken by the event loop thread in the signal handler, and their number
+// (-1 until taken)
+static void *s_backtrace_frames[MAX_BACKTRACE_FRAMES];
+static std::atomic<int> s_backtrace_frame_count(-1);
+
+// Signal sent to the event loop thread to make it take its own backtrace
+static int backtrace_signal() { return SIGRTMAX; }
+
+static void backtrace_signal_handler(int signum)
+{
+    s_backtrace_frame_count = backtrace(s_backtrace_frames, MAX_BACKTRACE_FRAMES);
+}
+
+static void install_backtrace_signal_handler()
+{
+    // The first call to backtrace() loads libgcc, which is not safe in a signal handler
+    void *frame;
+    backtrace(&frame, 1);
+
+    struct sigaction action = {};
+    action.sa_handler       = backtrace_signal_handler;
+    action.sa_flags         = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(backtrace_signal(), &action, nullptr);
+}
+
+/**
+ * @brief Logs the backtrace of a thread, taken by the thread itself in a signal handler.
+ */
+static void log_backtrace(pthread_t thread)
+{
+    // Only one backtrace at a time, the frames are global
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    s_backtrace_frame_count = -1;
+    if (0 != pthread_kill(thread, backtrace_signal())) {
+        LOG(ERROR) << "Failed signaling the event loop thread";
+        return;
+    }
+
+    for (int i = 0; i < 100 && s_backtrace_frame_count < 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    int count = s_backtrace_frame_count;
+    if (count < 0) {
+        LOG(WARNING) << "Event loop thread did not take its backtrace";
+        return;
+    }
+
+    char **symbols = backtrace_symbols(s_backtrace_frames, count);
+    if (!symbols) {
+        LOG(ERROR) << "Failed getting the backtrace symbols";
+        return;
+    }
+
+    std::stringstream ss;
+    ss << "Backtrace of the event loop thread:";
+    for (int i = 0; i < count; i++) {
+        ss << std::endl << "#" << i << " " << symbols[i];
+    }
+    free(symbols);
+
+    LOG(WARNING) << ss.str();
+}
+
+#else // BEEROCKS_HAVE_BACKTRACE
+
+static void install_backtrace_signal_handler() {}
+
+static void log_backtrace(pthread_t thread)
+{
+    LOG(WARNING) << "Backtrace of the event loop thread not supported";
+}
+
+#endif // BEEROCKS_HAVE_BACKTRACE
+
+/**
+ * @brief Gets the histogram bucket of a handler call duration.
+ */
+static size_t histogram_bucket(std::chrono::nanoseconds duration)
+{
+    auto micros   = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    size_t bucket = 0;
+    while (micros > 0 && bucket < EventLoopProfiler::HISTOGRAM_BUCKETS - 1) {
+        micros >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static uint64_t to_micros(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/////////////////////////////// Implementation ///////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+EventLoopProfiler::EventLoopProfiler(std::shared_ptr<EventLoop> event_loop,
+                                     std::chrono::milliseconds stall_threshold)
+    : m_event_loop(event_loop), m_stall_threshold(stall_threshold)
+{
+    LOG_IF(!m_event_loop, FATAL) << "Event loop is a null pointer!";
+
+    if (m_stall_threshold > std::chrono::milliseconds::zero()) {
+        install_backtrace_signal_handler();
+        m_watchdog = std::thread(&EventLoopProfiler::watchdog, this);
+    }
+}
+
+EventLoopProfiler::~EventLoopProfiler()
+{
+    if (m_watchdog.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_stop_condition.notify_one();
+        m_watchdog.join();
+    }
+
+    // The wrapped handlers in the profiled event loop refer to this object
+    LOG(DEBUG) << "Removing " << m_fd_to_registration.size() << " FDs from the event loop";
+
+    while (!m_fd_to_registration.empty()) {
+        int fd = m_fd_to_registration.begin()->first;
+        EventLoopProfiler::remove_handlers(fd);
+    }
+}
+
+bool EventLoopProfiler::register_handlers(int fd, const EventLoop::EventHandlers &handlers)
+{
+    EventHandlers wrapped = handlers;
+    wrapped.on_read       = wrap(fd, handlers.on_read);
+    wrapped.on_write      = wrap(fd, handlers.on_write);
+    wrapped.on_disconnect = wrap(fd, handlers.on_disconnect, true);
+    wrapped.on_error      = wrap(fd, handlers.on_error, true);
+    wrapped.on_data       = wrap(fd, handlers.on_data);
+
+    if (!m_event_loop->register_handlers(fd, wrapped)) {
+        return false;
+    }
+
+    set_name(fd, m_fd_to_registration[fd], handlers.name);
+
+    return true;
+}
+
+bool EventLoopProfiler::remove_handlers(int fd)
+{
+    m_fd_to_registration.erase(fd);
+
+    return m_event_loop->remove_handlers(fd);
+}
+
+bool EventLoopProfiler::set_handler_name(int fd, const std::string &name)
+{
+    if (!m_event_loop->set_handler_name(fd, name)) {
+        return false;
+    }
+
+    auto it = m_fd_to_registration.find(fd);
+    if (it != m_fd_to_registration.end()) {
+        set_name(fd, it->second, name);
+    }
+
+    return true;
+}
+
+bool EventLoopProfiler::set_write_handler(int fd, const EventHandler &on_write)
+{
+    return m_event_loop->set_write_handler(fd, wrap(fd, on_write));
+}
+
+int EventLoopProfiler::run()
+{
+    m_runs++;
+
+    int num_events = m_event_loop->run();
+    if (num_events > 0) {
+        m_wakeups++;
+    }
+
+    return num_events;
+}
+
+std::string EventLoopProfiler::to_string(const std::string &separator) const
+{
+    using Entry = std::pair<const HandlerKey, sHandlerStats>;
+
+    std::vector<const Entry *> sorted;
+    for (const auto &entry : m_stats) {
+        if (entry.second.calls > 0) {
+            sorted.push_back(&entry);
+        }
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Entry *a, const Entry *b) {
+        return a->second.total_time > b->second.total_time;
+    });
+
+    std::stringstream ss;
+    ss << "runs=" << m_runs << " wakeups=" << m_wakeups;
+
+    for (const auto &entry : sorted) {
+        const auto &stats = entry->second;
+
+        ss << separator << "'" << entry->first.first << "' fd=" << entry->first.second
+           << " calls=" << stats.calls << " total_us=" << to_micros(stats.total_time)
+           << " avg_us=" << to_micros(stats.total_time / stats.calls)
+           << " max_us=" << to_micros(stats.max_time) << " histogram_us=";
+
+        // Upper bound of each bucket, the last one has none
+        for (size_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+            if (!stats.histogram[bucket]) {
+                continue;
+            }
+            if (bucket < HISTOGRAM_BUCKETS - 1) {
+                ss << " <" << (uint64_t(1) << bucket);
+            } else {
+                ss << " >=" << (uint64_t(1) << (bucket - 1));
+            }
+            ss << ":" << stats.histogram[bucket];
+        }
+    }
+
+    return ss.str();
+}
+
+void EventLoopProfiler::reset()
+{
+    for (auto &entry : m_stats) {
+        entry.second = {};
+    }
+
+    m_runs    = 0;
+    m_wakeups = 0;
+}
+
+EventLoop::EventHandler EventLoopProfiler::wrap(int fd, const EventHandler &handler, bool removed)
+{
+    if (!handler) {
+        return nullptr;
+    }
+
+    return [this, fd, handler, removed](int, EventLoop &) {
+        auto start = std::chrono::steady_clock::now();
+        auto stats = begin_call(fd, start);
+        if (removed) {
+            m_fd_to_registration.erase(fd);
+        }
+        bool result = handler(fd, *this);
+        end_call(stats, start);
+        return result;
+    };
+}
+
+EventLoop::DataHandler EventLoopProfiler::wrap(int fd, const DataHandler &handler)
+{
+    if (!handler) {
+        return nullptr;
+    }
+
+    return [this, fd, handler](int, uint8_t *data, size_t length, EventLoop &) {
+        auto start  = std::chrono::steady_clock::now();
+        auto stats  = begin_call(fd, start);
+        bool result = handler(fd, data, length, *this);
+        end_call(stats, start);
+        return result;
+    };
+}
+
+EventLoopProfiler::sHandlerStats *
+EventLoopProfiler::begin_call(int fd, std::chrono::steady_clock::time_point start)
+{
+    auto it = m_fd_to_registration.find(fd);
+    if (it == m_fd_to_registration.end()) {
+        return nullptr;
+    }
+
+    if (m_watchdog.joinable()) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_call.active = true;
+        m_call.sequence++;
+        m_call.name   = it->second.name;
+        m_call.start  = start;
+        m_call.thread = pthread_self();
+    }
+
+    return it->second.stats;
+}
+
+void EventLoopProfiler::end_call(sHandlerStats *stats, std::chrono::steady_clock::time_point start)
+{
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    if (m_watchdog.joinable()) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_call.active = false;
+
+        if (duration >= m_stall_threshold) {
+            LOG(WARNING) << "Handler '" << m_call.name << "' blocked the event loop for "
+                         << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()
+                         << " ms";
+        }
+    }
+
+    if (!stats) {
+        return;
+    }
+
+    stats->calls++;
+    stats->total_time += duration;
+    stats->max_time = std::max(stats->max_time, std::chrono::nanoseconds(duration));
+    stats->histogram[histogram_bucket(duration)]++;
+}
+
+void EventLoopProfiler::set_name(int fd, sRegistration &registration, const std::string &name)
+{
+    registration.name  = name.empty() ? "FD (" + std::to_string(fd) + ")" : name;
+    registration.stats = &m_stats[HandlerKey(registration.name, fd)];
+}
+
+void EventLoopProfiler::watchdog()
+{
+    // Check often enough to report a blocking handler soon after it exceeds the threshold
+    auto period = std::max(m_stall_threshold / 4, std::chrono::milliseconds(1));
+
+    // Sequence number of the last call reported, each call is reported once
+    uint64_t reported = 0;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop_condition.wait_for(lock, period, [this]() { return m_stop; })) {
+        if (!m_call.active || m_call.sequence == reported) {
+            continue;
+        }
+
+        auto elapsed = std::chrono::steady_clock::now() - m_call.start;
+        if (elapsed < m_stall_threshold) {
+            continue;
+        }
+
+        reported    = m_call.sequence;
+        auto name   = m_call.name;
+        auto thread = m_call.thread;
+
+        // Don't block the event loop thread while logging
+        lock.unlock();
+
+        LOG(WARNING) << "Handler '" << name << "' has been blocking the event loop for "
+                     << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()
+                     << " ms";
+        log_backtrace(thread);
+
+        lock.lock();
+    }
+}
+
+} // namespace beerocks
@@ -0,0 +1,900 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_event_loop_uring_impl.h>
+
+#include <endian.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+
+#include <easylogging++.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// Multishot receive (Linux 6.0) is the newest io_uring feature used
+#if defined(IORING_RECV_MULTISHOT) && defined(__NR_io_uring_setup)
+#define BEEROCKS_HAVE_IO_URING
+#endif
+
+static std::string get_fd_name_print(std::string name)
+{
+
+    if (name.empty()) {
+        return {};
+    }
+    return name.insert(0, " of '").append("'");
+}
+
+namespace beerocks {
+
+#ifdef BEEROCKS_HAVE_IO_URING
+
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////// Local module definitions //////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Number of entries of the submission queue (the completion queue has twice as many)
+static constexpr unsigned RING_ENTRIES = 256;
+
+// Number of buffers provided to the kernel for multishot receives (must be a power of 2)
+static constexpr unsigned RECV_BUFFER_COUNT = 16;
+
+// Identifier of the group of provided buffers
+static constexpr uint16_t RECV_BUFFER_GROUP = 0;
+
+// Type of request, stored in the 2 lowest bits of the user data of the request
+enum eRequest : uint64_t { POLL = 0, RECV = 1, CANCEL = 2 };
+
+/**
+ * @brief Builds the user data of a request: the registration generation in the upper 32 bits,
+ * and the file descriptor and request type in the lower ones.
+ */
+static uint64_t make_user_data(uint32_t generation, int fd, eRequest request)
+{
+    return (uint64_t(generation) << 32) | ((uint64_t(fd) << 2) & UINT32_MAX) | request;
+}
+
+static int io_uring_setup(unsigned entries, io_uring_params *params)
+{
+    return syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags,
+                          const void *arg, size_t arg_size)
+{
+    return syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, arg_size);
+}
+
+static int io_uring_register(int fd, unsigned opcode, const void *arg, unsigned nr_args)
+{
+    return syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+/**
+ * io_uring instance, with its submission and completion queues mapped from the kernel and the
+ * ring of buffers provided for multishot receives.
+ */
+struct EventLoopUringImpl::sUring {
+    int fd = -1;
+
+    void *sq_ring       = MAP_FAILED;
+    size_t sq_ring_size = 0;
+    void *cq_ring       = MAP_FAILED;
+    size_t cq_ring_size = 0;
+    io_uring_sqe *sqes  = static_cast<io_uring_sqe *>(MAP_FAILED);
+    size_t sqes_size    = 0;
+
+    unsigned *sq_head  = nullptr;
+    unsigned *sq_tail  = nullptr;
+    unsigned *sq_array = nullptr;
+    unsigned sq_mask   = 0;
+    unsigned sq_size   = 0;
+
+    /**
+     * Tail of the submission queue, including the entries not yet made visible to the kernel.
+     */
+    unsigned sq_local_tail = 0;
+
+    unsigned *cq_head  = nullptr;
+    unsigned *cq_tail  = nullptr;
+    unsigned cq_mask   = 0;
+    io_uring_cqe *cqes = nullptr;
+
+    /**
+     * Ring of provided buffers (page aligned, shared with the kernel), set up on first use.
+     */
+    io_uring_buf *buf_ring = static_cast<io_uring_buf *>(MAP_FAILED);
+    uint16_t buf_tail      = 0;
+    std::vector<uint8_t> buffers;
+
+    ~sUring()
+    {
+        if (MAP_FAILED != buf_ring) {
+            munmap(buf_ring, RECV_BUFFER_COUNT * sizeof(io_uring_buf));
+        }
+        if (MAP_FAILED != static_cast<void *>(sqes)) {
+            munmap(sqes, sqes_size);
+        }
+        if (MAP_FAILED != cq_ring && cq_ring != sq_ring) {
+            munmap(cq_ring, cq_ring_size);
+        }
+        if (MAP_FAILED != sq_ring) {
+            munmap(sq_ring, sq_ring_size);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    bool setup()
+    {
+        // Completions are only processed on io_uring_enter(), so there is no need to interrupt
+        // the thread when a request completes (it would fail other blocking calls with EINTR)
+        io_uring_params params = {};
+        params.flags           = IORING_SETUP_COOP_TASKRUN;
+        fd                     = io_uring_setup(RING_ENTRIES, &params);
+        if (fd < 0) {
+            LOG(ERROR) << "Failed creating io_uring: " << strerror(errno);
+            return false;
+        }
+
+        sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+        }
+
+        sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       fd, IORING_OFF_SQ_RING);
+        if (MAP_FAILED == sq_ring) {
+            LOG(ERROR) << "Failed mapping the submission queue: " << strerror(errno);
+            return false;
+        }
+
+        if (single_mmap) {
+            cq_ring = sq_ring;
+        } else {
+            cq_ring = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (MAP_FAILED == cq_ring) {
+                LOG(ERROR) << "Failed mapping the completion queue: " << strerror(errno);
+                return false;
+            }
+        }
+
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        sqes      = static_cast<io_uring_sqe *>(mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+                                                MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (MAP_FAILED == static_cast<void *>(sqes)) {
+            LOG(ERROR) << "Failed mapping the submission queue entries: " << strerror(errno);
+            return false;
+        }
+
+        auto sq       = static_cast<uint8_t *>(sq_ring);
+        sq_head       = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+        sq_tail       = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        sq_array      = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+        sq_mask       = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+        sq_size       = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_entries);
+        sq_local_tail = *sq_tail;
+
+        auto cq = static_cast<uint8_t *>(cq_ring);
+        cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        cq_mask = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        cqes    = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+        return true;
+    }
+
+    /**
+     * @brief Submits the queued requests and optionally waits for completions.
+     *
+     * @param min_complete Number of completions to wait for.
+     * @param timeout Maximum time to wait, or nullptr to wait without limit.
+     * @return Number of requests submitted, or -1 on error (with errno set).
+     */
+    int enter(unsigned min_complete, const __kernel_timespec *timeout)
+    {
+        __atomic_store_n(sq_tail, sq_local_tail, __ATOMIC_RELEASE);
+        unsigned to_submit = sq_local_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+        if (!to_submit && !min_complete) {
+            return 0;
+        }
+
+        unsigned flags = min_complete ? IORING_ENTER_GETEVENTS : 0;
+        if (!timeout) {
+            return io_uring_enter(fd, to_submit, min_complete, flags, nullptr, 0);
+        }
+
+        io_uring_getevents_arg arg = {};
+        arg.ts                     = reinterpret_cast<uintptr_t>(timeout);
+        return io_uring_enter(fd, to_submit, min_complete, flags | IORING_ENTER_EXT_ARG, &arg,
+                              sizeof(arg));
+    }
+
+    /**
+     * @brief Gets a cleared submission queue entry, submitting the queue first if it is full.
+     *
+     * @return The entry on success and nullptr otherwise.
+     */
+    io_uring_sqe *get_sqe()
+    {
+        if (sq_local_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_size) {
+            if (enter(0, nullptr) < 0 ||
+                sq_local_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_size) {
+                return nullptr;
+            }
+        }
+
+        unsigned index = sq_local_tail & sq_mask;
+        auto sqe       = &sqes[index];
+        memset(sqe, 0, sizeof(*sqe));
+        sq_array[index] = index;
+        sq_local_tail++;
+
+        return sqe;
+    }
+
+    bool cq_empty() const { return *cq_head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE); }
+
+    /**
+     * @brief Takes the next completion off the completion queue.
+     *
+     * @param[out] cqe Copy of the completion.
+     * @return true on success and false if the completion queue is empty.
+     */
+    bool get_cqe(io_uring_cqe &cqe)
+    {
+        if (cq_empty()) {
+            return false;
+        }
+        unsigned head = *cq_head;
+        cqe           = cqes[head & cq_mask];
+        __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /**
+     * @brief Registers the ring of provided buffers and fills it, if not already done.
+     *
+     * @return true on success and false otherwise.
+     */
+    bool setup_buffers()
+    {
+        if (MAP_FAILED != buf_ring) {
+            return true;
+        }
+
+        void *ring = mmap(nullptr, RECV_BUFFER_COUNT * sizeof(io_uring_buf),
+                          PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == ring) {
+            LOG(ERROR) << "Failed allocating the provided buffers ring: " << strerror(errno);
+            return false;
+        }
+
+        io_uring_buf_reg reg = {};
+        reg.ring_addr        = reinterpret_cast<uintptr_t>(ring);
+        reg.ring_entries     = RECV_BUFFER_COUNT;
+        reg.bgid             = RECV_BUFFER_GROUP;
+        if (io_uring_register(fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+            LOG(ERROR) << "Failed registering the provided buffers ring: " << strerror(errno);
+            munmap(ring, RECV_BUFFER_COUNT * sizeof(io_uring_buf));
+            return false;
+        }
+
+        buf_ring = static_cast<io_uring_buf *>(ring);
+        buffers.resize(RECV_BUFFER_COUNT * EventLoop::RECV_BUFFER_SIZE);
+        for (uint16_t bid = 0; bid < RECV_BUFFER_COUNT; bid++) {
+            provide_buffer(bid);
+        }
+
+        return true;
+    }
+
+    uint8_t *buffer(uint16_t bid) { return buffers.data() + bid * EventLoop::RECV_BUFFER_SIZE; }
+
+    /**
+     * @brief Gives a buffer (back) to the kernel.
+     */
+    void provide_buffer(uint16_t bid)
+    {
+        auto &buf = buf_ring[buf_tail & (RECV_BUFFER_COUNT - 1)];
+        buf.addr  = reinterpret_cast<uintptr_t>(buffer(bid));
+        buf.len   = EventLoop::RECV_BUFFER_SIZE;
+        buf.bid   = bid;
+        buf_tail++;
+
+        // The ring tail overlays the reserved field of the first buffer
+        __atomic_store_n(&buf_ring[0].resv, buf_tail, __ATOMIC_RELEASE);
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+/////////////////////////////// Implementation ///////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+EventLoopUringImpl::EventLoopUringImpl(std::chrono::milliseconds timeout)
+    : m_uring(std::make_unique<sUring>()), m_timeout(timeout)
+{
+    LOG_IF(!m_uring->setup(), FATAL) << "Failed setting up io_uring";
+}
+
+EventLoopUringImpl::~EventLoopUringImpl()
+{
+    // Delete all the file descriptors in the poll. Closing the io_uring instance afterwards
+    // cancels all the pending requests.
+    LOG(DEBUG) << "Removing " << m_fd_to_registration.size() << " FDs from the event loop";
+
+    while (!m_fd_to_registration.empty()) {
+        int fd = m_fd_to_registration.begin()->first;
+        EventLoopUringImpl::remove_handlers(fd);
+    }
+}
+
+bool EventLoopUringImpl::is_supported()
+{
+    static bool supported = []() {
+        io_uring_params params = {};
+        params.flags           = IORING_SETUP_COOP_TASKRUN;
+        int fd                 = io_uring_setup(2, &params);
+        if (fd < 0) {
+            LOG(INFO) << "io_uring not available: " << strerror(errno);
+            return false;
+        }
+
+        // Multishot receive cannot be probed, but came with the zero-copy send operation
+        std::vector<uint8_t> buffer(sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op));
+        auto probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+        bool ops_supported = false;
+        if (io_uring_register(fd, IORING_REGISTER_PROBE, probe, 256) == 0) {
+            ops_supported = true;
+            for (uint8_t op : {IORING_OP_POLL_ADD, IORING_OP_RECV, IORING_OP_ASYNC_CANCEL,
+                               IORING_OP_SEND_ZC}) {
+                if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                    ops_supported = false;
+                }
+            }
+        }
+        close(fd);
+
+        if (!ops_supported || !(params.features & IORING_FEAT_EXT_ARG)) {
+            LOG(INFO) << "io_uring does not support multishot receive";
+            return false;
+        }
+        return true;
+    }();
+
+    return supported;
+}
+
+/**
+ * @brief Gets the events to poll for a set of event handlers.
+ *
+ * These are the same events as in EventLoopImpl, except for data handlers: their data, end of
+ * file and errors are reported by the multishot receive, so they only need a poll for write
+ * events.
+ *
+ * @return Events to poll for, or 0 if no poll is needed.
+ */
+static uint32_t get_poll_events(const EventLoop::EventHandlers &handlers)
+{
+    uint32_t events = 0;
+    if (!handlers.on_data) {
+        events = POLLRDHUP | POLLERR | POLLHUP;
+        if (handlers.on_read) {
+            events |= POLLIN;
+        }
+        if (handlers.on_write) {
+            events |= POLLOUT;
+        }
+    } else if (handlers.on_write) {
+        events = POLLOUT | POLLERR | POLLHUP;
+    }
+    return events;
+}
+
+bool EventLoopUringImpl::register_handlers(int fd, const EventLoop::EventHandlers &handlers)
+{
+    if (-1 == fd) {
+        LOG(ERROR) << "Invalid file descriptor!";
+        return false;
+    }
+
+    // Make sure that the file descriptor is not already part of the poll
+    if (m_fd_to_registration.find(fd) != m_fd_to_registration.end()) {
+        LOG(WARNING) << "Requested to add FD (" << fd << ") to the poll, but it's already there";
+        return false;
+    }
+
+    LOG(INFO) << "Register handlers for FD (" << fd << ")" << get_fd_name_print(handlers.name);
+
+    if (handlers.on_data && !m_uring->setup_buffers()) {
+        return false;
+    }
+
+    sRegistration registration;
+    registration.handlers   = handlers;
+    registration.generation = m_next_generation++;
+    if (0 == m_next_generation) {
+        m_next_generation = 1;
+    }
+
+    registration.poll_events = get_poll_events(handlers);
+
+    auto &added = m_fd_to_registration[fd] = registration;
+
+    if ((added.poll_events && !arm_poll(fd, added)) || (handlers.on_data && !arm_recv(fd, added))) {
+        LOG(ERROR) << "Failed adding FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                   << " to the poll";
+        remove_handlers(fd);
+        return false;
+    }
+
+    return true;
+}
+
+bool EventLoopUringImpl::remove_handlers(int fd)
+{
+    if (-1 == fd) {
+        LOG(ERROR) << "Invalid file descriptor!";
+        return false;
+    }
+
+    // Make sure that the file descriptor was previously added to the poll
+    const auto &it = m_fd_to_registration.find(fd);
+    if (it == m_fd_to_registration.end()) {
+        LOG(WARNING) << "Requested to delete FD (" << fd
+                     << ") from the poll, but it wasn't previously added.";
+
+        return false;
+    }
+
+    // Cancel the pending requests. Their completions are ignored since the generation of the
+    // registration is gone.
+    auto error = false;
+    for (auto request : {POLL, RECV}) {
+        bool armed = (POLL == request) ? it->second.poll_armed : it->second.recv_armed;
+        if (!armed) {
+            continue;
+        }
+        auto sqe = m_uring->get_sqe();
+        if (!sqe) {
+            error = true;
+            continue;
+        }
+        sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+        sqe->fd        = -1;
+        sqe->addr      = make_user_data(it->second.generation, fd, request);
+        sqe->flags     = IOSQE_CQE_SKIP_SUCCESS;
+        sqe->user_data = make_user_data(0, 0, CANCEL);
+    }
+    if (error) {
+        LOG(ERROR) << "Failed deleting FD (" << fd << ")"
+                   << get_fd_name_print(it->second.handlers.name)
+                   << " from the poll: submission queue full";
+    }
+    LOG(INFO) << "Removed handlers for FD (" << fd << ")"
+              << get_fd_name_print(it->second.handlers.name);
+
+    // Erase the file descriptor from the map
+    m_fd_to_registration.erase(fd);
+
+    return !error;
+}
+
+bool EventLoopUringImpl::set_handler_name(int fd, const std::string &name)
+{
+    auto it = m_fd_to_registration.find(fd);
+    if (it == m_fd_to_registration.end()) {
+        LOG(ERROR) << "Unable to find fd " << fd << " in the registered handlers";
+        return false;
+    }
+
+    it->second.handlers.name = name;
+    return true;
+}
+
+bool EventLoopUringImpl::set_write_handler(int fd, const EventHandler &on_write)
+{
+    auto it = m_fd_to_registration.find(fd);
+    if (it == m_fd_to_registration.end()) {
+        LOG(ERROR) << "Unable to find fd " << fd << " in the registered handlers";
+        return false;
+    }
+
+    auto &registration             = it->second;
+    registration.handlers.on_write = on_write;
+
+    uint32_t poll_events = get_poll_events(registration.handlers);
+    if (poll_events == registration.poll_events) {
+        return true;
+    }
+    registration.poll_events = poll_events;
+
+    // A pending poll request is for the previous events: cancel it, it is armed again with the
+    // new events when its cancellation completes. If it completes first instead, it is armed
+    // again after its events are handled.
+    if (registration.poll_armed) {
+        auto sqe = m_uring->get_sqe();
+        if (!sqe) {
+            LOG(ERROR) << "Failed modifying FD (" << fd << ")"
+                       << get_fd_name_print(registration.handlers.name)
+                       << " in the poll: submission queue full";
+            return false;
+        }
+        sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+        sqe->fd        = -1;
+        sqe->addr      = make_user_data(registration.generation, fd, POLL);
+        sqe->flags     = IOSQE_CQE_SKIP_SUCCESS;
+        sqe->user_data = make_user_data(0, 0, CANCEL);
+        return true;
+    }
+
+    if (poll_events) {
+        return arm_poll(fd, registration);
+    }
+
+    return true;
+}
+
+int EventLoopUringImpl::run()
+{
+    // Deadline of the wait, if the global event loop timeout is set
+    bool has_timeout = m_timeout > std::chrono::milliseconds::zero();
+    auto deadline    = std::chrono::steady_clock::now() + m_timeout;
+
+    int num_events = 0;
+    while (true) {
+        // Trigger event handlers. Completions of removed registrations or of cancellations are
+        // not events, wait again if there were only such completions.
+        io_uring_cqe cqe;
+        while (m_uring->get_cqe(cqe)) {
+            if (!handle_completion(cqe.user_data, cqe.res, cqe.flags, num_events)) {
+                return -1;
+            }
+        }
+        if (num_events > 0) {
+            return num_events;
+        }
+
+        __kernel_timespec timeout = {};
+        if (has_timeout) {
+            auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                deadline - std::chrono::steady_clock::now());
+            if (remaining <= std::chrono::nanoseconds::zero()) {
+                // Timeout... Do nothing
+                return 0;
+            }
+            timeout.tv_sec  = remaining.count() / 1000000000;
+            timeout.tv_nsec = remaining.count() % 1000000000;
+        }
+
+        // Submit the queued requests and wait for completions
+        int ret = m_uring->enter(1, has_timeout ? &timeout : nullptr);
+        int err = errno; // Save errno before any logging
+
+        if (ret < 0) {
+            if (ETIME == err) {
+                // Timeout... Do nothing
+                return 0;
+            }
+            if (EINTR == err) {
+                LOG(INFO) << strerror(err) << " during io_uring_enter";
+                return 0;
+            }
+            // The completion queue overflowed, completions are flushed as they are taken off
+            if (EBUSY == err || EAGAIN == err) {
+                continue;
+            }
+            LOG(ERROR) << "Error during io_uring_enter: " << strerror(err);
+            return -1;
+        }
+
+        // When requests were submitted, io_uring_enter() returns their number even if the wait
+        // was interrupted or timed out
+        if (m_uring->cq_empty()) {
+            return 0;
+        }
+    }
+}
+
+bool EventLoopUringImpl::arm_poll(int fd, sRegistration &registration)
+{
+    auto sqe = m_uring->get_sqe();
+    if (!sqe) {
+        LOG(ERROR) << "Failed polling FD (" << fd << "): submission queue full";
+        return false;
+    }
+
+    uint32_t events = registration.poll_events;
+#if __BYTE_ORDER == __BIG_ENDIAN
+    // The kernel reads the 32-bit events as two swapped 16-bit halves
+    events = (events << 16) | (events >> 16);
+#endif
+
+    sqe->opcode        = IORING_OP_POLL_ADD;
+    sqe->fd            = fd;
+    sqe->poll32_events = events;
+    sqe->user_data     = make_user_data(registration.generation, fd, POLL);
+
+    registration.poll_armed = true;
+    return true;
+}
+
+bool EventLoopUringImpl::arm_recv(int fd, sRegistration &registration)
+{
+    auto sqe = m_uring->get_sqe();
+    if (!sqe) {
+        LOG(ERROR) << "Failed receiving from FD (" << fd << "): submission queue full";
+        return false;
+    }
+
+    sqe->opcode    = IORING_OP_RECV;
+    sqe->fd        = fd;
+    sqe->ioprio    = IORING_RECV_MULTISHOT;
+    sqe->flags     = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = RECV_BUFFER_GROUP;
+    sqe->user_data = make_user_data(registration.generation, fd, RECV);
+
+    registration.recv_armed = true;
+    return true;
+}
+
+bool EventLoopUringImpl::handle_completion(uint64_t user_data, int32_t res, uint32_t flags,
+                                           int &num_events)
+{
+    auto request = static_cast<eRequest>(user_data & 3);
+    if (CANCEL == request) {
+        // Failed cancellations: the request already completed
+        return true;
+    }
+
+    int fd              = (user_data & UINT32_MAX) >> 2;
+    uint32_t generation = user_data >> 32;
+
+    auto it = m_fd_to_registration.find(fd);
+    if (it == m_fd_to_registration.end() || it->second.generation != generation) {
+        // Completion of a request of a removed registration, give its buffer back
+        if (RECV == request && (flags & IORING_CQE_F_BUFFER)) {
+            m_uring->provide_buffer(flags >> IORING_CQE_BUFFER_SHIFT);
+        }
+        return true;
+    }
+
+    if (POLL == request) {
+        return handle_poll(fd, it->second, res, num_events);
+    }
+    return handle_recv(fd, it->second, res, flags, num_events);
+}
+
+bool EventLoopUringImpl::handle_poll(int fd, sRegistration &registration, int32_t res,
+                                     int &num_events)
+{
+    registration.poll_armed = false;
+
+    // Cancelled by set_write_handler(), poll for the new events
+    if (-ECANCELED == res) {
+        if (registration.poll_events) {
+            arm_poll(fd, registration);
+        }
+        return true;
+    }
+
+    uint32_t generation = registration.generation;
+    uint32_t events     = (res < 0) ? POLLERR : res;
+
+    num_events++;
+
+    // Copy by value because it will be destroyed by remove_handlers below.
+    auto handlers = registration.handlers;
+
+    // Handle errors
+    if (events & POLLERR) {
+
+        // Remove the file descriptor from the poll
+        remove_handlers(fd);
+
+        // Call the on_error handler of this file descriptor
+        if (handlers.on_error && (!handlers.on_error(fd, *this))) {
+            LOG(ERROR) << "Error handler on FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                       << " failed";
+            return false;
+        }
+        return true;
+    }
+
+    // Handle disconnected sockets (stream socket peer closed connection)
+    if (events & (POLLRDHUP | POLLHUP)) {
+        LOG(DEBUG) << "Socket with FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                   << " disconnected";
+
+        // Remove the file descriptor from the poll
+        remove_handlers(fd);
+
+        // Call the on_disconnect handler of this file descriptor
+        if (handlers.on_disconnect && (!handlers.on_disconnect(fd, *this))) {
+            LOG(ERROR) << "Disconnect handler on FD (" << fd << ")"
+                       << get_fd_name_print(handlers.name) << " failed";
+            return false;
+        }
+        return true;
+    }
+
+    bool success = true;
+    if (events & (POLLIN | POLLOUT)) {
+        if ((events & POLLIN) && handlers.on_read && (!handlers.on_read(fd, *this))) {
+            LOG(ERROR) << "Read handler on FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                       << " failed";
+            success = false;
+        }
+
+        // Handle write operations, also when data came in at the same time so that writes are
+        // not held back by a busy reader. The read handler might have changed the handlers.
+        auto it = m_fd_to_registration.find(fd);
+        if (success && (events & POLLOUT) && it != m_fd_to_registration.end() &&
+            it->second.generation == generation) {
+            auto on_write = it->second.handlers.on_write;
+            if (on_write && (!on_write(fd, *this))) {
+                LOG(ERROR) << "Write handler on FD (" << fd << ")"
+                           << get_fd_name_print(handlers.name) << " failed";
+                success = false;
+            }
+        }
+    } else {
+        LOG(ERROR) << "FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                   << " generated unknown event: " << events;
+    }
+
+    // Poll again, unless the handler removed the file descriptor from the poll or no longer
+    // needs it
+    auto it = m_fd_to_registration.find(fd);
+    if (it != m_fd_to_registration.end() && it->second.generation == generation &&
+        !it->second.poll_armed && it->second.poll_events) {
+        arm_poll(fd, it->second);
+    }
+
+    return success;
+}
+
+bool EventLoopUringImpl::handle_recv(int fd, sRegistration &registration, int32_t res,
+                                     uint32_t flags, int &num_events)
+{
+    uint32_t generation = registration.generation;
+
+    // The multishot receive ends on errors, and when running out of provided buffers
+    if (!(flags & IORING_CQE_F_MORE)) {
+        registration.recv_armed = false;
+    }
+
+    // Copy by value because it will be destroyed by remove_handlers below.
+    auto handlers = registration.handlers;
+
+    if (res > 0 || -ENOBUFS == res) {
+        bool success = true;
+        if (res > 0) {
+            num_events++;
+
+            uint16_t bid = flags >> IORING_CQE_BUFFER_SHIFT;
+            if (!handlers.on_data(fd, m_uring->buffer(bid), res, *this)) {
+                LOG(ERROR) << "Data handler on FD (" << fd << ")"
+                           << get_fd_name_print(handlers.name) << " failed";
+                success = false;
+            }
+            m_uring->provide_buffer(bid);
+        }
+
+        // Receive again, unless the handler removed the file descriptor from the poll
+        auto it = m_fd_to_registration.find(fd);
+        if (it != m_fd_to_registration.end() && it->second.generation == generation &&
+            !it->second.recv_armed) {
+            arm_recv(fd, it->second);
+        }
+        return success;
+    }
+
+    num_events++;
+
+    // Receive again after a transient error
+    if (res < 0 && is_transient_receive_error(-res)) {
+        LOG(WARNING) << "Failed receiving from FD (" << fd << ")"
+                     << get_fd_name_print(handlers.name) << ": " << strerror(-res);
+        if (!registration.recv_armed) {
+            arm_recv(fd, registration);
+        }
+        return true;
+    }
+
+    // Remove the file descriptor from the poll
+    remove_handlers(fd);
+
+    // End of file on a stream socket
+    if (0 == res) {
+        LOG(DEBUG) << "Socket with FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                   << " disconnected";
+
+        if (handlers.on_disconnect && (!handlers.on_disconnect(fd, *this))) {
+            LOG(ERROR) << "Disconnect handler on FD (" << fd << ")"
+                       << get_fd_name_print(handlers.name) << " failed";
+            return false;
+        }
+        return true;
+    }
+
+    LOG(ERROR) << "Failed receiving from FD (" << fd << ")" << get_fd_name_print(handlers.name)
+               << ": " << strerror(-res);
+
+    if (handlers.on_error && (!handlers.on_error(fd, *this))) {
+        LOG(ERROR) << "Error handler on FD (" << fd << ")" << get_fd_name_print(handlers.name)
+                   << " failed";
+        return false;
+    }
+    return true;
+}
+
+#else // BEEROCKS_HAVE_IO_URING
+
+struct EventLoopUringImpl::sUring {
+};
+
+EventLoopUringImpl::EventLoopUringImpl(std::chrono::milliseconds timeout) : m_timeout(timeout)
+{
+    LOG(FATAL) << "Built without io_uring support";
+}
+
+EventLoopUringImpl::~EventLoopUringImpl() {}
+
+bool EventLoopUringImpl::is_supported() { return false; }
+
+bool EventLoopUringImpl::register_handlers(int fd, const EventLoop::EventHandlers &handlers)
+{
+    return false;
+}
+
+bool EventLoopUringImpl::remove_handlers(int fd) { return false; }
+
+bool EventLoopUringImpl::set_handler_name(int fd, const std::string &name) { return false; }
+
+bool EventLoopUringImpl::set_write_handler(int fd, const EventHandler &on_write) { return false; }
+
+int EventLoopUringImpl::run() { return -1; }
+
+bool EventLoopUringImpl::arm_poll(int fd, sRegistration &registration) { return false; }
+
+bool EventLoopUringImpl::arm_recv(int fd, sRegistration &registration) { return false; }
+
+bool EventLoopUringImpl::handle_completion(uint64_t user_data, int32_t res, uint32_t flags,
+                                           int &num_events)
+{
+    return false;
+}
+
+bool EventLoopUringImpl::handle_poll(int fd, sRegistration &registration, int32_t res,
+                                     int &num_events)
+{
+    return false;
+}
+
+bool EventLoopUringImpl::handle_recv(int fd, sRegistration &registration, int32_t res,
+                                     uint32_t flags, int &num_events)
+{
+    return false;
+}
+
+#endif // BEEROCKS_HAVE_IO_URING
+
+} // namespace beerocks
@@ -0,0 +1,239 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_thread_pool.h>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include <easylogging++.h>
+
+namespace beerocks {
+
+// Pool and index of the worker running in the current thread, if any. Used to post the work
+// created by a task to the queue of its own worker.
+static thread_local const ThreadPool *tl_pool = nullptr;
+static thread_local size_t tl_worker_index    = 0;
+
+ThreadPool::ThreadPool(size_t size, std::shared_ptr<EventLoop> event_loop)
+    : m_event_loop(event_loop)
+{
+    LOG_IF(!m_event_loop, FATAL) << "Event loop is a null pointer!";
+
+    m_completions_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    LOG_IF(m_completions_fd < 0, FATAL) << "Failed creating eventfd: " << strerror(errno);
+
+    EventLoop::EventHandlers handlers{
+        .name = "thread_pool",
+        .on_read =
+            [&](int fd, EventLoop &loop) {
+                handle_completions();
+                return true;
+            },
+        .on_write      = nullptr,
+        .on_disconnect = nullptr,
+        .on_error =
+            [&](int fd, EventLoop &loop) {
+                LOG(ERROR) << "Error on thread pool eventfd!";
+                return false;
+            },
+    };
+    LOG_IF(!m_event_loop->register_handlers(m_completions_fd, handlers), FATAL)
+        << "Failed registering event handlers for the thread pool!";
+
+    if (0 == size) {
+        size = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    // Create all the queues before starting the threads, which steal from each other
+    for (size_t i = 0; i < size; i++) {
+        m_workers.emplace_back(new sWorker);
+    }
+    for (size_t i = 0; i < size; i++) {
+        m_workers[i]->thread = std::thread(&ThreadPool::run_worker, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    m_stop = true;
+    for (auto &worker : m_workers) {
+        // Taking the mutex makes sure that the worker either sees the flag before sleeping or is
+        // already sleeping when notified
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+        }
+        worker->cv.notify_one();
+    }
+
+    for (auto &worker : m_workers) {
+        worker->thread.join();
+    }
+
+    // Cancel the work not started yet and the continuations not run yet
+    size_t cancelled_jobs = 0;
+    for (auto &worker : m_workers) {
+        cancelled_jobs += worker->jobs.size();
+        worker->jobs.clear();
+    }
+    size_t cancelled_continuations = m_completions.size();
+    m_completions.clear();
+
+    LOG_IF(cancelled_jobs > 0 || cancelled_continuations > 0, DEBUG)
+        << "Cancelled " << cancelled_jobs << " jobs and " << cancelled_continuations
+        << " continuations";
+
+    m_event_loop->remove_handlers(m_completions_fd);
+    close(m_completions_fd);
+}
+
+bool ThreadPool::post(const Task &work, const Task &continuation)
+{
+    if (!work) {
+        LOG(ERROR) << "Work is empty!";
+        return false;
+    }
+
+    if (m_stop) {
+        return false;
+    }
+
+    // Work created by a task goes to its own worker, other work is spread round-robin
+    size_t index = (this == tl_pool) ? tl_worker_index : (m_next_worker++ % m_workers.size());
+
+    auto &worker = *m_workers[index];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.jobs.push_back({work, continuation});
+        worker.queued++;
+    }
+
+    // A worker going idle looks at the queued jobs after flagging itself idle (see
+    // wait_for_job()), so either it sees this job or it is seen idle here and woken up
+    if (worker.idle) {
+        worker.cv.notify_one();
+    } else {
+        wake_idle_worker(index);
+    }
+
+    return true;
+}
+
+void ThreadPool::run_worker(size_t index)
+{
+    tl_pool         = this;
+    tl_worker_index = index;
+
+    while (!m_stop) {
+        sJob job;
+        if (!take_job(index, job)) {
+            wait_for_job(index);
+            continue;
+        }
+
+        job.work();
+
+        if (job.continuation) {
+            complete(std::move(job.continuation));
+        }
+    }
+}
+
+bool ThreadPool::take_job(size_t index, sJob &job)
+{
+    // Its own queue first, then the other queues
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        auto &worker = *m_workers[(index + i) % m_workers.size()];
+        if (worker.queued == 0) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.jobs.empty()) {
+            job = std::move(worker.jobs.front());
+            worker.jobs.pop_front();
+            worker.queued--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::wait_for_job(size_t index)
+{
+    auto &worker = *m_workers[index];
+    worker.idle  = true;
+
+    // Jobs queued from now on wake this worker up, look for the ones queued before
+    for (const auto &other : m_workers) {
+        if (other->queued > 0) {
+            worker.idle = false;
+            return;
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    worker.cv.wait(lock, [&]() { return m_stop || !worker.jobs.empty() || worker.wake; });
+    worker.wake = false;
+    worker.idle = false;
+}
+
+void ThreadPool::wake_idle_worker(size_t index)
+{
+    for (size_t i = 1; i < m_workers.size(); i++) {
+        auto &worker = *m_workers[(index + i) % m_workers.size()];
+        if (!worker.idle) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.wake = true;
+        }
+        worker.cv.notify_one();
+        return;
+    }
+}
+
+void ThreadPool::complete(Task &&continuation)
+{
+    std::lock_guard<std::mutex> lock(m_completions_mutex);
+
+    // Wake the event loop up only for the first continuation, the rest are run with it
+    if (m_completions.empty()) {
+        uint64_t counter = 1;
+        if (write(m_completions_fd, &counter, sizeof(counter)) < 0) {
+            LOG(ERROR) << "Failed updating eventfd counter: " << strerror(errno);
+        }
+    }
+    m_completions.push_back(std::move(continuation));
+}
+
+void ThreadPool::handle_completions()
+{
+    uint64_t counter;
+    if (read(m_completions_fd, &counter, sizeof(counter)) < 0 && errno != EAGAIN) {
+        LOG(ERROR) << "Failed reading eventfd counter: " << strerror(errno);
+    }
+
+    std::vector<Task> completions;
+    {
+        std::lock_guard<std::mutex> lock(m_completions_mutex);
+        completions.swap(m_completions);
+    }
+
+    for (auto &continuation : completions) {
+        continuation();
+    }
+}
+
+} // namespace beerocks
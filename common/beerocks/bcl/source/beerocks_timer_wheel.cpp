@@ -0,0 +1,274 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_timer_wheel.h>
+
+#include <easylogging++.h>
+
+#include <algorithm>
+#include <climits>
+
+namespace beerocks {
+
+constexpr int TimerWheel::SLOT_BITS;
+constexpr int TimerWheel::SLOTS;
+constexpr int TimerWheel::LEVELS;
+constexpr int TimerWheel::INVALID_ID;
+constexpr int TimerWheel::OVERFLOW_SLOT;
+constexpr int TimerWheel::NO_SLOT;
+
+/**
+ * Number of ticks spanned by the whole wheel.
+ */
+static constexpr int WHEEL_BITS = TimerWheel::SLOT_BITS * TimerWheel::LEVELS;
+
+void TimerWheel::link(sLink &head, sLink &node)
+{
+    node.prev       = head.prev;
+    node.next       = &head;
+    head.prev->next = &node;
+    head.prev       = &node;
+}
+
+void TimerWheel::unlink(sLink &node)
+{
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    node.prev = node.next = &node;
+}
+
+int TimerWheel::add(const std::string &name, uint64_t expiry, uint64_t period,
+                    const EventLoop::EventHandler &handler)
+{
+    if (!handler) {
+        LOG(ERROR) << "Timer handler is empty!, name = " << name;
+        return INVALID_ID;
+    }
+
+    // Find an identifier not in use, starting after the last one given
+    int id = m_next_id;
+    while (m_timers.find(id) != m_timers.end()) {
+        id = (id == INT_MAX) ? 1 : id + 1;
+        if (id == m_next_id) {
+            LOG(ERROR) << "No timer identifier left!, name = " << name;
+            return INVALID_ID;
+        }
+    }
+    m_next_id = (id == INT_MAX) ? 1 : id + 1;
+
+    auto &timer   = m_timers[id];
+    timer.id      = id;
+    timer.name    = name;
+    timer.expiry  = std::max(expiry, m_now + 1);
+    timer.period  = period;
+    timer.handler = handler;
+    insert(timer);
+
+    return id;
+}
+
+bool TimerWheel::remove(int id)
+{
+    auto it = m_timers.find(id);
+    if (m_timers.end() == it) {
+        return false;
+    }
+
+    detach(it->second);
+
+    // The handler being called is destroyed once it returns
+    if (&it->second == m_firing) {
+        m_firing_removed = true;
+        return true;
+    }
+
+    m_timers.erase(it);
+    return true;
+}
+
+bool TimerWheel::advance(uint64_t tick, EventLoop &loop)
+{
+    bool success = true;
+
+    for (uint64_t next = next_event(); next <= tick; next = next_event()) {
+        m_now = next;
+
+        // Move the timers of the slots starting at the current tick one level down, from the top
+        // level so that the slots they land in are cascaded in turn
+        if ((m_now & ((uint64_t(1) << WHEEL_BITS) - 1)) == 0) {
+            cascade(m_overflow);
+        }
+        for (int level = LEVELS - 1; level > 0; level--) {
+            if (m_now & ((uint64_t(1) << (SLOT_BITS * level)) - 1)) {
+                continue;
+            }
+            int slot = slot_of(m_now, level);
+            if (m_occupied[level] & (uint64_t(1) << slot)) {
+                m_occupied[level] &= ~(uint64_t(1) << slot);
+                cascade(m_slots[level][slot]);
+            }
+        }
+
+        if (!expire(tick, loop)) {
+            success = false;
+        }
+    }
+
+    if (tick > m_now) {
+        m_now = tick;
+    }
+
+    return success;
+}
+
+bool TimerWheel::next_expiry(uint64_t &expiry) const
+{
+    // The first non-empty slot after the current tick, from the lowest level, holds the earliest
+    // timers: each level spans the slots of the levels below it
+    const sLink *head = nullptr;
+    for (int level = 0; level < LEVELS && !head; level++) {
+        uint64_t pending = m_occupied[level] & ~((uint64_t(2) << slot_of(m_now, level)) - 1);
+        if (pending) {
+            head = &m_slots[level][__builtin_ctzll(pending)];
+        }
+    }
+    if (!head) {
+        if (m_overflow.empty()) {
+            return false;
+        }
+        head = &m_overflow;
+    }
+
+    expiry = UINT64_MAX;
+    for (auto node = head->next; node != head; node = node->next) {
+        expiry = std::min(expiry, static_cast<const sTimer *>(node)->expiry);
+    }
+
+    return true;
+}
+
+void TimerWheel::insert(sTimer &timer)
+{
+    for (int level = 0; level < LEVELS; level++) {
+        int shift = SLOT_BITS * (level + 1);
+        if ((timer.expiry >> shift) == (m_now >> shift)) {
+            int slot = slot_of(timer.expiry, level);
+            link(m_slots[level][slot], timer);
+            m_occupied[level] |= uint64_t(1) << slot;
+            timer.slot = level * SLOTS + slot;
+            return;
+        }
+    }
+
+    link(m_overflow, timer);
+    timer.slot = OVERFLOW_SLOT;
+}
+
+void TimerWheel::detach(sTimer &timer)
+{
+    // Timers out of the wheel may still be in the list of timers being expired
+    unlink(timer);
+    if (timer.slot >= 0) {
+        int level = timer.slot / SLOTS;
+        int slot  = timer.slot % SLOTS;
+        if (m_slots[level][slot].empty()) {
+            m_occupied[level] &= ~(uint64_t(1) << slot);
+        }
+    }
+    timer.slot = NO_SLOT;
+}
+
+void TimerWheel::splice(sLink &from, sLink &to)
+{
+    if (from.empty()) {
+        return;
+    }
+    from.next->prev = to.prev;
+    to.prev->next   = from.next;
+    from.prev->next = &to;
+    to.prev         = from.prev;
+    from.prev = from.next = &from;
+}
+
+uint64_t TimerWheel::next_event() const
+{
+    for (int level = 0; level < LEVELS; level++) {
+        uint64_t pending = m_occupied[level] & ~((uint64_t(2) << slot_of(m_now, level)) - 1);
+        if (pending) {
+            int shift = SLOT_BITS * (level + 1);
+            return ((m_now >> shift) << shift) |
+                   (uint64_t(__builtin_ctzll(pending)) << (SLOT_BITS * level));
+        }
+    }
+
+    if (!m_overflow.empty()) {
+        return ((m_now >> WHEEL_BITS) + 1) << WHEEL_BITS;
+    }
+
+    return UINT64_MAX;
+}
+
+void TimerWheel::cascade(sLink &head)
+{
+    sLink pending;
+    splice(head, pending);
+    while (!pending.empty()) {
+        auto &timer = static_cast<sTimer &>(*pending.next);
+        unlink(timer);
+        insert(timer);
+    }
+}
+
+bool TimerWheel::expire(uint64_t target, EventLoop &loop)
+{
+    int slot = slot_of(m_now, 0);
+    if (!(m_occupied[0] & (uint64_t(1) << slot))) {
+        return true;
+    }
+    m_occupied[0] &= ~(uint64_t(1) << slot);
+
+    // Handlers may remove any of the expiring timers, which unlinks them from this list
+    sLink expiring;
+    splice(m_slots[0][slot], expiring);
+    for (auto node = expiring.next; node != &expiring; node = node->next) {
+        static_cast<sTimer *>(node)->slot = NO_SLOT;
+    }
+
+    bool success = true;
+    while (!expiring.empty()) {
+        auto &timer = static_cast<sTimer &>(*expiring.next);
+        unlink(timer);
+
+        // Schedule the next expiration before calling the handler, which may remove the timer
+        if (timer.period) {
+            timer.expiry += timer.period;
+            if (timer.expiry <= target) {
+                uint64_t missed = (target - timer.expiry) / timer.period + 1;
+                timer.expiry += missed * timer.period;
+                LOG(WARNING) << "Timer overrun (number of expirations: " << missed + 1
+                             << "), name = " << timer.name << ", id = " << timer.id;
+            }
+            insert(timer);
+        }
+
+        m_firing         = &timer;
+        m_firing_removed = false;
+        if (!timer.handler(timer.id, loop)) {
+            success = false;
+        }
+        m_firing = nullptr;
+
+        if (m_firing_removed) {
+            m_timers.erase(timer.id);
+        }
+    }
+
+    return success;
+}
+
+} // namespace beerocks
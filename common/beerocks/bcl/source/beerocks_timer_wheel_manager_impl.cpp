@@ -0,0 +1,161 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_timer_wheel_manager_impl.h>
+
+#include <bcl/network/file_descriptor.h>
+
+#include <easylogging++.h>
+
+#include <algorithm>
+
+namespace beerocks {
+
+TimerWheelManagerImpl::TimerWheelManagerImpl(std::shared_ptr<TimerFactory> timer_factory,
+                                             std::shared_ptr<EventLoop> event_loop)
+    : m_timer_factory(timer_factory), m_event_loop(event_loop),
+      m_start(std::chrono::steady_clock::now())
+{
+    LOG_IF(!m_timer_factory, FATAL) << "Timer factory is a null pointer!";
+    LOG_IF(!m_event_loop, FATAL) << "Event loop is a null pointer!";
+}
+
+TimerWheelManagerImpl::~TimerWheelManagerImpl()
+{
+    if (!m_timer) {
+        return;
+    }
+
+    int fd = m_timer->fd();
+
+    if (!m_timer->cancel()) {
+        LOG(ERROR) << "Failed to cancel timer!, fd = " << fd;
+    }
+
+    if (!m_event_loop->remove_handlers(fd)) {
+        LOG(ERROR) << "Failed to remove handlers for the timer!, fd = " << fd;
+    }
+}
+
+int TimerWheelManagerImpl::add_timer(const std::string &timer_name,
+                                     std::chrono::milliseconds delay,
+                                     std::chrono::milliseconds period,
+                                     const EventLoop::EventHandler &handler)
+{
+    // 1.- Create the timer all timers are multiplexed on, on first use
+    if (!m_timer && !create_timer()) {
+        return beerocks::net::FileDescriptor::invalid_descriptor;
+    }
+
+    // 2.- Add the timer to the timing wheel
+    auto zero       = std::chrono::milliseconds::zero();
+    auto current    = now();
+    uint64_t expiry = current + std::max(delay, zero).count();
+    int id          = m_wheel.add(timer_name, expiry, std::max(period, zero).count(), handler);
+    if (TimerWheel::INVALID_ID == id) {
+        LOG(ERROR) << "Failed to add the timer!, name = " << timer_name;
+        return beerocks::net::FileDescriptor::invalid_descriptor;
+    }
+
+    // 3.- Arm the timer if the new timer is the earliest one
+    if (!schedule_timer(current)) {
+        m_wheel.remove(id);
+        return beerocks::net::FileDescriptor::invalid_descriptor;
+    }
+
+    LOG(DEBUG) << "Timer added, id = " << id << ", name = " << timer_name;
+
+    return id;
+}
+
+bool TimerWheelManagerImpl::remove_timer(int &fd)
+{
+    if (!m_wheel.remove(fd)) {
+        LOG(ERROR) << "Timer not found!, id = " << fd;
+        return false;
+    }
+
+    LOG(DEBUG) << "Timer removed, id = " << fd;
+
+    fd = beerocks::net::FileDescriptor::invalid_descriptor;
+
+    return true;
+}
+
+bool TimerWheelManagerImpl::create_timer()
+{
+    auto timer = m_timer_factory->create_instance();
+    if (!timer) {
+        LOG(ERROR) << "Failed to create timer instance!";
+        return false;
+    }
+
+    int fd = timer->fd();
+    if (beerocks::net::FileDescriptor::invalid_descriptor == fd) {
+        LOG(ERROR) << "Failed to create timer descriptor!";
+        return false;
+    }
+
+    EventLoop::EventHandlers handlers{
+        .name    = "Timer wheel",
+        .on_read = [this](int fd, EventLoop &loop) { return handle_read(loop); },
+    };
+
+    if (!m_event_loop->register_handlers(fd, handlers)) {
+        LOG(ERROR) << "Failed to register event handlers for the timer!, fd = " << fd;
+        return false;
+    }
+
+    m_timer = std::move(timer);
+
+    return true;
+}
+
+bool TimerWheelManagerImpl::handle_read(EventLoop &loop)
+{
+    // The number of expirations is irrelevant, the timer is armed as one-shot. On error, advance
+    // the wheel anyway so that the timer is armed again.
+    uint64_t number_of_expirations;
+    m_timer->read(number_of_expirations);
+    m_armed_expiry = UINT64_MAX;
+
+    bool success = m_wheel.advance(now(), loop);
+
+    if (!schedule_timer(now())) {
+        success = false;
+    }
+
+    return success;
+}
+
+bool TimerWheelManagerImpl::schedule_timer(uint64_t now)
+{
+    uint64_t expiry;
+    if (!m_wheel.next_expiry(expiry) || expiry == m_armed_expiry) {
+        return true;
+    }
+
+    // Past expiries (e.g. after handlers that took long) elapse as soon as possible
+    auto delay = std::chrono::milliseconds(expiry > now ? expiry - now : 1);
+    if (!m_timer->schedule(delay, std::chrono::milliseconds::zero())) {
+        LOG(ERROR) << "Failed to schedule the timer!, fd = " << m_timer->fd();
+        return false;
+    }
+    m_armed_expiry = expiry;
+
+    return true;
+}
+
+uint64_t TimerWheelManagerImpl::now() const
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                 m_start)
+        .count();
+}
+
+} // namespace beerocks
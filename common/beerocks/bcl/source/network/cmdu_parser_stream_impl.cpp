@@ -41,33 +41,34 @@ bool CmduParserStreamImpl::parse_cmdu(Buffer &buffer, uint32_t &iface_index, sMa
         return false;
     }
 
-    // Verify and parse the message
-    bool result = false;
-    if (!CmduUtils::verify_cmdu(cmdu_data, cmdu_length)) {
-        LOG(ERROR) << "Failed verifying CMDU!";
+    // Parse the message, which walks and verifies its TLVs. If nothing follows it in the buffer,
+    // or if the buffer does not move the next messages over it when it is shifted, it stays
+    // untouched until the next receive (after the message is handled), so it is parsed in place.
+    // Otherwise it is copied.
+    bool last     = (length == message_length);
+    bool in_place = last || buffer.is_shift_in_place();
+    bool result   = false;
+    if (!(in_place ? cmdu_rx.parse(cmdu_data, cmdu_length)
+                   : cmdu_rx.parseCopy(cmdu_data, cmdu_length))) {
+        LOG(ERROR) << "Failed parsing CMDU!";
         LOG(DEBUG) << "hex_dump (" << cmdu_length << " bytes):" << std::endl
                    << utils::dump_buffer(cmdu_data, cmdu_length);
-    } else if (cmdu_length > cmdu_rx.getMessageBuffLength()) {
-        LOG(ERROR) << "CMDU length (" << cmdu_length << ") is greater than CMDU buffer size ("
-                   << cmdu_rx.getMessageBuffLength() << ")";
+    } else if (!CmduUtils::verify_vendor_specific_tlvs(cmdu_rx)) {
+        LOG(ERROR) << "Failed verifying CMDU!";
     } else {
-        std::copy_n(cmdu_data, cmdu_length, cmdu_rx.getMessageBuff());
-        if (!cmdu_rx.parse()) {
-            LOG(ERROR) << "Failed parsing CMDU!";
-            LOG(DEBUG) << "hex_dump (" << cmdu_length << " bytes):" << std::endl
-                       << utils::dump_buffer(cmdu_data, cmdu_length);
-        } else {
-            iface_index = uds_header->if_index;
-            tlvf::mac_from_array(uds_header->dst_bridge_mac, dst_mac);
-            tlvf::mac_from_array(uds_header->src_bridge_mac, src_mac);
+        iface_index = uds_header->if_index;
+        tlvf::mac_from_array(uds_header->dst_bridge_mac, dst_mac);
+        tlvf::mac_from_array(uds_header->src_bridge_mac, src_mac);
 
-            result = true;
-        }
+        result = true;
     }
 
-    // Shift bytes remaining in buffer (i.e.: consume processed bytes and return bytes not
-    // processed yet, if any)
-    buffer.shift(message_length);
+    // Consume processed bytes and return bytes not processed yet, if any
+    if (last) {
+        buffer.length() = 0;
+    } else {
+        buffer.shift(message_length);
+    }
 
     return result;
 }
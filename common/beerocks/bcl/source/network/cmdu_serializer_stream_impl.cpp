@@ -13,9 +13,18 @@
 namespace beerocks {
 namespace net {
 
-bool CmduSerializerStreamImpl::serialize_cmdu(uint32_t iface_index, const sMacAddr &dst_mac,
-                                              const sMacAddr &src_mac,
-                                              ieee1905_1::CmduMessage &cmdu, Buffer &buffer)
+constexpr size_t CmduSerializer::MAX_HEADER_LENGTH;
+
+static_assert(sizeof(message::sUdsHeader) <= CmduSerializer::MAX_HEADER_LENGTH,
+              "UDS header does not fit into MAX_HEADER_LENGTH");
+
+/**
+ * @brief Fills in the UDS header that precedes a CMDU.
+ *
+ * @return true on success and false if given MAC addresses are not valid.
+ */
+static bool fill_uds_header(uint32_t iface_index, const sMacAddr &dst_mac, const sMacAddr &src_mac,
+                            size_t cmdu_length, message::sUdsHeader &uds_header)
 {
     // If a destination MAC address has been given, then source MAC address must be given too
     if (beerocks::net::network_utils::ZERO_MAC != dst_mac) {
@@ -25,15 +34,32 @@ bool CmduSerializerStreamImpl::serialize_cmdu(uint32_t iface_index, const sMacAd
         }
     }
 
+    uds_header.if_index = iface_index;
+    tlvf::mac_to_array(src_mac, uds_header.src_bridge_mac);
+    tlvf::mac_to_array(dst_mac, uds_header.dst_bridge_mac);
+    uds_header.length = cmdu_length;
+
+    return true;
+}
+
+bool CmduSerializerStreamImpl::serialize_cmdu(uint32_t iface_index, const sMacAddr &dst_mac,
+                                              const sMacAddr &src_mac,
+                                              ieee1905_1::CmduMessage &cmdu, Buffer &buffer)
+{
+    size_t cmdu_length = cmdu.getMessageLength();
+    uint8_t *cmdu_data = cmdu.getMessageBuff();
+
+    message::sUdsHeader uds_header;
+    if (!fill_uds_header(iface_index, dst_mac, src_mac, cmdu_length, uds_header)) {
+        return false;
+    }
+
     // Check if given buffer already contains some data
     if (buffer.length() > 0) {
         LOG(ERROR) << "Buffer is not empty!";
         return false;
     }
 
-    size_t cmdu_length = cmdu.getMessageLength();
-    uint8_t *cmdu_data = cmdu.getMessageBuff();
-
     // Check if serialized data fits into given buffer
     size_t length = sizeof(message::sUdsHeader) + cmdu_length;
     size_t size   = buffer.size();
@@ -42,13 +68,6 @@ bool CmduSerializerStreamImpl::serialize_cmdu(uint32_t iface_index, const sMacAd
         return false;
     }
 
-    // Fill in UDS header
-    message::sUdsHeader uds_header;
-    uds_header.if_index = iface_index;
-    tlvf::mac_to_array(src_mac, uds_header.src_bridge_mac);
-    tlvf::mac_to_array(dst_mac, uds_header.dst_bridge_mac);
-    uds_header.length = cmdu_length;
-
     // Fill in the buffer with header and payload
     if (!buffer.append(reinterpret_cast<uint8_t *>(&uds_header), sizeof(message::sUdsHeader))) {
         LOG(ERROR) << "Failed appending header to the buffer!";
@@ -62,5 +81,28 @@ bool CmduSerializerStreamImpl::serialize_cmdu(uint32_t iface_index, const sMacAd
     return true;
 }
 
+bool CmduSerializerStreamImpl::serialize_header(uint32_t iface_index, const sMacAddr &dst_mac,
+                                                const sMacAddr &src_mac,
+                                                ieee1905_1::CmduMessage &cmdu, Buffer &header)
+{
+    message::sUdsHeader uds_header;
+    if (!fill_uds_header(iface_index, dst_mac, src_mac, cmdu.getMessageLength(), uds_header)) {
+        return false;
+    }
+
+    // Check if given buffer already contains some data
+    if (header.length() > 0) {
+        LOG(ERROR) << "Buffer is not empty!";
+        return false;
+    }
+
+    if (!header.append(reinterpret_cast<uint8_t *>(&uds_header), sizeof(message::sUdsHeader))) {
+        LOG(ERROR) << "Failed appending header to the buffer!";
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace net
 } // namespace beerocks
@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/network/ring_buffer_impl.h>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <easylogging++.h>
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+namespace beerocks {
+namespace net {
+
+/**
+ * @brief Maps the same memory twice, back to back.
+ *
+ * @param size Size of the memory, multiple of the page size.
+ * @return Address of the first mapping (followed by the second one), or nullptr on error.
+ */
+static uint8_t *map_mirrored(size_t size)
+{
+#ifdef __NR_memfd_create
+    // Use the raw system call - memfd_create() is not exposed by all the supported C libraries
+    int fd = syscall(__NR_memfd_create, "ring_buffer", MFD_CLOEXEC);
+    if (fd < 0) {
+        LOG(DEBUG) << "memfd_create failed: " << strerror(errno);
+        return nullptr;
+    }
+
+    if (ftruncate(fd, size) < 0) {
+        LOG(DEBUG) << "ftruncate failed: " << strerror(errno);
+        close(fd);
+        return nullptr;
+    }
+
+    // Reserve the address range of both mappings, and replace it with them
+    void *memory = mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        LOG(DEBUG) << "mmap failed: " << strerror(errno);
+        close(fd);
+        return nullptr;
+    }
+
+    auto first  = static_cast<uint8_t *>(memory);
+    auto second = first + size;
+    if (mmap(first, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(second, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        LOG(DEBUG) << "mmap failed: " << strerror(errno);
+        munmap(memory, 2 * size);
+        close(fd);
+        return nullptr;
+    }
+
+    // The mappings keep the memory alive
+    close(fd);
+
+    return first;
+#else
+    return nullptr;
+#endif
+}
+
+RingBufferImpl::RingBufferImpl(size_t size)
+{
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    m_size           = (std::max(size, size_t(1)) + page_size - 1) / page_size * page_size;
+
+    m_memory = map_mirrored(m_size);
+    if (m_memory) {
+        m_mirrored = true;
+    } else {
+        LOG(DEBUG) << "Mirrored memory not available, contents will be moved on wrap around";
+        m_memory = new uint8_t[2 * m_size]();
+    }
+}
+
+RingBufferImpl::RingBufferImpl(RingBufferImpl &&other)
+    : m_memory(other.m_memory), m_size(other.m_size), m_head(other.m_head),
+      m_length(other.m_length), m_mirrored(other.m_mirrored)
+{
+    other.m_memory = nullptr;
+    other.m_size   = 0;
+    other.m_head   = 0;
+    other.m_length = 0;
+}
+
+RingBufferImpl::~RingBufferImpl()
+{
+    if (!m_memory) {
+        return;
+    }
+
+    if (m_mirrored) {
+        munmap(m_memory, 2 * m_size);
+    } else {
+        delete[] m_memory;
+    }
+}
+
+void RingBufferImpl::clear()
+{
+    m_head   = 0;
+    m_length = 0;
+}
+
+bool RingBufferImpl::append(const uint8_t *data, size_t length)
+{
+    if (m_length + length > m_size) {
+        return false;
+    }
+
+    // Free space is contiguous, as the head is in the first half of the memory
+    std::copy_n(data, length, m_memory + m_head + m_length);
+    m_length += length;
+
+    return true;
+}
+
+bool RingBufferImpl::shift(size_t count)
+{
+    if (count > m_length) {
+        return false;
+    }
+
+    m_head += count;
+    m_length -= count;
+
+    if (m_length == 0) {
+        // Start over at the beginning, so that the next contents do not wrap around
+        m_head = 0;
+    } else if (m_head >= m_size) {
+        if (m_mirrored) {
+            m_head -= m_size;
+        } else {
+            // The remaining bytes fit before the ones just consumed, which are not overwritten
+            std::copy_n(m_memory + m_head, m_length, m_memory);
+            m_head = 0;
+        }
+    }
+
+    return true;
+}
+
+} // namespace net
+} // namespace beerocks
@@ -0,0 +1,143 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/network/send_queue.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <easylogging++.h>
+
+namespace beerocks {
+namespace net {
+
+// Maximum number of queued chunks sent in a single system call
+static constexpr size_t MAX_FLUSH_CHUNKS = 64;
+
+constexpr size_t SendQueue::MAX_LENGTH;
+
+/**
+ * @brief Checks if a send failed only because the socket was not ready for writing.
+ */
+static bool would_block(int error) { return (EAGAIN == error) || (EWOULDBLOCK == error); }
+
+bool SendQueue::send(Socket::Connection &connection, const struct iovec *chunks, size_t count)
+{
+    // Data queued before goes first
+    if (!empty() && !flush(connection)) {
+        return false;
+    }
+
+    size_t length = 0;
+    for (size_t i = 0; i < count; i++) {
+        length += chunks[i].iov_len;
+    }
+
+    size_t sent = 0;
+    if (empty()) {
+        int result = connection.send_vectored(chunks, count);
+        if (result >= 0) {
+            sent = static_cast<size_t>(result);
+        } else if (!would_block(errno)) {
+            LOG(ERROR) << "Failed to send data: " << strerror(errno)
+                       << ", fd = " << connection.socket()->fd();
+            return false;
+        }
+
+        if (sent == length) {
+            return true;
+        }
+    }
+
+    // Queue the bytes not sent
+    if (m_length + length - sent > MAX_LENGTH) {
+        LOG(ERROR) << "Send queue is full (" << m_length << " bytes), dropping " << length - sent
+                   << " bytes, fd = " << connection.socket()->fd();
+        return false;
+    }
+
+    std::vector<uint8_t> chunk;
+    chunk.reserve(length - sent);
+    for (size_t i = 0; i < count; i++) {
+        auto data         = static_cast<const uint8_t *>(chunks[i].iov_base);
+        size_t chunk_sent = std::min(sent, chunks[i].iov_len);
+        chunk.insert(chunk.end(), data + chunk_sent, data + chunks[i].iov_len);
+        sent -= chunk_sent;
+    }
+
+    m_length += chunk.size();
+    m_chunks.push_back(std::move(chunk));
+
+    return true;
+}
+
+bool SendQueue::flush(Socket::Connection &connection)
+{
+    while (!empty()) {
+        struct iovec chunks[MAX_FLUSH_CHUNKS];
+        size_t count  = 0;
+        size_t length = 0;
+        for (auto &chunk : m_chunks) {
+            if (count == MAX_FLUSH_CHUNKS) {
+                break;
+            }
+            size_t offset          = (0 == count) ? m_offset : 0;
+            chunks[count].iov_base = chunk.data() + offset;
+            chunks[count].iov_len  = chunk.size() - offset;
+            length += chunks[count].iov_len;
+            count++;
+        }
+
+        int result = connection.send_vectored(chunks, count);
+        if (result < 0) {
+            if (would_block(errno)) {
+                return true;
+            }
+            LOG(ERROR) << "Failed to send queued data: " << strerror(errno)
+                       << ", fd = " << connection.socket()->fd();
+            return false;
+        }
+
+        consume(result);
+
+        // Socket is full, the rest is sent when it is ready for writing again
+        if (static_cast<size_t>(result) < length) {
+            return true;
+        }
+    }
+
+    return true;
+}
+
+void SendQueue::clear()
+{
+    m_chunks.clear();
+    m_offset = 0;
+    m_length = 0;
+}
+
+void SendQueue::consume(size_t count)
+{
+    m_length -= count;
+
+    while (count > 0) {
+        auto &chunk      = m_chunks.front();
+        size_t remaining = chunk.size() - m_offset;
+        if (count < remaining) {
+            m_offset += count;
+            return;
+        }
+        count -= remaining;
+        m_offset = 0;
+        m_chunks.pop_front();
+    }
+}
+
+} // namespace net
+} // namespace beerocks
@@ -150,11 +150,12 @@ TEST_F(CmduClientImplTest, send_cmdu_should_succeed)
             .WillOnce(DoAll(SaveArg<1>(&connected_socket_handlers), Return(true)));
 
         EXPECT_CALL(*m_cmdu_serializer,
-                    serialize_cmdu(0, beerocks::net::network_utils::ZERO_MAC,
-                                   beerocks::net::network_utils::ZERO_MAC, _, _))
+                    serialize_header(0, beerocks::net::network_utils::ZERO_MAC,
+                                     beerocks::net::network_utils::ZERO_MAC, _, _))
             .WillOnce(Return(true));
 
-        EXPECT_CALL(*m_connection_raw_ptr, send(_)).WillOnce(Return(true));
+        EXPECT_CALL(*m_connection_raw_ptr, send_vectored(_, 2))
+            .WillOnce(Invoke(beerocks::net::SocketConnectionMock::send_all));
     }
 
     beerocks::CmduClientImpl cmdu_client(std::move(m_connection), m_cmdu_parser, m_cmdu_serializer,
@@ -167,6 +168,62 @@ TEST_F(CmduClientImplTest, send_cmdu_should_succeed)
     connected_socket_handlers.on_disconnect(connected_socket_fd, *m_event_loop);
 }
 
+TEST_F(CmduClientImplTest, send_cmdu_should_queue_data_if_socket_is_not_ready)
+{
+    beerocks::EventLoop::EventHandlers connected_socket_handlers;
+    beerocks::EventLoop::EventHandler write_handler;
+    size_t queued_length = 0;
+
+    {
+        InSequence sequence;
+
+        EXPECT_CALL(*m_connection_raw_ptr, socket()).Times(2);
+        EXPECT_CALL(*m_connected_socket, fd()).Times(1);
+        EXPECT_CALL(*m_event_loop, register_handlers(connected_socket_fd, _))
+            .WillOnce(DoAll(SaveArg<1>(&connected_socket_handlers), Return(true)));
+
+        EXPECT_CALL(*m_cmdu_serializer,
+                    serialize_header(0, beerocks::net::network_utils::ZERO_MAC,
+                                     beerocks::net::network_utils::ZERO_MAC, _, _))
+            .WillOnce(Return(true));
+
+        // Socket is not ready for writing, CMDU is queued and the write event is monitored
+        EXPECT_CALL(*m_connection_raw_ptr, send_vectored(_, 2))
+            .WillOnce(Invoke([](const struct iovec *chunks, size_t count) {
+                errno = EAGAIN;
+                return -1;
+            }));
+        EXPECT_CALL(*m_connection_raw_ptr, socket()).Times(1);
+        EXPECT_CALL(*m_connected_socket, fd()).Times(1);
+        EXPECT_CALL(*m_event_loop, set_write_handler(connected_socket_fd, _))
+            .WillOnce(DoAll(SaveArg<1>(&write_handler), Return(true)));
+
+        // Socket is ready for writing, queued data is sent and the write event is not monitored
+        // anymore
+        EXPECT_CALL(*m_connection_raw_ptr, send_vectored(_, 1))
+            .WillOnce(Invoke([&](const struct iovec *chunks, size_t count) {
+                queued_length = chunks[0].iov_len;
+                return beerocks::net::SocketConnectionMock::send_all(chunks, count);
+            }));
+        EXPECT_CALL(*m_event_loop, set_write_handler(connected_socket_fd, _))
+            .WillOnce(Return(true));
+    }
+
+    beerocks::CmduClientImpl cmdu_client(std::move(m_connection), m_cmdu_parser, m_cmdu_serializer,
+                                         m_event_loop);
+
+    // Method `send_cmdu` should succeed even if the socket is not ready for writing
+    ASSERT_TRUE(cmdu_client.send_cmdu(m_cmdu_tx));
+    ASSERT_TRUE(write_handler);
+
+    // Emulate the socket gets ready for writing
+    ASSERT_TRUE(write_handler(connected_socket_fd, *m_event_loop));
+    ASSERT_EQ(queued_length, m_cmdu_tx.getMessageLength());
+
+    // Emulate the server closes the connection
+    connected_socket_handlers.on_disconnect(connected_socket_fd, *m_event_loop);
+}
+
 TEST_F(CmduClientImplTest, send_cmdu_should_fail_with_invalid_cmdu)
 {
     beerocks::EventLoop::EventHandlers connected_socket_handlers;
@@ -193,7 +250,7 @@ TEST_F(CmduClientImplTest, send_cmdu_should_fail_with_invalid_cmdu)
     connected_socket_handlers.on_disconnect(connected_socket_fd, *m_event_loop);
 }
 
-TEST_F(CmduClientImplTest, send_cmdu_should_fail_if_serialize_cmdu_fails)
+TEST_F(CmduClientImplTest, send_cmdu_should_fail_if_serialize_header_fails)
 {
     beerocks::EventLoop::EventHandlers connected_socket_handlers;
 
@@ -207,8 +264,8 @@ TEST_F(CmduClientImplTest, send_cmdu_should_fail_if_serialize_cmdu_fails)
 
         // Serialization fails!
         EXPECT_CALL(*m_cmdu_serializer,
-                    serialize_cmdu(0, beerocks::net::network_utils::ZERO_MAC,
-                                   beerocks::net::network_utils::ZERO_MAC, _, _))
+                    serialize_header(0, beerocks::net::network_utils::ZERO_MAC,
+                                     beerocks::net::network_utils::ZERO_MAC, _, _))
             .WillOnce(Return(false));
 
         EXPECT_CALL(*m_connection_raw_ptr, socket()).Times(1);
@@ -13,6 +13,7 @@
 #include <bcl/beerocks_message_structs.h>
 #include <bcl/network/buffer_mock.h>
 #include <bcl/network/net_struct.h>
+#include <bcl/network/ring_buffer_impl.h>
 
 #include <tlvf/CmduMessageTx.h>
 #include <tlvf/ieee_1905_1/eMessageType.h>
@@ -89,7 +90,7 @@ TEST_F(CmduParserStreamImplTest, parse_cmdu_should_fail_with_invalid_message)
     uds_header.length = 1;
 
     // Message is invalid (one byte length only)
-    const size_t length = size_of_uds_header + uds_header.length;
+    size_t length = size_of_uds_header + uds_header.length;
 
     uint8_t data[size_of_uds_header + uds_header.length];
     std::copy_n(reinterpret_cast<uint8_t *>(&uds_header), size_of_uds_header, data);
@@ -100,10 +101,13 @@ TEST_F(CmduParserStreamImplTest, parse_cmdu_should_fail_with_invalid_message)
 
         EXPECT_CALL(m_buffer, length()).WillOnce(ReturnRef(length));
         EXPECT_CALL(m_buffer, data()).WillOnce(Return(data));
-        EXPECT_CALL(m_buffer, shift(length)).Times(1);
+        EXPECT_CALL(m_buffer, length()).WillOnce(ReturnRef(length));
     }
 
     ASSERT_FALSE(m_parser.parse_cmdu(m_buffer, m_iface_index, m_dst_mac, m_src_mac, m_cmdu_rx));
+
+    // Invalid message has been consumed
+    ASSERT_EQ(length, 0U);
 }
 
 TEST_F(CmduParserStreamImplTest, parse_cmdu_should_succeed)
@@ -124,7 +128,7 @@ TEST_F(CmduParserStreamImplTest, parse_cmdu_should_succeed)
     tlvf::mac_to_array(expected_src_mac, uds_header.src_bridge_mac);
     uds_header.length = cmdu_tx.getMessageLength();
 
-    const size_t length = size_of_uds_header + uds_header.length;
+    size_t length = size_of_uds_header + uds_header.length;
 
     uint8_t data[size_of_uds_header + uds_header.length];
     std::copy_n(reinterpret_cast<uint8_t *>(&uds_header), size_of_uds_header, data);
@@ -135,7 +139,7 @@ TEST_F(CmduParserStreamImplTest, parse_cmdu_should_succeed)
 
         EXPECT_CALL(m_buffer, length()).WillOnce(ReturnRef(length));
         EXPECT_CALL(m_buffer, data()).WillOnce(Return(data));
-        EXPECT_CALL(m_buffer, shift(length)).Times(1);
+        EXPECT_CALL(m_buffer, length()).WillOnce(ReturnRef(length));
     }
 
     ASSERT_TRUE(m_parser.parse_cmdu(m_buffer, m_iface_index, m_dst_mac, m_src_mac, m_cmdu_rx));
@@ -143,5 +147,74 @@ TEST_F(CmduParserStreamImplTest, parse_cmdu_should_succeed)
     ASSERT_EQ(m_dst_mac, expected_dst_mac);
     ASSERT_EQ(m_src_mac, expected_src_mac);
     ASSERT_EQ(cmdu_tx.getMessageType(), m_cmdu_rx.getMessageType());
+
+    // Last message in the buffer is parsed in place, and consumed without shifting the buffer
+    ASSERT_EQ(m_cmdu_rx.getMessageBuff(), data + size_of_uds_header);
+    ASSERT_EQ(length, 0U);
+}
+
+TEST_F(CmduParserStreamImplTest, parse_cmdu_should_copy_message_followed_by_another)
+{
+    uint8_t tx_buffer[beerocks::message::MESSAGE_BUFFER_LENGTH];
+    ieee1905_1::CmduMessageTx cmdu_tx(tx_buffer, sizeof(tx_buffer));
+
+    cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_QUERY_MESSAGE);
+    cmdu_tx.finalize();
+
+    beerocks::message::sUdsHeader uds_header;
+    uds_header.length = cmdu_tx.getMessageLength();
+
+    const size_t message_length = size_of_uds_header + uds_header.length;
+
+    // Buffer holds the message and the first byte of the next one
+    const size_t length = message_length + 1;
+
+    uint8_t data[message_length + 1];
+    std::copy_n(reinterpret_cast<uint8_t *>(&uds_header), size_of_uds_header, data);
+    std::copy_n(tx_buffer, uds_header.length, data + size_of_uds_header);
+    data[message_length] = 0;
+
+    {
+        InSequence sequence;
+
+        EXPECT_CALL(m_buffer, length()).WillOnce(ReturnRef(length));
+        EXPECT_CALL(m_buffer, data()).WillOnce(Return(data));
+        EXPECT_CALL(m_buffer, shift(message_length)).Times(1);
+    }
+
+    ASSERT_TRUE(m_parser.parse_cmdu(m_buffer, m_iface_index, m_dst_mac, m_src_mac, m_cmdu_rx));
+    ASSERT_EQ(cmdu_tx.getMessageType(), m_cmdu_rx.getMessageType());
+    ASSERT_EQ(m_cmdu_rx.getMessageBuff(), m_rx_buffer);
+}
+
+TEST_F(CmduParserStreamImplTest, parse_cmdu_should_parse_in_place_if_shift_is_in_place)
+{
+    uint8_t tx_buffer[beerocks::message::MESSAGE_BUFFER_LENGTH];
+    ieee1905_1::CmduMessageTx cmdu_tx(tx_buffer, sizeof(tx_buffer));
+
+    cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_QUERY_MESSAGE);
+    cmdu_tx.finalize();
+
+    beerocks::message::sUdsHeader uds_header;
+    uds_header.length = cmdu_tx.getMessageLength();
+
+    // Buffer holds two messages
+    beerocks::net::RingBufferImpl buffer(beerocks::message::MESSAGE_BUFFER_LENGTH);
+    for (int i = 0; i < 2; i++) {
+        ASSERT_TRUE(
+            buffer.append(reinterpret_cast<uint8_t *>(&uds_header), size_of_uds_header));
+        ASSERT_TRUE(buffer.append(tx_buffer, uds_header.length));
+    }
+
+    // Both messages are parsed where they were received, also the one followed by another
+    for (int i = 0; i < 2; i++) {
+        const uint8_t *cmdu_data = buffer.data() + size_of_uds_header;
+
+        ASSERT_TRUE(m_parser.parse_cmdu(buffer, m_iface_index, m_dst_mac, m_src_mac, m_cmdu_rx));
+        ASSERT_EQ(cmdu_tx.getMessageType(), m_cmdu_rx.getMessageType());
+        ASSERT_EQ(m_cmdu_rx.getMessageBuff(), cmdu_data);
+    }
+
+    ASSERT_EQ(0U, buffer.length());
 }
 } // namespace
@@ -141,4 +141,42 @@ TEST_F(CmduSerializerStreamImplTest, serialize_cmdu_should_succeed)
     ASSERT_EQ(uds_header->length, cmdu_tx.getMessageLength());
 }
 
+TEST_F(CmduSerializerStreamImplTest, serialize_header_should_succeed)
+{
+    sMacAddr dst_mac = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
+    sMacAddr src_mac = {0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+
+    uint8_t tx_buffer[beerocks::message::MESSAGE_BUFFER_LENGTH];
+    ieee1905_1::CmduMessageTx cmdu_tx(tx_buffer, sizeof(tx_buffer));
+
+    cmdu_tx.create(0, ieee1905_1::eMessageType::TOPOLOGY_QUERY_MESSAGE);
+
+    uint8_t actual_data[beerocks::net::CmduSerializer::MAX_HEADER_LENGTH]{};
+    size_t actual_length = 0;
+    auto actual_append   = [&](const uint8_t *data, size_t length) {
+        std::copy_n(data, length, &actual_data[actual_length]);
+        actual_length += length;
+        return true;
+    };
+
+    {
+        InSequence sequence;
+
+        EXPECT_CALL(m_buffer, length()).WillOnce(ReturnRef(actual_length));
+        EXPECT_CALL(m_buffer, append(_, size_of_uds_header)).WillOnce(Invoke(actual_append));
+    }
+
+    ASSERT_TRUE(m_serializer.serialize_header(iface_index, dst_mac, src_mac, cmdu_tx, m_buffer));
+    ASSERT_EQ(actual_length, size_of_uds_header);
+
+    // Payload is not serialized, but its length is in the header
+    auto uds_header = reinterpret_cast<beerocks::message::sUdsHeader *>(actual_data);
+    ASSERT_EQ(uds_header->if_index, iface_index);
+    ASSERT_TRUE(std::equal(dst_mac.oct, dst_mac.oct + beerocks::net::MAC_ADDR_LEN,
+                           uds_header->dst_bridge_mac));
+    ASSERT_TRUE(std::equal(src_mac.oct, src_mac.oct + beerocks::net::MAC_ADDR_LEN,
+                           uds_header->src_bridge_mac));
+    ASSERT_EQ(uds_header->length, cmdu_tx.getMessageLength());
+}
+
 } // namespace
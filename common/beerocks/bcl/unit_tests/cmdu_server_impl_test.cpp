@@ -218,11 +218,12 @@ TEST_F(CmduServerImplTest, send_cmdu_should_succeed)
             .WillOnce(DoAll(SaveArg<1>(&connected_socket_handlers), Return(true)));
 
         EXPECT_CALL(*m_cmdu_serializer,
-                    serialize_cmdu(0, beerocks::net::network_utils::ZERO_MAC,
-                                   beerocks::net::network_utils::ZERO_MAC, _, _))
+                    serialize_header(0, beerocks::net::network_utils::ZERO_MAC,
+                                     beerocks::net::network_utils::ZERO_MAC, _, _))
             .WillOnce(Return(true));
 
-        EXPECT_CALL(*m_connection, send(_)).WillOnce(Return(true));
+        EXPECT_CALL(*m_connection, send_vectored(_, 2))
+            .WillOnce(Invoke(beerocks::net::SocketConnectionMock::send_all));
 
         EXPECT_CALL(*m_server_socket, socket()).Times(1);
         EXPECT_CALL(*m_socket, fd()).Times(1);
@@ -283,7 +284,7 @@ TEST_F(CmduServerImplTest, send_cmdu_should_fail_with_invalid_cmdu)
     connected_socket_handlers.on_disconnect(connected_socket_fd, *m_event_loop);
 }
 
-TEST_F(CmduServerImplTest, send_cmdu_should_fail_if_serialize_cmdu_fails)
+TEST_F(CmduServerImplTest, send_cmdu_should_fail_if_serialize_header_fails)
 {
     beerocks::EventLoop::EventHandlers server_socket_handlers;
     beerocks::EventLoop::EventHandlers connected_socket_handlers;
@@ -305,8 +306,8 @@ TEST_F(CmduServerImplTest, send_cmdu_should_fail_if_serialize_cmdu_fails)
 
         // Serialization fails!
         EXPECT_CALL(*m_cmdu_serializer,
-                    serialize_cmdu(0, beerocks::net::network_utils::ZERO_MAC,
-                                   beerocks::net::network_utils::ZERO_MAC, _, _))
+                    serialize_header(0, beerocks::net::network_utils::ZERO_MAC,
+                                     beerocks::net::network_utils::ZERO_MAC, _, _))
             .WillOnce(Return(false));
         EXPECT_CALL(*m_connection, socket()).Times(1);
         EXPECT_CALL(*m_connected_socket, fd()).Times(1);
@@ -391,10 +392,11 @@ TEST_F(CmduServerImplTest, forward_cmdu_should_succeed)
         EXPECT_CALL(*m_event_loop, register_handlers(connected_socket_fd, _))
             .WillOnce(DoAll(SaveArg<1>(&connected_socket_handlers), Return(true)));
 
-        EXPECT_CALL(*m_cmdu_serializer, serialize_cmdu(iface_index, dst_mac, src_mac, _, _))
+        EXPECT_CALL(*m_cmdu_serializer, serialize_header(iface_index, dst_mac, src_mac, _, _))
             .WillOnce(Return(true));
 
-        EXPECT_CALL(*m_connection, send(_)).WillOnce(Return(true));
+        EXPECT_CALL(*m_connection, send_vectored(_, 2))
+            .WillOnce(Invoke(beerocks::net::SocketConnectionMock::send_all));
 
         EXPECT_CALL(*m_server_socket, socket()).Times(1);
         EXPECT_CALL(*m_socket, fd()).Times(1);
@@ -104,3 +104,79 @@ TEST(beerocks_event_loop_impl, simple_read_write)
     close(writer_fd);
     close(reader_fd);
 }
+
+TEST(beerocks_event_loop_impl, data_handler)
+{
+    EventLoopImpl loop;
+    StrictMock<EventHandlersMock> reader;
+
+    std::string received;
+    reader.on_read  = nullptr;
+    reader.on_write = nullptr;
+    reader.on_data  = [&](int fd, uint8_t *data, size_t length, EventLoop &loop) {
+        received.append(reinterpret_cast<const char *>(data), length);
+        return true;
+    };
+
+    int sv[2];
+    int rc = socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+    ASSERT_NE(-1, rc);
+
+    int writer_fd = sv[0];
+    int reader_fd = sv[1];
+
+    // The data is received by the loop itself, end of file is a disconnection
+    EXPECT_CALL(reader, handle_disconnect(reader_fd, &loop)).WillOnce(::testing::Return(true));
+
+    ASSERT_TRUE(loop.register_handlers(reader_fd, reader));
+
+    ASSERT_EQ(4, send(writer_fd, "ABCD", 4, 0));
+    ASSERT_EQ(1, loop.run());
+    ASSERT_EQ("ABCD", received);
+
+    close(writer_fd);
+    ASSERT_EQ(1, loop.run());
+
+    // Removed on disconnection
+    ASSERT_FALSE(loop.remove_handlers(reader_fd));
+
+    close(reader_fd);
+}
+
+TEST(beerocks_event_loop_impl, set_write_handler)
+{
+    EventLoopImpl loop(std::chrono::milliseconds(10));
+    StrictMock<EventHandlersMock> writer;
+
+    // Write events are not monitored until a write handler is set
+    auto on_write   = writer.on_write;
+    writer.on_write = nullptr;
+
+    int sv[2];
+    int rc = socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+    ASSERT_NE(-1, rc);
+
+    int writer_fd = sv[0];
+
+    ASSERT_TRUE(loop.register_handlers(writer_fd, writer));
+    ASSERT_EQ(0, loop.run());
+
+    // Write handler stops monitoring write events once called
+    EXPECT_CALL(writer, handle_write(writer_fd, &loop))
+        .WillOnce(Invoke([](int fd, EventLoop *loop) -> bool {
+            EXPECT_TRUE(loop->set_write_handler(fd, nullptr));
+            return true;
+        }));
+
+    ASSERT_TRUE(loop.set_write_handler(writer_fd, on_write));
+    ASSERT_EQ(1, loop.run());
+    ASSERT_EQ(0, loop.run());
+
+    // Unknown file descriptor
+    ASSERT_FALSE(loop.set_write_handler(sv[1], nullptr));
+
+    ASSERT_TRUE(loop.remove_handlers(writer_fd));
+
+    close(sv[0]);
+    close(sv[1]);
+}
@@ -0,0 +1,184 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_event_loop_profiler.h>
+
+#include <bcl/beerocks_event_loop_impl.h>
+
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <numeric>
+#include <thread>
+
+namespace {
+
+class EventLoopProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override { ASSERT_NE(-1, socketpair(AF_UNIX, SOCK_STREAM, 0, m_sv)); }
+
+    void TearDown() override
+    {
+        for (int fd : m_sv) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    /**
+     * @brief Builds handlers that read one byte on each read event.
+     */
+    beerocks::EventLoop::EventHandlers reader(const std::string &name,
+                                              std::chrono::milliseconds delay)
+    {
+        beerocks::EventLoop::EventHandlers handlers;
+        handlers.name    = name;
+        handlers.on_read = [this, delay](int fd, beerocks::EventLoop &loop) {
+            // Handlers are given the profiler, so that they use it to register other handlers
+            EXPECT_EQ(&loop, m_profiler.get());
+            char dummy;
+            EXPECT_EQ(1, read(fd, &dummy, 1));
+            std::this_thread::sleep_for(delay);
+            return true;
+        };
+        handlers.on_disconnect = [this](int fd, beerocks::EventLoop &loop) {
+            m_disconnected = true;
+            return true;
+        };
+        return handlers;
+    }
+
+    int m_sv[2] = {-1, -1};
+    std::shared_ptr<beerocks::EventLoopProfiler> m_profiler;
+    bool m_disconnected = false;
+};
+
+TEST_F(EventLoopProfilerTest, handler_calls_should_be_measured)
+{
+    m_profiler = std::make_shared<beerocks::EventLoopProfiler>(
+        std::make_shared<beerocks::EventLoopImpl>(), std::chrono::milliseconds::zero());
+
+    int writer_fd = m_sv[0];
+    int reader_fd = m_sv[1];
+
+    ASSERT_TRUE(m_profiler->register_handlers(reader_fd, reader("reader", {})));
+
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(1, send(writer_fd, "X", 1, 0));
+        ASSERT_EQ(1, m_profiler->run());
+    }
+
+    EXPECT_EQ(3U, m_profiler->get_runs());
+    EXPECT_EQ(3U, m_profiler->get_wakeups());
+
+    const auto &stats = m_profiler->get_stats();
+    ASSERT_EQ(1U, stats.count({"reader", reader_fd}));
+    const auto &reader_stats = stats.at({"reader", reader_fd});
+    EXPECT_EQ(3U, reader_stats.calls);
+    EXPECT_LE(reader_stats.max_time, reader_stats.total_time);
+    EXPECT_EQ(3U, std::accumulate(reader_stats.histogram.begin(), reader_stats.histogram.end(),
+                                  uint64_t(0)));
+    EXPECT_NE(std::string::npos,
+              m_profiler->to_string().find("'reader' fd=" + std::to_string(reader_fd)));
+
+    m_profiler->reset();
+    EXPECT_EQ(0U, stats.at({"reader", reader_fd}).calls);
+    EXPECT_EQ(0U, m_profiler->get_runs());
+
+    ASSERT_TRUE(m_profiler->remove_handlers(reader_fd));
+}
+
+TEST_F(EventLoopProfilerTest, handlers_should_be_profiled_by_name)
+{
+    m_profiler = std::make_shared<beerocks::EventLoopProfiler>(
+        std::make_shared<beerocks::EventLoopImpl>(), std::chrono::milliseconds::zero());
+
+    int writer_fd = m_sv[0];
+    int reader_fd = m_sv[1];
+
+    // Handlers without a name are profiled by file descriptor
+    ASSERT_TRUE(m_profiler->register_handlers(reader_fd, reader("", {})));
+    ASSERT_EQ(1, send(writer_fd, "X", 1, 0));
+    ASSERT_EQ(1, m_profiler->run());
+
+    ASSERT_TRUE(m_profiler->set_handler_name(reader_fd, "renamed"));
+    ASSERT_EQ(1, send(writer_fd, "X", 1, 0));
+    ASSERT_EQ(1, m_profiler->run());
+
+    const auto &stats = m_profiler->get_stats();
+    EXPECT_EQ(1U, stats.at({"FD (" + std::to_string(reader_fd) + ")", reader_fd}).calls);
+    EXPECT_EQ(1U, stats.at({"renamed", reader_fd}).calls);
+
+    // Disconnected sockets are removed by the event loop
+    close(writer_fd);
+    m_sv[0] = -1;
+    ASSERT_EQ(1, m_profiler->run());
+    EXPECT_TRUE(m_disconnected);
+    EXPECT_EQ(2U, stats.at({"renamed", reader_fd}).calls);
+    EXPECT_FALSE(m_profiler->remove_handlers(reader_fd));
+}
+
+TEST_F(EventLoopProfilerTest, handlers_with_same_name_should_be_profiled_by_fd)
+{
+    m_profiler = std::make_shared<beerocks::EventLoopProfiler>(
+        std::make_shared<beerocks::EventLoopImpl>(), std::chrono::milliseconds::zero());
+
+    // Both ends of the socket pair read with handlers of the same name
+    ASSERT_TRUE(m_profiler->register_handlers(m_sv[0], reader("client", {})));
+    ASSERT_TRUE(m_profiler->register_handlers(m_sv[1], reader("client", {})));
+
+    ASSERT_EQ(1, send(m_sv[0], "X", 1, 0));
+    ASSERT_EQ(1, m_profiler->run());
+    for (int i = 0; i < 2; i++) {
+        ASSERT_EQ(1, send(m_sv[1], "X", 1, 0));
+        ASSERT_EQ(1, m_profiler->run());
+    }
+
+    const auto &stats = m_profiler->get_stats();
+    EXPECT_EQ(2U, stats.size());
+    EXPECT_EQ(2U, stats.at({"client", m_sv[0]}).calls);
+    EXPECT_EQ(1U, stats.at({"client", m_sv[1]}).calls);
+
+    auto text = m_profiler->to_string();
+    EXPECT_NE(std::string::npos, text.find("'client' fd=" + std::to_string(m_sv[0])));
+    EXPECT_NE(std::string::npos, text.find("'client' fd=" + std::to_string(m_sv[1])));
+
+    ASSERT_TRUE(m_profiler->remove_handlers(m_sv[0]));
+    ASSERT_TRUE(m_profiler->remove_handlers(m_sv[1]));
+}
+
+TEST_F(EventLoopProfilerTest, blocking_handler_should_be_measured)
+{
+    constexpr auto threshold = std::chrono::milliseconds(10);
+    constexpr auto delay     = std::chrono::milliseconds(50);
+
+    m_profiler = std::make_shared<beerocks::EventLoopProfiler>(
+        std::make_shared<beerocks::EventLoopImpl>(), threshold);
+
+    int writer_fd = m_sv[0];
+    int reader_fd = m_sv[1];
+
+    // The watchdog reports the handler (with a backtrace) while it blocks
+    ASSERT_TRUE(m_profiler->register_handlers(reader_fd, reader("blocking", delay)));
+    ASSERT_EQ(1, send(writer_fd, "X", 1, 0));
+    ASSERT_EQ(1, m_profiler->run());
+
+    const auto &blocking_stats = m_profiler->get_stats().at({"blocking", reader_fd});
+    EXPECT_EQ(1U, blocking_stats.calls);
+    EXPECT_LE(delay, blocking_stats.max_time);
+
+    // From 32768 to 65536 microseconds
+    EXPECT_EQ(1U, blocking_stats.histogram[16]);
+
+    ASSERT_TRUE(m_profiler->remove_handlers(reader_fd));
+}
+
+} // namespace
@@ -0,0 +1,285 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_event_loop_uring_impl.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <functional>
+#include <thread>
+
+using namespace beerocks;
+
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::StrictMock;
+
+namespace {
+
+/**
+ * @brief Mockable event handlers class
+ */
+class UringEventHandlersMock : public EventLoop::EventHandlers {
+
+public:
+    UringEventHandlersMock()
+    {
+        on_read       = [&](int fd, EventLoop &loop) { return handle_read(fd, &loop); };
+        on_write      = [&](int fd, EventLoop &loop) { return handle_write(fd, &loop); };
+        on_disconnect = [&](int fd, EventLoop &loop) { return handle_disconnect(fd, &loop); };
+        on_error      = [&](int fd, EventLoop &loop) { return handle_error(fd, &loop); };
+    }
+
+    MOCK_METHOD(bool, handle_read, (int fd, EventLoop *));
+    MOCK_METHOD(bool, handle_write, (int fd, EventLoop *));
+    MOCK_METHOD(bool, handle_disconnect, (int fd, EventLoop *));
+    MOCK_METHOD(bool, handle_error, (int fd, EventLoop *));
+};
+
+class EventLoopUringImplTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        bool supported = false;
+        run_in_thread([&]() { supported = EventLoopUringImpl::is_supported(); });
+        if (!supported) {
+            GTEST_SKIP() << "io_uring is not supported by the running kernel";
+        }
+        ASSERT_NE(-1, socketpair(AF_UNIX, SOCK_STREAM, 0, m_sv));
+    }
+
+    void TearDown() override
+    {
+        for (int fd : m_sv) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    /**
+     * @brief Runs a test body in its own thread.
+     *
+     * Closing an io_uring instance makes the kernel interrupt the thread that used it (blocking
+     * system calls fail with EINTR), which would disturb the tests run next in this thread.
+     */
+    void run_in_thread(const std::function<void()> &body) { std::thread(body).join(); }
+
+    int m_sv[2] = {-1, -1};
+};
+
+TEST_F(EventLoopUringImplTest, simple_read_write)
+{
+    run_in_thread([&]() {
+        EventLoopUringImpl loop;
+        StrictMock<UringEventHandlersMock> reader;
+        StrictMock<UringEventHandlersMock> writer;
+
+        // Disable the on_write handler (to prevent the loop from firing "write ready" events)
+        reader.on_write = nullptr;
+
+        int writer_fd = m_sv[0];
+        int reader_fd = m_sv[1];
+
+        {
+            InSequence sequence;
+
+            EXPECT_CALL(writer, handle_write(writer_fd, &loop))
+                .WillOnce(Invoke([](int fd, EventLoop *loop) -> bool {
+                    // Send a dummy byte and remove the socket from the loop
+                    EXPECT_EQ(1, send(fd, "X", 1, 0));
+                    EXPECT_TRUE(loop->remove_handlers(fd));
+                    return true;
+                }));
+
+            EXPECT_CALL(reader, handle_read(reader_fd, &loop))
+                .WillOnce(Invoke([](int fd, EventLoop *loop) -> bool {
+                    char dummy;
+                    EXPECT_EQ(1, read(fd, &dummy, 1));
+                    return true;
+                }));
+        };
+
+        ASSERT_TRUE(loop.register_handlers(writer_fd, writer));
+        ASSERT_TRUE(loop.register_handlers(reader_fd, reader));
+
+        // The read event may complete while the write event is handled, and be reported with it
+        int num_events = 0;
+        while (num_events < 2) {
+            int events = loop.run();
+            ASSERT_LT(0, events);
+            num_events += events;
+        }
+        ASSERT_EQ(2, num_events);
+
+        ASSERT_TRUE(loop.remove_handlers(reader_fd));
+    });
+}
+
+TEST_F(EventLoopUringImplTest, read_events_should_be_level_triggered)
+{
+    run_in_thread([&]() {
+        EventLoopUringImpl loop;
+        StrictMock<UringEventHandlersMock> reader;
+        reader.on_write = nullptr;
+
+        int writer_fd = m_sv[0];
+        int reader_fd = m_sv[1];
+
+        // One byte read per event, the second byte still pending triggers another event
+        EXPECT_CALL(reader, handle_read(reader_fd, &loop))
+            .Times(2)
+            .WillRepeatedly(Invoke([](int fd, EventLoop *loop) -> bool {
+                char dummy;
+                EXPECT_EQ(1, read(fd, &dummy, 1));
+                return true;
+            }));
+
+        ASSERT_TRUE(loop.register_handlers(reader_fd, reader));
+        ASSERT_EQ(2, send(writer_fd, "XY", 2, 0));
+
+        ASSERT_EQ(1, loop.run());
+        ASSERT_EQ(1, loop.run());
+
+        ASSERT_TRUE(loop.remove_handlers(reader_fd));
+    });
+}
+
+TEST_F(EventLoopUringImplTest, data_handler_should_receive_data_until_disconnected)
+{
+    run_in_thread([&]() {
+        EventLoopUringImpl loop;
+        StrictMock<UringEventHandlersMock> reader;
+
+        std::string received;
+        reader.on_read  = nullptr;
+        reader.on_write = nullptr;
+        reader.on_data  = [&](int fd, uint8_t *data, size_t length, EventLoop &loop) {
+            received.append(reinterpret_cast<const char *>(data), length);
+            return true;
+        };
+
+        int writer_fd = m_sv[0];
+        int reader_fd = m_sv[1];
+
+        EXPECT_CALL(reader, handle_disconnect(reader_fd, &loop)).WillOnce(Return(true));
+
+        ASSERT_TRUE(loop.register_handlers(reader_fd, reader));
+
+        // More messages than provided buffers, so that buffers are given back and reused
+        std::string sent;
+        for (int i = 0; i < 100; i++) {
+            std::string message = "message " + std::to_string(i) + ";";
+            ASSERT_EQ(ssize_t(message.size()), send(writer_fd, message.data(), message.size(), 0));
+            sent += message;
+            while (received.size() < sent.size()) {
+                ASSERT_LT(0, loop.run());
+            }
+        }
+        ASSERT_EQ(sent, received);
+
+        close(writer_fd);
+        m_sv[0] = -1;
+        ASSERT_EQ(1, loop.run());
+
+        // Removed on disconnection
+        ASSERT_FALSE(loop.remove_handlers(reader_fd));
+    });
+}
+
+TEST_F(EventLoopUringImplTest, run_should_return_zero_on_timeout)
+{
+    run_in_thread([&]() {
+        EventLoopUringImpl loop(std::chrono::milliseconds(10));
+        StrictMock<UringEventHandlersMock> reader;
+        reader.on_write = nullptr;
+
+        ASSERT_TRUE(loop.register_handlers(m_sv[1], reader));
+
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_EQ(0, loop.run());
+        ASSERT_LE(std::chrono::milliseconds(10), std::chrono::steady_clock::now() - start);
+
+        ASSERT_TRUE(loop.remove_handlers(m_sv[1]));
+    });
+}
+
+TEST_F(EventLoopUringImplTest, removed_handlers_should_not_be_called)
+{
+    run_in_thread([&]() {
+        EventLoopUringImpl loop(std::chrono::milliseconds(10));
+        StrictMock<UringEventHandlersMock> removed;
+        StrictMock<UringEventHandlersMock> reader;
+        removed.on_write = nullptr;
+        reader.on_write  = nullptr;
+
+        int writer_fd = m_sv[0];
+        int reader_fd = m_sv[1];
+
+        // Register and remove before any event, then register again with other handlers
+        ASSERT_TRUE(loop.register_handlers(reader_fd, removed));
+        ASSERT_EQ(0, loop.run());
+        ASSERT_TRUE(loop.remove_handlers(reader_fd));
+        ASSERT_FALSE(loop.remove_handlers(reader_fd));
+        ASSERT_TRUE(loop.register_handlers(reader_fd, reader));
+        ASSERT_FALSE(loop.register_handlers(reader_fd, reader));
+
+        EXPECT_CALL(reader, handle_read(reader_fd, &loop))
+            .WillOnce(Invoke([](int fd, EventLoop *loop) -> bool {
+                char dummy;
+                EXPECT_EQ(1, read(fd, &dummy, 1));
+                return true;
+            }));
+
+        ASSERT_EQ(1, send(writer_fd, "X", 1, 0));
+        ASSERT_EQ(1, loop.run());
+        ASSERT_EQ(0, loop.run());
+
+        ASSERT_TRUE(loop.remove_handlers(reader_fd));
+    });
+}
+
+TEST_F(EventLoopUringImplTest, set_write_handler_should_monitor_write_events)
+{
+    run_in_thread([&]() {
+        EventLoopUringImpl loop(std::chrono::milliseconds(10));
+        StrictMock<UringEventHandlersMock> writer;
+
+        // Write events are not monitored until a write handler is set
+        auto on_write   = writer.on_write;
+        writer.on_write = nullptr;
+
+        int writer_fd = m_sv[0];
+
+        ASSERT_TRUE(loop.register_handlers(writer_fd, writer));
+        ASSERT_EQ(0, loop.run());
+
+        // Write handler stops monitoring write events once called
+        EXPECT_CALL(writer, handle_write(writer_fd, &loop))
+            .WillOnce(Invoke([](int fd, EventLoop *loop) -> bool {
+                EXPECT_TRUE(loop->set_write_handler(fd, nullptr));
+                return true;
+            }));
+
+        ASSERT_TRUE(loop.set_write_handler(writer_fd, on_write));
+        ASSERT_EQ(1, loop.run());
+        ASSERT_EQ(0, loop.run());
+
+        // Unknown file descriptor
+        ASSERT_FALSE(loop.set_write_handler(m_sv[1], nullptr));
+
+        ASSERT_TRUE(loop.remove_handlers(writer_fd));
+    });
+}
+
+} // namespace
@@ -0,0 +1,145 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_mpsc_event_queue.h>
+
+#include <gtest/gtest.h>
+
+#include <poll.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Checks if the file descriptor is readable, without blocking.
+ */
+bool is_readable(int fd)
+{
+    struct pollfd pfd = {fd, POLLIN, 0};
+    return (poll(&pfd, 1, 0) == 1) && (pfd.revents & POLLIN);
+}
+
+TEST(MpscEventQueueTest, fd_is_readable_only_while_events_are_queued)
+{
+    beerocks::mpsc_event_queue<int> queue(4, 0);
+    ASSERT_LE(0, queue.fd());
+    EXPECT_FALSE(is_readable(queue.fd()));
+
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+    EXPECT_TRUE(is_readable(queue.fd()));
+
+    std::vector<int> events;
+    EXPECT_EQ(2u, queue.pop_all([&](int &event) { events.push_back(event); }));
+    EXPECT_EQ((std::vector<int>{1, 2}), events);
+    EXPECT_FALSE(is_readable(queue.fd()));
+
+    // Nothing to do on a spurious wake up
+    EXPECT_EQ(0u, queue.pop_all([&](int &event) { events.push_back(event); }));
+}
+
+TEST(MpscEventQueueTest, push_to_full_queue_fails)
+{
+    beerocks::mpsc_event_queue<std::unique_ptr<int>> queue(2, 0);
+    EXPECT_TRUE(queue.push(std::unique_ptr<int>(new int(0))));
+    EXPECT_TRUE(queue.push(std::unique_ptr<int>(new int(1))));
+
+    // Event is not moved if it is not queued
+    std::unique_ptr<int> event(new int(2));
+    EXPECT_FALSE(queue.push(std::move(event)));
+    EXPECT_TRUE(event);
+    EXPECT_EQ(1u, queue.dropped());
+}
+
+TEST(MpscEventQueueTest, overflow_events_are_received_in_order)
+{
+    beerocks::mpsc_event_queue<int> queue(2, 3);
+
+    // 2 events in the ring and 3 in the overflow list, the last one is dropped
+    for (int i = 0; i < 5; i++) {
+        EXPECT_TRUE(queue.push(int(i)));
+    }
+    EXPECT_FALSE(queue.push(5));
+    EXPECT_EQ(1u, queue.dropped());
+
+    std::vector<int> events;
+    auto handler = [&](int &event) { events.push_back(event); };
+
+    // Events pushed while the overflow list is not empty go after it, although the ring has room
+    EXPECT_EQ(3u, queue.pop_all(handler, 3));
+    EXPECT_TRUE(queue.push(6));
+    EXPECT_TRUE(is_readable(queue.fd()));
+
+    EXPECT_EQ(3u, queue.pop_all(handler));
+    EXPECT_FALSE(is_readable(queue.fd()));
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 6}), events);
+
+    // The ring is used again once the overflow list is empty
+    EXPECT_TRUE(queue.push(7));
+    EXPECT_TRUE(queue.push(8));
+    EXPECT_EQ(2u, queue.pop_all(handler));
+    EXPECT_EQ(1u, queue.dropped());
+}
+
+TEST(MpscEventQueueTest, fd_stays_readable_if_limit_is_reached)
+{
+    beerocks::mpsc_event_queue<int> queue(4, 0);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(queue.push(int(i)));
+    }
+
+    std::vector<int> events;
+    auto handler = [&](int &event) { events.push_back(event); };
+
+    EXPECT_EQ(2u, queue.pop_all(handler, 2));
+    EXPECT_TRUE(is_readable(queue.fd()));
+
+    EXPECT_EQ(1u, queue.pop_all(handler, 2));
+    EXPECT_FALSE(is_readable(queue.fd()));
+
+    EXPECT_EQ((std::vector<int>{0, 1, 2}), events);
+}
+
+TEST(MpscEventQueueTest, events_are_received_in_order_across_threads)
+{
+    constexpr int num_producers = 4;
+    constexpr int num_events    = 10000;
+    beerocks::mpsc_event_queue<int> queue(16, 64);
+
+    // Each producer pushes increasing numbers, tagged with the producer index
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < num_producers; producer++) {
+        producers.emplace_back([&, producer]() {
+            for (int i = 0; i < num_events; i++) {
+                while (!queue.push(i * num_producers + producer)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> expected(num_producers, 0);
+    int received = 0;
+    while (received < num_producers * num_events) {
+        struct pollfd pfd = {queue.fd(), POLLIN, 0};
+        ASSERT_EQ(1, poll(&pfd, 1, 1000));
+        received += queue.pop_all([&](int &event) {
+            int producer = event % num_producers;
+            EXPECT_EQ(expected[producer]++, event / num_producers);
+        });
+    }
+
+    for (auto &producer : producers) {
+        producer.join();
+    }
+}
+
+} // namespace
@@ -0,0 +1,83 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_precomputed_queue.h>
+
+#include <bcl/beerocks_event_loop_impl.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using namespace beerocks;
+
+namespace {
+
+TEST(PrecomputedQueueTest, values_should_be_computed_in_pool)
+{
+    auto loop = std::make_shared<EventLoopImpl>(std::chrono::milliseconds(1000));
+    auto pool = std::make_shared<ThreadPool>(2, loop);
+
+    auto loop_thread_id = std::this_thread::get_id();
+    std::atomic<int> created{0};
+    PrecomputedQueue<std::thread::id> queue(
+        pool,
+        [&]() {
+            created++;
+            return std::make_unique<std::thread::id>(std::this_thread::get_id());
+        },
+        2);
+
+    while (queue.ready() < 2) {
+        ASSERT_LT(0, loop->run());
+    }
+    EXPECT_EQ(2, created);
+
+    // Taking a value computes another one in the pool
+    auto value = queue.take();
+    ASSERT_NE(nullptr, value);
+    EXPECT_NE(loop_thread_id, *value);
+    EXPECT_EQ(1U, queue.ready());
+
+    while (queue.ready() < 2) {
+        ASSERT_LT(0, loop->run());
+    }
+    EXPECT_EQ(3, created);
+}
+
+TEST(PrecomputedQueueTest, value_should_be_created_inline_if_none_is_ready)
+{
+    auto loop = std::make_shared<EventLoopImpl>(std::chrono::milliseconds(10));
+    auto pool = std::make_shared<ThreadPool>(1, loop);
+
+    PrecomputedQueue<std::thread::id> queue(
+        pool, []() { return std::make_unique<std::thread::id>(std::this_thread::get_id()); }, 1);
+
+    // The value being computed has not been handed over yet, as the event loop has not run
+    auto value = queue.take();
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(std::this_thread::get_id(), *value);
+}
+
+TEST(PrecomputedQueueTest, failed_values_should_not_be_queued)
+{
+    auto loop = std::make_shared<EventLoopImpl>(std::chrono::milliseconds(10));
+    auto pool = std::make_shared<ThreadPool>(1, loop);
+
+    PrecomputedQueue<int> queue(pool, []() { return std::unique_ptr<int>(); }, 1);
+
+    while (loop->run() > 0) {
+    }
+    EXPECT_EQ(0U, queue.ready());
+    EXPECT_EQ(nullptr, queue.take());
+}
+
+} // namespace
@@ -0,0 +1,127 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/network/ring_buffer_impl.h>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+namespace {
+constexpr size_t buffer_size = 16;
+
+class RingBufferImplTest : public ::testing::Test {
+protected:
+    RingBufferImplTest() : m_buffer(buffer_size) { fill_buffer_with_test_data(m_buffer); }
+
+    void fill_buffer_with_test_data(beerocks::net::Buffer &buffer)
+    {
+        uint8_t *data = buffer.data();
+        for (size_t i = 0; i < buffer.size(); i++) {
+            data[i] = i;
+        }
+        buffer.length() = buffer.size();
+    }
+
+    beerocks::net::RingBufferImpl m_buffer;
+};
+
+TEST_F(RingBufferImplTest, size_should_be_rounded_up_to_page_size)
+{
+    ASSERT_GE(m_buffer.size(), buffer_size);
+    ASSERT_EQ(0U, m_buffer.size() % sysconf(_SC_PAGESIZE));
+}
+
+TEST_F(RingBufferImplTest, clear_should_succeed)
+{
+    m_buffer.clear();
+
+    ASSERT_EQ(0U, m_buffer.length());
+}
+
+TEST_F(RingBufferImplTest, append_should_fail_with_buffer_full)
+{
+    uint8_t data[]{0xff};
+
+    ASSERT_FALSE(m_buffer.append(data, sizeof(data)));
+}
+
+TEST_F(RingBufferImplTest, append_should_succeed)
+{
+    m_buffer.clear();
+
+    uint8_t data[]{0xff};
+
+    ASSERT_TRUE(m_buffer.append(data, sizeof(data)));
+    ASSERT_EQ(sizeof(data), m_buffer.length());
+    ASSERT_EQ(data[0], m_buffer.data()[0]);
+}
+
+TEST_F(RingBufferImplTest, shift_should_succeed)
+{
+    const uint8_t *data = m_buffer.data();
+
+    const size_t count = 1;
+    ASSERT_TRUE(m_buffer.shift(count));
+
+    // Contents are not moved
+    ASSERT_EQ(m_buffer.length(), m_buffer.size() - count);
+    ASSERT_EQ(data + count, m_buffer.data());
+    for (size_t i = 0; i < m_buffer.length(); i++) {
+        ASSERT_EQ(uint8_t(i + count), m_buffer.data()[i]);
+    }
+}
+
+TEST_F(RingBufferImplTest, shift_should_fail_if_count_greater_than_length)
+{
+    const size_t count = m_buffer.length() + 1;
+    ASSERT_FALSE(m_buffer.shift(count));
+}
+
+TEST_F(RingBufferImplTest, contents_should_be_contiguous_after_wrap_around)
+{
+    const size_t size  = m_buffer.size();
+    const size_t count = size - 2;
+
+    // Consume all but the last two bytes, then append past the end of the ring
+    ASSERT_TRUE(m_buffer.shift(count));
+    uint8_t data[]{0xa0, 0xa1, 0xa2};
+    ASSERT_TRUE(m_buffer.append(data, sizeof(data)));
+
+    ASSERT_EQ(2 + sizeof(data), m_buffer.length());
+    ASSERT_EQ(uint8_t(size - 2), m_buffer.data()[0]);
+    ASSERT_EQ(uint8_t(size - 1), m_buffer.data()[1]);
+    ASSERT_EQ(data[0], m_buffer.data()[2]);
+    ASSERT_EQ(data[1], m_buffer.data()[3]);
+    ASSERT_EQ(data[2], m_buffer.data()[4]);
+
+    // Consume the bytes before the end of the ring, the head wraps around
+    ASSERT_TRUE(m_buffer.shift(2));
+    ASSERT_EQ(sizeof(data), m_buffer.length());
+    ASSERT_EQ(data[0], m_buffer.data()[0]);
+    ASSERT_EQ(data[1], m_buffer.data()[1]);
+    ASSERT_EQ(data[2], m_buffer.data()[2]);
+
+    // Whole size is available again once the contents are consumed
+    ASSERT_TRUE(m_buffer.shift(sizeof(data)));
+    ASSERT_EQ(0U, m_buffer.length());
+    fill_buffer_with_test_data(m_buffer);
+    ASSERT_EQ(size, m_buffer.length());
+}
+
+TEST_F(RingBufferImplTest, move_should_transfer_contents)
+{
+    beerocks::net::RingBufferImpl buffer(std::move(m_buffer));
+
+    ASSERT_EQ(buffer.size(), buffer.length());
+    ASSERT_EQ(0U, m_buffer.length());
+    for (size_t i = 0; i < buffer.length(); i++) {
+        ASSERT_EQ(uint8_t(i), buffer.data()[i]);
+    }
+}
+} // namespace
@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/network/send_queue.h>
+
+#include <bcl/network/sockets_mock.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <functional>
+#include <vector>
+
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::StrictMock;
+
+namespace {
+
+constexpr int socket_fd = 1;
+
+class SendQueueTest : public ::testing::Test {
+protected:
+    SendQueueTest()
+    {
+        ON_CALL(m_connection, socket()).WillByDefault(Return(m_socket));
+        ON_CALL(*m_socket, fd()).WillByDefault(Return(socket_fd));
+    }
+
+    /**
+     * @brief Returns a fake send_vectored() that accepts up to the given number of bytes and
+     * records them.
+     */
+    std::function<int(const struct iovec *, size_t)> accept(size_t max_length)
+    {
+        return [this, max_length](const struct iovec *chunks, size_t count) {
+            size_t length = 0;
+            for (size_t i = 0; (i < count) && (length < max_length); i++) {
+                auto data = static_cast<const uint8_t *>(chunks[i].iov_base);
+                size_t n  = std::min(chunks[i].iov_len, max_length - length);
+                m_sent.insert(m_sent.end(), data, data + n);
+                length += n;
+            }
+            return static_cast<int>(length);
+        };
+    }
+
+    std::shared_ptr<StrictMock<beerocks::net::SocketMock>> m_socket =
+        std::make_shared<StrictMock<beerocks::net::SocketMock>>();
+    StrictMock<beerocks::net::SocketConnectionMock> m_connection;
+
+    beerocks::net::SendQueue m_queue;
+
+    uint8_t m_header[2]{0x01, 0x02};
+    uint8_t m_payload[4]{0x03, 0x04, 0x05, 0x06};
+    struct iovec m_chunks[2]{{m_header, sizeof(m_header)}, {m_payload, sizeof(m_payload)}};
+    const std::vector<uint8_t> m_data{0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+
+    std::vector<uint8_t> m_sent;
+};
+
+TEST_F(SendQueueTest, send_should_succeed)
+{
+    EXPECT_CALL(m_connection, send_vectored(_, 2)).WillOnce(Invoke(accept(m_data.size())));
+
+    ASSERT_TRUE(m_queue.send(m_connection, m_chunks, 2));
+    ASSERT_TRUE(m_queue.empty());
+    ASSERT_EQ(m_data, m_sent);
+}
+
+TEST_F(SendQueueTest, send_should_queue_data_not_sent)
+{
+    {
+        InSequence sequence;
+
+        // Only the header and part of the payload are sent
+        EXPECT_CALL(m_connection, send_vectored(_, 2)).WillOnce(Invoke(accept(3)));
+
+        // Rest of the payload is sent once the socket is ready for writing
+        EXPECT_CALL(m_connection, send_vectored(_, 1)).WillOnce(Invoke(accept(m_data.size())));
+    }
+
+    ASSERT_TRUE(m_queue.send(m_connection, m_chunks, 2));
+    ASSERT_EQ(m_data.size() - 3, m_queue.length());
+
+    ASSERT_TRUE(m_queue.flush(m_connection));
+    ASSERT_TRUE(m_queue.empty());
+    ASSERT_EQ(m_data, m_sent);
+}
+
+TEST_F(SendQueueTest, send_should_queue_data_behind_data_queued)
+{
+    {
+        InSequence sequence;
+
+        // Socket is not ready for writing
+        EXPECT_CALL(m_connection, send_vectored(_, 2))
+            .WillOnce(Invoke([](const struct iovec *chunks, size_t count) {
+                errno = EAGAIN;
+                return -1;
+            }));
+
+        // Socket is still not ready when more data is sent, so it is queued without trying to
+        // send it
+        EXPECT_CALL(m_connection, send_vectored(_, 1)).WillOnce(Invoke(accept(0)));
+
+        // Both chunks are sent with a single call, in order, when the socket is ready
+        EXPECT_CALL(m_connection, send_vectored(_, 2)).WillOnce(Invoke(accept(2 * m_data.size())));
+    }
+
+    ASSERT_TRUE(m_queue.send(m_connection, m_chunks, 2));
+    ASSERT_TRUE(m_queue.send(m_connection, m_chunks, 2));
+    ASSERT_EQ(2 * m_data.size(), m_queue.length());
+
+    ASSERT_TRUE(m_queue.flush(m_connection));
+    ASSERT_TRUE(m_queue.empty());
+
+    std::vector<uint8_t> expected(m_data);
+    expected.insert(expected.end(), m_data.begin(), m_data.end());
+    ASSERT_EQ(expected, m_sent);
+}
+
+TEST_F(SendQueueTest, send_should_fail_on_socket_error)
+{
+    {
+        InSequence sequence;
+
+        EXPECT_CALL(m_connection, send_vectored(_, 2))
+            .WillOnce(Invoke([](const struct iovec *chunks, size_t count) {
+                errno = EPIPE;
+                return -1;
+            }));
+        EXPECT_CALL(m_connection, socket());
+        EXPECT_CALL(*m_socket, fd());
+    }
+
+    ASSERT_FALSE(m_queue.send(m_connection, m_chunks, 2));
+    ASSERT_TRUE(m_queue.empty());
+}
+
+TEST_F(SendQueueTest, send_should_fail_if_queue_is_full)
+{
+    std::vector<uint8_t> data(beerocks::net::SendQueue::MAX_LENGTH);
+    struct iovec chunk = {data.data(), data.size()};
+
+    {
+        InSequence sequence;
+
+        // Socket accepts one byte less than the maximum queue length
+        EXPECT_CALL(m_connection, send_vectored(_, 1)).WillOnce(Return(1));
+
+        // Socket is not ready for writing
+        EXPECT_CALL(m_connection, send_vectored(_, 1)).WillOnce(Return(0));
+        EXPECT_CALL(m_connection, socket());
+        EXPECT_CALL(*m_socket, fd());
+    }
+
+    ASSERT_TRUE(m_queue.send(m_connection, &chunk, 1));
+    ASSERT_EQ(data.size() - 1, m_queue.length());
+
+    // Data does not fit into the queue
+    ASSERT_FALSE(m_queue.send(m_connection, m_chunks, 2));
+    ASSERT_EQ(data.size() - 1, m_queue.length());
+}
+
+TEST_F(SendQueueTest, clear_should_drop_queued_data)
+{
+    EXPECT_CALL(m_connection, send_vectored(_, 2)).WillOnce(Return(0));
+
+    ASSERT_TRUE(m_queue.send(m_connection, m_chunks, 2));
+    ASSERT_FALSE(m_queue.empty());
+
+    m_queue.clear();
+    ASSERT_TRUE(m_queue.empty());
+    ASSERT_TRUE(m_queue.flush(m_connection));
+}
+
+} // namespace
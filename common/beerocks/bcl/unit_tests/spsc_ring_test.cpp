@@ -0,0 +1,106 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_spsc_ring.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace {
+
+TEST(SpscRingTest, capacity_is_rounded_up_to_power_of_2)
+{
+    beerocks::spsc_ring<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+}
+
+TEST(SpscRingTest, pop_from_empty_ring_fails)
+{
+    beerocks::spsc_ring<int> ring(4);
+    int item;
+    EXPECT_FALSE(ring.pop(item));
+    EXPECT_EQ(ring.consume_slot(), nullptr);
+}
+
+TEST(SpscRingTest, push_to_full_ring_fails)
+{
+    beerocks::spsc_ring<int> ring(4);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(ring.push(i));
+    }
+    EXPECT_FALSE(ring.push(4));
+    EXPECT_EQ(ring.produce_slot(), nullptr);
+
+    int item;
+    ASSERT_TRUE(ring.pop(item));
+    EXPECT_EQ(item, 0);
+    EXPECT_TRUE(ring.push(4));
+}
+
+TEST(SpscRingTest, items_are_popped_in_order_across_wrap_around)
+{
+    beerocks::spsc_ring<int> ring(4);
+    int expected = 0;
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(ring.push(2 * i));
+        ASSERT_TRUE(ring.push(2 * i + 1));
+
+        int item;
+        ASSERT_TRUE(ring.pop(item));
+        EXPECT_EQ(item, expected++);
+        ASSERT_TRUE(ring.pop(item));
+        EXPECT_EQ(item, expected++);
+    }
+}
+
+TEST(SpscRingTest, slots_are_filled_and_read_in_place)
+{
+    beerocks::spsc_ring<std::vector<int>> ring(2);
+
+    auto slot = ring.produce_slot();
+    ASSERT_NE(slot, nullptr);
+    slot->assign({1, 2, 3});
+    ring.produce();
+
+    auto read_slot = ring.consume_slot();
+    ASSERT_EQ(read_slot, slot);
+    EXPECT_EQ(read_slot->size(), 3u);
+    ring.consume();
+
+    EXPECT_EQ(ring.consume_slot(), nullptr);
+}
+
+TEST(SpscRingTest, producer_and_consumer_threads)
+{
+    constexpr int kItems = 100000;
+    beerocks::spsc_ring<int> ring(64);
+
+    std::thread producer([&]() {
+        for (int i = 0; i < kItems; i++) {
+            while (!ring.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    while (expected < kItems) {
+        int item;
+        if (!ring.pop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(item, expected);
+        expected++;
+    }
+
+    producer.join();
+}
+
+} // namespace
@@ -0,0 +1,179 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_thread_pool.h>
+
+#include <bcl/beerocks_event_loop_impl.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace beerocks;
+
+namespace {
+
+TEST(ThreadPoolTest, size_should_default_to_number_of_cpus)
+{
+    auto loop = std::make_shared<EventLoopImpl>();
+
+    ThreadPool pool(0, loop);
+    EXPECT_EQ(std::max(1U, std::thread::hardware_concurrency()), pool.size());
+}
+
+TEST(ThreadPoolTest, continuation_should_run_in_event_loop_thread)
+{
+    auto loop = std::make_shared<EventLoopImpl>();
+    ThreadPool pool(2, loop);
+
+    auto loop_thread_id = std::this_thread::get_id();
+    std::thread::id work_thread_id;
+    bool done = false;
+
+    ASSERT_TRUE(pool.post([&]() { work_thread_id = std::this_thread::get_id(); },
+                          [&]() {
+                              EXPECT_EQ(loop_thread_id, std::this_thread::get_id());
+                              done = true;
+                          }));
+
+    ASSERT_EQ(1, loop->run());
+    EXPECT_TRUE(done);
+    EXPECT_NE(loop_thread_id, work_thread_id);
+}
+
+TEST(ThreadPoolTest, all_work_should_be_done)
+{
+    constexpr int num_jobs = 1000;
+
+    auto loop = std::make_shared<EventLoopImpl>(std::chrono::milliseconds(1000));
+    ThreadPool pool(4, loop);
+
+    // Each job posts a second one from the pool, which is run by the same worker unless stolen
+    std::atomic<int> work_done{0};
+    int continuations_done = 0;
+    for (int i = 0; i < num_jobs; i++) {
+        ASSERT_TRUE(pool.post(
+            [&]() {
+                work_done++;
+                EXPECT_TRUE(pool.post([&]() { work_done++; }, [&]() { continuations_done++; }));
+            },
+            [&]() { continuations_done++; }));
+    }
+
+    while (continuations_done < 2 * num_jobs) {
+        ASSERT_LT(0, loop->run());
+    }
+    EXPECT_EQ(2 * num_jobs, work_done);
+}
+
+TEST(ThreadPoolTest, pool_of_one_thread_should_run_work_in_order)
+{
+    constexpr int num_jobs = 100;
+
+    auto loop = std::make_shared<EventLoopImpl>(std::chrono::milliseconds(1000));
+    ThreadPool pool(1, loop);
+
+    std::vector<int> order;
+    bool done = false;
+    for (int i = 0; i < num_jobs; i++) {
+        ASSERT_TRUE(pool.post([&order, i]() { order.push_back(i); }));
+    }
+    ASSERT_TRUE(pool.post([]() {}, [&]() { done = true; }));
+
+    while (!done) {
+        ASSERT_LT(0, loop->run());
+    }
+    ASSERT_EQ(size_t(num_jobs), order.size());
+    for (int i = 0; i < num_jobs; i++) {
+        EXPECT_EQ(i, order[i]);
+    }
+}
+
+TEST(ThreadPoolTest, idle_worker_should_steal_work)
+{
+    auto loop = std::make_shared<EventLoopImpl>(std::chrono::milliseconds(1000));
+    ThreadPool pool(2, loop);
+
+    // The second job goes to the queue of the worker running the first one, which waits for it:
+    // it only completes if the idle worker is woken up to steal it
+    std::promise<void> stolen;
+    auto job_stolen = stolen.get_future();
+    std::future_status status;
+    bool done = false;
+    ASSERT_TRUE(pool.post(
+        [&]() {
+            EXPECT_TRUE(pool.post([&]() { stolen.set_value(); }));
+            status = job_stolen.wait_for(std::chrono::seconds(1));
+        },
+        [&]() { done = true; }));
+
+    while (!done) {
+        ASSERT_LT(0, loop->run());
+    }
+    EXPECT_EQ(std::future_status::ready, status);
+}
+
+TEST(ThreadPoolTest, destructor_should_wait_for_running_work)
+{
+    auto loop = std::make_shared<EventLoopImpl>();
+    std::promise<void> started;
+    auto job_started = started.get_future();
+    std::atomic<bool> done{false};
+
+    {
+        ThreadPool pool(1, loop);
+        ASSERT_TRUE(pool.post([&]() {
+            started.set_value();
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            done = true;
+        }));
+
+        // Destroy the pool only once the worker is running the job
+        job_started.wait();
+    }
+
+    EXPECT_TRUE(done);
+}
+
+TEST(ThreadPoolTest, destructor_should_cancel_pending_work_and_continuations)
+{
+    auto loop = std::make_shared<EventLoopImpl>(std::chrono::milliseconds(10));
+    std::promise<void> started;
+    auto job_started = started.get_future();
+    std::atomic<int> work_done{0};
+    int continuations_done = 0;
+
+    {
+        ThreadPool pool(1, loop);
+        ASSERT_TRUE(pool.post(
+            [&]() {
+                started.set_value();
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                work_done++;
+            },
+            [&]() { continuations_done++; }));
+        for (int i = 0; i < 3; i++) {
+            ASSERT_TRUE(pool.post([&]() { work_done++; }, [&]() { continuations_done++; }));
+        }
+
+        // The running job is completed, the others are not started
+        job_started.wait();
+    }
+
+    // The continuation of the completed job is not run either, even if the loop runs
+    EXPECT_EQ(1, work_done);
+    EXPECT_EQ(0, loop->run());
+    EXPECT_EQ(0, continuations_done);
+}
+
+} // namespace
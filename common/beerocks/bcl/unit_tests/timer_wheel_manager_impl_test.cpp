@@ -0,0 +1,167 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_timer_wheel_manager_impl.h>
+
+#include <bcl/beerocks_event_loop_impl.h>
+#include <bcl/beerocks_event_loop_mock.h>
+#include <bcl/beerocks_timer_factory_impl.h>
+#include <bcl/beerocks_timer_factory_mock.h>
+#include <bcl/network/file_descriptor.h>
+#include <bcl/network/timer_mock.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using ::testing::_;
+using ::testing::AllOf;
+using ::testing::Gt;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Lt;
+using ::testing::Return;
+using ::testing::SaveArg;
+using ::testing::StrictMock;
+
+namespace {
+
+constexpr int invalid_descriptor = beerocks::net::FileDescriptor::invalid_descriptor;
+
+class TimerWheelManagerImplTest : public ::testing::Test {
+protected:
+    std::shared_ptr<StrictMock<beerocks::TimerFactoryMock>> m_timer_factory =
+        std::make_shared<StrictMock<beerocks::TimerFactoryMock>>();
+    std::shared_ptr<StrictMock<beerocks::EventLoopMock>> m_event_loop =
+        std::make_shared<StrictMock<beerocks::EventLoopMock>>();
+};
+
+TEST_F(TimerWheelManagerImplTest, timers_should_share_a_single_timer)
+{
+    auto timer = new StrictMock<beerocks::net::TimerMock<>>();
+
+    int timer_fd               = 1;
+    constexpr auto short_delay = std::chrono::milliseconds(1);
+    constexpr auto long_delay  = std::chrono::milliseconds(100);
+    constexpr auto zero        = std::chrono::milliseconds::zero();
+
+    beerocks::EventLoop::EventHandlers timer_handlers;
+
+    ON_CALL(*timer, fd()).WillByDefault(Return(timer_fd));
+
+    {
+        InSequence sequence;
+
+        EXPECT_CALL(*m_timer_factory, create_instance_proxy()).WillOnce(Return(timer));
+        EXPECT_CALL(*timer, fd()).Times(1);
+        EXPECT_CALL(*m_event_loop, register_handlers(timer_fd, _))
+            .WillOnce(DoAll(SaveArg<1>(&timer_handlers), Return(true)));
+
+        // Armed to the earliest timer each time it changes
+        EXPECT_CALL(*timer, schedule(long_delay, zero)).WillOnce(Return(true));
+        EXPECT_CALL(*timer, schedule(short_delay, zero)).WillOnce(Return(true));
+
+        EXPECT_CALL(*timer, read(_)).WillOnce(Invoke([](uint64_t &number_of_expirations) {
+            number_of_expirations = 1;
+            return true;
+        }));
+        EXPECT_CALL(*timer, schedule(AllOf(Gt(zero), Lt(long_delay)), zero))
+            .WillOnce(Return(true));
+
+        EXPECT_CALL(*timer, fd()).Times(1);
+        EXPECT_CALL(*timer, cancel()).WillOnce(Return(true));
+        EXPECT_CALL(*m_event_loop, remove_handlers(timer_fd)).WillOnce(Return(true));
+    }
+
+    beerocks::TimerWheelManagerImpl timer_manager(m_timer_factory, m_event_loop);
+
+    uint32_t count                            = 0;
+    beerocks::EventLoop::EventHandler handler = [&](int fd, beerocks::EventLoop &loop) {
+        count++;
+        return true;
+    };
+
+    int long_timer = timer_manager.add_timer("long", long_delay, zero, handler);
+    ASSERT_NE(long_timer, invalid_descriptor);
+    int short_timer = timer_manager.add_timer("short", short_delay, zero, handler);
+    ASSERT_NE(short_timer, invalid_descriptor);
+    ASSERT_NE(long_timer, short_timer);
+
+    // Emulate the timer has elapsed, once the short timer is due
+    std::this_thread::sleep_for(2 * short_delay);
+    ASSERT_TRUE(timer_handlers.on_read(timer_fd, *m_event_loop));
+    ASSERT_EQ(1U, count);
+
+    ASSERT_TRUE(timer_manager.remove_timer(short_timer));
+    ASSERT_EQ(short_timer, invalid_descriptor);
+    ASSERT_TRUE(timer_manager.remove_timer(long_timer));
+}
+
+TEST_F(TimerWheelManagerImplTest, remove_timer_should_fail_with_unknown_timer_fd)
+{
+    int unknown_timer_fd = 2;
+
+    beerocks::TimerWheelManagerImpl timer_manager(m_timer_factory, m_event_loop);
+
+    ASSERT_FALSE(timer_manager.remove_timer(unknown_timer_fd));
+}
+
+TEST_F(TimerWheelManagerImplTest, add_timer_should_fail_if_timer_cannot_be_created)
+{
+    EXPECT_CALL(*m_timer_factory, create_instance_proxy()).WillOnce(Return(nullptr));
+
+    beerocks::TimerWheelManagerImpl timer_manager(m_timer_factory, m_event_loop);
+
+    beerocks::EventLoop::EventHandler handler = [&](int fd, beerocks::EventLoop &loop) {
+        return true;
+    };
+
+    ASSERT_EQ(invalid_descriptor,
+              timer_manager.add_timer("test", std::chrono::milliseconds(1),
+                                      std::chrono::milliseconds(1), handler));
+}
+
+TEST_F(TimerWheelManagerImplTest, example_of_use)
+{
+    auto timer_factory = std::make_shared<beerocks::TimerFactoryImpl>();
+    auto event_loop    = std::make_shared<beerocks::EventLoopImpl>();
+
+    beerocks::TimerWheelManagerImpl timer_manager(timer_factory, event_loop);
+
+    uint32_t periodic_count                            = 0;
+    beerocks::EventLoop::EventHandler periodic_handler = [&](int fd, beerocks::EventLoop &loop) {
+        periodic_count++;
+        return true;
+    };
+
+    uint32_t one_shot_count = 0;
+    int one_shot_timer      = invalid_descriptor;
+    beerocks::EventLoop::EventHandler one_shot_handler = [&](int fd, beerocks::EventLoop &loop) {
+        one_shot_count++;
+        return timer_manager.remove_timer(one_shot_timer);
+    };
+
+    constexpr auto period = std::chrono::milliseconds(1);
+    int periodic_timer    = timer_manager.add_timer("periodic", period, period, periodic_handler);
+    ASSERT_NE(periodic_timer, invalid_descriptor);
+    one_shot_timer = timer_manager.add_timer("one-shot", 5 * period,
+                                             std::chrono::milliseconds::zero(), one_shot_handler);
+    ASSERT_NE(one_shot_timer, invalid_descriptor);
+
+    // Both timers are multiplexed on a single timer, so each run handles a single event
+    while (periodic_count < 10) {
+        ASSERT_EQ(1, event_loop->run());
+    }
+
+    ASSERT_TRUE(timer_manager.remove_timer(periodic_timer));
+    ASSERT_EQ(periodic_timer, invalid_descriptor);
+    ASSERT_EQ(1U, one_shot_count);
+    ASSERT_EQ(one_shot_timer, invalid_descriptor);
+}
+
+} // namespace
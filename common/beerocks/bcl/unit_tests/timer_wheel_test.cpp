@@ -0,0 +1,208 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <bcl/beerocks_timer_wheel.h>
+
+#include <bcl/beerocks_event_loop_mock.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+using ::testing::StrictMock;
+
+namespace {
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+    /**
+     * @brief Adds a timer that records the tick at which it elapses.
+     */
+    int add(uint64_t expiry, uint64_t period = 0)
+    {
+        return m_wheel.add("test", expiry, period, [this](int id, beerocks::EventLoop &loop) {
+            m_fired.emplace_back(id, m_wheel.now());
+            return true;
+        });
+    }
+
+    beerocks::TimerWheel m_wheel;
+    StrictMock<beerocks::EventLoopMock> m_event_loop;
+
+    /**
+     * Identifier and tick of the timers elapsed, in order.
+     */
+    std::vector<std::pair<int, uint64_t>> m_fired;
+};
+
+TEST_F(TimerWheelTest, timer_should_elapse_at_expiry)
+{
+    int id = add(10);
+    ASSERT_NE(id, beerocks::TimerWheel::INVALID_ID);
+
+    ASSERT_TRUE(m_wheel.advance(9, m_event_loop));
+    EXPECT_TRUE(m_fired.empty());
+
+    ASSERT_TRUE(m_wheel.advance(10, m_event_loop));
+    ASSERT_EQ(m_fired.size(), 1U);
+    EXPECT_EQ(m_fired[0], std::make_pair(id, uint64_t(10)));
+
+    // One-shot timers elapse once, and are kept until removed
+    ASSERT_TRUE(m_wheel.advance(1000, m_event_loop));
+    EXPECT_EQ(m_fired.size(), 1U);
+    EXPECT_EQ(m_wheel.size(), 1U);
+    EXPECT_TRUE(m_wheel.remove(id));
+    EXPECT_FALSE(m_wheel.remove(id));
+    EXPECT_EQ(m_wheel.size(), 0U);
+}
+
+TEST_F(TimerWheelTest, timers_should_elapse_in_expiry_order_on_all_levels)
+{
+    // From level 0 up to the overflow list
+    std::vector<uint64_t> expiries = {uint64_t(1) << 40, 300000, 5, 70, 4100, 20000000};
+    std::map<int, uint64_t> expected;
+    for (auto expiry : expiries) {
+        expected[add(expiry)] = expiry;
+    }
+
+    ASSERT_TRUE(m_wheel.advance(UINT64_MAX - 1, m_event_loop));
+
+    ASSERT_EQ(m_fired.size(), expiries.size());
+    for (size_t i = 0; i < m_fired.size(); i++) {
+        EXPECT_EQ(m_fired[i].second, expected[m_fired[i].first]);
+        if (i > 0) {
+            EXPECT_LT(m_fired[i - 1].second, m_fired[i].second);
+        }
+    }
+}
+
+TEST_F(TimerWheelTest, periodic_timer_should_elapse_every_period)
+{
+    add(10, 10);
+
+    for (uint64_t tick = 1; tick <= 35; tick++) {
+        ASSERT_TRUE(m_wheel.advance(tick, m_event_loop));
+    }
+
+    ASSERT_EQ(m_fired.size(), 3U);
+    EXPECT_EQ(m_fired[0].second, 10U);
+    EXPECT_EQ(m_fired[1].second, 20U);
+    EXPECT_EQ(m_fired[2].second, 30U);
+}
+
+TEST_F(TimerWheelTest, overrun_periodic_timer_should_elapse_once)
+{
+    add(10, 10);
+
+    ASSERT_TRUE(m_wheel.advance(10, m_event_loop));
+    ASSERT_TRUE(m_wheel.advance(45, m_event_loop));
+    ASSERT_EQ(m_fired.size(), 2U);
+
+    // Expirations at 30 and 40 were missed, the next one is still in phase
+    uint64_t expiry;
+    ASSERT_TRUE(m_wheel.next_expiry(expiry));
+    EXPECT_EQ(expiry, 50U);
+}
+
+TEST_F(TimerWheelTest, next_expiry_should_return_earliest_timer)
+{
+    uint64_t expiry;
+    EXPECT_FALSE(m_wheel.next_expiry(expiry));
+
+    int far = add(uint64_t(1) << 40);
+    ASSERT_TRUE(m_wheel.next_expiry(expiry));
+    EXPECT_EQ(expiry, uint64_t(1) << 40);
+
+    add(5000);
+    int near = add(4100);
+    ASSERT_TRUE(m_wheel.next_expiry(expiry));
+    EXPECT_EQ(expiry, 4100U);
+
+    ASSERT_TRUE(m_wheel.remove(near));
+    ASSERT_TRUE(m_wheel.next_expiry(expiry));
+    EXPECT_EQ(expiry, 5000U);
+
+    ASSERT_TRUE(m_wheel.advance(5000, m_event_loop));
+    ASSERT_TRUE(m_wheel.remove(far));
+    EXPECT_FALSE(m_wheel.next_expiry(expiry));
+}
+
+TEST_F(TimerWheelTest, handler_should_remove_timers)
+{
+    int first      = beerocks::TimerWheel::INVALID_ID;
+    int second     = beerocks::TimerWheel::INVALID_ID;
+    uint32_t count = 0;
+
+    auto handler = [&](int id, beerocks::EventLoop &loop) {
+        count++;
+        EXPECT_TRUE(m_wheel.remove(first));
+        EXPECT_TRUE(m_wheel.remove(second));
+        return true;
+    };
+
+    // Same expiry, the first one removes both itself and the second one before it elapses
+    first  = m_wheel.add("first", 10, 10, handler);
+    second = m_wheel.add("second", 10, 10, handler);
+
+    ASSERT_TRUE(m_wheel.advance(100, m_event_loop));
+    EXPECT_EQ(count, 1U);
+    EXPECT_EQ(m_wheel.size(), 0U);
+}
+
+TEST_F(TimerWheelTest, handler_should_add_timers)
+{
+    m_wheel.add("test", 10, 0, [this](int id, beerocks::EventLoop &loop) {
+        add(m_wheel.now() + 5);
+        return true;
+    });
+
+    ASSERT_TRUE(m_wheel.advance(100, m_event_loop));
+    ASSERT_EQ(m_fired.size(), 1U);
+    EXPECT_EQ(m_fired[0].second, 15U);
+}
+
+TEST_F(TimerWheelTest, advance_should_fail_if_a_handler_fails)
+{
+    m_wheel.add("test", 10, 0, [](int id, beerocks::EventLoop &loop) { return false; });
+    add(10);
+
+    EXPECT_FALSE(m_wheel.advance(10, m_event_loop));
+    EXPECT_EQ(m_fired.size(), 1U);
+}
+
+TEST_F(TimerWheelTest, random_timers_should_elapse_at_expiry)
+{
+    std::mt19937_64 random(1);
+    std::map<int, uint64_t> expected;
+    uint64_t tick = 0;
+
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 50; i++) {
+            // Spread the delays over all levels
+            uint64_t delay = random() & ((uint64_t(1) << (random() % 40)) - 1);
+            int id         = add(tick + delay + 1);
+            expected[id]   = tick + delay + 1;
+            if (random() % 4 == 0) {
+                ASSERT_TRUE(m_wheel.remove(id));
+                expected.erase(id);
+            }
+        }
+        tick += random() % (uint64_t(1) << (random() % 24));
+        ASSERT_TRUE(m_wheel.advance(tick, m_event_loop));
+    }
+    ASSERT_TRUE(m_wheel.advance(UINT64_MAX - 1, m_event_loop));
+
+    ASSERT_EQ(m_fired.size(), expected.size());
+    for (const auto &fired : m_fired) {
+        EXPECT_EQ(fired.second, expected[fired.first]);
+    }
+}
+
+} // namespace
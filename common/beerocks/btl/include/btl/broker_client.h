@@ -135,11 +135,13 @@ public:
      * If the interface is a bridge or outside a bridge, it should be empty.
      * @param is_bridge Is @a iface_name is a bridge interface.
      * @param add true to add the interface, otherwise to remove.
+     * @param rx_ring true to receive frames through a memory-mapped ring (TPACKET_V3) on the
+     * interface(s). The transport falls back to regular socket reads if the ring is not available.
      *
      * @return true on success and false otherwise.
      */
     virtual bool configure_interfaces(const std::string &iface_name, const std::string &bridge_name,
-                                      bool is_bridge, bool add) = 0;
+                                      bool is_bridge, bool add, bool rx_ring = false) = 0;
 
     /**
      * @brief Configures the transport process to bind a given local bridge al_mac address.
@@ -25,10 +25,13 @@ namespace btl {
  * @param uds_address Unix Domain Socket address where the broker server is listening for connection
  * requests and hence the broker client has to connect to.
  * @param event_loop Application event loop used by the process to wait for I/O events.
+ * @param shared_memory Request the broker server to deliver CMDUs through shared memory instead
+ * of copying them into the socket (the socket is used if the server can't).
  */
 std::unique_ptr<BrokerClientFactory>
 create_broker_client_factory(const std::string &uds_path,
-                             std::shared_ptr<beerocks::EventLoop> event_loop);
+                             std::shared_ptr<beerocks::EventLoop> event_loop,
+                             bool shared_memory = false);
 
 } // namespace btl
 
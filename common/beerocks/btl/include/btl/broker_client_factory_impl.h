@@ -35,11 +35,13 @@ public:
      * @param message_serializer Message serializer used to put transport messages into a byte
      * array ready to be sent through a socket connection.
      * @param event_loop Application event loop used by the process to wait for I/O events.
+     * @param shared_memory Request created clients to use the broker shared memory.
      */
     BrokerClientFactoryImpl(const std::string &uds_path,
                             std::shared_ptr<MessageParser> message_parser,
                             std::shared_ptr<MessageSerializer> message_serializer,
-                            std::shared_ptr<beerocks::EventLoop> event_loop);
+                            std::shared_ptr<beerocks::EventLoop> event_loop,
+                            bool shared_memory = false);
 
     /**
      * @brief Creates an instance of a broker client.
@@ -70,6 +72,11 @@ private:
      * Application event loop used by the process to wait for I/O events.
      */
     std::shared_ptr<EventLoop> m_event_loop;
+
+    /**
+     * Request created clients to use the broker shared memory.
+     */
+    bool m_shared_memory;
 };
 
 } // namespace btl
@@ -15,9 +15,11 @@
 #include <btl/message_serializer.h>
 
 #include <bcl/beerocks_event_loop.h>
-#include <bcl/network/buffer_impl.h>
+#include <bcl/network/ring_buffer_impl.h>
+#include <bcl/network/send_queue.h>
 #include <bcl/network/sockets.h>
 #include <mapf/transport/ieee1905_transport_messages.h>
+#include <mapf/transport/ieee1905_transport_shared_memory.h>
 
 namespace beerocks {
 namespace btl {
@@ -41,11 +43,13 @@ public:
      * @param message_serializer Message serializer used to put transport messages into a byte
      * array ready to be sent through a socket connection.
      * @param event_loop Application event loop used by the process to wait for I/O events.
+     * @param shared_memory Request the server, when subscribing, to deliver CMDUs through its
+     * shared memory instead of the socket connection.
      */
     BrokerClientImpl(std::unique_ptr<beerocks::net::Socket::Connection> connection,
                      std::shared_ptr<MessageParser> message_parser,
                      std::shared_ptr<MessageSerializer> message_serializer,
-                     std::shared_ptr<beerocks::EventLoop> event_loop);
+                     std::shared_ptr<beerocks::EventLoop> event_loop, bool shared_memory = false);
 
     /**
      * @brief Class destructor
@@ -65,7 +69,7 @@ public:
      * @see BrokerClient::configure_interfaces()
      */
     bool configure_interfaces(const std::string &iface_name, const std::string &bridge_name,
-                              bool is_bridge, bool add) override;
+                              bool is_bridge, bool add, bool rx_ring = false) override;
 
     /**
      * @brief Configures the transport process to bind a given local al_mac address.
@@ -109,6 +113,32 @@ private:
      */
     void handle_read(int fd);
 
+    /**
+     * @brief Receives data through the socket connection, together with the file descriptors
+     * passed by the server (if any).
+     *
+     * Used instead of `Connection::receive()` while the shared memory mode is being negotiated,
+     * so that the file descriptors of the shared memory are not dropped by the kernel.
+     *
+     * @return Number of bytes received, -1 on failure.
+     */
+    int receive_with_fds();
+
+    /**
+     * @brief Closes the file descriptors received from the server and not consumed yet.
+     */
+    void close_received_fds();
+
+    /**
+     * @brief Handles the write event in a client socket connected to the server socket.
+     *
+     * Sends the data queued because the socket was not ready for writing when it was sent. Stops
+     * monitoring the write event once all of it has been sent.
+     *
+     * @param fd File descriptor of the connected socket.
+     */
+    void handle_write(int fd);
+
     /**
      * @brief Handles the disconnect and error events in a client socket connected to the server
      * socket.
@@ -130,6 +160,36 @@ private:
      */
     void handle_message(const beerocks::transport::messages::Message &message);
 
+    /**
+     * @brief Handles the reply of the server to a shared memory mode request.
+     *
+     * Maps the shared memory using the file descriptors received along with the message.
+     *
+     * @param message Shared memory configuration received from server.
+     */
+    void handle_shared_memory_configuration(
+        const beerocks::transport::messages::SharedMemoryConfigurationMessage &message);
+
+    /**
+     * @brief Handles a CMDU published through the shared memory.
+     *
+     * Copies the CMDU out of the shared memory slot, releases the slot and handles the CMDU.
+     *
+     * @param message Descriptor of the shared memory slot holding the CMDU.
+     */
+    void handle_shared_memory_cmdu(
+        const beerocks::transport::messages::SharedMemoryCmduRxMessage &message);
+
+    /**
+     * @brief Parses a received CMDU and notifies that it has been received.
+     *
+     * @param metadata Metadata of the CmduRxMessage the CMDU was received in.
+     * @param cmdu_rx_buffer Buffer holding the CMDU (parsed in place).
+     * @param buffer_size Size of the buffer.
+     */
+    void handle_cmdu(const beerocks::transport::messages::CmduRxMessage::Metadata &metadata,
+                     uint8_t *cmdu_rx_buffer, size_t buffer_size);
+
     /**
      * @brief Closes connection between client and server socket.
      *
@@ -197,7 +257,33 @@ private:
      * If connection uses a message-oriented socket instead, this buffer and the code that
      * uses it is also valid.
      */
-    beerocks::net::BufferImpl<broker_buffer_size> m_buffer;
+    beerocks::net::RingBufferImpl m_buffer{broker_buffer_size};
+
+    /**
+     * Queue of the data not sent yet through the socket connection because the socket was not
+     * ready for writing.
+     */
+    beerocks::net::SendQueue m_send_queue;
+
+    /**
+     * Request the shared memory mode when subscribing.
+     */
+    bool m_shared_memory_requested;
+
+    /**
+     * File descriptors received from the server and not consumed yet.
+     */
+    std::vector<int> m_received_fds;
+
+    /**
+     * Shared memory of the broker server, once the shared memory mode has been negotiated.
+     */
+    std::unique_ptr<beerocks::transport::messages::SharedMemoryRing> m_shared_memory;
+
+    /**
+     * Index given by the server to this client as a consumer of the shared memory.
+     */
+    uint8_t m_shared_memory_consumer = 0;
 };
 
 } // namespace btl
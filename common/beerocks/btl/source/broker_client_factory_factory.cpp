@@ -21,7 +21,7 @@ namespace btl {
 
 std::unique_ptr<BrokerClientFactory>
 create_broker_client_factory(const std::string &uds_path,
-                             std::shared_ptr<beerocks::EventLoop> event_loop)
+                             std::shared_ptr<beerocks::EventLoop> event_loop, bool shared_memory)
 {
     // Create parser for broker messages received through a stream-oriented socket.
     auto message_parser = std::make_shared<beerocks::btl::MessageParserStreamImpl>();
@@ -32,8 +32,8 @@ create_broker_client_factory(const std::string &uds_path,
     LOG_IF(!message_serializer, FATAL) << "Unable to create message serializer!";
 
     // Create broker client factory to create broker clients when requested
-    return std::make_unique<beerocks::btl::BrokerClientFactoryImpl>(uds_path, message_parser,
-                                                                    message_serializer, event_loop);
+    return std::make_unique<beerocks::btl::BrokerClientFactoryImpl>(
+        uds_path, message_parser, message_serializer, event_loop, shared_memory);
 }
 
 } // namespace btl
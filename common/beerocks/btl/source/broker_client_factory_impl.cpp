@@ -22,9 +22,10 @@ namespace btl {
 BrokerClientFactoryImpl::BrokerClientFactoryImpl(
     const std::string &uds_path, std::shared_ptr<MessageParser> message_parser,
     std::shared_ptr<MessageSerializer> message_serializer,
-    std::shared_ptr<beerocks::EventLoop> event_loop)
+    std::shared_ptr<beerocks::EventLoop> event_loop, bool shared_memory)
     : m_uds_path(uds_path), m_message_parser(message_parser),
-      m_message_serializer(message_serializer), m_event_loop(event_loop)
+      m_message_serializer(message_serializer), m_event_loop(event_loop),
+      m_shared_memory(shared_memory)
 {
     LOG_IF(m_uds_path.empty(), FATAL) << "UDS path is an empty string!";
     LOG_IF(!m_message_parser, FATAL) << "Message parser is a null pointer!";
@@ -75,8 +76,9 @@ std::shared_ptr<BrokerClient> BrokerClientFactoryImpl::create_instance()
     }
 
     LOG(DEBUG) << "Broker client created with fd = " << connection->socket()->fd();
-    auto broker_client = std::make_shared<BrokerClientImpl>(std::move(connection), m_message_parser,
-                                                            m_message_serializer, m_event_loop);
+    auto broker_client =
+        std::make_shared<BrokerClientImpl>(std::move(connection), m_message_parser,
+                                           m_message_serializer, m_event_loop, m_shared_memory);
     if (!broker_client) {
         LOG(ERROR) << "Unable to create broker client connected to '" << address.path() + "'";
         return nullptr;
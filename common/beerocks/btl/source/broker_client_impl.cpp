@@ -10,10 +10,14 @@
 
 #include <bcl/beerocks_cmdu_utils.h>
 #include <bcl/beerocks_utils.h>
+#include <bcl/network/buffer_impl.h>
 #include <bcl/network/network_utils.h>
 
 #include <easylogging++.h>
 
+#include <sys/socket.h>
+#include <unistd.h>
+
 namespace beerocks {
 
 namespace btl {
@@ -21,9 +25,11 @@ namespace btl {
 BrokerClientImpl::BrokerClientImpl(std::unique_ptr<beerocks::net::Socket::Connection> connection,
                                    std::shared_ptr<MessageParser> message_parser,
                                    std::shared_ptr<MessageSerializer> message_serializer,
-                                   std::shared_ptr<beerocks::EventLoop> event_loop)
+                                   std::shared_ptr<beerocks::EventLoop> event_loop,
+                                   bool shared_memory)
     : m_connection(std::move(connection)), m_message_parser(message_parser),
-      m_message_serializer(message_serializer), m_event_loop(event_loop)
+      m_message_serializer(message_serializer), m_event_loop(event_loop),
+      m_shared_memory_requested(shared_memory)
 {
     LOG_IF(!m_connection, FATAL) << "Connection is a null pointer!";
     LOG_IF(!m_message_parser, FATAL) << "Message parser is a null pointer!";
@@ -63,7 +69,12 @@ BrokerClientImpl::BrokerClientImpl(std::unique_ptr<beerocks::net::Socket::Connec
         << "Failed registering event handlers for the connection!";
 }
 
-BrokerClientImpl::~BrokerClientImpl() { close_connection(true); }
+BrokerClientImpl::~BrokerClientImpl()
+{
+    close_connection(true);
+
+    close_received_fds();
+}
 
 bool BrokerClientImpl::subscribe(const std::set<ieee1905_1::eMessageType> &msg_types)
 {
@@ -92,12 +103,16 @@ bool BrokerClientImpl::subscribe(const std::set<ieee1905_1::eMessageType> &msg_t
         ++message.metadata()->msg_types_count;
     }
 
+    // Ask for the shared memory mode (the server replies with a SharedMemoryConfigurationMessage
+    // if it accepts)
+    message.metadata()->shared_memory = m_shared_memory_requested && !m_shared_memory;
+
     return send_message(message);
 }
 
 bool BrokerClientImpl::configure_interfaces(const std::string &iface_name,
                                             const std::string &bridge_name, bool is_bridge,
-                                            bool add)
+                                            bool add, bool rx_ring)
 {
     beerocks::transport::messages::InterfaceConfigurationRequestMessage message;
 
@@ -105,6 +120,7 @@ bool BrokerClientImpl::configure_interfaces(const std::string &iface_name,
     string_utils::copy_string(message.metadata()->bridge_name, bridge_name.c_str(), IF_NAMESIZE);
     message.metadata()->is_bridge = is_bridge;
     message.metadata()->add       = add;
+    message.metadata()->rx_ring   = rx_ring;
 
     LOG(DEBUG) << "Configuring bridge " << iface_name << " to ieee1905 transport";
 
@@ -170,7 +186,10 @@ bool BrokerClientImpl::forward_cmdu(ieee1905_1::CmduMessageRx &cmdu_rx, const sM
 void BrokerClientImpl::handle_read(int fd)
 {
     // Read available bytes into buffer
-    int bytes_received = m_connection->receive(m_buffer);
+    // While the shared memory mode is being negotiated, the server might pass file descriptors
+    int bytes_received = (m_shared_memory_requested && !m_shared_memory)
+                             ? receive_with_fds()
+                             : m_connection->receive(m_buffer);
     if (bytes_received <= 0) {
         LOG(ERROR) << "Bytes received through connection: " << bytes_received << ", fd = " << fd;
         return;
@@ -192,6 +211,73 @@ void BrokerClientImpl::handle_read(int fd)
     }
 }
 
+int BrokerClientImpl::receive_with_fds()
+{
+    beerocks::net::Buffer &buffer = m_buffer;
+
+    if (buffer.length() >= buffer.size()) {
+        // Buffer is full
+        return -1;
+    }
+
+    struct iovec iov = {.iov_base = buffer.data() + buffer.length(),
+                        .iov_len  = buffer.size() - buffer.length()};
+
+    union {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(sizeof(int) * beerocks::transport::messages::kMaxPassedFds)];
+    } control;
+
+    struct msghdr msgh  = {};
+    msgh.msg_iov        = &iov;
+    msgh.msg_iovlen     = 1;
+    msgh.msg_control    = control.buf;
+    msgh.msg_controllen = sizeof(control.buf);
+
+    int result = recvmsg(m_connection->socket()->fd(), &msgh, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+    if (result > 0) {
+        buffer.length() += static_cast<size_t>(result);
+    }
+
+    for (auto cmsg = CMSG_FIRSTHDR(&msgh); cmsg; cmsg = CMSG_NXTHDR(&msgh, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+
+        // Only the file descriptors passed along with the last message are kept
+        close_received_fds();
+        size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        m_received_fds.resize(count);
+        std::copy_n(CMSG_DATA(cmsg), count * sizeof(int),
+                    reinterpret_cast<uint8_t *>(m_received_fds.data()));
+    }
+
+    return result;
+}
+
+void BrokerClientImpl::close_received_fds()
+{
+    for (int fd : m_received_fds) {
+        close(fd);
+    }
+    m_received_fds.clear();
+}
+
+void BrokerClientImpl::handle_write(int fd)
+{
+    // Send queued data. On error, drop it: the connection will most likely be closed soon
+    if (!m_send_queue.flush(*m_connection)) {
+        LOG(ERROR) << "Failed to send queued data, dropping " << m_send_queue.length()
+                   << " bytes, fd = " << fd;
+        m_send_queue.clear();
+    }
+
+    // Stop monitoring the write event once all queued data has been sent
+    if (m_send_queue.empty()) {
+        m_event_loop->set_write_handler(fd, nullptr);
+    }
+}
+
 void BrokerClientImpl::handle_close(int fd)
 {
     // Close the connection
@@ -206,8 +292,20 @@ void BrokerClientImpl::handle_close(int fd)
 
 void BrokerClientImpl::handle_message(const beerocks::transport::messages::Message &message)
 {
-    // Check if received message contains a CMDU
-    if (beerocks::transport::messages::Type::CmduRxMessage != message.type()) {
+    switch (message.type()) {
+    case beerocks::transport::messages::Type::CmduRxMessage:
+        break;
+    case beerocks::transport::messages::Type::SharedMemoryConfigurationMessage:
+        handle_shared_memory_configuration(
+            reinterpret_cast<const beerocks::transport::messages::SharedMemoryConfigurationMessage
+                                 &>(message));
+        return;
+    case beerocks::transport::messages::Type::SharedMemoryCmduRxMessage:
+        handle_shared_memory_cmdu(
+            reinterpret_cast<const beerocks::transport::messages::SharedMemoryCmduRxMessage &>(
+                message));
+        return;
+    default:
         LOG(ERROR) << "Received non CmduRxMessage:\n\tMessage: " << message
                    << "\n\tFrame: " << message.frame().str();
         return;
@@ -228,33 +326,114 @@ void BrokerClientImpl::handle_message(const beerocks::transport::messages::Messa
         return;
     }
 
-    // Verify CMDU
-    if (!CmduUtils::verify_cmdu(cmdu_data, cmdu_length)) {
-        LOG(ERROR) << "Failed verifying CMDU!";
-        LOG(DEBUG) << "hex_dump (" << cmdu_length << " bytes):" << std::endl
-                   << utils::dump_buffer(cmdu_data, cmdu_length);
+    // Copy the data to rx_buffer
+    std::copy_n(cmdu_data, cmdu_length, cmdu_rx_buffer);
+
+    handle_cmdu(*cmdu_rx_msg->metadata(), cmdu_rx_buffer, sizeof(cmdu_rx_buffer));
+}
+
+void BrokerClientImpl::handle_shared_memory_configuration(
+    const beerocks::transport::messages::SharedMemoryConfigurationMessage &message)
+{
+    // The read-only file descriptor of the data region, then the one of the state region
+    if (m_received_fds.size() != 2) {
+        LOG(ERROR) << "Shared memory configuration received with " << m_received_fds.size()
+                   << " file descriptors instead of 2";
+        close_received_fds();
         return;
     }
 
-    // Copy the data to rx_buffer
-    std::copy_n(cmdu_data, cmdu_length, cmdu_rx_buffer);
+    // The ring takes ownership of the file descriptors
+    m_shared_memory = beerocks::transport::messages::SharedMemoryRing::attach_instance(
+        m_received_fds[0], m_received_fds[1], message.metadata()->slot_count,
+        message.metadata()->slot_size);
+    m_received_fds.clear();
+
+    if (!m_shared_memory) {
+        LOG(ERROR) << "Failed mapping the broker shared memory";
+        return;
+    }
+    m_shared_memory_consumer = message.metadata()->consumer;
+
+    LOG(DEBUG) << "Receiving CMDUs through the broker shared memory";
+}
 
-    // Parse CMDU
-    ieee1905_1::CmduMessageRx cmdu_rx(cmdu_rx_buffer, sizeof(cmdu_rx_buffer));
-    if (!cmdu_rx.parse()) {
+void BrokerClientImpl::handle_shared_memory_cmdu(
+    const beerocks::transport::messages::SharedMemoryCmduRxMessage &message)
+{
+    if (!m_shared_memory) {
+        LOG(ERROR) << "Received a shared memory CMDU before the shared memory was configured";
+        return;
+    }
+
+    using CmduRxMetadata = beerocks::transport::messages::CmduRxMessage::Metadata;
+
+    uint32_t slot       = message.metadata()->slot;
+    uint16_t generation = message.metadata()->generation;
+
+    size_t length;
+    auto data = m_shared_memory->get(slot, generation, length);
+    if (!data || length < sizeof(CmduRxMetadata)) {
+        LOG(ERROR) << "Invalid shared memory slot " << slot;
+        m_shared_memory->release(slot, generation, m_shared_memory_consumer);
+        return;
+    }
+
+    // Buffer to hold CMDU received
+    uint8_t cmdu_rx_buffer[message::MESSAGE_BUFFER_LENGTH];
+
+    // Copy the metadata and the CMDU out of the shared memory - this is the only copy of the CMDU.
+    // It cannot be parsed in place: parsing swaps the byte order of the CMDU in its buffer, while
+    // the shared memory is mapped read-only.
+    CmduRxMetadata metadata;
+    std::copy_n(data, sizeof(metadata), reinterpret_cast<uint8_t *>(&metadata));
+
+    size_t cmdu_length = metadata.length;
+    bool fits          = (sizeof(cmdu_rx_buffer) >= cmdu_length) &&
+                (length - sizeof(CmduRxMetadata) >= cmdu_length);
+    if (fits) {
+        std::copy_n(data + sizeof(CmduRxMetadata), cmdu_length, cmdu_rx_buffer);
+    }
+
+    // The copy is only valid if the slot was still referenced by this client while reading it
+    // (the server releases the references of a client it considers disconnected)
+    if (!m_shared_memory->release(slot, generation, m_shared_memory_consumer)) {
+        LOG(ERROR) << "Shared memory slot " << slot << " was released while reading it";
+        return;
+    }
+
+    if (!fits) {
+        LOG(DEBUG) << "Buffer size (" << sizeof(cmdu_rx_buffer) << ") is less than CMDU length ("
+                   << cmdu_length << ")";
+        return;
+    }
+
+    handle_cmdu(metadata, cmdu_rx_buffer, sizeof(cmdu_rx_buffer));
+}
+
+void BrokerClientImpl::handle_cmdu(
+    const beerocks::transport::messages::CmduRxMessage::Metadata &metadata,
+    uint8_t *cmdu_rx_buffer, size_t buffer_size)
+{
+    size_t cmdu_length = metadata.length;
+
+    // Parse CMDU. Handlers usually read a few TLVs only, so the rest are parsed on demand. The
+    // TLV chain is walked once, verifying the TLVs at the same time.
+    ieee1905_1::CmduMessageRx cmdu_rx(cmdu_rx_buffer, buffer_size);
+    if (!cmdu_rx.parse(cmdu_rx_buffer, cmdu_length, true, CmduUtils::verify_tlv)) {
         LOG(ERROR) << "Failed parsing CMDU!";
         LOG(DEBUG) << "hex_dump (" << cmdu_length << " bytes):" << std::endl
-                   << utils::dump_buffer(cmdu_data, cmdu_length);
+                   << utils::dump_buffer(cmdu_rx_buffer, cmdu_length);
         return;
     }
 
     cmdu_rx.received_time = std::chrono::time_point<std::chrono::system_clock>(
-        std::chrono::seconds(cmdu_rx_msg->metadata()->received_time));
+        std::chrono::seconds(metadata.received_time));
 
     // Set the rest of fields to notify
-    uint32_t iface_index = cmdu_rx_msg->metadata()->if_index;
-    sMacAddr dst_mac     = tlvf::mac_from_array(cmdu_rx_msg->metadata()->dst);
-    sMacAddr src_mac     = tlvf::mac_from_array(cmdu_rx_msg->metadata()->src);
+    uint32_t iface_index = metadata.if_index;
+    sMacAddr dst_mac     = tlvf::mac_from_array(metadata.dst);
+    sMacAddr src_mac     = tlvf::mac_from_array(metadata.src);
 
     // Finally, notify that a CMDU has been received from broker server
     notify_cmdu_received(iface_index, dst_mac, src_mac, cmdu_rx);
@@ -270,8 +449,9 @@ void BrokerClientImpl::close_connection(bool remove_handlers)
             m_event_loop->remove_handlers(m_connection->socket()->fd());
         }
 
-        // Terminate the connection
+        // Terminate the connection, dropping the data not sent yet
         m_connection.reset();
+        m_send_queue.clear();
     }
 }
 
@@ -319,8 +499,19 @@ bool BrokerClientImpl::send_message(const beerocks::transport::messages::Message
         return false;
     }
 
-    // Send data
-    return m_connection->send(buffer);
+    // Send data, or queue it until the socket is ready for writing
+    struct iovec chunk = {const_cast<uint8_t *>(buffer.data()), buffer.length()};
+    bool result        = m_send_queue.send(*m_connection, &chunk, 1);
+
+    if (!m_send_queue.empty()) {
+        m_event_loop->set_write_handler(m_connection->socket()->fd(),
+                                        [&](int fd, EventLoop &loop) {
+                                            handle_write(fd);
+                                            return true;
+                                        });
+    }
+
+    return result;
 }
 
 } // namespace btl
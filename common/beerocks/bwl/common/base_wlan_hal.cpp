@@ -11,8 +11,6 @@
 #include <bcl/beerocks_string_utils.h>
 
 #include <errno.h>
-#include <sys/eventfd.h>
-#include <unistd.h>
 
 #include <easylogging++.h>
 
@@ -27,39 +25,24 @@ base_wlan_hal::base_wlan_hal(HALType type, std::string iface_name, IfaceType ifa
     m_radio_info.iface_name = iface_name;
     m_radio_info.iface_type = iface_type;
 
-    // Create an eventfd for internal events
-    if ((m_fd_int_events = eventfd(0, EFD_SEMAPHORE)) < 0) {
+    // The eventfd for internal events is created by the queue
+    if (m_queue_events.fd() < 0) {
         LOG(FATAL) << "Failed creating eventfd: " << strerror(errno);
     }
 }
 
-base_wlan_hal::~base_wlan_hal()
-{
-    // Close the eventfd used for internal events
-    if (m_fd_int_events != -1) {
-        if (close(m_fd_int_events) == -1) {
-            LOG(ERROR) << "Failed to close internal event descriptor: " << m_fd_int_events
-                       << " with error: " << strerror(errno);
-        } else {
-            LOG(DEBUG) << "Closed internal event descriptor: " << m_fd_int_events;
-        }
-        m_fd_int_events = -1;
-    }
-}
+base_wlan_hal::~base_wlan_hal() {}
+
+constexpr size_t base_wlan_hal::INT_EVENTS_QUEUE_SIZE;
 
 bool base_wlan_hal::event_queue_push(int event, std::shared_ptr<void> data)
 {
-    // Create a new shared pointer of the event and the payload
-    auto event_ptr = std::make_shared<hal_event_t>(hal_event_t(event, data));
-
-    // Push the event into the queue
-    // push with block (default true) can't return false
-    m_queue_events.push(event_ptr);
-
-    // Increment the eventfd counter by 1
-    uint64_t counter = 1;
-    if (write(m_fd_int_events, &counter, sizeof(counter)) < 0) {
-        LOG(ERROR) << "Failed updating eventfd counter: " << strerror(errno);
+    // The event is stored in a preallocated slot of the queue, only the payload is allocated
+    // (unless a burst of events overflows the slots).
+    if (!m_queue_events.push(hal_event_t(event, std::move(data)))) {
+        LOG(ERROR) << "Failed to queue event " << event
+                   << ", queue is full or eventfd is not writable (events dropped so far: "
+                   << m_queue_events.dropped() << ")";
         return false;
     }
 
@@ -163,45 +146,25 @@ base_wlan_hal::create_mgmt_frame_notification(const char *mgmt_frame_hex)
 
 bool base_wlan_hal::process_int_events()
 {
-    uint64_t counter                           = 0;
-    bool ret                                   = true;
-    constexpr uint8_t MAX_EVENTS_PER_ITERATION = 250;
-    uint8_t events_received                    = 0;
+    bool ret                                  = true;
+    constexpr size_t MAX_EVENTS_PER_ITERATION = 250;
 
     if (!m_int_event_cb) {
         LOG(ERROR) << "Event callback not registered!";
         return false;
     }
 
-    if (m_queue_events.empty()) {
-        LOG(WARNING) << "process_int_events() called but queue is empty";
-        return true;
-    }
-
-    do {
-        // Read the counter value of the eventfd
-        if (read(m_fd_int_events, &counter, sizeof(counter)) < 0) {
-            LOG(ERROR) << "Failed reading eventfd counter: " << strerror(errno);
-            return false;
-        }
-
-        if (!counter) {
-            LOG(WARNING) << "process_int_events() called but counter is 0";
-            return false;
-        }
-        // Pop an event from the queue
-        auto event = m_queue_events.pop(true, 250);
-
-        if (!event) {
-            LOG(WARNING) << "process_int_events() called but event is nullptr";
-            return false;
-        }
-
-        ++events_received;
-
-        // Call the callback for handling the event
-        ret &= m_int_event_cb(event);
-    } while (!m_queue_events.empty() && (events_received < MAX_EVENTS_PER_ITERATION));
+    // Events left over (if the limit is reached) are processed on the next call, as the eventfd
+    // is kept readable
+    size_t events_received = m_queue_events.pop_all(
+        [&](hal_event_t &event) {
+            // Call the callback for handling the event
+            ret &= m_int_event_cb(&event);
+
+            // Release the payload now, instead of when the slot is reused
+            event.second.reset();
+        },
+        MAX_EVENTS_PER_ITERATION);
 
     if (events_received < MAX_EVENTS_PER_ITERATION) {
         LOG(DEBUG) << "All events received, events= " << events_received;
@@ -12,7 +12,7 @@
 #include "base_802_11_defs.h"
 #include "base_wlan_hal_types.h"
 
-#include <bcl/beerocks_thread_safe_queue.h>
+#include <bcl/beerocks_mpsc_event_queue.h>
 #include <bcl/son/son_wireless_utils.h>
 
 #include <functional>
@@ -37,7 +37,8 @@ class base_wlan_hal {
 public:
     // Pair of event ID and payload pointer
     typedef std::pair<int, std::shared_ptr<void>> hal_event_t;
-    typedef std::shared_ptr<hal_event_t> hal_event_ptr_t;
+    // Pointer to a queued event, only valid while the event callback runs
+    typedef const hal_event_t *hal_event_ptr_t;
     typedef std::function<bool(hal_event_ptr_t)> hal_event_cb_t;
 
     // Public methods
@@ -210,7 +211,7 @@ public:
      * Returns a file descriptor to the internal events queue, or -1 on error.
      * The returned file descriptor supports select(), poll() and epoll().
      */
-    int get_int_events_fd() const { return (m_fd_int_events); }
+    int get_int_events_fd() const { return (m_queue_events.fd()); }
 
     /*!
      * Returns a file descriptor to the netlink events queue, or -1 on error.
@@ -398,11 +399,23 @@ private:
 
     bool m_acs_enabled = false;
 
-    int m_fd_int_events = -1;
-
     hal_event_cb_t m_int_event_cb = nullptr;
 
-    beerocks::thread_safe_queue<hal_event_ptr_t> m_queue_events;
+    /*!
+     * Maximum number of internal events queued and not processed yet, in preallocated slots and
+     * in the overflow list used when a burst of events does not fit in them.
+     */
+    static constexpr size_t INT_EVENTS_QUEUE_SIZE          = 1024;
+    static constexpr size_t INT_EVENTS_QUEUE_OVERFLOW_SIZE = 16 * 1024;
+
+    /*!
+     * Queue of internal events, processed by the thread of the HAL user. The eventfd of the
+     * queue is the one returned by get_int_events_fd().
+     * Events may be pushed from more than one thread (e.g. the dwpald HAL pushes from the
+     * dwpald listener thread and from the thread of the HAL user).
+     */
+    beerocks::mpsc_event_queue<hal_event_t> m_queue_events{INT_EVENTS_QUEUE_SIZE,
+                                                           INT_EVENTS_QUEUE_OVERFLOW_SIZE};
 };
 
 } // namespace bwl
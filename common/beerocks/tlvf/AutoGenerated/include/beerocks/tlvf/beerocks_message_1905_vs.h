@@ -52,6 +52,7 @@ class tlvVsClientAssociationEvent : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2d0afbba43146312ULL; }
 
     private:
         bool init();
@@ -90,9 +91,11 @@ class tlvVsChannelScanRequestExtension : public BaseClass
         uint8_t& scan_requests_list_length();
         std::tuple<bool, sScanRequestExtension&> scan_requests_list(size_t idx);
         bool alloc_scan_requests_list(size_t count = 1);
+        sScanRequestExtension* reserve_scan_requests_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9a6b5d4129265034ULL; }
 
     private:
         bool init();
@@ -117,6 +120,7 @@ class tlvVsChannelScanReportDone : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6b84ae351e8d000cULL; }
 
     private:
         bool init();
@@ -139,6 +143,7 @@ class tlvVsOnDemandChannelSelection : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa3a8ed8be0b87289ULL; }
 
     private:
         bool init();
@@ -160,9 +165,11 @@ class tlvVsBssidIfaceMapping : public BaseClass
         uint8_t& bssid_vap_id_map_length();
         std::tuple<bool, sBssidVapId&> bssid_vap_id_map(size_t idx);
         bool alloc_bssid_vap_id_map(size_t count = 1);
+        sBssidVapId* reserve_bssid_vap_id_map(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd4d075a16c5c50fdULL; }
 
     private:
         bool init();
@@ -50,6 +50,7 @@ class cACTION_APMANAGER_UP_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xba4c37aec10a6e77ULL; }
 
     private:
         bool init();
@@ -75,6 +76,7 @@ class cACTION_APMANAGER_CONFIGURE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x66f87b815800f1f2ULL; }
 
     private:
         bool init();
@@ -104,6 +106,7 @@ class cACTION_APMANAGER_JOINED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0085d11b57b8da67ULL; }
 
     private:
         bool init();
@@ -135,6 +138,7 @@ class cACTION_APMANAGER_ENABLE_APS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4aef1306851adb32ULL; }
 
     private:
         bool init();
@@ -158,6 +162,7 @@ class cACTION_APMANAGER_ENABLE_APS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x09f209aa2d30e35eULL; }
 
     private:
         bool init();
@@ -179,6 +184,7 @@ class cACTION_APMANAGER_HOSTAP_SET_RESTRICTED_FAILSAFE_CHANNEL_REQUEST : public
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd886e96f7e9ac950ULL; }
 
     private:
         bool init();
@@ -200,6 +206,7 @@ class cACTION_APMANAGER_HOSTAP_SET_RESTRICTED_FAILSAFE_CHANNEL_RESPONSE : public
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x00e5136ebbd87e9cULL; }
 
     private:
         bool init();
@@ -221,6 +228,7 @@ class cACTION_APMANAGER_HOSTAP_AP_DISABLED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x60e171f9072a8c56ULL; }
 
     private:
         bool init();
@@ -243,6 +251,7 @@ class cACTION_APMANAGER_HOSTAP_AP_ENABLED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x230c3d2a3f257bc9ULL; }
 
     private:
         bool init();
@@ -264,6 +273,7 @@ class cACTION_APMANAGER_HOSTAP_VAPS_LIST_UPDATE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x76a85eeb1e52e99bULL; }
 
     private:
         bool init();
@@ -283,6 +293,7 @@ class cACTION_APMANAGER_HOSTAP_GENERATE_CLIENT_ASSOCIATION_NOTIFICATIONS_REQUEST
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0d2aa779bf5de480ULL; }
 
     private:
         bool init();
@@ -303,6 +314,7 @@ class cACTION_APMANAGER_HOSTAP_VAPS_LIST_UPDATE_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf5d7d9deff71e3ddULL; }
 
     private:
         bool init();
@@ -328,6 +340,7 @@ class cACTION_APMANAGER_HOSTAP_CHANNEL_SWITCH_ACS_START : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcaffa329717a3f97ULL; }
 
     private:
         bool init();
@@ -353,6 +366,7 @@ class cACTION_APMANAGER_HOSTAP_CANCEL_ACTIVE_CAC_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xac530f3c0c549d83ULL; }
 
     private:
         bool init();
@@ -374,6 +388,7 @@ class cACTION_APMANAGER_HOSTAP_CANCEL_ACTIVE_CAC_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x29c387b1c3fb7191ULL; }
 
     private:
         bool init();
@@ -395,6 +410,7 @@ class cACTION_APMANAGER_HOSTAP_CSA_ERROR_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd83e6c2fef3cb8f4ULL; }
 
     private:
         bool init();
@@ -416,6 +432,7 @@ class cACTION_APMANAGER_HOSTAP_CSA_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7f370e73cd9889afULL; }
 
     private:
         bool init();
@@ -437,6 +454,7 @@ class cACTION_APMANAGER_HOSTAP_ACS_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xec4e59a703f7d76bULL; }
 
     private:
         bool init();
@@ -458,6 +476,7 @@ class cACTION_APMANAGER_HOSTAP_DFS_CAC_STARTED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6b464962049ca85dULL; }
 
     private:
         bool init();
@@ -479,6 +498,7 @@ class cACTION_APMANAGER_HOSTAP_DFS_CAC_COMPLETED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb487d325f1c31d81ULL; }
 
     private:
         bool init();
@@ -500,6 +520,7 @@ class cACTION_APMANAGER_HOSTAP_DFS_CHANNEL_AVAILABLE_NOTIFICATION : public BaseC
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa5b4568fb13aaa35ULL; }
 
     private:
         bool init();
@@ -521,6 +542,7 @@ class cACTION_APMANAGER_HOSTAP_SET_NEIGHBOR_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x48b34d13866facc3ULL; }
 
     private:
         bool init();
@@ -542,6 +564,7 @@ class cACTION_APMANAGER_HOSTAP_REMOVE_NEIGHBOR_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x19ef4eaf80d6fe57ULL; }
 
     private:
         bool init();
@@ -567,6 +590,7 @@ class cACTION_APMANAGER_HOSTAP_ZWDFS_ANT_CHANNEL_SWITCH_REQUEST : public BaseCla
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7dfda30c11651611ULL; }
 
     private:
         bool init();
@@ -592,6 +616,7 @@ class cACTION_APMANAGER_HOSTAP_ZWDFS_ANT_CHANNEL_SWITCH_RESPONSE : public BaseCl
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x695ce426940999efULL; }
 
     private:
         bool init();
@@ -613,6 +638,7 @@ class cACTION_APMANAGER_HOSTAP_SET_PRIMARY_VLAN_ID_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1e854a2d6c225421ULL; }
 
     private:
         bool init();
@@ -634,6 +660,7 @@ class cACTION_APMANAGER_HOSTAP_SERVICE_PRIO_CONFIG : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3259c22719ecffbbULL; }
 
     private:
         bool init();
@@ -655,6 +682,7 @@ class cACTION_APMANAGER_HOSTAP_SPATIAL_REUSE_REPORT_NOTIFICATION : public BaseCl
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb143b6121512384aULL; }
 
     private:
         bool init();
@@ -687,6 +715,7 @@ class cACTION_APMANAGER_CLIENT_ASSOCIATED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7e88b5e4f59cb83aULL; }
 
     private:
         bool init();
@@ -715,6 +744,7 @@ class cACTION_APMANAGER_CLIENT_DISCONNECTED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x87dd7b5296e0bbd5ULL; }
 
     private:
         bool init();
@@ -740,6 +770,7 @@ class cACTION_APMANAGER_CLIENT_DISCONNECT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7a689d370e2c1856ULL; }
 
     private:
         bool init();
@@ -765,6 +796,7 @@ class cACTION_APMANAGER_CLIENT_DISCONNECT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb08c653ce24dc56aULL; }
 
     private:
         bool init();
@@ -785,11 +817,13 @@ class cACTION_APMANAGER_CLIENT_DISALLOW_REQUEST : public BaseClass
         uint8_t& sta_list_size();
         std::tuple<bool, sStaAssociationControl&> sta(size_t idx);
         bool alloc_sta(size_t count = 1);
+        sStaAssociationControl* reserve_sta(size_t count);
         sMacAddr& bssid();
         uint16_t& validity_period_sec();
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5738a92c98ecca95ULL; }
 
     private:
         bool init();
@@ -815,10 +849,12 @@ class cACTION_APMANAGER_CLIENT_ALLOW_REQUEST : public BaseClass
         uint8_t& mac_list_size();
         std::tuple<bool, sMacAddr&> mac(size_t idx);
         bool alloc_mac(size_t count = 1);
+        sMacAddr* reserve_mac(size_t count);
         sMacAddr& bssid();
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9d021a874f8c6871ULL; }
 
     private:
         bool init();
@@ -844,6 +880,7 @@ class cACTION_APMANAGER_CLIENT_RX_RSSI_MEASUREMENT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf9190f50a685ff77ULL; }
 
     private:
         bool init();
@@ -865,6 +902,7 @@ class cACTION_APMANAGER_CLIENT_RX_RSSI_MEASUREMENT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfe8ab7bce5c441adULL; }
 
     private:
         bool init();
@@ -887,6 +925,7 @@ class cACTION_APMANAGER_ACK : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc726e75bd72ea167ULL; }
 
     private:
         bool init();
@@ -909,6 +948,7 @@ class cACTION_APMANAGER_CLIENT_BSS_STEER_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x09cd73a9ae02a222ULL; }
 
     private:
         bool init();
@@ -930,6 +970,7 @@ class cACTION_APMANAGER_CLIENT_BSS_STEER_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd20cbdd481953b8eULL; }
 
     private:
         bool init();
@@ -951,6 +992,7 @@ class cACTION_APMANAGER_CLIENT_RX_RSSI_MEASUREMENT_CMD_RESPONSE : public BaseCla
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x76049e7abb87e284ULL; }
 
     private:
         bool init();
@@ -972,6 +1014,7 @@ class cACTION_APMANAGER_STEERING_CLIENT_SET_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4c3682a441d22f80ULL; }
 
     private:
         bool init();
@@ -993,6 +1036,7 @@ class cACTION_APMANAGER_STEERING_CLIENT_SET_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe21806e046ddb34cULL; }
 
     private:
         bool init();
@@ -1014,6 +1058,7 @@ class cACTION_APMANAGER_STEERING_EVENT_PROBE_REQ_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1d09e2f3a546321eULL; }
 
     private:
         bool init();
@@ -1035,6 +1080,7 @@ class cACTION_APMANAGER_STEERING_EVENT_AUTH_FAIL_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xeb6b66fbbed39ec4ULL; }
 
     private:
         bool init();
@@ -1065,6 +1111,7 @@ class cACTION_APMANAGER_WIFI_CREDENTIALS_UPDATE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6308af3097e68828ULL; }
 
     private:
         bool init();
@@ -1094,6 +1141,7 @@ class cACTION_APMANAGER_WIFI_CREDENTIALS_UPDATE_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3bbd04145a4728c4ULL; }
 
     private:
         bool init();
@@ -1114,6 +1162,7 @@ class cACTION_APMANAGER_START_WPS_PBC_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7887728a31c0bf6bULL; }
 
     private:
         bool init();
@@ -1135,6 +1184,7 @@ class cACTION_APMANAGER_SET_ASSOC_DISALLOW_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe5089f6acfb332acULL; }
 
     private:
         bool init();
@@ -1156,6 +1206,7 @@ class cACTION_APMANAGER_RADIO_DISABLE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdd6d324d60961a20ULL; }
 
     private:
         bool init();
@@ -1175,6 +1226,7 @@ class cACTION_APMANAGER_RADIO_ENABLE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc8b5c750caa22547ULL; }
 
     private:
         bool init();
@@ -1194,6 +1246,7 @@ class cACTION_APMANAGER_HEARTBEAT_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5b5b7a95b51272e4ULL; }
 
     private:
         bool init();
@@ -1213,6 +1266,7 @@ class cACTION_APMANAGER_CHANNELS_LIST_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd098c52646134549ULL; }
 
     private:
         bool init();
@@ -1236,6 +1290,7 @@ class cACTION_APMANAGER_CHANNELS_LIST_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8eb0b8e36d681ed7ULL; }
 
     private:
         bool init();
@@ -1261,6 +1316,7 @@ class cACTION_APMANAGER_SET_MAP_CONTROLLER_PROFILE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3d482050138d470eULL; }
 
     private:
         bool init();
@@ -1289,6 +1345,7 @@ class cACTION_APMANAGER_STATE_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa314a8e053a02effULL; }
 
     private:
         bool init();
@@ -1315,6 +1372,7 @@ class cACTION_APMANAGER_MULTI_CHAN_BEACON_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb10442b22f49abbbULL; }
 
     private:
         bool init();
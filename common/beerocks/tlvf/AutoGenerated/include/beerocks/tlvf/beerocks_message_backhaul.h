@@ -41,6 +41,7 @@ class cACTION_BACKHAUL_REGISTER_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6021e807ea6bfbdcULL; }
 
     private:
         bool init();
@@ -60,6 +61,7 @@ class cACTION_BACKHAUL_REGISTER_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe08dde525dab64b0ULL; }
 
     private:
         bool init();
@@ -79,6 +81,7 @@ class cACTION_BACKHAUL_ENABLE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcf10d0a1fea16494ULL; }
 
     private:
         bool init();
@@ -98,6 +101,7 @@ class cACTION_BACKHAUL_CONNECTED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xec1227d858a558ccULL; }
 
     private:
         bool init();
@@ -118,6 +122,7 @@ class cACTION_BACKHAUL_DISCONNECTED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7c8b0bdf22545296ULL; }
 
     private:
         bool init();
@@ -145,6 +150,7 @@ class cACTION_BACKHAUL_ENABLE_APS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x85e4196c52a1ef6fULL; }
 
     private:
         bool init();
@@ -171,6 +177,7 @@ class cACTION_BACKHAUL_UPDATE_STOP_ON_FAILURE_ATTEMPTS_REQUEST : public BaseClas
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf1e92335fe7115e9ULL; }
 
     private:
         bool init();
@@ -195,6 +202,7 @@ class cACTION_BACKHAUL_AP_DISABLED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa3ea547ae27263ffULL; }
 
     private:
         bool init();
@@ -218,6 +226,7 @@ class cACTION_BACKHAUL_CLIENT_RX_RSSI_MEASUREMENT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1034f069918e3b5aULL; }
 
     private:
         bool init();
@@ -239,6 +248,7 @@ class cACTION_BACKHAUL_CLIENT_RX_RSSI_MEASUREMENT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7833a5ba23776db6ULL; }
 
     private:
         bool init();
@@ -260,6 +270,7 @@ class cACTION_BACKHAUL_CLIENT_RX_RSSI_MEASUREMENT_CMD_RESPONSE : public BaseClas
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3cb1e847330c9a13ULL; }
 
     private:
         bool init();
@@ -284,6 +295,7 @@ class cACTION_BACKHAUL_START_WPS_PBC_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb3ba890c4dee8d50ULL; }
 
     private:
         bool init();
@@ -308,6 +320,7 @@ class cACTION_BACKHAUL_SET_ASSOC_DISALLOW_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x73bb0b4bc74e39bdULL; }
 
     private:
         bool init();
@@ -329,6 +342,7 @@ class cACTION_BACKHAUL_APPLY_VLAN_POLICY_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9105a327b31b501cULL; }
 
     private:
         bool init();
@@ -352,6 +366,7 @@ class cACTION_BACKHAUL_ZWDFS_RADIO_DETECTED : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6ecedeb7ff2f8bc6ULL; }
 
     private:
         bool init();
@@ -374,6 +389,7 @@ class cACTION_BACKHAUL_CHANNELS_LIST_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x695120dfd835c6deULL; }
 
     private:
         bool init();
@@ -393,6 +409,7 @@ class cACTION_BACKHAUL_CHANNELS_LIST_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1825d28d310bfa62ULL; }
 
     private:
         bool init();
@@ -417,6 +434,7 @@ class cACTION_BACKHAUL_HOSTAP_CHANNEL_SWITCH_ACS_START : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb0799ba533e8190cULL; }
 
     private:
         bool init();
@@ -442,6 +460,7 @@ class cACTION_BACKHAUL_HOSTAP_CANCEL_ACTIVE_CAC_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x30917e70e53a4e26ULL; }
 
     private:
         bool init();
@@ -463,6 +482,7 @@ class cACTION_BACKHAUL_HOSTAP_CANCEL_ACTIVE_CAC_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x07165528ef0494faULL; }
 
     private:
         bool init();
@@ -484,6 +504,7 @@ class cACTION_BACKHAUL_HOSTAP_CSA_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfd86cb48c3bfe2b0ULL; }
 
     private:
         bool init();
@@ -505,6 +526,7 @@ class cACTION_BACKHAUL_HOSTAP_CSA_ERROR_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdbe244926252033fULL; }
 
     private:
         bool init();
@@ -526,6 +548,7 @@ class cACTION_BACKHAUL_HOSTAP_DFS_CAC_STARTED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x783f56bac77bd3a6ULL; }
 
     private:
         bool init();
@@ -547,6 +570,7 @@ class cACTION_BACKHAUL_HOSTAP_DFS_CAC_COMPLETED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x85cfa49742a11792ULL; }
 
     private:
         bool init();
@@ -572,6 +596,7 @@ class cACTION_BACKHAUL_HOSTAP_ZWDFS_ANT_CHANNEL_SWITCH_REQUEST : public BaseClas
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfe227ea6cd0b8d02ULL; }
 
     private:
         bool init();
@@ -597,6 +622,7 @@ class cACTION_BACKHAUL_HOSTAP_ZWDFS_ANT_CHANNEL_SWITCH_RESPONSE : public BaseCla
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5df43084072986aeULL; }
 
     private:
         bool init();
@@ -621,6 +647,7 @@ class cACTION_BACKHAUL_RADIO_DISABLE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4e499f94583deb43ULL; }
 
     private:
         bool init();
@@ -643,6 +670,7 @@ class cACTION_BACKHAUL_RADIO_TEAR_DOWN_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7636e5df5a7aa1eaULL; }
 
     private:
         bool init();
@@ -662,6 +690,7 @@ class cACTION_BACKHAUL_DISCONNECT_COMMAND : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8439ac8351a9693bULL; }
 
     private:
         bool init();
@@ -681,6 +710,7 @@ class cACTION_BACKHAUL_RECONNECT_COMMAND : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0429d486a508bd32ULL; }
 
     private:
         bool init();
@@ -701,6 +731,7 @@ class cACTION_BACKHAUL_HOSTAP_SPATIAL_REUSE_REPORT_NOTIFICATION : public BaseCla
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0b9b118a07008183ULL; }
 
     private:
         bool init();
@@ -726,6 +757,7 @@ class cACTION_BACKHAUL_WIFI_CREDENTIALS_UPDATE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfe7d77257dcdf90bULL; }
 
     private:
         bool init();
@@ -752,6 +784,7 @@ class cACTION_BACKHAUL_TRIGGER_ON_BOOT_SCAN : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7b092ebae32576c0ULL; }
 
     private:
         bool init();
@@ -774,6 +807,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_TRIGGER_SCAN_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc042f4e28b04beadULL; }
 
     private:
         bool init();
@@ -796,6 +830,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_TRIGGER_SCAN_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x09ddebf45080a0f3ULL; }
 
     private:
         bool init();
@@ -816,6 +851,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_DUMP_RESULTS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf68a948eaf71e99eULL; }
 
     private:
         bool init();
@@ -836,6 +872,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_DUMP_RESULTS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x442eacfb1f154822ULL; }
 
     private:
         bool init();
@@ -857,6 +894,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_TRIGGERED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5078dc2be957b9eaULL; }
 
     private:
         bool init();
@@ -881,6 +919,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_RESULTS_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0399dafb9b5c4d63ULL; }
 
     private:
         bool init();
@@ -903,6 +942,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_ABORT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7e49e3de4f654651ULL; }
 
     private:
         bool init();
@@ -923,6 +963,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_ABORT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x36e7a73ed4aceb2fULL; }
 
     private:
         bool init();
@@ -945,6 +986,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_ABORTED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9c675ae6fc2dda5cULL; }
 
     private:
         bool init();
@@ -967,6 +1009,7 @@ class cACTION_BACKHAUL_CHANNEL_SCAN_FINISHED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8ef8dae60093d1fdULL; }
 
     private:
         bool init();
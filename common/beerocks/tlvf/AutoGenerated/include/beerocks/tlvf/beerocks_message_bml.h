@@ -39,6 +39,7 @@ class cACTION_BML_PING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4ac9edae8ca0634dULL; }
 
     private:
         bool init();
@@ -58,6 +59,7 @@ class cACTION_BML_PING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb260b53147f44e53ULL; }
 
     private:
         bool init();
@@ -77,6 +79,7 @@ class cACTION_BML_NW_MAP_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc2d54f148d4b23d3ULL; }
 
     private:
         bool init();
@@ -101,6 +104,7 @@ class cACTION_BML_NW_MAP_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4fc16c3e14261ea1ULL; }
 
     private:
         bool init();
@@ -130,6 +134,7 @@ class cACTION_BML_NW_MAP_UPDATE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3d6783e7e297e107ULL; }
 
     private:
         bool init();
@@ -159,6 +164,7 @@ class cACTION_BML_STATS_UPDATE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2e17caa9520188a6ULL; }
 
     private:
         bool init();
@@ -187,6 +193,7 @@ class cACTION_BML_EVENTS_UPDATE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3282a568ceb1fc7eULL; }
 
     private:
         bool init();
@@ -210,6 +217,7 @@ class cACTION_BML_REGISTER_TO_NW_MAP_UPDATES_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x041e249c7c7f2c36ULL; }
 
     private:
         bool init();
@@ -229,6 +237,7 @@ class cACTION_BML_UNREGISTER_FROM_NW_MAP_UPDATES_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x964beb42f1e7f9faULL; }
 
     private:
         bool init();
@@ -248,6 +257,7 @@ class cACTION_BML_SET_LEGACY_CLIENT_ROAMING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd5771d10ae26bf6dULL; }
 
     private:
         bool init();
@@ -267,6 +277,7 @@ class cACTION_BML_GET_LEGACY_CLIENT_ROAMING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3837c2902235bb23ULL; }
 
     private:
         bool init();
@@ -286,6 +297,7 @@ class cACTION_BML_REGISTER_TO_EVENTS_UPDATES_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x23d47621467851a1ULL; }
 
     private:
         bool init();
@@ -305,6 +317,7 @@ class cACTION_BML_UNREGISTER_FROM_EVENTS_UPDATES_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcf3e5563265a4c3dULL; }
 
     private:
         bool init();
@@ -324,6 +337,7 @@ class cACTION_BML_REGISTER_TO_STATS_UPDATES_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x403fa954059eeb09ULL; }
 
     private:
         bool init();
@@ -343,6 +357,7 @@ class cACTION_BML_UNREGISTER_FROM_STATS_UPDATES_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9b3485987518bf35ULL; }
 
     private:
         bool init();
@@ -363,6 +378,7 @@ class cACTION_BML_SET_LEGACY_CLIENT_ROAMING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe1552109726da837ULL; }
 
     private:
         bool init();
@@ -384,6 +400,7 @@ class cACTION_BML_GET_LEGACY_CLIENT_ROAMING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6a03c6292d7c9371ULL; }
 
     private:
         bool init();
@@ -405,6 +422,7 @@ class cACTION_BML_SET_CLIENT_ROAMING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc54477657a4e553fULL; }
 
     private:
         bool init();
@@ -425,6 +443,7 @@ class cACTION_BML_SET_CLIENT_ROAMING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbae8d840f0fd07a5ULL; }
 
     private:
         bool init();
@@ -444,6 +463,7 @@ class cACTION_BML_GET_CLIENT_ROAMING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc0b161fa472b1533ULL; }
 
     private:
         bool init();
@@ -464,6 +484,7 @@ class cACTION_BML_GET_CLIENT_ROAMING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe417fdd793619cc1ULL; }
 
     private:
         bool init();
@@ -485,6 +506,7 @@ class cACTION_BML_SET_DFS_REENTRY_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcc5eea2584bb5437ULL; }
 
     private:
         bool init();
@@ -505,6 +527,7 @@ class cACTION_BML_SET_DFS_REENTRY_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x84c3d7c3c822036dULL; }
 
     private:
         bool init();
@@ -524,6 +547,7 @@ class cACTION_BML_GET_DFS_REENTRY_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x57005eb9c8ea9f33ULL; }
 
     private:
         bool init();
@@ -544,6 +568,7 @@ class cACTION_BML_GET_DFS_REENTRY_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0bd977410bd91ac1ULL; }
 
     private:
         bool init();
@@ -565,6 +590,7 @@ class cACTION_BML_SET_CLIENT_ROAMING_PREFER_SIGNAL_STRENGTH_REQUEST : public Bas
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb7c6b30ec903ad49ULL; }
 
     private:
         bool init();
@@ -585,6 +611,7 @@ class cACTION_BML_SET_CLIENT_ROAMING_PREFER_SIGNAL_STRENGTH_RESPONSE : public Ba
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5223faf9ebe8d6d7ULL; }
 
     private:
         bool init();
@@ -604,6 +631,7 @@ class cACTION_BML_GET_CLIENT_ROAMING_PREFER_SIGNAL_STRENGTH_REQUEST : public Bas
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x00ffe9e5a690cb35ULL; }
 
     private:
         bool init();
@@ -624,6 +652,7 @@ class cACTION_BML_GET_CLIENT_ROAMING_PREFER_SIGNAL_STRENGTH_RESPONSE : public Ba
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4ed1b8d8873b78abULL; }
 
     private:
         bool init();
@@ -645,6 +674,7 @@ class cACTION_BML_SET_CLIENT_BAND_STEERING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9815ff2de81e5e2bULL; }
 
     private:
         bool init();
@@ -665,6 +695,7 @@ class cACTION_BML_SET_CLIENT_BAND_STEERING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x718c17279cbf3fc9ULL; }
 
     private:
         bool init();
@@ -684,6 +715,7 @@ class cACTION_BML_GET_CLIENT_BAND_STEERING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x342c5d56fbf5c5cfULL; }
 
     private:
         bool init();
@@ -704,6 +736,7 @@ class cACTION_BML_GET_CLIENT_BAND_STEERING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x17ce24084fe60035ULL; }
 
     private:
         bool init();
@@ -725,6 +758,7 @@ class cACTION_BML_SET_IRE_ROAMING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9a841d04764bc32aULL; }
 
     private:
         bool init();
@@ -745,6 +779,7 @@ class cACTION_BML_SET_IRE_ROAMING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa2c3810e39ad8546ULL; }
 
     private:
         bool init();
@@ -764,6 +799,7 @@ class cACTION_BML_GET_IRE_ROAMING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xca556c916c0c47aeULL; }
 
     private:
         bool init();
@@ -784,6 +820,7 @@ class cACTION_BML_GET_IRE_ROAMING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb11a6575e4682872ULL; }
 
     private:
         bool init();
@@ -805,6 +842,7 @@ class cACTION_BML_SET_LOAD_BALANCER_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x16c7b0ab7875b9afULL; }
 
     private:
         bool init();
@@ -825,6 +863,7 @@ class cACTION_BML_SET_LOAD_BALANCER_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfed531d686782bd5ULL; }
 
     private:
         bool init();
@@ -844,6 +883,7 @@ class cACTION_BML_GET_LOAD_BALANCER_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa2980af53ed6a32bULL; }
 
     private:
         bool init();
@@ -864,6 +904,7 @@ class cACTION_BML_GET_LOAD_BALANCER_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x04cb1adff7dc7ec9ULL; }
 
     private:
         bool init();
@@ -885,6 +926,7 @@ class cACTION_BML_SET_SERVICE_FAIRNESS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xee5ecfe9b8ab9429ULL; }
 
     private:
         bool init();
@@ -905,6 +947,7 @@ class cACTION_BML_SET_SERVICE_FAIRNESS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x69cffc6400ca1af7ULL; }
 
     private:
         bool init();
@@ -924,6 +967,7 @@ class cACTION_BML_GET_SERVICE_FAIRNESS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb3e084a29856173dULL; }
 
     private:
         bool init();
@@ -944,6 +988,7 @@ class cACTION_BML_GET_SERVICE_FAIRNESS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb7bf14a88ab521c3ULL; }
 
     private:
         bool init();
@@ -965,6 +1010,7 @@ class cACTION_BML_CHANGE_MODULE_LOGGING_LEVEL_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc6c94681d2b1d249ULL; }
 
     private:
         bool init();
@@ -985,6 +1031,7 @@ class cACTION_BML_CHANGE_MODULE_LOGGING_LEVEL_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x81a987735ed1b5d7ULL; }
 
     private:
         bool init();
@@ -1025,6 +1072,7 @@ class cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x98b398ecc3c87fa2ULL; }
 
     private:
         bool init();
@@ -1060,6 +1108,7 @@ class cACTION_BML_WIFI_CREDENTIALS_SET_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x68fb8ed280cc9c0eULL; }
 
     private:
         bool init();
@@ -1081,6 +1130,7 @@ class cACTION_BML_SET_RESTRICTED_CHANNELS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa62c39441003ae02ULL; }
 
     private:
         bool init();
@@ -1102,6 +1152,7 @@ class cACTION_BML_SET_RESTRICTED_CHANNELS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xde9d49bcd2c999aeULL; }
 
     private:
         bool init();
@@ -1123,6 +1174,7 @@ class cACTION_BML_GET_RESTRICTED_CHANNELS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa46c6d6762b2a0e6ULL; }
 
     private:
         bool init();
@@ -1144,6 +1196,7 @@ class cACTION_BML_GET_RESTRICTED_CHANNELS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbbac99a507a1f7baULL; }
 
     private:
         bool init();
@@ -1165,6 +1218,7 @@ class cACTION_BML_SET_CERTIFICATION_MODE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x78a39dd1c4403408ULL; }
 
     private:
         bool init();
@@ -1185,6 +1239,7 @@ class cACTION_BML_SET_CERTIFICATION_MODE_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xee2acedf26ec2464ULL; }
 
     private:
         bool init();
@@ -1204,6 +1259,7 @@ class cACTION_BML_GET_CERTIFICATION_MODE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb13cb9ed36f6956cULL; }
 
     private:
         bool init();
@@ -1224,6 +1280,7 @@ class cACTION_BML_GET_CERTIFICATION_MODE_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7aa06598c394ac00ULL; }
 
     private:
         bool init();
@@ -1245,9 +1302,11 @@ class cACTION_BML_SET_VAP_LIST_CREDENTIALS_REQUEST : public BaseClass
         uint8_t& vap_list_size();
         std::tuple<bool, sConfigVapInfo&> vap_list(size_t idx);
         bool alloc_vap_list(size_t count = 1);
+        sConfigVapInfo* reserve_vap_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa5a365d60808a49dULL; }
 
     private:
         bool init();
@@ -1273,6 +1332,7 @@ class cACTION_BML_SET_VAP_LIST_CREDENTIALS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xeaba96b6aed109e3ULL; }
 
     private:
         bool init();
@@ -1294,9 +1354,11 @@ class cACTION_BML_GET_VAP_LIST_CREDENTIALS_RESPONSE : public BaseClass
         uint8_t& vap_list_size();
         std::tuple<bool, sConfigVapInfo&> vap_list(size_t idx);
         bool alloc_vap_list(size_t count = 1);
+        sConfigVapInfo* reserve_vap_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xeab7c50f8281badfULL; }
 
     private:
         bool init();
@@ -1322,6 +1384,7 @@ class cACTION_BML_GET_VAP_LIST_CREDENTIALS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe3e9c1716223b441ULL; }
 
     private:
         bool init();
@@ -1343,9 +1406,11 @@ class cACTION_BML_STEERING_SET_GROUP_REQUEST : public BaseClass
         size_t ap_cfgs_length() { return m_ap_cfgs_idx__ * sizeof(sSteeringApConfig); }
         std::tuple<bool, sSteeringApConfig&> ap_cfgs(size_t idx);
         bool alloc_ap_cfgs(size_t count = 1);
+        sSteeringApConfig* reserve_ap_cfgs(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0bdfb2c17bc59615ULL; }
 
     private:
         bool init();
@@ -1370,6 +1435,7 @@ class cACTION_BML_STEERING_SET_GROUP_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf880d552b7189fcbULL; }
 
     private:
         bool init();
@@ -1395,6 +1461,7 @@ class cACTION_BML_STEERING_CLIENT_SET_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa543504b1ce70123ULL; }
 
     private:
         bool init();
@@ -1420,6 +1487,7 @@ class cACTION_BML_STEERING_CLIENT_SET_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x65eb9ae128b68571ULL; }
 
     private:
         bool init();
@@ -1441,6 +1509,7 @@ class cACTION_BML_STEERING_EVENT_REGISTER_UNREGISTER_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xff25045c8e74d9f2ULL; }
 
     private:
         bool init();
@@ -1462,6 +1531,7 @@ class cACTION_BML_STEERING_EVENT_REGISTER_UNREGISTER_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe3fd3cb4f48ca21eULL; }
 
     private:
         bool init();
@@ -1487,6 +1557,7 @@ class cACTION_BML_STEERING_CLIENT_DISCONNECT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdce6ae4ff8b0ee03ULL; }
 
     private:
         bool init();
@@ -1512,6 +1583,7 @@ class cACTION_BML_STEERING_CLIENT_DISCONNECT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x10eb568c64d83b11ULL; }
 
     private:
         bool init();
@@ -1535,6 +1607,7 @@ class cACTION_BML_STEERING_CLIENT_MEASURE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x105643ac246c5cfbULL; }
 
     private:
         bool init();
@@ -1558,6 +1631,7 @@ class cACTION_BML_STEERING_CLIENT_MEASURE_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa845e9a5021db199ULL; }
 
     private:
         bool init();
@@ -1582,6 +1656,7 @@ class cACTION_BML_STEERING_EVENTS_UPDATE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf979d353fad05564ULL; }
 
     private:
         bool init();
@@ -1606,6 +1681,7 @@ class cACTION_BML_TRIGGER_TOPOLOGY_QUERY : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdfdd54001926b3a4ULL; }
 
     private:
         bool init();
@@ -1628,6 +1704,7 @@ class cACTION_BML_TOPOLOGY_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5dcc4ad1045b1b30ULL; }
 
     private:
         bool init();
@@ -1649,6 +1726,7 @@ class cACTION_BML_REGISTER_TOPOLOGY_QUERY : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x24d25b26bd25e619ULL; }
 
     private:
         bool init();
@@ -1668,6 +1746,7 @@ class cACTION_BML_UNREGISTER_TOPOLOGY_QUERY : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x75b3d3e6e78f424cULL; }
 
     private:
         bool init();
@@ -1691,6 +1770,7 @@ class cACTION_BML_TRIGGER_CHANNEL_SELECTION_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4208582f3026427aULL; }
 
     private:
         bool init();
@@ -1716,6 +1796,7 @@ class cACTION_BML_TRIGGER_CHANNEL_SELECTION_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0c871eb42ea84d96ULL; }
 
     private:
         bool init();
@@ -1738,6 +1819,7 @@ class cACTION_BML_CHANNEL_SCAN_SET_CONTINUOUS_PARAMS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2657406234926ae2ULL; }
 
     private:
         bool init();
@@ -1761,6 +1843,7 @@ class cACTION_BML_CHANNEL_SCAN_SET_CONTINUOUS_PARAMS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe362db612acb5c4eULL; }
 
     private:
         bool init();
@@ -1782,6 +1865,7 @@ class cACTION_BML_CHANNEL_SCAN_GET_CONTINUOUS_PARAMS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x64dff60c14d43adeULL; }
 
     private:
         bool init();
@@ -1803,6 +1887,7 @@ class cACTION_BML_CHANNEL_SCAN_GET_CONTINUOUS_PARAMS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2a4e0cb8324b1662ULL; }
 
     private:
         bool init();
@@ -1825,6 +1910,7 @@ class cACTION_BML_CHANNEL_SCAN_SET_CONTINUOUS_ENABLE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x970cadfa571dec0fULL; }
 
     private:
         bool init();
@@ -1848,6 +1934,7 @@ class cACTION_BML_CHANNEL_SCAN_SET_CONTINUOUS_ENABLE_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf0121c6fbd284275ULL; }
 
     private:
         bool init();
@@ -1869,6 +1956,7 @@ class cACTION_BML_CHANNEL_SCAN_GET_CONTINUOUS_ENABLE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x758607ee62e807a3ULL; }
 
     private:
         bool init();
@@ -1890,6 +1978,7 @@ class cACTION_BML_CHANNEL_SCAN_GET_CONTINUOUS_ENABLE_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x485025511c7490f1ULL; }
 
     private:
         bool init();
@@ -1911,6 +2000,7 @@ class cACTION_BML_CHANNEL_SCAN_START_SCAN_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xeed11aea902b260dULL; }
 
     private:
         bool init();
@@ -1933,6 +2023,7 @@ class cACTION_BML_CHANNEL_SCAN_START_SCAN_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4bd9d22664bdb613ULL; }
 
     private:
         bool init();
@@ -1956,6 +2047,7 @@ class cACTION_BML_CHANNEL_SCAN_GET_RESULTS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x562ca776d48f82daULL; }
 
     private:
         bool init();
@@ -1983,9 +2075,11 @@ class cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE : public BaseClass
         uint8_t& results_size();
         std::tuple<bool, sChannelScanResults&> results(size_t idx);
         bool alloc_results(size_t count = 1);
+        sChannelScanResults* reserve_results(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5d673142fea3ec36ULL; }
 
     private:
         bool init();
@@ -2012,6 +2106,7 @@ class cACTION_BML_WIFI_CREDENTIALS_UPDATE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x339fb03f52c9e76fULL; }
 
     private:
         bool init();
@@ -2032,6 +2127,7 @@ class cACTION_BML_WIFI_CREDENTIALS_UPDATE_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x50b5c268b93da095ULL; }
 
     private:
         bool init();
@@ -2053,6 +2149,7 @@ class cACTION_BML_WIFI_CREDENTIALS_CLEAR_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe938004ee4997ef3ULL; }
 
     private:
         bool init();
@@ -2074,6 +2171,7 @@ class cACTION_BML_WIFI_CREDENTIALS_CLEAR_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7b0a2577fc525581ULL; }
 
     private:
         bool init();
@@ -2094,6 +2192,7 @@ class cACTION_BML_CLIENT_GET_CLIENT_LIST_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x03af87c5aa5edfb2ULL; }
 
     private:
         bool init();
@@ -2117,6 +2216,7 @@ class cACTION_BML_ADD_UNASSOCIATED_STATION_STATS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x07912fc6fd65e9fbULL; }
 
     private:
         bool init();
@@ -2142,6 +2242,7 @@ class cACTION_BML_REMOVE_UNASSOCIATED_STATION_STATS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1ac61c41448cd9d0ULL; }
 
     private:
         bool init();
@@ -2163,6 +2264,7 @@ class cACTION_BML_GET_UNASSOCIATED_STATIONS_STATS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe5201bb41ec5043bULL; }
 
     private:
         bool init();
@@ -2195,9 +2297,11 @@ class cACTION_BML_GET_UNASSOCIATED_STATIONS_STATS_RESPONSE : public BaseClass
         uint8_t& sta_list_length();
         std::tuple<bool, sStaMetrics&> sta_list(size_t idx);
         bool alloc_sta_list(size_t count = 1);
+        sStaMetrics* reserve_sta_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x993bb6dd31062bd9ULL; }
 
     private:
         bool init();
@@ -2222,9 +2326,11 @@ class cACTION_BML_CLIENT_GET_CLIENT_LIST_RESPONSE : public BaseClass
         uint32_t& client_list_size();
         std::tuple<bool, sMacAddr&> client_list(size_t idx);
         bool alloc_client_list(size_t count = 1);
+        sMacAddr* reserve_client_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3cfcea767fc488deULL; }
 
     private:
         bool init();
@@ -2251,6 +2357,7 @@ class cACTION_BML_CLIENT_SET_CLIENT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2645cd7167d91435ULL; }
 
     private:
         bool init();
@@ -2273,6 +2380,7 @@ class cACTION_BML_CLIENT_SET_CLIENT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xecdc5f51f50f83abULL; }
 
     private:
         bool init();
@@ -2294,6 +2402,7 @@ class cACTION_BML_CLIENT_GET_CLIENT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdcdb26e800db8a31ULL; }
 
     private:
         bool init();
@@ -2316,6 +2425,7 @@ class cACTION_BML_CLIENT_GET_CLIENT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb81c81caed7a034fULL; }
 
     private:
         bool init();
@@ -2338,6 +2448,7 @@ class cACTION_BML_CLIENT_CLEAR_CLIENT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcc4ec1897fe4965aULL; }
 
     private:
         bool init();
@@ -2359,6 +2470,7 @@ class cACTION_BML_CLIENT_CLEAR_CLIENT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6e6cfefc20340eb6ULL; }
 
     private:
         bool init();
@@ -2380,6 +2492,7 @@ class cACTION_BML_SET_CLIENT_ROAMING_11K_SUPPORT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb11cf959b7da9397ULL; }
 
     private:
         bool init();
@@ -2400,6 +2513,7 @@ class cACTION_BML_SET_CLIENT_ROAMING_11K_SUPPORT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xaa5e094dff5ae70dULL; }
 
     private:
         bool init();
@@ -2419,6 +2533,7 @@ class cACTION_BML_GET_CLIENT_ROAMING_11K_SUPPORT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x02ba99790bba29d3ULL; }
 
     private:
         bool init();
@@ -2439,6 +2554,7 @@ class cACTION_BML_GET_CLIENT_ROAMING_11K_SUPPORT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5164d500eacd50a1ULL; }
 
     private:
         bool init();
@@ -2463,6 +2579,7 @@ class cACTION_BML_SET_SELECTION_CHANNEL_POOL_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x247870935c13b5b9ULL; }
 
     private:
         bool init();
@@ -2488,6 +2605,7 @@ class cACTION_BML_SET_SELECTION_CHANNEL_POOL_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd69b644f0f1c1787ULL; }
 
     private:
         bool init();
@@ -2509,6 +2627,7 @@ class cACTION_BML_GET_SELECTION_CHANNEL_POOL_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe638b7bfe1c0171dULL; }
 
     private:
         bool init();
@@ -2533,6 +2652,7 @@ class cACTION_BML_GET_SELECTION_CHANNEL_POOL_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5fe74713a1889963ULL; }
 
     private:
         bool init();
@@ -2560,6 +2680,7 @@ class cACTION_BML_UNASSOC_STA_RCPI_QUERY_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x679d60701ff88a0aULL; }
 
     private:
         bool init();
@@ -2584,6 +2705,7 @@ class cACTION_BML_UNASSOC_STA_RCPI_QUERY_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x22d98a6949f3c4e6ULL; }
 
     private:
         bool init();
@@ -2605,6 +2727,7 @@ class cACTION_BML_GET_UNASSOC_STA_QUERY_RESULT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3613a042029f8b58ULL; }
 
     private:
         bool init();
@@ -2632,6 +2755,7 @@ class cACTION_BML_GET_UNASSOC_STA_QUERY_RESULT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x726e7d02488125f4ULL; }
 
     private:
         bool init();
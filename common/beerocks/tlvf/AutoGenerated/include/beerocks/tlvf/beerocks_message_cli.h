@@ -41,6 +41,7 @@ class cACTION_CLI_ENABLE_DIAGNOSTICS_MEASUREMENTS : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8ed3c29095e9b84cULL; }
 
     private:
         bool init();
@@ -62,6 +63,7 @@ class cACTION_CLI_ENABLE_DEBUG : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x01b9f4f34977e117ULL; }
 
     private:
         bool init();
@@ -83,6 +85,7 @@ class cACTION_CLI_SET_SLAVES_STOP_ON_FAILURE_ATTEMPTS : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe7ef3f50232099ceULL; }
 
     private:
         bool init();
@@ -105,6 +108,7 @@ class cACTION_CLI_RESPONSE_INT : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xef22a8e9bbd6d321ULL; }
 
     private:
         bool init();
@@ -132,6 +136,7 @@ class cACTION_CLI_RESPONSE_STR : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x323014e95146257fULL; }
 
     private:
         bool init();
@@ -158,6 +163,7 @@ class cACTION_CLI_CROSS_RX_RSSI_MEASUREMENT : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x53eb6e0d36d6e324ULL; }
 
     private:
         bool init();
@@ -181,6 +187,7 @@ class cACTION_CLI_OPTIMAL_PATH_TASK : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdc0451c34a17d89cULL; }
 
     private:
         bool init();
@@ -202,6 +209,7 @@ class cACTION_CLI_LOAD_BALANCER_TASK : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3991385338555fcdULL; }
 
     private:
         bool init();
@@ -222,6 +230,7 @@ class cACTION_CLI_IRE_NETWORK_OPTIMIZATION_TASK : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb68eef611710d9d3ULL; }
 
     private:
         bool init();
@@ -242,6 +251,7 @@ class cACTION_CLI_DUMP_NODE_INFO : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x37b742f7954e25c0ULL; }
 
     private:
         bool init();
@@ -264,6 +274,7 @@ class cACTION_CLI_BACKHAUL_ROAM_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfaae22fecdbcfdfdULL; }
 
     private:
         bool init();
@@ -287,6 +298,7 @@ class cACTION_CLI_CLIENT_ALLOW_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe8b6005ff1800d1fULL; }
 
     private:
         bool init();
@@ -310,6 +322,7 @@ class cACTION_CLI_CLIENT_DISALLOW_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8cbdc6acf1f87143ULL; }
 
     private:
         bool init();
@@ -334,6 +347,7 @@ class cACTION_CLI_CLIENT_DISCONNECT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x66337ce453674e00ULL; }
 
     private:
         bool init();
@@ -359,6 +373,7 @@ class cACTION_CLI_CLIENT_BSS_STEER_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x28a380be0723bc98ULL; }
 
     private:
         bool init();
@@ -392,6 +407,7 @@ class cACTION_CLI_CLIENT_BEACON_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0c520301e46d06aaULL; }
 
     private:
         bool init();
@@ -425,6 +441,7 @@ class cACTION_CLI_HOSTAP_CHANNEL_SWITCH_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xac5bf796c5e7dbceULL; }
 
     private:
         bool init();
@@ -450,6 +467,7 @@ class cACTION_CLI_HOSTAP_SET_NEIGHBOR_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd32279e92cc7eaa1ULL; }
 
     private:
         bool init();
@@ -476,6 +494,7 @@ class cACTION_CLI_HOSTAP_REMOVE_NEIGHBOR_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xae037f3aed890949ULL; }
 
     private:
         bool init();
@@ -499,6 +518,7 @@ class cACTION_CLI_HOSTAP_STATS_MEASUREMENT : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbdb02bc7f5b3d83cULL; }
 
     private:
         bool init();
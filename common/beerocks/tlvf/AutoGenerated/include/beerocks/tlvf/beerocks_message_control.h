@@ -39,6 +39,7 @@ class cACTION_CONTROL_SLAVE_HANDSHAKE_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xad528f3426dfeba8ULL; }
 
     private:
         bool init();
@@ -58,6 +59,7 @@ class cACTION_CONTROL_SLAVE_HANDSHAKE_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x70a82a204c0b3b44ULL; }
 
     private:
         bool init();
@@ -88,6 +90,7 @@ class cACTION_CONTROL_SLAVE_JOINED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf0a4dc4d80ef65d2ULL; }
 
     private:
         bool init();
@@ -123,6 +126,7 @@ class cACTION_CONTROL_SLAVE_JOINED_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0ac0d8709acf2c02ULL; }
 
     private:
         bool init();
@@ -148,6 +152,7 @@ class cACTION_CONTROL_ARP_QUERY_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6eb7df19be6ae2a3ULL; }
 
     private:
         bool init();
@@ -169,6 +174,7 @@ class cACTION_CONTROL_ARP_QUERY_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3adbc3fd9bceb1f1ULL; }
 
     private:
         bool init();
@@ -190,6 +196,7 @@ class cACTION_CONTROL_CHANGE_MODULE_LOGGING_LEVEL : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8ee857db5c7a83a1ULL; }
 
     private:
         bool init();
@@ -211,6 +218,7 @@ class cACTION_CONTROL_HOSTAP_CSA_ERROR_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x76fb8bfab6b083b5ULL; }
 
     private:
         bool init();
@@ -232,6 +240,7 @@ class cACTION_CONTROL_HOSTAP_CSA_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcf80598b90d0a2baULL; }
 
     private:
         bool init();
@@ -253,6 +262,7 @@ class cACTION_CONTROL_HOSTAP_ACS_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdfc084a689def67eULL; }
 
     private:
         bool init();
@@ -274,6 +284,7 @@ class cACTION_CONTROL_HOSTAP_DFS_CAC_COMPLETED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x70a7ecfad4103f4cULL; }
 
     private:
         bool init();
@@ -295,6 +306,7 @@ class cACTION_CONTROL_HOSTAP_DFS_CHANNEL_AVAILABLE_NOTIFICATION : public BaseCla
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x90e8ccd7dac6e0e0ULL; }
 
     private:
         bool init();
@@ -316,6 +328,7 @@ class cACTION_CONTROL_HOSTAP_SET_RESTRICTED_FAILSAFE_CHANNEL_REQUEST : public Ba
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x69ebe605a4daa923ULL; }
 
     private:
         bool init();
@@ -337,6 +350,7 @@ class cACTION_CONTROL_HOSTAP_SET_RESTRICTED_FAILSAFE_CHANNEL_RESPONSE : public B
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x840a06d62bbcfd71ULL; }
 
     private:
         bool init();
@@ -358,6 +372,7 @@ class cACTION_CONTROL_HOSTAP_CHANNEL_SWITCH_ACS_START : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa237133a80b81896ULL; }
 
     private:
         bool init();
@@ -379,6 +394,7 @@ class cACTION_CONTROL_HOSTAP_UPDATE_STOP_ON_FAILURE_ATTEMPTS_REQUEST : public Ba
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x209ef82b58abd63dULL; }
 
     private:
         bool init();
@@ -400,6 +416,7 @@ class cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x851217798f7a5ef3ULL; }
 
     private:
         bool init();
@@ -420,12 +437,15 @@ class cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE : public BaseClass
         uint8_t& ap_stats_size();
         std::tuple<bool, sApStatsParams&> ap_stats(size_t idx);
         bool alloc_ap_stats(size_t count = 1);
+        sApStatsParams* reserve_ap_stats(size_t count);
         uint8_t& sta_stats_size();
         std::tuple<bool, sStaStatsParams&> sta_stats(size_t idx);
         bool alloc_sta_stats(size_t count = 1);
+        sStaStatsParams* reserve_sta_stats(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2f7f82f8586ef581ULL; }
 
     private:
         bool init();
@@ -453,6 +473,7 @@ class cACTION_CONTROL_HOSTAP_LOAD_MEASUREMENT_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcf1c3d73b94c123aULL; }
 
     private:
         bool init();
@@ -474,6 +495,7 @@ class cACTION_CONTROL_HOSTAP_SET_NEIGHBOR_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x431b5bf486509d4aULL; }
 
     private:
         bool init();
@@ -495,6 +517,7 @@ class cACTION_CONTROL_HOSTAP_REMOVE_NEIGHBOR_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa3a83f8da8240ff8ULL; }
 
     private:
         bool init();
@@ -516,6 +539,7 @@ class cACTION_CONTROL_HOSTAP_ACTIVITY_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa082a76131eb3aa4ULL; }
 
     private:
         bool init();
@@ -537,6 +561,7 @@ class cACTION_CONTROL_HOSTAP_VAPS_LIST_UPDATE_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8e6755fe46cc6156ULL; }
 
     private:
         bool init();
@@ -558,6 +583,7 @@ class cACTION_CONTROL_HOSTAP_AP_DISABLED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb39f8c1f45c3cbf3ULL; }
 
     private:
         bool init();
@@ -580,6 +606,7 @@ class cACTION_CONTROL_HOSTAP_AP_ENABLED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x87d5a211b56a6faeULL; }
 
     private:
         bool init();
@@ -602,6 +629,7 @@ class cACTION_CONTROL_CLIENT_START_MONITORING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd6d32c885b61074aULL; }
 
     private:
         bool init();
@@ -623,6 +651,7 @@ class cACTION_CONTROL_CLIENT_START_MONITORING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8c7b0f4009a80a26ULL; }
 
     private:
         bool init();
@@ -644,6 +673,7 @@ class cACTION_CONTROL_CLIENT_RX_RSSI_MEASUREMENT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x00153ad2d1e185c4ULL; }
 
     private:
         bool init();
@@ -665,6 +695,7 @@ class cACTION_CONTROL_CLIENT_RX_RSSI_MEASUREMENT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x548c39b8d7e79f68ULL; }
 
     private:
         bool init();
@@ -686,6 +717,7 @@ class cACTION_CONTROL_CLIENT_RX_RSSI_MEASUREMENT_START_NOTIFICATION : public Bas
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc121fe9745487bf1ULL; }
 
     private:
         bool init();
@@ -707,6 +739,7 @@ class cACTION_CONTROL_CLIENT_RX_RSSI_MEASUREMENT_CMD_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf95d5798cb6430edULL; }
 
     private:
         bool init();
@@ -728,6 +761,7 @@ class cACTION_CONTROL_CLIENT_RX_RSSI_MEASUREMENT_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x879bd6fb0eac4fc4ULL; }
 
     private:
         bool init();
@@ -749,6 +783,7 @@ class cACTION_CONTROL_CLIENT_NO_ACTIVITY_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x192aed9c48793736ULL; }
 
     private:
         bool init();
@@ -770,6 +805,7 @@ class cACTION_CONTROL_CLIENT_NO_RESPONSE_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb57a9d67bb02dcb8ULL; }
 
     private:
         bool init();
@@ -792,6 +828,7 @@ class cACTION_CONTROL_CLIENT_NEW_IP_ADDRESS_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1e96cc1bc6f28f90ULL; }
 
     private:
         bool init();
@@ -818,6 +855,7 @@ class cACTION_CONTROL_CLIENT_DISCONNECT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc9ccc421cc35af6bULL; }
 
     private:
         bool init();
@@ -843,6 +881,7 @@ class cACTION_CONTROL_CLIENT_DISCONNECT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5ae179390fc0c409ULL; }
 
     private:
         bool init();
@@ -869,6 +908,7 @@ class cACTION_CONTROL_CLIENT_DHCP_COMPLETE_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x11e2c1bcc2cec1a0ULL; }
 
     private:
         bool init();
@@ -894,6 +934,7 @@ class cACTION_CONTROL_CLIENT_ARP_MONITOR_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8da7c51f59bc52a9ULL; }
 
     private:
         bool init();
@@ -915,6 +956,7 @@ class cACTION_CONTROL_CLIENT_BEACON_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x660910e215d56d7dULL; }
 
     private:
         bool init();
@@ -936,6 +978,7 @@ class cACTION_CONTROL_CLIENT_BEACON_11K_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfab61c34973c2203ULL; }
 
     private:
         bool init();
@@ -957,6 +1000,7 @@ class cACTION_CONTROL_STEERING_CLIENT_SET_GROUP_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb49db8a346d82e3dULL; }
 
     private:
         bool init();
@@ -978,6 +1022,7 @@ class cACTION_CONTROL_STEERING_CLIENT_SET_GROUP_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7b5571d111c236c3ULL; }
 
     private:
         bool init();
@@ -999,6 +1044,7 @@ class cACTION_CONTROL_STEERING_CLIENT_SET_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6e7d64f32189c851ULL; }
 
     private:
         bool init();
@@ -1020,6 +1066,7 @@ class cACTION_CONTROL_STEERING_CLIENT_SET_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x82edfd9fe8b5d12fULL; }
 
     private:
         bool init();
@@ -1041,6 +1088,7 @@ class cACTION_CONTROL_STEERING_EVENT_CLIENT_ACTIVITY_NOTIFICATION : public BaseC
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2d7ea71b1965b567ULL; }
 
     private:
         bool init();
@@ -1062,6 +1110,7 @@ class cACTION_CONTROL_STEERING_EVENT_SNR_XING_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa9eef584b8585e3eULL; }
 
     private:
         bool init();
@@ -1083,6 +1132,7 @@ class cACTION_CONTROL_STEERING_EVENT_PROBE_REQ_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3e982e6663c96417ULL; }
 
     private:
         bool init();
@@ -1104,6 +1154,7 @@ class cACTION_CONTROL_STEERING_EVENT_AUTH_FAIL_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc0732313a3dc1bedULL; }
 
     private:
         bool init();
@@ -1125,6 +1176,7 @@ class cACTION_CONTROL_CHANNEL_SCAN_TRIGGER_SCAN_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x56e04020b84cadbbULL; }
 
     private:
         bool init();
@@ -1146,6 +1198,7 @@ class cACTION_CONTROL_CHANNEL_SCAN_TRIGGER_SCAN_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6a631b66128b3059ULL; }
 
     private:
         bool init();
@@ -1166,6 +1219,7 @@ class cACTION_CONTROL_CHANNEL_SCAN_DUMP_RESULTS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x893a7fc5e903a43cULL; }
 
     private:
         bool init();
@@ -1186,6 +1240,7 @@ class cACTION_CONTROL_CHANNEL_SCAN_TRIGGERED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x98ead257559ea2c0ULL; }
 
     private:
         bool init();
@@ -1210,6 +1265,7 @@ class cACTION_CONTROL_CHANNEL_SCAN_RESULTS_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf4f4579d3fcf8a1dULL; }
 
     private:
         bool init();
@@ -1234,6 +1290,7 @@ class cACTION_CONTROL_CHANNEL_SCAN_ABORT_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfa29e3fbc5b54bf9ULL; }
 
     private:
         bool init();
@@ -1256,6 +1313,7 @@ class cACTION_CONTROL_CHANNEL_SCAN_FINISHED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd9dd27911e117f93ULL; }
 
     private:
         bool init();
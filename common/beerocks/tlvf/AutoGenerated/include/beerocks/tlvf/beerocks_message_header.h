@@ -46,6 +46,7 @@ class cACTION_HEADER : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x08fef545791b60aaULL; }
 
     private:
         bool init();
@@ -40,6 +40,7 @@ class cACTION_MONITOR_HOSTAP_AP_DISABLED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbc57add5b7337c78ULL; }
 
     private:
         bool init();
@@ -66,6 +67,7 @@ class cACTION_MONITOR_JOINED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf06d8e3e2b697fbdULL; }
 
     private:
         bool init();
@@ -90,6 +92,7 @@ class cACTION_MONITOR_SON_CONFIG_UPDATE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x306962da0f6d7699ULL; }
 
     private:
         bool init();
@@ -111,6 +114,7 @@ class cACTION_MONITOR_CHANGE_MODULE_LOGGING_LEVEL : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf94de46fa42eb792ULL; }
 
     private:
         bool init();
@@ -131,6 +135,7 @@ class cACTION_MONITOR_HEARTBEAT_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xce2a8fc4fbb3ea9aULL; }
 
     private:
         bool init();
@@ -151,6 +156,7 @@ class cACTION_MONITOR_CLIENT_START_MONITORING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x87a72f2b8735d501ULL; }
 
     private:
         bool init();
@@ -172,6 +178,7 @@ class cACTION_MONITOR_CLIENT_START_MONITORING_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x326680b2b60ccb9fULL; }
 
     private:
         bool init();
@@ -193,6 +200,7 @@ class cACTION_MONITOR_CLIENT_RX_RSSI_MEASUREMENT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x643f5a770f57a5edULL; }
 
     private:
         bool init();
@@ -214,6 +222,7 @@ class cACTION_MONITOR_CLIENT_RX_RSSI_MEASUREMENT_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3f6624e92430a5abULL; }
 
     private:
         bool init();
@@ -235,6 +244,7 @@ class cACTION_MONITOR_CLIENT_RX_RSSI_MEASUREMENT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xac351478b955f133ULL; }
 
     private:
         bool init();
@@ -256,6 +266,7 @@ class cACTION_MONITOR_CLIENT_NO_RESPONSE_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x92d0f99ff8fe2a93ULL; }
 
     private:
         bool init();
@@ -277,6 +288,7 @@ class cACTION_MONITOR_CLIENT_RX_RSSI_MEASUREMENT_START_NOTIFICATION : public Bas
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4ad86c7666c902a6ULL; }
 
     private:
         bool init();
@@ -298,6 +310,7 @@ class cACTION_MONITOR_CLIENT_RX_RSSI_MEASUREMENT_CMD_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x61e54b497e1a402aULL; }
 
     private:
         bool init();
@@ -319,6 +332,7 @@ class cACTION_MONITOR_CLIENT_NO_ACTIVITY_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x922709b530da8ec9ULL; }
 
     private:
         bool init();
@@ -340,6 +354,7 @@ class cACTION_MONITOR_HOSTAP_ACTIVITY_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa97c5e97e4da5445ULL; }
 
     private:
         bool init();
@@ -361,6 +376,7 @@ class cACTION_MONITOR_CLIENT_ASSOCIATED_STA_LINK_METRIC_REQUEST : public BaseCla
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc2553bc62f4e34efULL; }
 
     private:
         bool init();
@@ -383,9 +399,11 @@ class cACTION_MONITOR_CLIENT_ASSOCIATED_STA_LINK_METRIC_RESPONSE : public BaseCl
         uint8_t& bssid_info_list_length();
         std::tuple<bool, sBssidInfo&> bssid_info_list(size_t idx);
         bool alloc_bssid_info_list(size_t count = 1);
+        sBssidInfo* reserve_bssid_info_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x537f58916e0d5115ULL; }
 
     private:
         bool init();
@@ -412,9 +430,11 @@ class cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_REQUEST : public BaseC
         uint8_t& stations_list_length();
         std::tuple<bool, sUnassociatedStationInfo&> stations_list(size_t idx);
         bool alloc_stations_list(size_t count = 1);
+        sUnassociatedStationInfo* reserve_stations_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x804cd4dc0d56e73cULL; }
 
     private:
         bool init();
@@ -440,9 +460,11 @@ class cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_RESPONSE : public Base
         uint8_t& stations_list_length();
         std::tuple<bool, sUnassociatedStationStats&> stations_list(size_t idx);
         bool alloc_stations_list(size_t count = 1);
+        sUnassociatedStationStats* reserve_stations_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xca28c008591dcf50ULL; }
 
     private:
         bool init();
@@ -468,6 +490,7 @@ class cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x67f0b7318e5e86b2ULL; }
 
     private:
         bool init();
@@ -488,12 +511,15 @@ class cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE : public BaseClass
         uint8_t& ap_stats_size();
         std::tuple<bool, sApStatsParams&> ap_stats(size_t idx);
         bool alloc_ap_stats(size_t count = 1);
+        sApStatsParams* reserve_ap_stats(size_t count);
         uint8_t& sta_stats_size();
         std::tuple<bool, sStaStatsParams&> sta_stats(size_t idx);
         bool alloc_sta_stats(size_t count = 1);
+        sStaStatsParams* reserve_sta_stats(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x97677ecaeb2d4ddeULL; }
 
     private:
         bool init();
@@ -521,6 +547,7 @@ class cACTION_MONITOR_HOSTAP_LOAD_MEASUREMENT_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8afc54dd21069ad7ULL; }
 
     private:
         bool init();
@@ -542,6 +569,7 @@ class cACTION_MONITOR_CLIENT_BEACON_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2aa1d459fdf69a5eULL; }
 
     private:
         bool init();
@@ -563,6 +591,7 @@ class cACTION_MONITOR_CLIENT_BEACON_11K_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x551a4b1b57b35ce2ULL; }
 
     private:
         bool init();
@@ -584,6 +613,7 @@ class cACTION_MONITOR_CLIENT_CHANNEL_LOAD_11K_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x324689701af0383aULL; }
 
     private:
         bool init();
@@ -605,6 +635,7 @@ class cACTION_MONITOR_CLIENT_CHANNEL_LOAD_11K_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x689e07a803375756ULL; }
 
     private:
         bool init();
@@ -627,6 +658,7 @@ class cACTION_MONITOR_CLIENT_NEW_IP_ADDRESS_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5198ad1a43ed2ab1ULL; }
 
     private:
         bool init();
@@ -649,6 +681,7 @@ class cACTION_MONITOR_STEERING_CLIENT_SET_GROUP_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5d3af4f8fd0e41baULL; }
 
     private:
         bool init();
@@ -670,6 +703,7 @@ class cACTION_MONITOR_STEERING_CLIENT_SET_GROUP_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x83fa41403c417bd6ULL; }
 
     private:
         bool init();
@@ -691,6 +725,7 @@ class cACTION_MONITOR_STEERING_CLIENT_SET_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6f79ee999040c0beULL; }
 
     private:
         bool init();
@@ -712,6 +747,7 @@ class cACTION_MONITOR_STEERING_CLIENT_SET_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3f9e2fe2411b1102ULL; }
 
     private:
         bool init();
@@ -733,6 +769,7 @@ class cACTION_MONITOR_STEERING_EVENT_CLIENT_ACTIVITY_NOTIFICATION : public BaseC
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd1326af069d90854ULL; }
 
     private:
         bool init();
@@ -754,6 +791,7 @@ class cACTION_MONITOR_STEERING_EVENT_SNR_XING_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9b6dd9677aaf1ee7ULL; }
 
     private:
         bool init();
@@ -776,6 +814,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_TRIGGER_SCAN_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x52f685fd168f7bfcULL; }
 
     private:
         bool init();
@@ -798,6 +837,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_TRIGGER_SCAN_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4f99fb261c430d10ULL; }
 
     private:
         bool init();
@@ -818,6 +858,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_DUMP_RESULTS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x611a93ace2550323ULL; }
 
     private:
         bool init();
@@ -838,6 +879,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_DUMP_RESULTS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x02b51a03a2a3eb71ULL; }
 
     private:
         bool init();
@@ -858,6 +900,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_TRIGGERED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2463b4a7d9420d4bULL; }
 
     private:
         bool init();
@@ -880,6 +923,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_RESULTS_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc70e6474c98969b6ULL; }
 
     private:
         bool init();
@@ -901,6 +945,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_ABORT_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb48557e7d886a636ULL; }
 
     private:
         bool init();
@@ -921,6 +966,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_ABORT_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcb94663d6d0a490aULL; }
 
     private:
         bool init();
@@ -942,6 +988,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_ABORTED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x59ea326a6659ed75ULL; }
 
     private:
         bool init();
@@ -962,6 +1009,7 @@ class cACTION_MONITOR_CHANNEL_SCAN_FINISHED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1ec27788a738a2caULL; }
 
     private:
         bool init();
@@ -39,6 +39,7 @@ class cACTION_PLATFORM_SON_SLAVE_BACKHAUL_CONNECTION_COMPLETE_NOTIFICATION : pub
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x20aa1c7f4df26182ULL; }
 
     private:
         bool init();
@@ -58,6 +59,7 @@ class cACTION_PLATFORM_SON_SLAVE_REGISTER_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x07cec81928d4d4bbULL; }
 
     private:
         bool init();
@@ -77,6 +79,7 @@ class cACTION_PLATFORM_SON_SLAVE_REGISTER_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x97db268d49e57559ULL; }
 
     private:
         bool init();
@@ -97,6 +100,7 @@ class cACTION_PLATFORM_ARP_MONITOR_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf6868a3ab89aa927ULL; }
 
     private:
         bool init();
@@ -122,6 +126,7 @@ class cACTION_PLATFORM_WLAN_PARAMS_CHANGED_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7b5a03158e75b797ULL; }
 
     private:
         bool init();
@@ -153,6 +158,7 @@ class cACTION_PLATFORM_DHCP_MONITOR_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x352ff54229ce59f3ULL; }
 
     private:
         bool init();
@@ -180,6 +186,7 @@ class cACTION_PLATFORM_CHANGE_MODULE_LOGGING_LEVEL : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x34bdcb1951411d89ULL; }
 
     private:
         bool init();
@@ -201,6 +208,7 @@ class cACTION_PLATFORM_ARP_QUERY_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe4be670eb78b1bdbULL; }
 
     private:
         bool init();
@@ -222,6 +230,7 @@ class cACTION_PLATFORM_ARP_QUERY_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0ed14c8daf5d5e39ULL; }
 
     private:
         bool init();
@@ -242,6 +251,7 @@ class cACTION_PLATFORM_ONBOARD_QUERY_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x40f08d3899115369ULL; }
 
     private:
         bool init();
@@ -262,6 +272,7 @@ class cACTION_PLATFORM_ONBOARD_QUERY_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc89d6119fd0ddf37ULL; }
 
     private:
         bool init();
@@ -283,6 +294,7 @@ class cACTION_PLATFORM_ONBOARD_SET_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x48acb017c903cb39ULL; }
 
     private:
         bool init();
@@ -307,6 +319,7 @@ class cACTION_PLATFORM_WPS_ONBOARDING_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb2dddc987a33d667ULL; }
 
     private:
         bool init();
@@ -330,6 +343,7 @@ class cACTION_PLATFORM_WIFI_CREDENTIALS_GET_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf4aa61d427f85620ULL; }
 
     private:
         bool init();
@@ -353,6 +367,7 @@ class cACTION_PLATFORM_WIFI_CREDENTIALS_GET_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xeeb26541e4406b2cULL; }
 
     private:
         bool init();
@@ -375,6 +390,7 @@ class cACTION_PLATFORM_ADMIN_CREDENTIALS_GET_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7f69045606992bbcULL; }
 
     private:
         bool init();
@@ -396,6 +412,7 @@ class cACTION_PLATFORM_ADMIN_CREDENTIALS_GET_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8951ec4ae4b834d0ULL; }
 
     private:
         bool init();
@@ -417,6 +434,7 @@ class cACTION_PLATFORM_LOCAL_MASTER_GET_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1871bc9a25a41e26ULL; }
 
     private:
         bool init();
@@ -437,6 +455,7 @@ class cACTION_PLATFORM_LOCAL_MASTER_GET_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x72eff54162d104faULL; }
 
     private:
         bool init();
@@ -458,6 +477,7 @@ class cACTION_PLATFORM_MASTER_SLAVE_VERSIONS_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9af0fc9f17318831ULL; }
 
     private:
         bool init();
@@ -478,6 +498,7 @@ class cACTION_PLATFORM_GET_MASTER_SLAVE_VERSIONS_REQUEST : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x075ffc967fe711a0ULL; }
 
     private:
         bool init();
@@ -499,6 +520,7 @@ class cACTION_PLATFORM_GET_MASTER_SLAVE_VERSIONS_RESPONSE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa803dd7d4ee905acULL; }
 
     private:
         bool init();
@@ -525,6 +547,7 @@ class cACTION_PLATFORM_ERROR_NOTIFICATION : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc8247cc74a806dd5ULL; }
 
     private:
         bool init();
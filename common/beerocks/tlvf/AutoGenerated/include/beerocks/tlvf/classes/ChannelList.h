@@ -43,6 +43,7 @@ class cChannelList : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa2a86bc25f6a4f4fULL; }
 
     private:
         bool init();
@@ -69,9 +70,11 @@ class cChannel : public BaseClass
         uint8_t& supported_bandwidths_length();
         std::tuple<bool, sSupportedBandwidth&> supported_bandwidths(size_t idx);
         bool alloc_supported_bandwidths(size_t count = 1);
+        sSupportedBandwidth* reserve_supported_bandwidths(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc95834533b7b50c7ULL; }
 
     private:
         bool init();
@@ -186,7 +186,7 @@ bool tlvVsChannelScanRequestExtension::alloc_scan_requests_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_scan_requests_list[*m_scan_requests_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_scan_requests_list_idx__ += count;
@@ -201,12 +201,17 @@ bool tlvVsChannelScanRequestExtension::alloc_scan_requests_list(size_t count) {
     return true;
 }
 
+sScanRequestExtension* tlvVsChannelScanRequestExtension::reserve_scan_requests_list(size_t count) {
+    if (!alloc_scan_requests_list(count)) {
+        return nullptr;
+    }
+    return &m_scan_requests_list[m_scan_requests_list_idx__ - count];
+}
+
 void tlvVsChannelScanRequestExtension::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_1905_VS), reinterpret_cast<uint8_t*>(m_action_op));
-    for (size_t i = 0; i < m_scan_requests_list_idx__; i++){
-        m_scan_requests_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_scan_requests_list, m_scan_requests_list_idx__);
 }
 
 bool tlvVsChannelScanRequestExtension::finalize()
@@ -451,7 +456,7 @@ bool tlvVsBssidIfaceMapping::alloc_bssid_vap_id_map(size_t count) {
     uint8_t *src = (uint8_t *)&m_bssid_vap_id_map[*m_bssid_vap_id_map_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bssid_vap_id_map_idx__ += count;
@@ -466,12 +471,17 @@ bool tlvVsBssidIfaceMapping::alloc_bssid_vap_id_map(size_t count) {
     return true;
 }
 
+sBssidVapId* tlvVsBssidIfaceMapping::reserve_bssid_vap_id_map(size_t count) {
+    if (!alloc_bssid_vap_id_map(count)) {
+        return nullptr;
+    }
+    return &m_bssid_vap_id_map[m_bssid_vap_id_map_idx__ - count];
+}
+
 void tlvVsBssidIfaceMapping::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_1905_VS), reinterpret_cast<uint8_t*>(m_action_op));
-    for (size_t i = 0; i < m_bssid_vap_id_map_idx__; i++){
-        m_bssid_vap_id_map[i].struct_swap();
-    }
+    tlvf_swap_array(m_bssid_vap_id_map, m_bssid_vap_id_map_idx__);
 }
 
 bool tlvVsBssidIfaceMapping::finalize()
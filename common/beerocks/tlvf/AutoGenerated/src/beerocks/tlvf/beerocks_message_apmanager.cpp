@@ -76,7 +76,7 @@ bool cACTION_APMANAGER_UP_NOTIFICATION::alloc_iface_name(size_t count) {
     uint8_t *src = (uint8_t *)&m_iface_name[*m_iface_name_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_iface_name_idx__ += count;
@@ -273,7 +273,7 @@ std::shared_ptr<cChannelList> cACTION_APMANAGER_JOINED_NOTIFICATION::create_chan
     uint8_t *src = (uint8_t *)m_channel_list;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_vap_list = (sVapsList *)((uint8_t *)(m_vap_list) + len);
@@ -2305,7 +2305,7 @@ bool cACTION_APMANAGER_CLIENT_ASSOCIATED_NOTIFICATION::alloc_association_frame(s
     uint8_t *src = (uint8_t *)&m_association_frame[m_association_frame_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_association_frame_idx__ += count;
@@ -2699,7 +2699,7 @@ bool cACTION_APMANAGER_CLIENT_DISALLOW_REQUEST::alloc_sta(size_t count) {
     uint8_t *src = (uint8_t *)&m_sta[*m_sta_list_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bssid = (sMacAddr *)((uint8_t *)(m_bssid) + len);
@@ -2716,6 +2716,13 @@ bool cACTION_APMANAGER_CLIENT_DISALLOW_REQUEST::alloc_sta(size_t count) {
     return true;
 }
 
+sStaAssociationControl* cACTION_APMANAGER_CLIENT_DISALLOW_REQUEST::reserve_sta(size_t count) {
+    if (!alloc_sta(count)) {
+        return nullptr;
+    }
+    return &m_sta[m_sta_idx__ - count];
+}
+
 sMacAddr& cACTION_APMANAGER_CLIENT_DISALLOW_REQUEST::bssid() {
     return (sMacAddr&)(*m_bssid);
 }
@@ -2727,9 +2734,7 @@ uint16_t& cACTION_APMANAGER_CLIENT_DISALLOW_REQUEST::validity_period_sec() {
 void cACTION_APMANAGER_CLIENT_DISALLOW_REQUEST::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_APMANAGER), reinterpret_cast<uint8_t*>(m_action_op));
-    for (size_t i = 0; i < m_sta_idx__; i++){
-        m_sta[i].struct_swap();
-    }
+    tlvf_swap_array(m_sta, m_sta_idx__);
     m_bssid->struct_swap();
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_validity_period_sec));
 }
@@ -2841,7 +2846,7 @@ bool cACTION_APMANAGER_CLIENT_ALLOW_REQUEST::alloc_mac(size_t count) {
     uint8_t *src = (uint8_t *)&m_mac[*m_mac_list_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bssid = (sMacAddr *)((uint8_t *)(m_bssid) + len);
@@ -2857,6 +2862,13 @@ bool cACTION_APMANAGER_CLIENT_ALLOW_REQUEST::alloc_mac(size_t count) {
     return true;
 }
 
+sMacAddr* cACTION_APMANAGER_CLIENT_ALLOW_REQUEST::reserve_mac(size_t count) {
+    if (!alloc_mac(count)) {
+        return nullptr;
+    }
+    return &m_mac[m_mac_idx__ - count];
+}
+
 sMacAddr& cACTION_APMANAGER_CLIENT_ALLOW_REQUEST::bssid() {
     return (sMacAddr&)(*m_bssid);
 }
@@ -2864,9 +2876,7 @@ sMacAddr& cACTION_APMANAGER_CLIENT_ALLOW_REQUEST::bssid() {
 void cACTION_APMANAGER_CLIENT_ALLOW_REQUEST::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_APMANAGER), reinterpret_cast<uint8_t*>(m_action_op));
-    for (size_t i = 0; i < m_mac_idx__; i++){
-        m_mac[i].struct_swap();
-    }
+    tlvf_swap_array(m_mac, m_mac_idx__);
     m_bssid->struct_swap();
 }
 
@@ -3705,7 +3715,7 @@ bool cACTION_APMANAGER_WIFI_CREDENTIALS_UPDATE_REQUEST::alloc_bridge_ifname(size
     uint8_t *src = (uint8_t *)&m_bridge_ifname[*m_bridge_ifname_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_wifi_credentials_size = (uint8_t *)((uint8_t *)(m_wifi_credentials_size) + len);
@@ -3754,7 +3764,7 @@ std::shared_ptr<WSC::cConfigData> cACTION_APMANAGER_WIFI_CREDENTIALS_UPDATE_REQU
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<WSC::cConfigData>(src, getBuffRemainingBytes(src), m_parse__);
@@ -4356,7 +4366,7 @@ std::shared_ptr<cChannelList> cACTION_APMANAGER_CHANNELS_LIST_RESPONSE::create_c
     uint8_t *src = (uint8_t *)m_channel_list;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cChannelList>(src, getBuffRemainingBytes(src), m_parse__);
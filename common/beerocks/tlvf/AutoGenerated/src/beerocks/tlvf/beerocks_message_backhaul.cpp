@@ -2358,7 +2358,7 @@ std::shared_ptr<WSC::cConfigData> cACTION_BACKHAUL_WIFI_CREDENTIALS_UPDATE_REQUE
     uint8_t *src = (uint8_t *)m_wifi_credentials;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<WSC::cConfigData>(src, getBuffRemainingBytes(src), m_parse__);
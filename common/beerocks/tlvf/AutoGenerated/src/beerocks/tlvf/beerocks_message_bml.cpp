@@ -242,7 +242,7 @@ bool cACTION_BML_NW_MAP_RESPONSE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -378,7 +378,7 @@ bool cACTION_BML_NW_MAP_UPDATE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -514,7 +514,7 @@ bool cACTION_BML_STATS_UPDATE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -646,7 +646,7 @@ bool cACTION_BML_EVENTS_UPDATE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -3295,7 +3295,7 @@ bool cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_network_key_size = (uint8_t *)((uint8_t *)(m_network_key_size) + len);
@@ -3362,7 +3362,7 @@ bool cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST::alloc_network_key(size_t count) {
     uint8_t *src = (uint8_t *)&m_network_key[*m_network_key_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_operating_classes_size = (uint8_t *)((uint8_t *)(m_operating_classes_size) + len);
@@ -3415,7 +3415,7 @@ bool cACTION_BML_WIFI_CREDENTIALS_SET_REQUEST::alloc_operating_classes(size_t co
     uint8_t *src = (uint8_t *)&m_operating_classes[*m_operating_classes_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_operating_classes_idx__ += count;
@@ -4192,7 +4192,7 @@ bool cACTION_BML_SET_VAP_LIST_CREDENTIALS_REQUEST::alloc_vap_list(size_t count)
     uint8_t *src = (uint8_t *)&m_vap_list[*m_vap_list_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_vap_list_idx__ += count;
@@ -4207,13 +4207,18 @@ bool cACTION_BML_SET_VAP_LIST_CREDENTIALS_REQUEST::alloc_vap_list(size_t count)
     return true;
 }
 
+sConfigVapInfo* cACTION_BML_SET_VAP_LIST_CREDENTIALS_REQUEST::reserve_vap_list(size_t count) {
+    if (!alloc_vap_list(count)) {
+        return nullptr;
+    }
+    return &m_vap_list[m_vap_list_idx__ - count];
+}
+
 void cACTION_BML_SET_VAP_LIST_CREDENTIALS_REQUEST::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_BML), reinterpret_cast<uint8_t*>(m_action_op));
     tlvf_swap(32, reinterpret_cast<uint8_t*>(m_result));
-    for (size_t i = 0; i < m_vap_list_idx__; i++){
-        m_vap_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_vap_list, m_vap_list_idx__);
 }
 
 bool cACTION_BML_SET_VAP_LIST_CREDENTIALS_REQUEST::finalize()
@@ -4389,7 +4394,7 @@ bool cACTION_BML_GET_VAP_LIST_CREDENTIALS_RESPONSE::alloc_vap_list(size_t count)
     uint8_t *src = (uint8_t *)&m_vap_list[*m_vap_list_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_vap_list_idx__ += count;
@@ -4404,13 +4409,18 @@ bool cACTION_BML_GET_VAP_LIST_CREDENTIALS_RESPONSE::alloc_vap_list(size_t count)
     return true;
 }
 
+sConfigVapInfo* cACTION_BML_GET_VAP_LIST_CREDENTIALS_RESPONSE::reserve_vap_list(size_t count) {
+    if (!alloc_vap_list(count)) {
+        return nullptr;
+    }
+    return &m_vap_list[m_vap_list_idx__ - count];
+}
+
 void cACTION_BML_GET_VAP_LIST_CREDENTIALS_RESPONSE::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_BML), reinterpret_cast<uint8_t*>(m_action_op));
     tlvf_swap(32, reinterpret_cast<uint8_t*>(m_result));
-    for (size_t i = 0; i < m_vap_list_idx__; i++){
-        m_vap_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_vap_list, m_vap_list_idx__);
 }
 
 bool cACTION_BML_GET_VAP_LIST_CREDENTIALS_RESPONSE::finalize()
@@ -4582,7 +4592,7 @@ bool cACTION_BML_STEERING_SET_GROUP_REQUEST::alloc_ap_cfgs(size_t count) {
     uint8_t *src = (uint8_t *)&m_ap_cfgs[m_ap_cfgs_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ap_cfgs_idx__ += count;
@@ -4596,13 +4606,18 @@ bool cACTION_BML_STEERING_SET_GROUP_REQUEST::alloc_ap_cfgs(size_t count) {
     return true;
 }
 
+sSteeringApConfig* cACTION_BML_STEERING_SET_GROUP_REQUEST::reserve_ap_cfgs(size_t count) {
+    if (!alloc_ap_cfgs(count)) {
+        return nullptr;
+    }
+    return &m_ap_cfgs[m_ap_cfgs_idx__ - count];
+}
+
 void cACTION_BML_STEERING_SET_GROUP_REQUEST::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_BML), reinterpret_cast<uint8_t*>(m_action_op));
     tlvf_swap(32, reinterpret_cast<uint8_t*>(m_steeringGroupIndex));
-    for (size_t i = 0; i < m_ap_cfgs_idx__; i++){
-        m_ap_cfgs[i].struct_swap();
-    }
+    tlvf_swap_array(m_ap_cfgs, m_ap_cfgs_idx__);
 }
 
 bool cACTION_BML_STEERING_SET_GROUP_REQUEST::finalize()
@@ -5448,7 +5463,7 @@ bool cACTION_BML_STEERING_EVENTS_UPDATE::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
@@ -6803,7 +6818,7 @@ bool cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE::alloc_results(size_t count)
     uint8_t *src = (uint8_t *)&m_results[*m_results_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_results_idx__ += count;
@@ -6818,12 +6833,17 @@ bool cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE::alloc_results(size_t count)
     return true;
 }
 
+sChannelScanResults* cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE::reserve_results(size_t count) {
+    if (!alloc_results(count)) {
+        return nullptr;
+    }
+    return &m_results[m_results_idx__ - count];
+}
+
 void cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_BML), reinterpret_cast<uint8_t*>(m_action_op));
-    for (size_t i = 0; i < m_results_idx__; i++){
-        m_results[i].struct_swap();
-    }
+    tlvf_swap_array(m_results, m_results_idx__);
 }
 
 bool cACTION_BML_CHANNEL_SCAN_GET_RESULTS_RESPONSE::finalize()
@@ -7504,7 +7524,7 @@ bool cACTION_BML_GET_UNASSOCIATED_STATIONS_STATS_RESPONSE::alloc_sta_list(size_t
     uint8_t *src = (uint8_t *)&m_sta_list[*m_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_sta_list_idx__ += count;
@@ -7519,12 +7539,17 @@ bool cACTION_BML_GET_UNASSOCIATED_STATIONS_STATS_RESPONSE::alloc_sta_list(size_t
     return true;
 }
 
+sStaMetrics* cACTION_BML_GET_UNASSOCIATED_STATIONS_STATS_RESPONSE::reserve_sta_list(size_t count) {
+    if (!alloc_sta_list(count)) {
+        return nullptr;
+    }
+    return &m_sta_list[m_sta_list_idx__ - count];
+}
+
 void cACTION_BML_GET_UNASSOCIATED_STATIONS_STATS_RESPONSE::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_BML), reinterpret_cast<uint8_t*>(m_action_op));
-    for (size_t i = 0; i < m_sta_list_idx__; i++){
-        m_sta_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_sta_list, m_sta_list_idx__);
 }
 
 bool cACTION_BML_GET_UNASSOCIATED_STATIONS_STATS_RESPONSE::finalize()
@@ -7625,7 +7650,7 @@ bool cACTION_BML_CLIENT_GET_CLIENT_LIST_RESPONSE::alloc_client_list(size_t count
     uint8_t *src = (uint8_t *)&m_client_list[*m_client_list_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_client_list_idx__ += count;
@@ -7640,13 +7665,18 @@ bool cACTION_BML_CLIENT_GET_CLIENT_LIST_RESPONSE::alloc_client_list(size_t count
     return true;
 }
 
+sMacAddr* cACTION_BML_CLIENT_GET_CLIENT_LIST_RESPONSE::reserve_client_list(size_t count) {
+    if (!alloc_client_list(count)) {
+        return nullptr;
+    }
+    return &m_client_list[m_client_list_idx__ - count];
+}
+
 void cACTION_BML_CLIENT_GET_CLIENT_LIST_RESPONSE::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_BML), reinterpret_cast<uint8_t*>(m_action_op));
     tlvf_swap(32, reinterpret_cast<uint8_t*>(m_client_list_size));
-    for (size_t i = 0; i < m_client_list_idx__; i++){
-        m_client_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_client_list, m_client_list_idx__);
 }
 
 bool cACTION_BML_CLIENT_GET_CLIENT_LIST_RESPONSE::finalize()
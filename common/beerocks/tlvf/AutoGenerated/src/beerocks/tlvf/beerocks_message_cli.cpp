@@ -359,7 +359,7 @@ bool cACTION_CLI_RESPONSE_STR::alloc_buffer(size_t count) {
     uint8_t *src = (uint8_t *)&m_buffer[*m_buffer_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_buffer_idx__ += count;
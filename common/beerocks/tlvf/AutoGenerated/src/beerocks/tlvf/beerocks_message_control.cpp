@@ -1369,7 +1369,7 @@ bool cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_ap_stats(size_t co
     uint8_t *src = (uint8_t *)&m_ap_stats[*m_ap_stats_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_sta_stats_size = (uint8_t *)((uint8_t *)(m_sta_stats_size) + len);
@@ -1386,6 +1386,13 @@ bool cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_ap_stats(size_t co
     return true;
 }
 
+sApStatsParams* cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::reserve_ap_stats(size_t count) {
+    if (!alloc_ap_stats(count)) {
+        return nullptr;
+    }
+    return &m_ap_stats[m_ap_stats_idx__ - count];
+}
+
 uint8_t& cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::sta_stats_size() {
     return (uint8_t&)(*m_sta_stats_size);
 }
@@ -1413,7 +1420,7 @@ bool cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_sta_stats(size_t c
     uint8_t *src = (uint8_t *)&m_sta_stats[*m_sta_stats_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_sta_stats_idx__ += count;
@@ -1428,15 +1435,18 @@ bool cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_sta_stats(size_t c
     return true;
 }
 
+sStaStatsParams* cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::reserve_sta_stats(size_t count) {
+    if (!alloc_sta_stats(count)) {
+        return nullptr;
+    }
+    return &m_sta_stats[m_sta_stats_idx__ - count];
+}
+
 void cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_CONTROL), reinterpret_cast<uint8_t*>(m_action_op));
-    for (size_t i = 0; i < m_ap_stats_idx__; i++){
-        m_ap_stats[i].struct_swap();
-    }
-    for (size_t i = 0; i < m_sta_stats_idx__; i++){
-        m_sta_stats[i].struct_swap();
-    }
+    tlvf_swap_array(m_ap_stats, m_ap_stats_idx__);
+    tlvf_swap_array(m_sta_stats, m_sta_stats_idx__);
 }
 
 bool cACTION_CONTROL_HOSTAP_STATS_MEASUREMENT_RESPONSE::finalize()
@@ -144,7 +144,7 @@ bool cACTION_MONITOR_JOINED_NOTIFICATION::alloc_iface_name(size_t count) {
     uint8_t *src = (uint8_t *)&m_iface_name[*m_iface_name_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_iface_name_idx__ += count;
@@ -1229,7 +1229,7 @@ bool cACTION_MONITOR_CLIENT_ASSOCIATED_STA_LINK_METRIC_RESPONSE::alloc_bssid_inf
     uint8_t *src = (uint8_t *)&m_bssid_info_list[*m_bssid_info_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bssid_info_list_idx__ += count;
@@ -1245,14 +1245,19 @@ bool cACTION_MONITOR_CLIENT_ASSOCIATED_STA_LINK_METRIC_RESPONSE::alloc_bssid_inf
     return true;
 }
 
+sBssidInfo* cACTION_MONITOR_CLIENT_ASSOCIATED_STA_LINK_METRIC_RESPONSE::reserve_bssid_info_list(size_t count) {
+    if (!alloc_bssid_info_list(count)) {
+        return nullptr;
+    }
+    return &m_bssid_info_list[m_bssid_info_list_idx__ - count];
+}
+
 void cACTION_MONITOR_CLIENT_ASSOCIATED_STA_LINK_METRIC_RESPONSE::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_MONITOR), reinterpret_cast<uint8_t*>(m_action_op));
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
     m_sta_mac->struct_swap();
-    for (size_t i = 0; i < m_bssid_info_list_idx__; i++){
-        m_bssid_info_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_bssid_info_list, m_bssid_info_list_idx__);
 }
 
 bool cACTION_MONITOR_CLIENT_ASSOCIATED_STA_LINK_METRIC_RESPONSE::finalize()
@@ -1370,7 +1375,7 @@ bool cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_REQUEST::alloc_stations
     uint8_t *src = (uint8_t *)&m_stations_list[*m_stations_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_stations_list_idx__ += count;
@@ -1386,13 +1391,18 @@ bool cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_REQUEST::alloc_stations
     return true;
 }
 
+sUnassociatedStationInfo* cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_REQUEST::reserve_stations_list(size_t count) {
+    if (!alloc_stations_list(count)) {
+        return nullptr;
+    }
+    return &m_stations_list[m_stations_list_idx__ - count];
+}
+
 void cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_REQUEST::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_MONITOR), reinterpret_cast<uint8_t*>(m_action_op));
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_stations_list_idx__; i++){
-        m_stations_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_stations_list, m_stations_list_idx__);
 }
 
 bool cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_REQUEST::finalize()
@@ -1502,7 +1512,7 @@ bool cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_RESPONSE::alloc_station
     uint8_t *src = (uint8_t *)&m_stations_list[*m_stations_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_stations_list_idx__ += count;
@@ -1518,13 +1528,18 @@ bool cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_RESPONSE::alloc_station
     return true;
 }
 
+sUnassociatedStationStats* cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_RESPONSE::reserve_stations_list(size_t count) {
+    if (!alloc_stations_list(count)) {
+        return nullptr;
+    }
+    return &m_stations_list[m_stations_list_idx__ - count];
+}
+
 void cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_RESPONSE::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_MONITOR), reinterpret_cast<uint8_t*>(m_action_op));
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_stations_list_idx__; i++){
-        m_stations_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_stations_list, m_stations_list_idx__);
 }
 
 bool cACTION_MONITOR_CLIENT_UNASSOCIATED_STA_LINK_METRIC_RESPONSE::finalize()
@@ -1698,7 +1713,7 @@ bool cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_ap_stats(size_t co
     uint8_t *src = (uint8_t *)&m_ap_stats[*m_ap_stats_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_sta_stats_size = (uint8_t *)((uint8_t *)(m_sta_stats_size) + len);
@@ -1715,6 +1730,13 @@ bool cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_ap_stats(size_t co
     return true;
 }
 
+sApStatsParams* cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE::reserve_ap_stats(size_t count) {
+    if (!alloc_ap_stats(count)) {
+        return nullptr;
+    }
+    return &m_ap_stats[m_ap_stats_idx__ - count];
+}
+
 uint8_t& cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE::sta_stats_size() {
     return (uint8_t&)(*m_sta_stats_size);
 }
@@ -1742,7 +1764,7 @@ bool cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_sta_stats(size_t c
     uint8_t *src = (uint8_t *)&m_sta_stats[*m_sta_stats_size];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_sta_stats_idx__ += count;
@@ -1757,15 +1779,18 @@ bool cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE::alloc_sta_stats(size_t c
     return true;
 }
 
+sStaStatsParams* cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE::reserve_sta_stats(size_t count) {
+    if (!alloc_sta_stats(count)) {
+        return nullptr;
+    }
+    return &m_sta_stats[m_sta_stats_idx__ - count];
+}
+
 void cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE::class_swap()
 {
     tlvf_swap(8*sizeof(eActionOp_MONITOR), reinterpret_cast<uint8_t*>(m_action_op));
-    for (size_t i = 0; i < m_ap_stats_idx__; i++){
-        m_ap_stats[i].struct_swap();
-    }
-    for (size_t i = 0; i < m_sta_stats_idx__; i++){
-        m_sta_stats[i].struct_swap();
-    }
+    tlvf_swap_array(m_ap_stats, m_ap_stats_idx__);
+    tlvf_swap_array(m_sta_stats, m_sta_stats_idx__);
 }
 
 bool cACTION_MONITOR_HOSTAP_STATS_MEASUREMENT_RESPONSE::finalize()
@@ -60,7 +60,7 @@ std::shared_ptr<cChannel> cChannelList::create_channels_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cChannel>(src, getBuffRemainingBytes(src), m_parse__);
@@ -221,7 +221,7 @@ bool cChannel::alloc_supported_bandwidths(size_t count) {
     uint8_t *src = (uint8_t *)&m_supported_bandwidths[*m_supported_bandwidths_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_supported_bandwidths_idx__ += count;
@@ -236,11 +236,16 @@ bool cChannel::alloc_supported_bandwidths(size_t count) {
     return true;
 }
 
+sSupportedBandwidth* cChannel::reserve_supported_bandwidths(size_t count) {
+    if (!alloc_supported_bandwidths(count)) {
+        return nullptr;
+    }
+    return &m_supported_bandwidths[m_supported_bandwidths_idx__ - count];
+}
+
 void cChannel::class_swap()
 {
-    for (size_t i = 0; i < m_supported_bandwidths_idx__; i++){
-        m_supported_bandwidths[i].struct_swap();
-    }
+    tlvf_swap_array(m_supported_bandwidths, m_supported_bandwidths_idx__);
 }
 
 bool cChannel::finalize()
@@ -20,9 +20,10 @@ static std::shared_ptr<beerocks::nbapi::Amxrt> guarantee = nullptr;
 #include <bcl/beerocks_cmdu_server_factory.h>
 #include <bcl/beerocks_config_file.h>
 #include <bcl/beerocks_event_loop_impl.h>
+#include <bcl/beerocks_event_loop_profiler.h>
 #include <bcl/beerocks_logging.h>
 #include <bcl/beerocks_timer_factory_impl.h>
-#include <bcl/beerocks_timer_manager_impl.h>
+#include <bcl/beerocks_timer_wheel_manager_impl.h>
 #include <bcl/beerocks_ucc_server_factory.h>
 #include <bcl/beerocks_version.h>
 #include <bcl/network/network_utils.h>
@@ -69,7 +70,8 @@ static bool s_kill_master = false;
 static int s_signal       = 0;
 
 // Pointer to logger instance
-static beerocks::logging *s_pLogger = nullptr;
+static beerocks::logging *s_pLogger                       = nullptr;
+static beerocks::EventLoopProfiler *s_event_loop_profiler = nullptr;
 
 static void handle_signal()
 {
@@ -97,6 +99,17 @@ static void handle_signal()
         LOG(INFO) << "--- Start of file after roll ---";
         break;
     }
+
+    // Dump event loop statistics
+    case SIGUSR2: {
+        if (!s_event_loop_profiler) {
+            LOG(WARNING) << "Event loop profiling is disabled";
+            break;
+        }
+
+        LOG(INFO) << "Event loop statistics:" << std::endl << s_event_loop_profiler->to_string();
+        break;
+    }
 #ifdef ENABLE_NBAPI
     // Handle SIGALRM signal indicating that one of amxp's timers is expired.
     case SIGALRM:
@@ -135,6 +148,12 @@ static void init_signals()
     sigemptyset(&sigusr1_action.sa_mask);
     sigusr1_action.sa_flags = 0;
     sigaction(SIGUSR1, &sigusr1_action, NULL);
+
+    struct sigaction sigusr2_action;
+    sigusr2_action.sa_handler = signal_handler;
+    sigemptyset(&sigusr2_action.sa_mask);
+    sigusr2_action.sa_flags = 0;
+    sigaction(SIGUSR2, &sigusr2_action, NULL);
 #ifdef ENABLE_NBAPI
     struct sigaction sigalrm_action;
     sigalrm_action.sa_handler = signal_handler;
@@ -704,15 +723,29 @@ int main(int argc, char *argv[])
         beerocks_master_conf.temp_path + "pid/" + base_master_name; // for file touching
 
     // Create application event loop to wait for blocking I/O operations.
-    auto event_loop = std::make_shared<beerocks::EventLoopImpl>();
+    std::shared_ptr<beerocks::EventLoop> event_loop = std::make_shared<beerocks::EventLoopImpl>();
     LOG_IF(!event_loop, FATAL) << "Unable to create event loop!";
 
+    // If enabled, profile the event handlers by running them through the event loop profiler.
+    std::shared_ptr<beerocks::EventLoopProfiler> event_loop_profiler;
+    if (!beerocks_master_conf.event_loop_stall_threshold_ms.empty()) {
+        auto stall_threshold = std::chrono::milliseconds(
+            beerocks::string_utils::stoi(beerocks_master_conf.event_loop_stall_threshold_ms));
+        if (stall_threshold > std::chrono::milliseconds::zero()) {
+            event_loop_profiler =
+                std::make_shared<beerocks::EventLoopProfiler>(event_loop, stall_threshold);
+            event_loop            = event_loop_profiler;
+            s_event_loop_profiler = event_loop_profiler.get();
+        }
+    }
+
     // Create timer factory to create instances of timers.
     auto timer_factory = std::make_shared<beerocks::TimerFactoryImpl>();
     LOG_IF(!timer_factory, FATAL) << "Unable to create timer factory!";
 
     // Create timer manager to help using application timers.
-    auto timer_manager = std::make_shared<beerocks::TimerManagerImpl>(timer_factory, event_loop);
+    auto timer_manager =
+        std::make_shared<beerocks::TimerWheelManagerImpl>(timer_factory, event_loop);
     LOG_IF(!timer_manager, FATAL) << "Unable to create timer manager!";
 
     // Create UDS address where the server socket will listen for incoming connection requests.
@@ -811,15 +844,17 @@ int main(int argc, char *argv[])
         LOG_IF(!ucc_server, FATAL) << "Unable to create UCC server!";
     }
 
-    // Create broker client factory to create broker clients when requested
+    // Create broker client factory to create broker clients when requested (the clients receive
+    // CMDUs through the broker shared memory if the transport supports it)
     std::string broker_uds_path =
         beerocks_slave_conf.temp_path + "/" + std::string(BEEROCKS_BROKER_UDS);
     auto broker_client_factory =
-        beerocks::btl::create_broker_client_factory(broker_uds_path, event_loop);
+        beerocks::btl::create_broker_client_factory(broker_uds_path, event_loop, true);
     LOG_IF(!broker_client_factory, FATAL) << "Unable to create broker client factory!";
 
     son::Controller controller(master_db, std::move(broker_client_factory), std::move(ucc_server),
                                std::move(cmdu_server), timer_manager, event_loop);
+    controller.set_event_loop_profiler(event_loop_profiler);
 
     if (!amb_dm_obj->set_current_time(DATAELEMENTS_ROOT_DM ".Network")) {
         return false;
@@ -848,7 +883,8 @@ int main(int argc, char *argv[])
         }
     }
 
-    s_pLogger = nullptr;
+    s_pLogger             = nullptr;
+    s_event_loop_profiler = nullptr;
     controller.stop();
 
     beerocks::bpl::bpl_close();
@@ -122,6 +122,11 @@ constexpr auto tasks_timer_period = std::chrono::milliseconds(250);
  */
 constexpr auto operations_timer_period = std::chrono::milliseconds(1000);
 
+/**
+ * Number of Diffie-Hellman key pairs generated ahead of time (one is used per M2 or M8 message)
+ */
+constexpr size_t DH_KEYS_PRECOMPUTED = 4;
+
 Controller::Controller(db &database_,
                        std::unique_ptr<beerocks::btl::BrokerClientFactory> broker_client_factory,
                        std::unique_ptr<beerocks::UccServer> ucc_server,
@@ -140,7 +145,15 @@ Controller::Controller(db &database_,
     LOG_IF(!m_timer_manager, FATAL) << "Timer manager is a null pointer!";
     LOG_IF(!m_event_loop, FATAL) << "Event loop is a null pointer!";
 
+    m_thread_pool = std::make_shared<beerocks::ThreadPool>(1, m_event_loop);
+
+    // Generating a key pair takes a modular exponentiation, so it is done in the thread pool
+    m_dh_keys = std::make_unique<beerocks::PrecomputedQueue<mapf::encryption::diffie_hellman>>(
+        m_thread_pool, []() { return std::make_unique<mapf::encryption::diffie_hellman>(); },
+        DH_KEYS_PRECOMPUTED);
+
     database.set_controller_ctx(this);
+    database.set_thread_pool(m_thread_pool);
 
     start_mandatory_tasks();
     start_optional_tasks();
@@ -161,6 +174,8 @@ Controller::~Controller()
 {
     m_cmdu_server->clear_handlers();
 
+    database.set_thread_pool(nullptr);
+
     LOG(DEBUG) << "closing";
 }
 
@@ -385,7 +400,9 @@ void Controller::start_mandatory_tasks()
     LOG(INFO) << "VBSS is not enabled";
 #endif
 
-    LOG_IF(!m_task_pool.add_task(std::make_shared<DhcpTask>(database, m_timer_manager)), FATAL)
+    LOG_IF(!m_task_pool.add_task(
+               std::make_shared<DhcpTask>(database, m_timer_manager, m_event_loop)),
+           FATAL)
         << "Failed adding dhcp task!";
 
     LOG_IF(!m_task_pool.add_task(std::make_shared<service_prioritization_task>(database, cmdu_tx)),
@@ -1083,11 +1100,15 @@ bool Controller::autoconfig_wsc_add_m2(WSC::m1 &m1,
     ///////////////////////////////
     // @brief encryption support //
     ///////////////////////////////
-    mapf::encryption::diffie_hellman dh;
+    auto dh = m_dh_keys->take();
+    if (!dh) {
+        LOG(ERROR) << "Failed to generate Diffie-Hellman key pair";
+        return false;
+    }
     uint8_t authkey[32];
     uint8_t keywrapkey[16];
     autoconfig_wsc_calculate_keys(m1, *m2_cfg.enrollee_nonce, *m2_cfg.registrar_nonce,
-                                  *m2_cfg.pub_key, dh, authkey, keywrapkey);
+                                  *m2_cfg.pub_key, *dh, authkey, keywrapkey);
 
     // Encrypted settings
     // Encrypted settings are the ConfigData + IV. First create the ConfigData,
@@ -1141,11 +1162,15 @@ bool Controller::autoconfig_wsc_add_m8(WSC::m1 &m1,
     ///////////////////////////////
     // @brief encryption support //
     ///////////////////////////////
-    mapf::encryption::diffie_hellman dh;
+    auto dh = m_dh_keys->take();
+    if (!dh) {
+        LOG(ERROR) << "Failed to generate Diffie-Hellman key pair";
+        return false;
+    }
     uint8_t authkey[32];
     uint8_t keywrapkey[16];
     autoconfig_wsc_calculate_keys(m1, *m8_cfg.enrollee_nonce, *m8_cfg.registrar_nonce,
-                                  *m8_cfg.pub_key, dh, authkey, keywrapkey);
+                                  *m8_cfg.pub_key, *dh, authkey, keywrapkey);
 
     // Encrypted settings
     // Encrypted settings are the ConfigData + IV. First create the ConfigData,
@@ -25,6 +25,8 @@
 #include <bcl/beerocks_event_loop.h>
 #include <bcl/beerocks_logging.h>
 #include <bcl/beerocks_message_structs.h>
+#include <bcl/beerocks_precomputed_queue.h>
+#include <bcl/beerocks_thread_pool.h>
 #include <bcl/beerocks_timer_manager.h>
 #include <bcl/beerocks_ucc_server.h>
 #include <bcl/network/file_descriptor.h>
@@ -68,6 +70,16 @@ public:
      */
     bool stop();
 
+    /**
+     * @brief Sets the event loop profiler, to report its statistics through the UCC listener.
+     *
+     * @param profiler Event loop profiler, or nullptr if profiling is disabled.
+     */
+    void set_event_loop_profiler(std::shared_ptr<beerocks::EventLoopProfiler> profiler)
+    {
+        m_controller_ucc_listener.set_event_loop_profiler(profiler);
+    }
+
     /**
      * @brief Sends given CMDU message through the specified socket connection.
      *
@@ -754,6 +766,19 @@ private:
      */
     std::shared_ptr<beerocks::EventLoop> m_event_loop;
 
+    /**
+     * Thread pool to run blocking or CPU-intensive work off the event loop. It has a single
+     * thread, so that the persistent configuration written in it by the database is written in
+     * order.
+     */
+    std::shared_ptr<beerocks::ThreadPool> m_thread_pool;
+
+    /**
+     * Diffie-Hellman key pairs generated ahead of time in the thread pool, to build the WSC M2
+     * and M8 messages without generating a key pair in the event loop.
+     */
+    std::unique_ptr<beerocks::PrecomputedQueue<mapf::encryption::diffie_hellman>> m_dh_keys;
+
     /**
      * File descriptor of the timer to run internal tasks periodically.
      */
@@ -120,6 +120,14 @@ bool controller_ucc_listener::handle_dev_get_param(
         }
         value = "macaddr/bssid not found for ruid " + tlvf::mac_to_string(ruid) + " ssid " + ssid;
         return false;
+    } else if (parameter == "event_loop_stats") {
+        if (!m_event_loop_profiler) {
+            value = "event loop profiling disabled";
+            return false;
+        }
+        // The reply is a comma separated list, so the statistics lines are separated otherwise
+        value = m_event_loop_profiler->to_string("; ");
+        return true;
     }
     value = "parameter " + parameter + " not supported";
     return false;
@@ -11,6 +11,7 @@
 
 #include <bcl/beerocks_ucc_listener.h>
 
+#include <bcl/beerocks_event_loop_profiler.h>
 #include <bcl/beerocks_ucc_server.h>
 
 #include "db/db.h"
@@ -26,6 +27,17 @@ public:
                             std::unique_ptr<beerocks::UccServer> ucc_server);
     ~controller_ucc_listener() override;
 
+    /**
+     * @brief Sets the event loop profiler whose statistics are reported by the "event_loop_stats"
+     * parameter of the "dev_get_parameter" command.
+     *
+     * @param profiler Event loop profiler, or nullptr if profiling is disabled.
+     */
+    void set_event_loop_profiler(std::shared_ptr<EventLoopProfiler> profiler)
+    {
+        m_event_loop_profiler = profiler;
+    }
+
 private:
     std::string fill_version_reply_string() override;
     bool clear_configuration();
@@ -59,6 +71,7 @@ private:
 
     db &m_database;
     std::unordered_set<sMacAddr> m_bss_info_cleared_mac;
+    std::shared_ptr<EventLoopProfiler> m_event_loop_profiler;
 
 private:
     /**
@@ -5935,8 +5935,10 @@ void db::disable_periodic_link_metrics_requests()
 {
     config.link_metrics_request_interval_seconds = std::chrono::seconds::zero();
 
-    beerocks::bpl::cfg_set_link_metrics_request_interval(
-        config.link_metrics_request_interval_seconds);
+    auto interval = config.link_metrics_request_interval_seconds;
+    write_persistent_config([interval]() mutable {
+        return beerocks::bpl::cfg_set_link_metrics_request_interval(interval);
+    });
 
     m_ambiorix_datamodel->set(CONTROLLER_ROOT_DM ".Configuration", "LinkMetricsRequestInterval",
                               config.link_metrics_request_interval_seconds.count());
@@ -7652,36 +7654,52 @@ bool db::update_master_configuration(const sDbNbapiConfig &nbapi_config)
     config.daisy_chaining_disabled          = nbapi_config.daisy_chaining_disabled;
 
     // Update persistent configuration.
-    ret_val &= beerocks::bpl::cfg_set_band_steering(config.load_client_band_steering);
-    ret_val &= beerocks::bpl::cfg_set_channel_select_task(config.load_channel_select_task);
-    ret_val &= beerocks::bpl::cfg_set_client_11k_roaming(config.load_client_11k_roaming);
-    ret_val &= beerocks::bpl::cfg_set_client_roaming(config.load_client_optimal_path_roaming);
-    ret_val &= beerocks::bpl::cfg_set_dfs_reentry(config.load_dfs_reentry);
-    ret_val &= beerocks::bpl::cfg_set_dfs_task(config.load_dynamic_channel_select_task);
-    ret_val &=
-        beerocks::bpl::cfg_set_diagnostics_measurements(config.load_diagnostics_measurements);
-    ret_val &= beerocks::bpl::cfg_set_diagnostics_measurements_polling_rate_sec(
-        config.diagnostics_measurements_polling_rate_sec);
-    ret_val &= beerocks::bpl::cfg_set_health_check(config.load_health_check);
-    ret_val &= beerocks::bpl::cfg_set_ire_roaming(config.load_ire_roaming);
-    ret_val &= beerocks::bpl::cfg_set_link_metrics_request_interval(
-        config.link_metrics_request_interval_seconds);
-    ret_val &= beerocks::bpl::cfg_set_load_balancing(config.load_load_balancing);
-    ret_val &= beerocks::bpl::cfg_set_optimal_path_prefer_signal_strenght(
-        config.load_optimal_path_roaming_prefer_signal_strength);
-    ret_val &= beerocks::bpl::cfg_set_roaming_hysteresis_percent_bonus(
-        config.roaming_hysteresis_percent_bonus);
-    ret_val &=
-        beerocks::bpl::cfg_set_steering_disassoc_timer_msec(config.steering_disassoc_timer_msec);
-    ret_val &= beerocks::bpl::cfg_set_daisy_chaining_disabled(config.daisy_chaining_disabled);
-
-    ret_val &= beerocks::bpl::cfg_commit_changes();
+    auto cfg = config;
+    ret_val &= write_persistent_config([cfg]() mutable {
+        bool ok = true;
+        ok &= beerocks::bpl::cfg_set_band_steering(cfg.load_client_band_steering);
+        ok &= beerocks::bpl::cfg_set_channel_select_task(cfg.load_channel_select_task);
+        ok &= beerocks::bpl::cfg_set_client_11k_roaming(cfg.load_client_11k_roaming);
+        ok &= beerocks::bpl::cfg_set_client_roaming(cfg.load_client_optimal_path_roaming);
+        ok &= beerocks::bpl::cfg_set_dfs_reentry(cfg.load_dfs_reentry);
+        ok &= beerocks::bpl::cfg_set_dfs_task(cfg.load_dynamic_channel_select_task);
+        ok &= beerocks::bpl::cfg_set_diagnostics_measurements(cfg.load_diagnostics_measurements);
+        ok &= beerocks::bpl::cfg_set_diagnostics_measurements_polling_rate_sec(
+            cfg.diagnostics_measurements_polling_rate_sec);
+        ok &= beerocks::bpl::cfg_set_health_check(cfg.load_health_check);
+        ok &= beerocks::bpl::cfg_set_ire_roaming(cfg.load_ire_roaming);
+        ok &= beerocks::bpl::cfg_set_link_metrics_request_interval(
+            cfg.link_metrics_request_interval_seconds);
+        ok &= beerocks::bpl::cfg_set_load_balancing(cfg.load_load_balancing);
+        ok &= beerocks::bpl::cfg_set_optimal_path_prefer_signal_strenght(
+            cfg.load_optimal_path_roaming_prefer_signal_strength);
+        ok &= beerocks::bpl::cfg_set_roaming_hysteresis_percent_bonus(
+            cfg.roaming_hysteresis_percent_bonus);
+        ok &= beerocks::bpl::cfg_set_steering_disassoc_timer_msec(cfg.steering_disassoc_timer_msec);
+        ok &= beerocks::bpl::cfg_set_daisy_chaining_disabled(cfg.daisy_chaining_disabled);
+
+        ok &= beerocks::bpl::cfg_commit_changes();
+        return ok;
+    });
 
     update_master_settings_from_config();
 
     return ret_val;
 }
 
+bool db::write_persistent_config(const std::function<bool()> &write)
+{
+    if (!m_thread_pool) {
+        return write();
+    }
+
+    return m_thread_pool->post([write]() {
+        if (!write()) {
+            LOG(ERROR) << "Failed to write the persistent configuration";
+        }
+    });
+}
+
 void db::update_master_settings_from_config()
 {
     // calling these functions with "true" is equivalent to copying the value from config container
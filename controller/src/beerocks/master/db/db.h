@@ -15,6 +15,7 @@
 
 #include <bcl/beerocks_defines.h>
 #include <bcl/beerocks_logging.h>
+#include <bcl/beerocks_thread_pool.h>
 #include <bcl/beerocks_wifi_channel.h>
 #include <bcl/network/network_utils.h>
 #include <bcl/son/son_wireless_utils.h>
@@ -2200,6 +2201,8 @@ public:
      *
      * Data model path : "Device.WiFi.DataElements.Configuration" defined in controller.odl
      *
+     * The persistent configuration is written in the thread pool (see set_thread_pool()).
+     *
      * @param nbapi_config Settings read from datamodel with change action.
      * @return true on success, otherwise false.
      */
@@ -2849,6 +2852,20 @@ public:
     void set_controller_ctx(Controller *ctx) { m_controller_ctx = ctx; }
     Controller *get_controller_ctx() { return m_controller_ctx; }
 
+    /**
+     * @brief Sets the thread pool to write the persistent configuration in.
+     *
+     * Writing the UCI configuration is blocking, so it is done off the event loop. The pool must
+     * run the work in order (i.e.: have a single thread). If no pool is set, the configuration is
+     * written inline.
+     *
+     * @param thread_pool Thread pool, or nullptr to write inline.
+     */
+    void set_thread_pool(std::shared_ptr<beerocks::ThreadPool> thread_pool)
+    {
+        m_thread_pool = thread_pool;
+    }
+
     const sMacAddr &get_local_bridge_mac() { return m_local_bridge_mac; }
 
     //
@@ -2925,6 +2942,15 @@ private:
      */
     bool update_client_entry_in_persistent_db(const sMacAddr &mac, const ValuesMap &values_map);
 
+    /**
+     * @brief Writes the persistent configuration in the thread pool, or inline if not set.
+     *
+     * @param write Function that writes the configuration, returning false on error.
+     * @return The result of the function when run inline, or whether it could be posted to the
+     * thread pool (errors are then logged).
+     */
+    bool write_persistent_config(const std::function<bool()> &write);
+
     /**
      * @brief Sets the node params (runtime db) from a param-value map.
      *
@@ -3198,6 +3224,7 @@ private:
         default_8021q_settings; // key=al_mac
 
     Controller *m_controller_ctx = nullptr;
+    std::shared_ptr<beerocks::ThreadPool> m_thread_pool;
     const sMacAddr m_local_bridge_mac;
 
     int m_persistent_db_clients_count = 0;
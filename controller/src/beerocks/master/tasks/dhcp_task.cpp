@@ -14,8 +14,10 @@
 using namespace beerocks;
 using namespace son;
 
-DhcpTask::DhcpTask(db &database_, std::shared_ptr<beerocks::TimerManager> timer_manager)
-    : task("dhcp task"), m_database(database_), m_timer_manager(timer_manager)
+DhcpTask::DhcpTask(db &database_, std::shared_ptr<beerocks::TimerManager> timer_manager,
+                   std::shared_ptr<beerocks::EventLoop> event_loop)
+    : task("dhcp task"), m_database(database_), m_timer_manager(timer_manager),
+      m_thread_pool(std::make_unique<beerocks::ThreadPool>(1, event_loop))
 {
     LOG_IF(!m_timer_manager, FATAL) << "Timer manager is a null pointer!";
 
@@ -36,28 +38,45 @@ DhcpTask::~DhcpTask()
         m_timer_manager->remove_timer(m_periodic_timer);
     }
 
+    // Wait for the leases being read, if any, before destroying the ubus context
+    m_thread_pool.reset();
+
     bpl::dhcp_manual_procedure_destroy();
 }
 
 void DhcpTask::handle_timer_timeout()
 {
-    bpl::leases_pair_t leases;
-
-    if (!bpl::dhcp_get_leases(leases)) {
-        LOG(ERROR) << "DHCP get leases failed.";
+    if (m_lease_poll_pending) {
+        LOG(DEBUG) << "Previous DHCP lease poll is still pending, skipping.";
         return;
     }
 
-    for (const auto &ipv6 : leases.second) {
-        m_database.set_sta_dhcp_v6_lease(ipv6.second.mac, ipv6.second.host_name,
-                                         ipv6.second.ip_address);
-    }
-
-    // To give precedence ipv4 hostname in database in case of host name conflict,
-    // ipv4 leases are proccessed later.
-    for (const auto &ipv4 : leases.first) {
-        m_database.set_sta_dhcp_v4_lease(ipv4.first, ipv4.second.host_name, ipv4.second.ip_address);
-    }
+    auto leases  = std::make_shared<bpl::leases_pair_t>();
+    auto success = std::make_shared<bool>(false);
+
+    // The continuation is cancelled if the task is destroyed first
+    m_lease_poll_pending = m_thread_pool->post(
+        [leases, success]() { *success = bpl::dhcp_get_leases(*leases); },
+        [this, leases, success]() {
+            m_lease_poll_pending = false;
+
+            if (!*success) {
+                LOG(ERROR) << "DHCP get leases failed.";
+                return;
+            }
+
+            for (const auto &ipv6 : leases->second) {
+                m_database.set_sta_dhcp_v6_lease(ipv6.second.mac, ipv6.second.host_name,
+                                                 ipv6.second.ip_address);
+            }
+
+            // To give precedence ipv4 hostname in database in case of host name conflict,
+            // ipv4 leases are proccessed later.
+            for (const auto &ipv4 : leases->first) {
+                m_database.set_sta_dhcp_v4_lease(ipv4.first, ipv4.second.host_name,
+                                                 ipv4.second.ip_address);
+            }
+        });
 }
 
 void DhcpTask::start_periodic_lease_poll(const std::chrono::milliseconds &delay_ms)
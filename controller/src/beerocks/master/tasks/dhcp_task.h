@@ -12,13 +12,15 @@
 #include "../db/db.h"
 #include "task.h"
 #include "task_pool.h"
+#include <bcl/beerocks_thread_pool.h>
 #include <bcl/beerocks_timer_manager.h>
 #include <bcl/network/file_descriptor.h>
 
 namespace son {
 class DhcpTask : public task {
 public:
-    DhcpTask(db &database_, std::shared_ptr<beerocks::TimerManager> timer_manager);
+    DhcpTask(db &database_, std::shared_ptr<beerocks::TimerManager> timer_manager,
+             std::shared_ptr<beerocks::EventLoop> event_loop);
     ~DhcpTask() override;
 
     enum events {
@@ -34,9 +36,16 @@ private:
     std::shared_ptr<beerocks::TimerManager>
         m_timer_manager; //!< Timer manager to add/remove timers.
 
+    /**
+     * Thread to read the leases in, as bpl::dhcp_get_leases() blocks on a ubus call. A single
+     * thread is used so that the ubus context is never used by two threads at once.
+     */
+    std::unique_ptr<beerocks::ThreadPool> m_thread_pool;
+
     //! File descriptor of the timer to get DHCP IPv4/IPv6 leases periodically.
     int m_periodic_timer{beerocks::net::FileDescriptor::invalid_descriptor};
-    bool m_successful_init; //!< Flag for successful initialized ubus context.
+    bool m_successful_init;           //!< Flag for successful initialized ubus context.
+    bool m_lease_poll_pending{false}; //!< Flag for leases being read in m_thread_pool.
 
     const std::chrono::milliseconds DELAY_AFTER_STA_CONNECTED_MS{5000};
 
@@ -44,8 +53,8 @@ private:
      * @brief Start periodical DHCP IPv4/IPv6 lease poll with timer.
      *
      * Periodic lease polls are triggered with timer.
-     * Leases are read from bpl::dhcp_get_leases() within timer handler.
-     * After reading leases, database objects are filled.
+     * Leases are read from bpl::dhcp_get_leases() in the thread pool.
+     * After reading leases, database objects are filled in the event loop thread.
      *
      * Period of this timer is config.dhcp_monitor_interval_seconds.
      * Timer delay is passed as argument to control timers delay.
@@ -60,7 +69,8 @@ private:
     /**
      * @brief Handles periodic lease poll timer timeout.
      *
-     * It calls bpl::dhcp_get_leases() and related datamodel methods.
+     * It calls bpl::dhcp_get_leases() in the thread pool, and related datamodel methods once
+     * the leases are read. A poll is skipped if the previous one is still pending.
      */
     void handle_timer_timeout();
 };
@@ -9,17 +9,27 @@
 #include "prplmesh_cli.h"
 #include "prplmesh_amx_client.h"
 
+#include <bcl/beerocks_config_file.h>
+#include <bcl/beerocks_defines.h>
+#include <bcl/network/socket.h>
+#include <mapf/common/utils.h>
+#include <mapf/transport/ieee1905_transport_messages.h>
+#include <tlvf/ieee_1905_1/eMessageType.h>
+
 #include <arpa/inet.h>
 #include <net/if.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 
@@ -508,6 +518,12 @@ version         : get current prplMesh version
 mode            : get current prplMesh mode (Agent only/Controller only/Agent+Controller)
 status          : print an overview of the current prplMesh status
   -o <output format>                Either "pretty" (default if stdout is a TTY) or "json" (otherwise)
+transport_stats : print the per message type telemetry of the IEEE1905 transport and the egress
+                  statistics of its broker subscribers
+transport_capture : start or stop the pcapng capture of the IEEE1905 transport
+  -o start|stop
+  -f <file>                         Capture file name, in the temp path (default: ieee1905_transport.pcapng)
+  -s <size>                         Capture file size in bytes (default: 1 MiB, maximum: 64 MiB)
 show_ap         : show AccessPoints
 set_ssid        : set SSID
   -o .<ap_object_number>|<ap_ssid>  Use .. if <ap_ssid> starts with .
@@ -659,5 +675,173 @@ bool prplmesh_cli::set_security(const std::string &ap, const std::string &mode,
     return status == AMXB_STATUS_OK;
 }
 
+/**
+ * @brief Connect to the broker of the IEEE1905 transport.
+ *
+ * @return The connected socket or nullptr on error.
+ */
+static std::unique_ptr<SocketClient> connect_to_transport_broker()
+{
+    // The transport (and its broker) share the agent configuration
+    std::string config_file_path =
+        mapf::utils::get_install_path() + "config/" + std::string(BEEROCKS_AGENT) + ".conf";
+    beerocks::config_file::sConfigSlave slave_conf;
+    if (!beerocks::config_file::read_slave_config_file(config_file_path, slave_conf)) {
+        std::cerr << "Failed reading the agent configuration: " << config_file_path << std::endl;
+        return nullptr;
+    }
+
+    auto broker =
+        std::make_unique<SocketClient>(slave_conf.temp_path + std::string(BEEROCKS_BROKER_UDS));
+    if (!broker->getError().empty()) {
+        std::cerr << "Failed connecting to the broker: " << broker->getError() << std::endl;
+        return nullptr;
+    }
+
+    return broker;
+}
+
+bool prplmesh_cli::print_transport_telemetry()
+{
+    using namespace beerocks::transport::messages;
+
+    auto broker_socket = connect_to_transport_broker();
+    if (!broker_socket) {
+        return false;
+    }
+    auto &broker = *broker_socket;
+
+    // Subscribe to the report before querying it
+    SubscribeMessage subscribe;
+    subscribe.metadata()->type              = SubscribeMessage::ReqType::SUBSCRIBE;
+    subscribe.metadata()->msg_types_count   = 1;
+    subscribe.metadata()->msg_types[0].bits = {
+        .internal        = 1,
+        .vendor_specific = 0,
+        .reserved        = 0,
+        .type            = uint32_t(Type::TransportTelemetryReportMessage)};
+
+    if (!send_transport_message(broker, subscribe) ||
+        !send_transport_message(broker, TransportTelemetryQueryMessage())) {
+        std::cerr << "Failed sending the telemetry query" << std::endl;
+        return false;
+    }
+
+    std::vector<TransportTelemetryReportMessage::Entry> entries;
+    std::vector<TransportTelemetryReportMessage::Subscriber> subscribers;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    bool more     = true;
+    while (more) {
+        auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           deadline - std::chrono::steady_clock::now())
+                           .count();
+        struct pollfd pfd = {.fd = broker.getSocketFd(), .events = POLLIN, .revents = 0};
+        if (timeout <= 0 || poll(&pfd, 1, timeout) <= 0) {
+            std::cerr << "Timeout waiting for the telemetry report" << std::endl;
+            return false;
+        }
+
+        // Wait for the rest of partially received messages
+        auto message = read_transport_message(broker);
+        if (!message) {
+            continue;
+        }
+
+        auto report = dynamic_cast<TransportTelemetryReportMessage *>(message.get());
+        if (!report) {
+            continue;
+        }
+
+        auto metadata    = report->metadata();
+        auto entry_count = std::min(metadata->entry_count,
+                                    TransportTelemetryReportMessage::kMaxEntries);
+        entries.insert(entries.end(), metadata->entries, metadata->entries + entry_count);
+        auto subscriber_count = std::min(metadata->subscriber_count,
+                                         TransportTelemetryReportMessage::kMaxSubscribers);
+        subscribers.insert(subscribers.end(), metadata->subscribers,
+                           metadata->subscribers + subscriber_count);
+        more = metadata->more;
+    }
+
+    auto average = [](const TransportTelemetryReportMessage::Latency &latency) {
+        return latency.count ? latency.sum_us / latency.count : 0;
+    };
+
+    std::cout << std::left << std::setw(48) << "Message type" << std::right << std::setw(10)
+              << "RX" << std::setw(12) << "RX bytes" << std::setw(8) << "RX frag" << std::setw(10)
+              << "TX" << std::setw(12) << "TX bytes" << std::setw(8) << "TX frag" << std::setw(8)
+              << "Dup" << std::setw(20) << "Reassembly avg/max" << std::setw(20)
+              << "Publish avg/max" << std::setw(12) << "Dedup drop" << std::endl;
+
+    for (const auto &entry : entries) {
+        std::stringstream type;
+        type << "0x" << std::hex << std::setw(4) << std::setfill('0') << entry.msg_type << " "
+             << ieee1905_1::eMessageType_str(ieee1905_1::eMessageType(entry.msg_type));
+
+        std::stringstream reassembly;
+        reassembly << average(entry.reassembly_latency) << "/" << entry.reassembly_latency.max_us;
+
+        std::stringstream publish;
+        publish << average(entry.publish_latency) << "/" << entry.publish_latency.max_us;
+
+        std::cout << std::left << std::setw(48) << type.str() << std::right << std::setw(10)
+                  << entry.rx_packets << std::setw(12) << entry.rx_bytes << std::setw(8)
+                  << entry.rx_fragments << std::setw(10) << entry.tx_packets << std::setw(12)
+                  << entry.tx_bytes << std::setw(8) << entry.tx_fragments << std::setw(8)
+                  << entry.duplicates << std::setw(20) << reassembly.str() << std::setw(20)
+                  << publish.str() << std::setw(12) << entry.de_duplication_drops << std::endl;
+    }
+    std::cout << "(latencies in microseconds)" << std::endl;
+
+    std::cout << std::endl
+              << std::left << std::setw(16) << "Subscriber FD" << std::right << std::setw(12)
+              << "Queued" << std::setw(12) << "Max queued" << std::setw(12) << "Sent"
+              << std::setw(12) << "Dropped" << std::endl;
+
+    for (const auto &subscriber : subscribers) {
+        std::cout << std::left << std::setw(16) << subscriber.fd << std::right << std::setw(12)
+                  << subscriber.queue_depth << std::setw(12) << subscriber.max_queue_depth
+                  << std::setw(12) << subscriber.sent << std::setw(12) << subscriber.dropped
+                  << std::endl;
+    }
+
+    return true;
+}
+
+bool prplmesh_cli::set_transport_capture(bool enable, const std::string &path, uint32_t size)
+{
+    using namespace beerocks::transport::messages;
+
+    TransportCaptureControlMessage request;
+    if (path.length() >= TransportCaptureControlMessage::kMaxPathLength) {
+        std::cerr << "Capture file name is too long: " << path << std::endl;
+        return false;
+    }
+    if (path.find('/') != std::string::npos) {
+        std::cerr << "Capture file must be a file name, without a directory: " << path
+                  << std::endl;
+        return false;
+    }
+
+    auto broker = connect_to_transport_broker();
+    if (!broker) {
+        return false;
+    }
+
+    request.metadata()->enable = enable;
+    request.metadata()->size   = size;
+    std::copy(path.begin(), path.end(), request.metadata()->path);
+
+    if (!send_transport_message(*broker, request)) {
+        std::cerr << "Failed sending the capture request" << std::endl;
+        return false;
+    }
+
+    // The transport does not reply, the outcome is in its log
+    std::cerr << "Capture " << (enable ? "start" : "stop") << " request sent to the transport"
+              << std::endl;
+    return true;
+}
+
 } // namespace prplmesh_api
 } // namespace beerocks
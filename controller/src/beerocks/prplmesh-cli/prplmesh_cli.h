@@ -129,6 +129,29 @@ public:
     */
     bool print_status(const std::string &format);
 
+    /**
+    * @brief Print the per message type telemetry of the IEEE1905 transport.
+    *
+    * Queries the transport through the broker socket, so it is meant to be run on a device where
+    * the prplMesh agent (and its transport) is running.
+    *
+    * @return True on success, false if unable to get the telemetry.
+    */
+    bool print_transport_telemetry();
+
+    /**
+    * @brief Start or stop the pcapng capture of the IEEE1905 transport.
+    *
+    * The capture file is written by the transport, on the device where it is running.
+    *
+    * @param enable Start (true) or stop (false) the capture.
+    * @param path Capture file name (created in the temporary directory of the transport), or
+    * empty for the default one.
+    * @param size Capture file size in bytes, or 0 for the default size.
+    * @return True if the request was sent to the transport, false otherwise.
+    */
+    bool set_transport_capture(bool enable, const std::string &path, uint32_t size);
+
     /**
     * @brief Get frequency using operating classes.
     * 
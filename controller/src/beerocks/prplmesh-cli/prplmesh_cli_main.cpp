@@ -10,8 +10,10 @@
 
 #include <iostream>
 #include <limits.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 beerocks::prplmesh_api::prplmesh_cli prpl_cli;
@@ -86,6 +88,36 @@ bool print_status(int argc, char *argv[])
     return !prpl_cli.print_status(format);
 }
 
+bool set_transport_capture(int argc, char *argv[])
+{
+    int opt;
+    const char *action = 0;
+    const char *file   = "";
+    unsigned long size = 0;
+
+    while ((opt = getopt(argc, argv, "o:f:s:")) != -1) {
+        switch (opt) {
+        case 'o':
+            action = optarg;
+            break;
+        case 'f':
+            file = optarg;
+            break;
+        case 's':
+            size = strtoul(optarg, nullptr, 0);
+            break;
+        default:
+            return false;
+        }
+    }
+
+    if (!action || (strcmp(action, "start") && strcmp(action, "stop")) || size > UINT32_MAX) {
+        return false;
+    }
+
+    return prpl_cli.set_transport_capture(!strcmp(action, "start"), file, size);
+}
+
 int main(int argc, char *argv[])
 {
     if (argc < 2) {
@@ -115,6 +147,10 @@ int main(int argc, char *argv[])
                 return !prpl_cli.print_mode();
             } else if (command_string == "status") {
                 return print_status(argc, argv);
+            } else if (command_string == "transport_stats") {
+                return !prpl_cli.print_transport_telemetry();
+            } else if (command_string == "transport_capture") {
+                return !set_transport_capture(argc, argv);
             } else {
                 std::cerr << "Error, command not found: " << command_string << std::endl
                           << "Run '-c help' to see supported commands" << std::endl;
@@ -303,6 +303,7 @@ class cDppAttrInitiatorCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc50d465f7a9bd201ULL; }
 
     private:
         bool init();
@@ -342,6 +343,7 @@ class cDppAttrResponderCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x89ff6610b90ee6beULL; }
 
     private:
         bool init();
@@ -366,6 +368,7 @@ class cDppAttrWrappedDataAttribute : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa5a4fabf1bc2b479ULL; }
 
     private:
         bool init();
@@ -392,6 +395,7 @@ class cDppAttrInitiatorAuthenticatingTag : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x38e08f69b3871003ULL; }
 
     private:
         bool init();
@@ -418,6 +422,7 @@ class cDppAttrResponderAuthenticatingTag : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfc0d6feb630ebbeeULL; }
 
     private:
         bool init();
@@ -446,6 +451,7 @@ class cDppAttrDppConfigurationObject : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdf5859eb7b3f03ffULL; }
 
     private:
         bool init();
@@ -474,6 +480,7 @@ class cDppAttrDppConnector : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5142ec91faaab425ULL; }
 
     private:
         bool init();
@@ -502,6 +509,7 @@ class cDppAttrDppConfigurationRequestObject : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcc18f22f9f6b7996ULL; }
 
     private:
         bool init();
@@ -530,6 +538,7 @@ class cDppAttrBootstrappingKey : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3c2663c4553c9197ULL; }
 
     private:
         bool init();
@@ -558,6 +567,7 @@ class cDppAttrCodeIdentifier : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdd79938430a77e2cULL; }
 
     private:
         bool init();
@@ -586,6 +596,7 @@ class cDppAttrBootstrappingInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x44f8b18b12949634ULL; }
 
     private:
         bool init();
@@ -612,6 +623,7 @@ class cDppAttrDppEnvelopedData : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7660c1ffd874863aULL; }
 
     private:
         bool init();
@@ -640,6 +652,7 @@ class cDppAttrDppConnectionStatusObject : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x32026253a9c32617ULL; }
 
     private:
         bool init();
@@ -679,6 +692,7 @@ class cDppAttrReconfigurationFlags : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x98ea62b3a773f73eULL; }
 
     private:
         bool init();
@@ -703,6 +717,7 @@ class cDppAttrEtagId : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd31e8a6c9df78e56ULL; }
 
     private:
         bool init();
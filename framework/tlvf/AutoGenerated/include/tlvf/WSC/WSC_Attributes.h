@@ -160,6 +160,7 @@ class cWscAttrKeyWrapAuthenticator : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa87e3b75ef14c871ULL; }
 
     private:
         bool init();
@@ -189,6 +190,7 @@ class cWscAttrVendorExtension : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5829d5261045ede6ULL; }
 
     private:
         bool init();
@@ -232,6 +234,7 @@ class cConfigData : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x77c23166d220f723ULL; }
 
     private:
         bool init();
@@ -274,6 +277,7 @@ class cWscAttrEncryptedSettings : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9a9abccba8d00bfcULL; }
 
     private:
         bool init();
@@ -299,6 +303,7 @@ class cWscAttrVersion : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9c22b7c97dd5db15ULL; }
 
     private:
         bool init();
@@ -320,6 +325,7 @@ class cWscAttrMessageType : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa6b565d840d6c432ULL; }
 
     private:
         bool init();
@@ -342,6 +348,7 @@ class cWscAttrEnrolleeNonce : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xef5da6ce5265b42cULL; }
 
     private:
         bool init();
@@ -366,6 +373,7 @@ class cWscAttrPublicKey : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xea96edba831d03bdULL; }
 
     private:
         bool init();
@@ -389,6 +397,7 @@ class cWscAttrAuthenticationTypeFlags : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x272a5fea1fc1a8eeULL; }
 
     private:
         bool init();
@@ -410,6 +419,7 @@ class cWscAttrEncryptionTypeFlags : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4127b68014e75fc1ULL; }
 
     private:
         bool init();
@@ -431,6 +441,7 @@ class cWscAttrConnectionTypeFlags : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x19254ec87de75a6aULL; }
 
     private:
         bool init();
@@ -452,6 +463,7 @@ class cWscAttrConfigurationMethods : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc8801277bdd3a253ULL; }
 
     private:
         bool init();
@@ -478,6 +490,7 @@ class cWscAttrManufacturer : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfbf66b6dc9360fd2ULL; }
 
     private:
         bool init();
@@ -506,6 +519,7 @@ class cWscAttrModelName : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x786ec4b97403223bULL; }
 
     private:
         bool init();
@@ -534,6 +548,7 @@ class cWscAttrModelNumber : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x065f242e6fc7ec69ULL; }
 
     private:
         bool init();
@@ -562,6 +577,7 @@ class cWscAttrSerialNumber : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3c2a8d05499de53eULL; }
 
     private:
         bool init();
@@ -587,6 +603,7 @@ class cWscAttrPrimaryDeviceType : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb800daff659be179ULL; }
 
     private:
         bool init();
@@ -615,6 +632,7 @@ class cWscAttrDeviceName : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcb8c7a42b9b66c4aULL; }
 
     private:
         bool init();
@@ -638,6 +656,7 @@ class cWscAttrRfBands : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x98a13f54046ca111ULL; }
 
     private:
         bool init();
@@ -659,6 +678,7 @@ class cWscAttrAssociationState : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc05c3db394b2c523ULL; }
 
     private:
         bool init();
@@ -680,6 +700,7 @@ class cWscAttrDevicePasswordID : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x91c395e85188f841ULL; }
 
     private:
         bool init();
@@ -701,6 +722,7 @@ class cWscAttrConfigurationError : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6c296005e22819cbULL; }
 
     private:
         bool init();
@@ -722,6 +744,7 @@ class cWscAttrOsVersion : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6652ea3c83c953afULL; }
 
     private:
         bool init();
@@ -743,6 +766,7 @@ class cWscAttrMac : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1ec01ca9fda4e3eeULL; }
 
     private:
         bool init();
@@ -765,6 +789,7 @@ class cWscAttrUuidE : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa6d5927e96c4abe7ULL; }
 
     private:
         bool init();
@@ -788,6 +813,7 @@ class cWscAttrWscState : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4ea33a4091383427ULL; }
 
     private:
         bool init();
@@ -810,6 +836,7 @@ class cWscAttrUuidR : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa6d57f7e96c48b9eULL; }
 
     private:
         bool init();
@@ -834,6 +861,7 @@ class cWscAttrAuthenticator : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2ea1985e8add490aULL; }
 
     private:
         bool init();
@@ -858,6 +886,7 @@ class cWscAttrRegistrarNonce : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x85ba5ae31914c9ddULL; }
 
     private:
         bool init();
@@ -886,6 +915,7 @@ class cWscAttrSsid : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x805d0863c82ef444ULL; }
 
     private:
         bool init();
@@ -909,6 +939,7 @@ class cWscAttrAuthenticationType : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xad8782647a210717ULL; }
 
     private:
         bool init();
@@ -930,6 +961,7 @@ class cWscAttrEncryptionType : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9796c132124a5066ULL; }
 
     private:
         bool init();
@@ -956,6 +988,7 @@ class cWscAttrNetworkKey : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xea49f5e833ede13aULL; }
 
     private:
         bool init();
@@ -93,6 +93,7 @@ class tlvAirtiesDeviceInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x22cdf06a28c5ee2bULL; }
 
     private:
         bool init();
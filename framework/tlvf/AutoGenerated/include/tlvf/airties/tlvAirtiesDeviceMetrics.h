@@ -54,6 +54,7 @@ class tlvAirtiesDeviceMetrics : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd230654b5e0d9370ULL; }
 
     private:
         bool init();
@@ -87,6 +88,7 @@ class cRadioInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xff260e86a1e1cfacULL; }
 
     private:
         bool init();
@@ -49,6 +49,7 @@ class tlvAirtiesEthernetInterface : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xeb2887322d788fe1ULL; }
 
     private:
         bool init();
@@ -120,6 +121,7 @@ class cInterfaceList : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x38c93284c62972ccULL; }
 
     private:
         bool init();
@@ -50,6 +50,7 @@ class tlvAirtiesEthernetStats : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc9457db6be73bb99ULL; }
 
     private:
         bool init();
@@ -97,6 +98,7 @@ class cPortList : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa07b67be49203876ULL; }
 
     private:
         bool init();
@@ -143,6 +145,7 @@ class tlvAirtiesEthernetStatsallcntr : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xaa1c58e5424f6c33ULL; }
 
     private:
         bool init();
@@ -198,6 +201,7 @@ class cPortList_ext : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5b60114d27df19a6ULL; }
 
     private:
         bool init();
@@ -76,6 +76,7 @@ class tlvAirtiesServiceStatus : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x518dd97638bd9e82ULL; }
 
     private:
         bool init();
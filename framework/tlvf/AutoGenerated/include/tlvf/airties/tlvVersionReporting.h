@@ -48,6 +48,7 @@ class tlvVersionReporting : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbf599196029fdf9cULL; }
 
     private:
         bool init();
@@ -75,6 +76,7 @@ class cLocalInterfaceInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe6e398bec9f19c4bULL; }
 
     private:
         bool init();
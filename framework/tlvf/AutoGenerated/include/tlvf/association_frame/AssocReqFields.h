@@ -62,6 +62,7 @@ class cSSID : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5a3155ed68003d70ULL; }
 
     private:
         bool init();
@@ -89,6 +90,7 @@ class cRSN : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7c01b7e3b9f9de46ULL; }
 
     private:
         bool init();
@@ -117,6 +119,7 @@ class cSupportedOpClasses : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x478281d653cfba58ULL; }
 
     private:
         bool init();
@@ -144,6 +147,7 @@ class cSupportRates : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc21ef6aa6c3e8461ULL; }
 
     private:
         bool init();
@@ -170,6 +174,7 @@ class cExtendedSupportRates : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x856fd68eb2beffa4ULL; }
 
     private:
         bool init();
@@ -194,6 +199,7 @@ class cPowerCapability : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x353ba1cb26fce8ceULL; }
 
     private:
         bool init();
@@ -216,6 +222,7 @@ class cBssCoexistence20_40 : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0fe032d541b49084ULL; }
 
     private:
         bool init();
@@ -240,6 +247,7 @@ class cQosTrafficCap : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5ebe143ac28d6563ULL; }
 
     private:
         bool init();
@@ -262,6 +270,7 @@ class cTimBroadcastRequest : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0bcfcbe4f94afb73ULL; }
 
     private:
         bool init();
@@ -287,6 +296,7 @@ class cInterworking : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa778e65602b188aeULL; }
 
     private:
         bool init();
@@ -349,6 +359,7 @@ class cMultiBand : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdb23e52dd53ea557ULL; }
 
     private:
         bool init();
@@ -390,6 +401,7 @@ class cDmgCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xedb5f10fb8ae030bULL; }
 
     private:
         bool init();
@@ -425,6 +437,7 @@ class cMultipleMacSublayers : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8ab00eee20728d5eULL; }
 
     private:
         bool init();
@@ -450,6 +463,7 @@ class cOperatingModeNotify : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbba3410e760cbb7cULL; }
 
     private:
         bool init();
@@ -477,6 +491,7 @@ class cVendorSpecific : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x05742c9e9c724a19ULL; }
 
     private:
         bool init();
@@ -506,6 +521,7 @@ class cUnknownField : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd406c75654efc2f9ULL; }
 
     private:
         bool init();
@@ -42,6 +42,7 @@ class cCurrentApAddress : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4ede65e1d22a0d17ULL; }
 
     private:
         bool init();
@@ -64,6 +65,7 @@ class cFastBssTrans : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1633804364a76b83ULL; }
 
     private:
         bool init();
@@ -91,6 +93,7 @@ class cFmsRequest : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4ede524a099812fcULL; }
 
     private:
         bool init();
@@ -118,6 +121,7 @@ class cDmsRequest : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe8d357d418a9f9a2ULL; }
 
     private:
         bool init();
@@ -82,6 +82,7 @@ class cCapInfoDmgSta : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x810ea10e6229a8c3ULL; }
 
     private:
         bool init();
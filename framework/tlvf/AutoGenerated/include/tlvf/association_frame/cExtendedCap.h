@@ -72,6 +72,7 @@ class cExtendedCap : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x497e886f2f442ef6ULL; }
 
     private:
         bool init();
@@ -58,6 +58,7 @@ class cMobilityDomain : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x80cd34c8320ed432ULL; }
 
     private:
         bool init();
@@ -61,6 +61,7 @@ class cQosCapability : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x87a8c8b410845832ULL; }
 
     private:
         bool init();
@@ -40,6 +40,7 @@ class cRmEnabledCaps : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3c8f2da6cba203e6ULL; }
 
     private:
         bool init();
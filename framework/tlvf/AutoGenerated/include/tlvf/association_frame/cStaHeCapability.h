@@ -97,6 +97,7 @@ class cStaHeCapability : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xefe1fe38a4537a2aULL; }
 
     private:
         bool init();
@@ -65,6 +65,7 @@ class cStaHtCapability : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x09d4a2560e984ac9ULL; }
 
     private:
         bool init();
@@ -40,6 +40,7 @@ class cStaVhtCapability : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x419dc1fd9805c66dULL; }
 
     private:
         bool init();
@@ -49,9 +49,11 @@ class cSupportedChannels : public BaseClass
         size_t supported_channel_sets_length() { return m_supported_channel_sets_idx__ * sizeof(cSupportedChannels::sSupportedChannelsSet); }
         std::tuple<bool, sSupportedChannelsSet&> supported_channel_sets(size_t idx);
         bool alloc_supported_channel_sets(size_t count = 1);
+        sSupportedChannelsSet* reserve_supported_channel_sets(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xea095bada18d3443ULL; }
 
     private:
         bool init();
@@ -71,9 +71,11 @@ class tlv1905NeighborDevice : public BaseClass
         size_t mac_al_1905_device_length() { return m_mac_al_1905_device_idx__ * sizeof(tlv1905NeighborDevice::sMacAl1905Device); }
         std::tuple<bool, sMacAl1905Device&> mac_al_1905_device(size_t idx);
         bool alloc_mac_al_1905_device(size_t count = 1);
+        sMacAl1905Device* reserve_mac_al_1905_device(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x37f89cae409fe76fULL; }
 
     private:
         bool init();
@@ -39,6 +39,7 @@ class tlvAlMacAddress : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf865304afb89bae2ULL; }
 
     private:
         bool init();
@@ -61,6 +61,7 @@ class tlvAutoconfigFreqBand : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x024d913c5a1fa91aULL; }
 
     private:
         bool init();
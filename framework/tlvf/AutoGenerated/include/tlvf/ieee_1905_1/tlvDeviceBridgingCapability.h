@@ -45,6 +45,7 @@ class tlvDeviceBridgingCapability : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4b73d23644b64aa0ULL; }
 
     private:
         bool init();
@@ -68,9 +69,11 @@ class cMacList : public BaseClass
         uint8_t& mac_list_length();
         std::tuple<bool, sMacAddr&> mac_list(size_t idx);
         bool alloc_mac_list(size_t count = 1);
+        sMacAddr* reserve_mac_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xdcb461b40e38067cULL; }
 
     private:
         bool init();
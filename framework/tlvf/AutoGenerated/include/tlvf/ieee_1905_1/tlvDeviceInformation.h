@@ -47,6 +47,7 @@ class tlvDeviceInformation : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8a53b1a6e6707ceaULL; }
 
     private:
         bool init();
@@ -77,6 +78,7 @@ class cLocalInterfaceInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5f68dc45f3ac5863ULL; }
 
     private:
         bool init();
@@ -37,6 +37,7 @@ class tlvEndOfMessage : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x31db075d395f8471ULL; }
 
     private:
         bool init();
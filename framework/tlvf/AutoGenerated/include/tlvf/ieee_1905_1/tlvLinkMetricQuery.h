@@ -43,6 +43,7 @@ class tlvLinkMetricQueryAllNeighbors : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x52f89fcbc1b7ac4cULL; }
 
     private:
         bool init();
@@ -67,6 +68,7 @@ class tlvLinkMetricQuery : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xda7827913fefb5aaULL; }
 
     private:
         bool init();
@@ -55,6 +55,7 @@ class tlvLinkMetricResultCode : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xeb8c6352b10bf3deULL; }
 
     private:
         bool init();
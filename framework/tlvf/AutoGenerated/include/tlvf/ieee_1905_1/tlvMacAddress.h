@@ -39,6 +39,7 @@ class tlvMacAddress : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa3ad07d1fe03c29bULL; }
 
     private:
         bool init();
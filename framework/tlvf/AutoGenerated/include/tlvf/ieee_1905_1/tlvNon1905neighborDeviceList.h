@@ -40,9 +40,11 @@ class tlvNon1905neighborDeviceList : public BaseClass
         size_t mac_non_1905_device_length() { return m_mac_non_1905_device_idx__ * sizeof(sMacAddr); }
         std::tuple<bool, sMacAddr&> mac_non_1905_device(size_t idx);
         bool alloc_mac_non_1905_device(size_t count = 1);
+        sMacAddr* reserve_mac_non_1905_device(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd62afa81144eda0cULL; }
 
     private:
         bool init();
@@ -53,9 +53,11 @@ class tlvPushButtonEventNotification : public BaseClass
         uint8_t& media_type_list_length();
         std::tuple<bool, sMediaType&> media_type_list(size_t idx);
         bool alloc_media_type_list(size_t count = 1);
+        sMediaType* reserve_media_type_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfffcea6c6ddb7d35ULL; }
 
     private:
         bool init();
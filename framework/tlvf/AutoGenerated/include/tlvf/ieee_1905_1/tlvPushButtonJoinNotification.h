@@ -46,6 +46,7 @@ class tlvPushButtonJoinNotification : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6b3221de838b7965ULL; }
 
     private:
         bool init();
@@ -82,9 +82,11 @@ class tlvReceiverLinkMetric : public BaseClass
         size_t interface_pair_info_length() { return m_interface_pair_info_idx__ * sizeof(tlvReceiverLinkMetric::sInterfacePairInfo); }
         std::tuple<bool, sInterfacePairInfo&> interface_pair_info(size_t idx);
         bool alloc_interface_pair_info(size_t count = 1);
+        sInterfacePairInfo* reserve_interface_pair_info(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb605592b9c7b8297ULL; }
 
     private:
         bool init();
@@ -55,6 +55,7 @@ class tlvSearchedRole : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb2e33828da2eb017ULL; }
 
     private:
         bool init();
@@ -55,6 +55,7 @@ class tlvSupportedRole : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd031574ce0cc6f90ULL; }
 
     private:
         bool init();
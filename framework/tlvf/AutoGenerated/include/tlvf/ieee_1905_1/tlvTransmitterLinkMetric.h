@@ -107,9 +107,11 @@ class tlvTransmitterLinkMetric : public BaseClass
         size_t interface_pair_info_length() { return m_interface_pair_info_idx__ * sizeof(tlvTransmitterLinkMetric::sInterfacePairInfo); }
         std::tuple<bool, sInterfacePairInfo&> interface_pair_info(size_t idx);
         bool alloc_interface_pair_info(size_t count = 1);
+        sInterfacePairInfo* reserve_interface_pair_info(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1f90a290c5efc951ULL; }
 
     private:
         bool init();
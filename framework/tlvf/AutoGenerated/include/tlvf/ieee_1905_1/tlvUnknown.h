@@ -41,6 +41,7 @@ class tlvUnknown : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd895efe42fc1c2c8ULL; }
 
     private:
         bool init();
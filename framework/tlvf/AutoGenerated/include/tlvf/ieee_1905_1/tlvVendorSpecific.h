@@ -63,6 +63,7 @@ class tlvVendorSpecific : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5fe4c500503868e8ULL; }
 
     private:
         bool init();
@@ -299,6 +299,7 @@ class sMacHeader : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe29358ce11a83a99ULL; }
 
     private:
         bool init();
@@ -62,6 +62,7 @@ class tlvTestVarList : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x82b17305d38d0e9eULL; }
 
     private:
         bool init();
@@ -115,6 +116,7 @@ class cInner : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe2bdf6d30c467ca2ULL; }
 
     private:
         bool init();
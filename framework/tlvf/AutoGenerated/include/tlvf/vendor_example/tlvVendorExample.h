@@ -58,6 +58,7 @@ class tlvVendorExample : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x734a51834d9551c8ULL; }
 
     private:
         bool init();
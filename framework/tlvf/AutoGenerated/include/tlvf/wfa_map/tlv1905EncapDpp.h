@@ -88,6 +88,7 @@ class tlv1905EncapDpp : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x590d4e40e5dcd4f2ULL; }
 
     private:
         bool init();
@@ -42,6 +42,7 @@ class tlv1905EncapEapol : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9697f67881d37dc7ULL; }
 
     private:
         bool init();
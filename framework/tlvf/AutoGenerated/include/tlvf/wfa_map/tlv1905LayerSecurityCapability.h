@@ -95,6 +95,7 @@ class tlv1905LayerSecurityCapability : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe194bfb6d04a4dbeULL; }
 
     private:
         bool init();
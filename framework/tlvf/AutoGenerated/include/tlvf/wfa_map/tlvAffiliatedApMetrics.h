@@ -54,6 +54,7 @@ class tlvAffiliatedApMetrics : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0a94a9bf2a6e421dULL; }
 
     private:
         bool init();
@@ -50,6 +50,7 @@ class tlvAffiliatedStaMetrics : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x989ca5eb214bfa1eULL; }
 
     private:
         bool init();
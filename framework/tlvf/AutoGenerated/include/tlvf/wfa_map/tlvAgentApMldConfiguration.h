@@ -47,6 +47,7 @@ class tlvAgentApMldConfiguration : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2668287448613b1fULL; }
 
     private:
         bool init();
@@ -123,6 +124,7 @@ class cApMld : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8c91071426ac78e9ULL; }
 
     private:
         bool init();
@@ -176,6 +178,7 @@ class cAffiliatedAp : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x70319deadfc2443bULL; }
 
     private:
         bool init();
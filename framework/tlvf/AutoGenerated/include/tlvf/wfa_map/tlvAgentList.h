@@ -94,9 +94,11 @@ class tlvAgentList : public BaseClass
         uint8_t& number_of_agents();
         std::tuple<bool, sAgent&> agents(size_t idx);
         bool alloc_agents(size_t count = 1);
+        sAgent* reserve_agents(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x034e4fc92c49a9bdULL; }
 
     private:
         bool init();
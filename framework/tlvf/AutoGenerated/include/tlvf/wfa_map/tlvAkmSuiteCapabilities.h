@@ -73,12 +73,15 @@ class tlvAkmSuiteCapabilities : public BaseClass
         uint8_t& number_of_bh_bss_akm_suite_selectors();
         std::tuple<bool, sBssAkmSuiteSelector&> backhaul_bss_akm_suite_selectors(size_t idx);
         bool alloc_backhaul_bss_akm_suite_selectors(size_t count = 1);
+        sBssAkmSuiteSelector* reserve_backhaul_bss_akm_suite_selectors(size_t count);
         uint8_t& number_of_fh_bss_akm_suite_selectors();
         std::tuple<bool, sBssAkmSuiteSelector&> fronthaul_bss_akm_suite_selectors(size_t idx);
         bool alloc_fronthaul_bss_akm_suite_selectors(size_t count = 1);
+        sBssAkmSuiteSelector* reserve_fronthaul_bss_akm_suite_selectors(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x35f23edeffc01623ULL; }
 
     private:
         bool init();
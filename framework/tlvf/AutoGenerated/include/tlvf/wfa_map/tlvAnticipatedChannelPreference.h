@@ -44,6 +44,7 @@ class tlvAnticipatedChannelPreference : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa2a503b2e41113d2ULL; }
 
     private:
         bool init();
@@ -73,6 +74,7 @@ class cAnticipatedOperatingClasses : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x406dec3e345f7b04ULL; }
 
     private:
         bool init();
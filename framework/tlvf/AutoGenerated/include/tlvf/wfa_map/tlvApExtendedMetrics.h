@@ -45,6 +45,7 @@ class tlvApExtendedMetrics : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7af1cebed4ab0741ULL; }
 
     private:
         bool init();
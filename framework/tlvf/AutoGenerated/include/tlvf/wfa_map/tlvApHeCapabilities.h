@@ -96,6 +96,7 @@ class tlvApHeCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x58472f047c9dac0cULL; }
 
     private:
         bool init();
@@ -65,6 +65,7 @@ class tlvApHtCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4a4e295d1381b8dfULL; }
 
     private:
         bool init();
@@ -39,9 +39,11 @@ class tlvApMetricQuery : public BaseClass
         uint8_t& bssid_list_length();
         std::tuple<bool, sMacAddr&> bssid_list(size_t idx);
         bool alloc_bssid_list(size_t count = 1);
+        sMacAddr* reserve_bssid_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xef11d33aa21bd9fbULL; }
 
     private:
         bool init();
@@ -71,6 +71,7 @@ class tlvApMetrics : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xee4f75b9408b7d8aULL; }
 
     private:
         bool init();
@@ -46,6 +46,7 @@ class tlvApOperationalBSS : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb11e38d24d18b7a5ULL; }
 
     private:
         bool init();
@@ -74,6 +75,7 @@ class cRadioInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6fd6dbfd586fcbcaULL; }
 
     private:
         bool init();
@@ -103,6 +105,7 @@ class cRadioBssInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf14e800c5d5c5f9eULL; }
 
     private:
         bool init();
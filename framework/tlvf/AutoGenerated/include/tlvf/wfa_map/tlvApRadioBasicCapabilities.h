@@ -47,6 +47,7 @@ class tlvApRadioBasicCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd4b05df5d2e527f8ULL; }
 
     private:
         bool init();
@@ -78,6 +79,7 @@ class cOperatingClassesInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6807915b87709c6eULL; }
 
     private:
         bool init();
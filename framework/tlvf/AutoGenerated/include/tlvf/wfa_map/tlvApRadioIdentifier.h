@@ -39,6 +39,7 @@ class tlvApRadioIdentifier : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe8408d3b852985c3ULL; }
 
     private:
         bool init();
@@ -68,6 +68,7 @@ class ApRadioVbssCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7d7cf64ba7b807feULL; }
 
     private:
         bool init();
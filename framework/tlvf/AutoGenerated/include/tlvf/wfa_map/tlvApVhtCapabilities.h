@@ -87,6 +87,7 @@ class tlvApVhtCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7e430cf9c8f94643ULL; }
 
     private:
         bool init();
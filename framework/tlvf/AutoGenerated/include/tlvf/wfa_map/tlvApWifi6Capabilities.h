@@ -47,6 +47,7 @@ class tlvApWifi6Capabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x81cf0306555c82d0ULL; }
 
     private:
         bool init();
@@ -178,6 +179,7 @@ class cRole : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3b0682351c335603ULL; }
 
     private:
         bool init();
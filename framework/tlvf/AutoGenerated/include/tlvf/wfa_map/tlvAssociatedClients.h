@@ -46,6 +46,7 @@ class tlvAssociatedClients : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4592f44ae132d00eULL; }
 
     private:
         bool init();
@@ -74,6 +75,7 @@ class cBssInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb9aa55e0aa0de085ULL; }
 
     private:
         bool init();
@@ -98,6 +100,7 @@ class cClientInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4da55a30ffdd0144ULL; }
 
     private:
         bool init();
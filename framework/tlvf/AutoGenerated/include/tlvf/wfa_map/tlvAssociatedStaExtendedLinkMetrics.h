@@ -58,9 +58,11 @@ class tlvAssociatedStaExtendedLinkMetrics : public BaseClass
         uint8_t& metrics_list_length();
         std::tuple<bool, sMetrics&> metrics_list(size_t idx);
         bool alloc_metrics_list(size_t count = 1);
+        sMetrics* reserve_metrics_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x052223a25aa57dc2ULL; }
 
     private:
         bool init();
@@ -60,9 +60,11 @@ class tlvAssociatedStaLinkMetrics : public BaseClass
         uint8_t& bssid_info_list_length();
         std::tuple<bool, sBssidInfo&> bssid_info_list(size_t idx);
         bool alloc_bssid_info_list(size_t count = 1);
+        sBssidInfo* reserve_bssid_info_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa4660ecb840d8ce9ULL; }
 
     private:
         bool init();
@@ -73,6 +73,7 @@ class tlvAssociatedStaMldConfigurationReport : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc5355d4258de8805ULL; }
 
     private:
         bool init();
@@ -105,6 +106,7 @@ class cAffiliatedSta : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcb23a219df329b6cULL; }
 
     private:
         bool init();
@@ -46,6 +46,7 @@ class tlvAssociatedStaTrafficStats : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcb6bcd676dbcdea4ULL; }
 
     private:
         bool init();
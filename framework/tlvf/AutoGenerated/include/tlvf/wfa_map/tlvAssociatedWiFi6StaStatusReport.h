@@ -51,9 +51,11 @@ class tlvAssociatedWiFi6StaStatusReport : public BaseClass
         uint8_t& tid_queue_size_list_length();
         std::tuple<bool, sTidQueueSize&> tid_queue_size_list(size_t idx);
         bool alloc_tid_queue_size_list(size_t count = 1);
+        sTidQueueSize* reserve_tid_queue_size_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc97a6b35ed40ba1fULL; }
 
     private:
         bool init();
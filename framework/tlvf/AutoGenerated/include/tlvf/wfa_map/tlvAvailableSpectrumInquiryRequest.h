@@ -42,6 +42,7 @@ class tlvAvailableSpectrumInquiryRequest : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6bbab5c1adc56d02ULL; }
 
     private:
         bool init();
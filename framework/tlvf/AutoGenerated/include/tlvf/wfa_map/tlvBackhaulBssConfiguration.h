@@ -59,6 +59,7 @@ class tlvBackhaulBssConfiguration : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x30c067116d4da117ULL; }
 
     private:
         bool init();
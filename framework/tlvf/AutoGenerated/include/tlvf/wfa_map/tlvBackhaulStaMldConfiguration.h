@@ -92,6 +92,7 @@ class tlvBackhaulStaMldConfiguration : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xde391920b4f3f8daULL; }
 
     private:
         bool init();
@@ -142,6 +143,7 @@ class cAffiliatedBhSta : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe2d3c0953a9c556aULL; }
 
     private:
         bool init();
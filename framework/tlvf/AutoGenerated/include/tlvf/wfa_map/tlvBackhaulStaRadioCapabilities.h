@@ -63,6 +63,7 @@ class tlvBackhaulStaRadioCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb35063537d695f02ULL; }
 
     private:
         bool init();
@@ -60,6 +60,7 @@ class tlvBackhaulSteeringResponse : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x962ee64d8f27cd81ULL; }
 
     private:
         bool init();
@@ -60,6 +60,7 @@ class tlvBeaconMetricsQuery : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x445de907570e3e97ULL; }
 
     private:
         bool init();
@@ -99,6 +100,7 @@ class cApChannelReports : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7a24dac03c77a164ULL; }
 
     private:
         bool init();
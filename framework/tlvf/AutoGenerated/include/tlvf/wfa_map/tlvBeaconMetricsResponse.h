@@ -52,6 +52,7 @@ class tlvBeaconMetricsResponse : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb437ca185f8c08caULL; }
 
     private:
         bool init();
@@ -146,6 +147,7 @@ class cMeasurementReportElement : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xec407e9fb33b6255ULL; }
 
     private:
         bool init();
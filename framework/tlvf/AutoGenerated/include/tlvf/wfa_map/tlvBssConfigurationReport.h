@@ -48,6 +48,7 @@ class tlvBssConfigurationReport : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x1e93a834b22d2bdcULL; }
 
     private:
         bool init();
@@ -106,6 +107,7 @@ class cBssConf : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xcf9da7ac48b20057ULL; }
 
     private:
         bool init();
@@ -133,6 +135,7 @@ class cRadio : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4da598b5ee271e52ULL; }
 
     private:
         bool init();
@@ -44,6 +44,7 @@ class tlvBssConfigurationRequest : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9d4d6b0528e433e3ULL; }
 
     private:
         bool init();
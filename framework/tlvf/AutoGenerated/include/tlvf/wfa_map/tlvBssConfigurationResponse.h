@@ -44,6 +44,7 @@ class tlvBssConfigurationResponse : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0be42d8d5089cb51ULL; }
 
     private:
         bool init();
@@ -39,6 +39,7 @@ class tlvBssid : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x48483c7119f98d69ULL; }
 
     private:
         bool init();
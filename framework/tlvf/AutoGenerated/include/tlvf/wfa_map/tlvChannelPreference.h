@@ -48,6 +48,7 @@ class tlvChannelPreference : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x405c98c0994c4b8eULL; }
 
     private:
         bool init();
@@ -176,6 +177,7 @@ class cPreferenceOperatingClasses : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x30d3bdd99f3e3effULL; }
 
     private:
         bool init();
@@ -48,6 +48,7 @@ class tlvChannelScanCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7859907d3a034a14ULL; }
 
     private:
         bool init();
@@ -119,6 +120,7 @@ class cRadiosWithScanCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc748e404a9813914ULL; }
 
     private:
         bool init();
@@ -150,6 +152,7 @@ class cOperatingClasses : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xad44e60609c356eeULL; }
 
     private:
         bool init();
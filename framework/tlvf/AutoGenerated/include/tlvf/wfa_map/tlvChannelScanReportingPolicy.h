@@ -57,6 +57,7 @@ class tlvChannelScanReportingPolicy : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6b2b1220b74f6382ULL; }
 
     private:
         bool init();
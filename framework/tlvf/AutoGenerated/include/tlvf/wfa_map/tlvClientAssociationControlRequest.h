@@ -65,9 +65,11 @@ class tlvClientAssociationControlRequest : public BaseClass
         uint8_t& sta_list_length();
         std::tuple<bool, sMacAddr&> sta_list(size_t idx);
         bool alloc_sta_list(size_t count = 1);
+        sMacAddr* reserve_sta_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf5ab25015ba69570ULL; }
 
     private:
         bool init();
@@ -60,6 +60,7 @@ class tlvClientAssociationEvent : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x27f8431fa7df0be6ULL; }
 
     private:
         bool init();
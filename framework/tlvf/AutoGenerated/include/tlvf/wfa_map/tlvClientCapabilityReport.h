@@ -62,6 +62,7 @@ class tlvClientCapabilityReport : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x278504a90e979de7ULL; }
 
     private:
         bool init();
@@ -40,6 +40,7 @@ class tlvClientInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa49866291c9235abULL; }
 
     private:
         bool init();
@@ -76,6 +76,7 @@ class ClientSecurityContext : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x6200a882f55302eaULL; }
 
     private:
         bool init();
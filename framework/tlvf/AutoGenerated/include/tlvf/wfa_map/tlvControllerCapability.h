@@ -63,6 +63,7 @@ class tlvControllerCapability : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x76d8e27396bb2a96ULL; }
 
     private:
         bool init();
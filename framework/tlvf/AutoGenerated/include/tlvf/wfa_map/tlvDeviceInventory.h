@@ -67,6 +67,7 @@ class tlvDeviceInventory : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf5865b45779ffcceULL; }
 
     private:
         bool init();
@@ -108,6 +109,7 @@ class cRadioVendorInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x84f7084c104e8254ULL; }
 
     private:
         bool init();
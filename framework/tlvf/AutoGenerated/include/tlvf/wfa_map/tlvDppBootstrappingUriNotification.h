@@ -53,6 +53,7 @@ class tlvDppBootstrappingUriNotification : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x428000bb298314cbULL; }
 
     private:
         bool init();
@@ -57,6 +57,7 @@ class tlvDppCceIndication : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd370aaf759ac287bULL; }
 
     private:
         bool init();
@@ -66,6 +66,7 @@ class tlvDppChirpValue : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5613b3240e8e1191ULL; }
 
     private:
         bool init();
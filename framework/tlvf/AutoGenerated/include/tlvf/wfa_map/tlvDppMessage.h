@@ -42,6 +42,7 @@ class tlvDppMessage : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xec25cf7ea03f7edbULL; }
 
     private:
         bool init();
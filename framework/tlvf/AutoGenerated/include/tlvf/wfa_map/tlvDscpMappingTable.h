@@ -44,6 +44,7 @@ class tlvDscpMappingTable : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd9c7e991297d6c34ULL; }
 
     private:
         bool init();
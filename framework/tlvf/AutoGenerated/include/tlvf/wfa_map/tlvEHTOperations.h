@@ -49,6 +49,7 @@ class tlvEHTOperations : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x271937d19c65ff69ULL; }
 
     private:
         bool init();
@@ -81,6 +82,7 @@ class cRadioEntry : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x81dda1d5620414baULL; }
 
     private:
         bool init();
@@ -138,6 +140,7 @@ class cBssEntry : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd36b2af0b8bfe593ULL; }
 
     private:
         bool init();
@@ -52,6 +52,7 @@ class tlvEncryptedPayload : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x80cbfae7a107122eULL; }
 
     private:
         bool init();
@@ -69,6 +69,7 @@ class tlvErrorCode : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xec425d60c90194ebULL; }
 
     private:
         bool init();
@@ -60,6 +60,7 @@ class tlvHigherLayerData : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbc9681e285f9766cULL; }
 
     private:
         bool init();
@@ -79,9 +79,11 @@ class tlvMetricReportingPolicy : public BaseClass
         uint8_t& metrics_reporting_conf_list_length();
         std::tuple<bool, sMetricsReportingConf&> metrics_reporting_conf_list(size_t idx);
         bool alloc_metrics_reporting_conf_list(size_t count = 1);
+        sMetricsReportingConf* reserve_metrics_reporting_conf_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x78bb5cbe453a45fcULL; }
 
     private:
         bool init();
@@ -90,6 +90,7 @@ class tlvMic : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x25e1ca5552fd5eebULL; }
 
     private:
         bool init();
@@ -48,6 +48,7 @@ class tlvMldStructure : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xae96f5daf7f082e4ULL; }
 
     private:
         bool init();
@@ -77,6 +78,7 @@ class cAffiliated : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x34ed74b6b45cd5f2ULL; }
 
     private:
         bool init();
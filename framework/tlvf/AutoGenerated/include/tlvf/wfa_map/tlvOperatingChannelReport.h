@@ -49,6 +49,7 @@ class tlvOperatingChannelReport : public BaseClass
         uint8_t& operating_classes_list_length();
         std::tuple<bool, sOperatingClasses&> operating_classes_list(size_t idx);
         bool alloc_operating_classes_list(size_t count = 1);
+        sOperatingClasses* reserve_operating_classes_list(size_t count);
         //Current Transmit Power EIRP representing the current nominal transmit power.
         //The field is coded as a 2's complement signed integer in units of decibels relative to 1 mW (dBm).
         //This value is less than or equal to the Maximum Transmit Power specified in the AP Radio Basic Capabilities TLV for the current operating class.    
@@ -56,6 +57,7 @@ class tlvOperatingChannelReport : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc30424db6b408fa4ULL; }
 
     private:
         bool init();
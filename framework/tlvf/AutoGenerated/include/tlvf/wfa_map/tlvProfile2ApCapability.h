@@ -87,6 +87,7 @@ class tlvProfile2ApCapability : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x271e4b3bde5ad442ULL; }
 
     private:
         bool init();
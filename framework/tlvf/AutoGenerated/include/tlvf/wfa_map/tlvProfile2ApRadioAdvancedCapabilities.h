@@ -67,6 +67,7 @@ class tlvProfile2ApRadioAdvancedCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf78d32f0a13dba63ULL; }
 
     private:
         bool init();
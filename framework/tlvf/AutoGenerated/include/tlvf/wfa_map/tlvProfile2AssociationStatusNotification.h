@@ -71,9 +71,11 @@ class tlvProfile2AssociationStatusNotification : public BaseClass
         uint8_t& bssid_status_list_length();
         std::tuple<bool, sBssidStatus&> bssid_status_list(size_t idx);
         bool alloc_bssid_status_list(size_t count = 1);
+        sBssidStatus* reserve_bssid_status_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5d0c994e0b0e6cadULL; }
 
     private:
         bool init();
@@ -72,6 +72,7 @@ class tlvProfile2CacCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x93aa7736a3394310ULL; }
 
     private:
         bool init();
@@ -102,6 +103,7 @@ class cCacCapabilitiesRadio : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x5a0118ff195109e9ULL; }
 
     private:
         bool init();
@@ -131,6 +133,7 @@ class cCacTypes : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf91d0b118387cc35ULL; }
 
     private:
         bool init();
@@ -160,6 +163,7 @@ class cCacCapabilitiesOperatingClasses : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x39a30e0001b64a6fULL; }
 
     private:
         bool init();
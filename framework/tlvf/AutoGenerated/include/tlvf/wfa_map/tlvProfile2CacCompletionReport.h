@@ -46,6 +46,7 @@ class tlvProfile2CacCompletionReport : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x871596dfeb888fceULL; }
 
     private:
         bool init();
@@ -110,9 +111,11 @@ class cCacCompletionReportRadio : public BaseClass
         uint8_t& number_of_detected_pairs();
         std::tuple<bool, sCacDetectedPair&> detected_pairs(size_t idx);
         bool alloc_detected_pairs(size_t count = 1);
+        sCacDetectedPair* reserve_detected_pairs(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8494a1060a721a8bULL; }
 
     private:
         bool init();
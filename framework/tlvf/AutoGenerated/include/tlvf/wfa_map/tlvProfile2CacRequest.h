@@ -92,9 +92,11 @@ class tlvProfile2CacRequest : public BaseClass
         uint8_t& number_of_cac_radios();
         std::tuple<bool, sCacRequestRadio&> cac_radios(size_t idx);
         bool alloc_cac_radios(size_t count = 1);
+        sCacRequestRadio* reserve_cac_radios(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7e4cb7ba4c4519d3ULL; }
 
     private:
         bool init();
@@ -73,15 +73,19 @@ class tlvProfile2CacStatusReport : public BaseClass
         uint8_t& number_of_available_channels();
         std::tuple<bool, sAvailableChannels&> available_channels(size_t idx);
         bool alloc_available_channels(size_t count = 1);
+        sAvailableChannels* reserve_available_channels(size_t count);
         uint8_t& number_of_detected_pairs();
         std::tuple<bool, sDetectedPairs&> detected_pairs(size_t idx);
         bool alloc_detected_pairs(size_t count = 1);
+        sDetectedPairs* reserve_detected_pairs(size_t count);
         uint8_t& number_of_active_cac_pairs();
         std::tuple<bool, sActiveCacPairs&> active_cac_pairs(size_t idx);
         bool alloc_active_cac_pairs(size_t count = 1);
+        sActiveCacPairs* reserve_active_cac_pairs(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x50b831b65c40f93aULL; }
 
     private:
         bool init();
@@ -51,9 +51,11 @@ class tlvProfile2CacTermination : public BaseClass
         uint8_t& number_of_cac_radios();
         std::tuple<bool, sCacTerminationRadio&> cac_radios(size_t idx);
         bool alloc_cac_radios(size_t count = 1);
+        sCacTerminationRadio* reserve_cac_radios(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xd33b1eead6c89c18ULL; }
 
     private:
         bool init();
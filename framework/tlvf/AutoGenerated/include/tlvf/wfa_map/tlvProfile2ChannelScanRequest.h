@@ -64,6 +64,7 @@ class tlvProfile2ChannelScanRequest : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb04547eb35f2a802ULL; }
 
     private:
         bool init();
@@ -93,6 +94,7 @@ class cRadiosToScan : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe8dae093ec7ce2ebULL; }
 
     private:
         bool init();
@@ -113,6 +113,7 @@ class tlvProfile2ChannelScanResult : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe204da2af5b43714ULL; }
 
     private:
         bool init();
@@ -192,6 +193,7 @@ class cNeighbors : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3377ad861fd73a26ULL; }
 
     private:
         bool init();
@@ -40,6 +40,7 @@ class tlvProfile2Default802dotQSettings : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8e5b0031d6360e43ULL; }
 
     private:
         bool init();
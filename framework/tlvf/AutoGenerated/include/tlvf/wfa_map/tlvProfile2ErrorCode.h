@@ -74,6 +74,7 @@ class tlvProfile2ErrorCode : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4c4604fb25cf0ef8ULL; }
 
     private:
         bool init();
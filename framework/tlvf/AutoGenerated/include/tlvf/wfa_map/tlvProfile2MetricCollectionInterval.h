@@ -38,6 +38,7 @@ class tlvProfile2MetricCollectionInterval : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb26b8d050bbcc1e8ULL; }
 
     private:
         bool init();
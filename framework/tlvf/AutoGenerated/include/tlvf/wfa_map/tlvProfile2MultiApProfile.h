@@ -63,6 +63,7 @@ class tlvProfile2MultiApProfile : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xf4bfb8dc756b4ec4ULL; }
 
     private:
         bool init();
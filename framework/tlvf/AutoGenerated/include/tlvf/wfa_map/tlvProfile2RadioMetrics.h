@@ -43,6 +43,7 @@ class tlvProfile2RadioMetrics : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x8b38ea073a94de79ULL; }
 
     private:
         bool init();
@@ -177,6 +177,7 @@ class tlvProfile2ReasonCode : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x55e56a84b590ee50ULL; }
 
     private:
         bool init();
@@ -38,6 +38,7 @@ class tlvProfile2StatusCode : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x7ef413c75f5f7e7eULL; }
 
     private:
         bool init();
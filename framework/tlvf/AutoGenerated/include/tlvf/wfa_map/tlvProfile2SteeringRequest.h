@@ -100,12 +100,15 @@ class tlvProfile2SteeringRequest : public BaseClass
         uint8_t& sta_list_length();
         std::tuple<bool, sMacAddr&> sta_list(size_t idx);
         bool alloc_sta_list(size_t count = 1);
+        sMacAddr* reserve_sta_list(size_t count);
         uint8_t& target_bssid_list_length();
         std::tuple<bool, sTargetBssidInfo&> target_bssid_list(size_t idx);
         bool alloc_target_bssid_list(size_t count = 1);
+        sTargetBssidInfo* reserve_target_bssid_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x13417a9d8114ca77ULL; }
 
     private:
         bool init();
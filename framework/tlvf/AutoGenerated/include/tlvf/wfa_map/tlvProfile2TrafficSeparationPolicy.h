@@ -44,6 +44,7 @@ class tlvProfile2TrafficSeparationPolicy : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbb34ffcaa12ec9a4ULL; }
 
     private:
         bool init();
@@ -77,6 +78,7 @@ class cSsidVlanId : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa62a10d78d0c5560ULL; }
 
     private:
         bool init();
@@ -57,6 +57,7 @@ class tlvProfile2UnsuccessfulAssociationPolicy : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2290b91c6fac2201ULL; }
 
     private:
         bool init();
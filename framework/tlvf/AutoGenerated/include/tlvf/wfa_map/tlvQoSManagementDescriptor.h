@@ -53,6 +53,7 @@ class tlvQoSManagementDescriptor : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xb6da5120a61f3e7bULL; }
 
     private:
         bool init();
@@ -39,14 +39,17 @@ class tlvQoSManagementPolicy : public BaseClass
         uint8_t& mscs_disallowed_sta_length();
         std::tuple<bool, sMacAddr&> mscs_disallowed_sta_list(size_t idx);
         bool alloc_mscs_disallowed_sta_list(size_t count = 1);
+        sMacAddr* reserve_mscs_disallowed_sta_list(size_t count);
         uint8_t& scs_disallowed_sta_length();
         std::tuple<bool, sMacAddr&> scs_disallowed_sta_list(size_t idx);
         bool alloc_scs_disallowed_sta_list(size_t count = 1);
+        sMacAddr* reserve_scs_disallowed_sta_list(size_t count);
         uint8_t* reserved(size_t idx = 0);
         bool set_reserved(const void* buffer, size_t size);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4db88e3961b90838ULL; }
 
     private:
         bool init();
@@ -46,6 +46,7 @@ class tlvRadioOperationRestriction : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4e48a36eb46c7bdeULL; }
 
     private:
         bool init();
@@ -83,9 +84,11 @@ class cRestrictedOperatingClasses : public BaseClass
         uint8_t& channel_list_length();
         std::tuple<bool, sChannelInfo&> channel_list(size_t idx);
         bool alloc_channel_list(size_t count = 1);
+        sChannelInfo* reserve_channel_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0ca72ae44597426bULL; }
 
     private:
         bool init();
@@ -58,6 +58,7 @@ class tlvSearchedService : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbf713e05f1018dbcULL; }
 
     private:
         bool init();
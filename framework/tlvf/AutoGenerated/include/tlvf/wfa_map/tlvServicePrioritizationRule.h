@@ -91,6 +91,7 @@ class tlvServicePrioritizationRule : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x26f6a3d9ceb9ac96ULL; }
 
     private:
         bool init();
@@ -60,6 +60,7 @@ class tlvSpatialReuseConfigResponse : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xaee8c0d4eb7de161ULL; }
 
     private:
         bool init();
@@ -88,6 +88,7 @@ class tlvSpatialReuseReport : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xffe0a5ac9a4a6deaULL; }
 
     private:
         bool init();
@@ -85,6 +85,7 @@ class tlvSpatialReuseRequest : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xc31357d2c9d51871ULL; }
 
     private:
         bool init();
@@ -79,6 +79,7 @@ class tlvSteeringBTMReport : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x48c8f93952b2651eULL; }
 
     private:
         bool init();
@@ -74,15 +74,19 @@ class tlvSteeringPolicy : public BaseClass
         uint8_t& local_steering_disallowed_sta_list_length();
         std::tuple<bool, sMacAddr&> local_steering_disallowed_sta_list(size_t idx);
         bool alloc_local_steering_disallowed_sta_list(size_t count = 1);
+        sMacAddr* reserve_local_steering_disallowed_sta_list(size_t count);
         uint8_t& btm_steering_disallowed_sta_list_length();
         std::tuple<bool, sMacAddr&> btm_steering_disallowed_sta_list(size_t idx);
         bool alloc_btm_steering_disallowed_sta_list(size_t count = 1);
+        sMacAddr* reserve_btm_steering_disallowed_sta_list(size_t count);
         uint8_t& radio_ap_control_policy_list_length();
         std::tuple<bool, sRadioApControlPolicy&> radio_ap_control_policy_list(size_t idx);
         bool alloc_radio_ap_control_policy_list(size_t count = 1);
+        sRadioApControlPolicy* reserve_radio_ap_control_policy_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x72ae64cc4ea00af1ULL; }
 
     private:
         bool init();
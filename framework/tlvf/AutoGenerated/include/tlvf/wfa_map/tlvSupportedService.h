@@ -64,6 +64,7 @@ class tlvSupportedService : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x2d5b147d9215e42dULL; }
 
     private:
         bool init();
@@ -84,6 +84,7 @@ class tlvTidToLinkMappingPolicy : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0da4500662eb4da0ULL; }
 
     private:
         bool init();
@@ -165,6 +166,7 @@ class cMapping : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x67dd8f1ff0045e9bULL; }
 
     private:
         bool init();
@@ -218,6 +220,7 @@ class cTidToLinkControlField : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe47423f170ca6216ULL; }
 
     private:
         bool init();
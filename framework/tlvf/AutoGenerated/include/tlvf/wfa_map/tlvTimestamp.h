@@ -47,6 +47,7 @@ class tlvTimestamp : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x835a7f38c1958b00ULL; }
 
     private:
         bool init();
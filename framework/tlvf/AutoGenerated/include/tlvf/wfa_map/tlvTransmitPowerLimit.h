@@ -42,6 +42,7 @@ class tlvTransmitPowerLimit : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x45ef12c7edef7a78ULL; }
 
     private:
         bool init();
@@ -42,6 +42,7 @@ class TriggerChannelSwitchAnnouncement : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xfe716125ff4ca812ULL; }
 
     private:
         bool init();
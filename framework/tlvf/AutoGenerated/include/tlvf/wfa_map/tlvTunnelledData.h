@@ -43,6 +43,7 @@ class tlvTunnelledData : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0e3e636a41d627ebULL; }
 
     private:
         bool init();
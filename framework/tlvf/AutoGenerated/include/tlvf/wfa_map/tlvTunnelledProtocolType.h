@@ -64,6 +64,7 @@ class tlvTunnelledProtocolType : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x22c94ff8f2e15f1fULL; }
 
     private:
         bool init();
@@ -40,6 +40,7 @@ class tlvTunnelledSourceInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x0e57ff4afffdb626ULL; }
 
     private:
         bool init();
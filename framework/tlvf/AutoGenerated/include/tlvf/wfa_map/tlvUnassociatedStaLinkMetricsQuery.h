@@ -46,6 +46,7 @@ class tlvUnassociatedStaLinkMetricsQuery : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xbfc66eef42bf4836ULL; }
 
     private:
         bool init();
@@ -71,9 +72,11 @@ class cChannelParameters : public BaseClass
         uint8_t& sta_list_length();
         std::tuple<bool, sMacAddr&> sta_list(size_t idx);
         bool alloc_sta_list(size_t count = 1);
+        sMacAddr* reserve_sta_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xa223826a7e7a8936ULL; }
 
     private:
         bool init();
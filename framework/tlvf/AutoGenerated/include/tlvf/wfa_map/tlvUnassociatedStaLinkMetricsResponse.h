@@ -54,9 +54,11 @@ class tlvUnassociatedStaLinkMetricsResponse : public BaseClass
         uint8_t& sta_list_length();
         std::tuple<bool, sStaMetrics&> sta_list(size_t idx);
         bool alloc_sta_list(size_t count = 1);
+        sStaMetrics* reserve_sta_list(size_t count);
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xe4a169afa872d69dULL; }
 
     private:
         bool init();
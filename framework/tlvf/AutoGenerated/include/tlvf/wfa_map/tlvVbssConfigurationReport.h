@@ -48,6 +48,7 @@ class VbssConfigurationReport : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9d7fe23110a13b84ULL; }
 
     private:
         bool init();
@@ -77,6 +78,7 @@ class cVbssRadioInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x4a1cd6280f3110dcULL; }
 
     private:
         bool init();
@@ -106,6 +108,7 @@ class cVbssBssInfo : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x51872db2be43e18bULL; }
 
     private:
         bool init();
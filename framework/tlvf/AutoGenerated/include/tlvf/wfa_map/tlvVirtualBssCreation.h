@@ -89,6 +89,7 @@ class VirtualBssCreation : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9e2415fcf722d8caULL; }
 
     private:
         bool init();
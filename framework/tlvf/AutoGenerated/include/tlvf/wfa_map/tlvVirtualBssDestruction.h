@@ -43,6 +43,7 @@ class VirtualBssDestruction : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x59292bd563e8d561ULL; }
 
     private:
         bool init();
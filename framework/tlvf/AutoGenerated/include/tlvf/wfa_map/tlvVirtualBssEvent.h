@@ -43,6 +43,7 @@ class VirtualBssEvent : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x757153b189aa2419ULL; }
 
     private:
         bool init();
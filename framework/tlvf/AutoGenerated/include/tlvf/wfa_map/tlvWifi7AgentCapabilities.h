@@ -85,6 +85,7 @@ class tlvWifi7AgentCapabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0xaca3b6497bb4ec29ULL; }
 
     private:
         bool init();
@@ -147,6 +148,7 @@ class cRadioWifi7Capabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3aca835702a43bfeULL; }
 
     private:
         bool init();
@@ -191,6 +193,7 @@ class cWifi7Capabilities : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x3bc1d184db4838bdULL; }
 
     private:
         bool init();
@@ -242,6 +245,7 @@ class cRadioConfig : public BaseClass
         void class_swap() override;
         bool finalize() override;
         static size_t get_initial_size();
+        static constexpr uint64_t get_class_type_id() { return 0x9278ca4e7936f69cULL; }
 
     private:
         bool init();
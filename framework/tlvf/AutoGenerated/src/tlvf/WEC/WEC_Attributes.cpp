@@ -251,7 +251,7 @@ bool cDppAttrWrappedDataAttribute::alloc_wrapped_data(size_t count) {
     uint8_t *src = (uint8_t *)&m_wrapped_data[m_wrapped_data_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_wrapped_data_idx__ += count;
@@ -392,7 +392,7 @@ bool cDppAttrInitiatorAuthenticatingTag::alloc_initiator_authenticating_tag(size
     uint8_t *src = (uint8_t *)&m_initiator_authenticating_tag[m_initiator_authenticating_tag_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_initiator_authenticating_tag_idx__ += count;
@@ -533,7 +533,7 @@ bool cDppAttrResponderAuthenticatingTag::alloc_responder_authenticating_tag(size
     uint8_t *src = (uint8_t *)&m_responder_authenticating_tag[m_responder_authenticating_tag_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_responder_authenticating_tag_idx__ += count;
@@ -686,7 +686,7 @@ bool cDppAttrDppConfigurationObject::alloc_configuration_object(size_t count) {
     uint8_t *src = (uint8_t *)&m_configuration_object[m_configuration_object_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_configuration_object_idx__ += count;
@@ -839,7 +839,7 @@ bool cDppAttrDppConnector::alloc_connector(size_t count) {
     uint8_t *src = (uint8_t *)&m_connector[m_connector_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_connector_idx__ += count;
@@ -992,7 +992,7 @@ bool cDppAttrDppConfigurationRequestObject::alloc_configuration_request_object(s
     uint8_t *src = (uint8_t *)&m_configuration_request_object[m_configuration_request_object_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_configuration_request_object_idx__ += count;
@@ -1145,7 +1145,7 @@ bool cDppAttrBootstrappingKey::alloc_configuration_request_object(size_t count)
     uint8_t *src = (uint8_t *)&m_configuration_request_object[m_configuration_request_object_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_configuration_request_object_idx__ += count;
@@ -1306,7 +1306,7 @@ bool cDppAttrCodeIdentifier::alloc_code_identifier(size_t count) {
     uint8_t *src = (uint8_t *)&m_code_identifier[m_code_identifier_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_code_identifier_idx__ += count;
@@ -1459,7 +1459,7 @@ bool cDppAttrBootstrappingInfo::alloc_bootstrapping_info(size_t count) {
     uint8_t *src = (uint8_t *)&m_bootstrapping_info[m_bootstrapping_info_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bootstrapping_info_idx__ += count;
@@ -1600,7 +1600,7 @@ bool cDppAttrDppEnvelopedData::alloc_enveloped_data(size_t count) {
     uint8_t *src = (uint8_t *)&m_enveloped_data[m_enveloped_data_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_enveloped_data_idx__ += count;
@@ -1753,7 +1753,7 @@ bool cDppAttrDppConnectionStatusObject::alloc_dpp_connection_status_json_object(
     uint8_t *src = (uint8_t *)&m_dpp_connection_status_json_object[m_dpp_connection_status_json_object_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_dpp_connection_status_json_object_idx__ += count;
@@ -1986,7 +1986,7 @@ bool cDppAttrEtagId::alloc_etag_id(size_t count) {
     uint8_t *src = (uint8_t *)&m_etag_id[m_etag_id_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_etag_id_idx__ += count;
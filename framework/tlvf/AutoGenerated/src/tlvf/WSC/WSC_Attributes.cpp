@@ -192,7 +192,7 @@ bool cWscAttrVendorExtension::alloc_vendor_data(size_t count) {
     uint8_t *src = (uint8_t *)&m_vendor_data[m_vendor_data_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_vendor_data_idx__ += count;
@@ -377,7 +377,7 @@ bool cConfigData::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_authentication_type_attr = (sWscAttrAuthenticationType *)((uint8_t *)(m_authentication_type_attr) + len);
@@ -469,7 +469,7 @@ bool cConfigData::alloc_network_key(size_t count) {
     uint8_t *src = (uint8_t *)&m_network_key[*m_network_key_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bssid_attr = (sWscAttrBssid *)((uint8_t *)(m_bssid_attr) + len);
@@ -738,7 +738,7 @@ bool cWscAttrEncryptedSettings::alloc_encrypted_settings(size_t count) {
     uint8_t *src = (uint8_t *)&m_encrypted_settings[m_encrypted_settings_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_encrypted_settings_idx__ += count;
@@ -1698,7 +1698,7 @@ bool cWscAttrManufacturer::alloc_manufacturer(size_t count) {
     uint8_t *src = (uint8_t *)&m_manufacturer[m_manufacturer_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_manufacturer_idx__ += count;
@@ -1851,7 +1851,7 @@ bool cWscAttrModelName::alloc_model(size_t count) {
     uint8_t *src = (uint8_t *)&m_model[m_model_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_model_idx__ += count;
@@ -2004,7 +2004,7 @@ bool cWscAttrModelNumber::alloc_model_number(size_t count) {
     uint8_t *src = (uint8_t *)&m_model_number[m_model_number_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_model_number_idx__ += count;
@@ -2157,7 +2157,7 @@ bool cWscAttrSerialNumber::alloc_serial_number(size_t count) {
     uint8_t *src = (uint8_t *)&m_serial_number[m_serial_number_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_serial_number_idx__ += count;
@@ -2430,7 +2430,7 @@ bool cWscAttrDeviceName::alloc_device_name(size_t count) {
     uint8_t *src = (uint8_t *)&m_device_name[m_device_name_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_device_name_idx__ += count;
@@ -3693,7 +3693,7 @@ bool cWscAttrSsid::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[m_ssid_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ssid_idx__ += count;
@@ -4036,7 +4036,7 @@ bool cWscAttrNetworkKey::alloc_key(size_t count) {
     uint8_t *src = (uint8_t *)&m_key[m_key_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_key_idx__ += count;
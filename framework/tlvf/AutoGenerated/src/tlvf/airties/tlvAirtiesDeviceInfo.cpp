@@ -96,7 +96,7 @@ bool tlvAirtiesDeviceInfo::alloc_client_id(size_t count) {
     uint8_t *src = (uint8_t *)&m_client_id[*m_client_id_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_client_secret_length = (uint8_t *)((uint8_t *)(m_client_secret_length) + len);
@@ -164,7 +164,7 @@ bool tlvAirtiesDeviceInfo::alloc_client_secret(size_t count) {
     uint8_t *src = (uint8_t *)&m_client_secret[*m_client_secret_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_flags1 = (sFlags1 *)((uint8_t *)(m_flags1) + len);
@@ -100,7 +100,7 @@ std::shared_ptr<cRadioInfo> tlvAirtiesDeviceMetrics::create_radio_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadioInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -76,7 +76,7 @@ std::shared_ptr<cInterfaceList> tlvAirtiesEthernetInterface::create_interface_li
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cInterfaceList>(src, getBuffRemainingBytes(src), m_parse__);
@@ -298,7 +298,7 @@ bool cInterfaceList::alloc_eth_intf_name(size_t count) {
     uint8_t *src = (uint8_t *)&m_eth_intf_name[*m_eth_intf_name_len];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_flags1 = (sFlags1 *)((uint8_t *)(m_flags1) + len);
@@ -80,7 +80,7 @@ std::shared_ptr<cPortList> tlvAirtiesEthernetStats::create_port_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cPortList>(src, getBuffRemainingBytes(src), m_parse__);
@@ -643,7 +643,7 @@ std::shared_ptr<cPortList_ext> tlvAirtiesEthernetStatsallcntr::create_port_list(
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cPortList_ext>(src, getBuffRemainingBytes(src), m_parse__);
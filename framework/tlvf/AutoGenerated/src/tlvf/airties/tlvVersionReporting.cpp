@@ -80,7 +80,7 @@ std::shared_ptr<cLocalInterfaceInfo> tlvVersionReporting::create_em_agent_featur
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cLocalInterfaceInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -88,7 +88,7 @@ bool cSSID::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[m_ssid_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ssid_idx__ += count;
@@ -231,7 +231,7 @@ bool cRSN::alloc_optional(size_t count) {
     uint8_t *src = (uint8_t *)&m_optional[m_optional_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_optional_idx__ += count;
@@ -382,7 +382,7 @@ bool cSupportedOpClasses::alloc_op_classes(size_t count) {
     uint8_t *src = (uint8_t *)&m_op_classes[m_op_classes_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_op_classes_idx__ += count;
@@ -528,7 +528,7 @@ bool cSupportRates::alloc_supported_rated(size_t count) {
     uint8_t *src = (uint8_t *)&m_supported_rated[m_supported_rated_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_supported_rated_idx__ += count;
@@ -667,7 +667,7 @@ bool cExtendedSupportRates::alloc_extended_suport_rated(size_t count) {
     uint8_t *src = (uint8_t *)&m_extended_suport_rated[m_extended_suport_rated_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_extended_suport_rated_idx__ += count;
@@ -1196,7 +1196,7 @@ bool cInterworking::alloc_optional_params(size_t count) {
     uint8_t *src = (uint8_t *)&m_optional_params[m_optional_params_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_optional_params_idx__ += count;
@@ -1752,7 +1752,7 @@ bool cMultipleMacSublayers::alloc_interface_addr(size_t count) {
     uint8_t *src = (uint8_t *)&m_interface_addr[m_interface_addr_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_interface_addr_idx__ += count;
@@ -2022,7 +2022,7 @@ bool cVendorSpecific::alloc_data(size_t count) {
     uint8_t *src = (uint8_t *)&m_data[m_data_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_data_idx__ += count;
@@ -2178,7 +2178,7 @@ bool cUnknownField::alloc_data(size_t count) {
     uint8_t *src = (uint8_t *)&m_data[m_data_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_data_idx__ += count;
@@ -137,7 +137,7 @@ bool cFastBssTrans::alloc_data(size_t count) {
     uint8_t *src = (uint8_t *)&m_data[m_data_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_data_idx__ += count;
@@ -280,7 +280,7 @@ bool cFmsRequest::alloc_fms_request_subelem(size_t count) {
     uint8_t *src = (uint8_t *)&m_fms_request_subelem[m_fms_request_subelem_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_fms_request_subelem_idx__ += count;
@@ -426,7 +426,7 @@ bool cDmsRequest::alloc_dms_descrip_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_dms_descrip_list[m_dms_descrip_list_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_dms_descrip_list_idx__ += count;
@@ -68,7 +68,7 @@ bool cExtendedCap::alloc_extended_cap_field(size_t count) {
     uint8_t *src = (uint8_t *)&m_extended_cap_field[m_extended_cap_field_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_extended_cap_field_idx__ += count;
@@ -78,7 +78,7 @@ bool cStaHeCapability::alloc_rx_mcs_160() {
     uint8_t *src = (uint8_t *)m_rx_mcs_160;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_tx_mcs_160 = (uint16_t *)((uint8_t *)(m_tx_mcs_160) + len);
@@ -124,7 +124,7 @@ bool cStaHeCapability::alloc_tx_mcs_160() {
     uint8_t *src = (uint8_t *)m_tx_mcs_160;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_rx_mcs_80_80 = (uint16_t *)((uint8_t *)(m_rx_mcs_80_80) + len);
@@ -169,7 +169,7 @@ bool cStaHeCapability::alloc_rx_mcs_80_80() {
     uint8_t *src = (uint8_t *)m_rx_mcs_80_80;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_tx_mcs_80_80 = (uint16_t *)((uint8_t *)(m_tx_mcs_80_80) + len);
@@ -213,7 +213,7 @@ bool cStaHeCapability::alloc_tx_mcs_80_80() {
     uint8_t *src = (uint8_t *)m_tx_mcs_80_80;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ppe_thresholds = (uint8_t *)((uint8_t *)(m_ppe_thresholds) + len);
@@ -278,7 +278,7 @@ bool cStaHeCapability::alloc_ppe_thresholds(size_t count) {
     uint8_t *src = (uint8_t *)&m_ppe_thresholds[m_ppe_thresholds_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ppe_thresholds_idx__ += count;
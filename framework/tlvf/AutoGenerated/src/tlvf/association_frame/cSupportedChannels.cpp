@@ -56,7 +56,7 @@ bool cSupportedChannels::alloc_supported_channel_sets(size_t count) {
     uint8_t *src = (uint8_t *)&m_supported_channel_sets[m_supported_channel_sets_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_supported_channel_sets_idx__ += count;
@@ -71,11 +71,16 @@ bool cSupportedChannels::alloc_supported_channel_sets(size_t count) {
     return true;
 }
 
+cSupportedChannels::sSupportedChannelsSet* cSupportedChannels::reserve_supported_channel_sets(size_t count) {
+    if (!alloc_supported_channel_sets(count)) {
+        return nullptr;
+    }
+    return &m_supported_channel_sets[m_supported_channel_sets_idx__ - count];
+}
+
 void cSupportedChannels::class_swap()
 {
-    for (size_t i = 0; i < m_supported_channel_sets_idx__; i++){
-        m_supported_channel_sets[i].struct_swap();
-    }
+    tlvf_swap_array(m_supported_channel_sets, m_supported_channel_sets_idx__);
 }
 
 bool cSupportedChannels::finalize()
@@ -68,7 +68,7 @@ std::shared_ptr<cMacList> tlvDeviceBridgingCapability::create_bridging_tuples_li
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cMacList>(src, getBuffRemainingBytes(src), m_parse__);
@@ -241,7 +241,7 @@ bool cMacList::alloc_mac_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_mac_list[*m_mac_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_mac_list_idx__ += count;
@@ -256,11 +256,16 @@ bool cMacList::alloc_mac_list(size_t count) {
     return true;
 }
 
+sMacAddr* cMacList::reserve_mac_list(size_t count) {
+    if (!alloc_mac_list(count)) {
+        return nullptr;
+    }
+    return &m_mac_list[m_mac_list_idx__ - count];
+}
+
 void cMacList::class_swap()
 {
-    for (size_t i = 0; i < m_mac_list_idx__; i++){
-        m_mac_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_mac_list, m_mac_list_idx__);
 }
 
 bool cMacList::finalize()
@@ -72,7 +72,7 @@ std::shared_ptr<cLocalInterfaceInfo> tlvDeviceInformation::create_local_interfac
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cLocalInterfaceInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -274,7 +274,7 @@ bool cLocalInterfaceInfo::alloc_media_info(size_t count) {
     uint8_t *src = (uint8_t *)&m_media_info[*m_media_info_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_media_info_idx__ += count;
@@ -60,7 +60,7 @@ bool tlvNon1905neighborDeviceList::alloc_mac_non_1905_device(size_t count) {
     uint8_t *src = (uint8_t *)&m_mac_non_1905_device[m_mac_non_1905_device_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_mac_non_1905_device_idx__ += count;
@@ -75,13 +75,18 @@ bool tlvNon1905neighborDeviceList::alloc_mac_non_1905_device(size_t count) {
     return true;
 }
 
+sMacAddr* tlvNon1905neighborDeviceList::reserve_mac_non_1905_device(size_t count) {
+    if (!alloc_mac_non_1905_device(count)) {
+        return nullptr;
+    }
+    return &m_mac_non_1905_device[m_mac_non_1905_device_idx__ - count];
+}
+
 void tlvNon1905neighborDeviceList::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
     m_mac_local_iface->struct_swap();
-    for (size_t i = 0; i < m_mac_non_1905_device_idx__; i++){
-        m_mac_non_1905_device[i].struct_swap();
-    }
+    tlvf_swap_array(m_mac_non_1905_device, m_mac_non_1905_device_idx__);
 }
 
 bool tlvNon1905neighborDeviceList::finalize()
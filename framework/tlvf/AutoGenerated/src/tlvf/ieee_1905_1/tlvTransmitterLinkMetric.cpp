@@ -64,7 +64,7 @@ bool tlvTransmitterLinkMetric::alloc_interface_pair_info(size_t count) {
     uint8_t *src = (uint8_t *)&m_interface_pair_info[m_interface_pair_info_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_interface_pair_info_idx__ += count;
@@ -79,14 +79,19 @@ bool tlvTransmitterLinkMetric::alloc_interface_pair_info(size_t count) {
     return true;
 }
 
+tlvTransmitterLinkMetric::sInterfacePairInfo* tlvTransmitterLinkMetric::reserve_interface_pair_info(size_t count) {
+    if (!alloc_interface_pair_info(count)) {
+        return nullptr;
+    }
+    return &m_interface_pair_info[m_interface_pair_info_idx__ - count];
+}
+
 void tlvTransmitterLinkMetric::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
     m_reporter_al_mac->struct_swap();
     m_neighbor_al_mac->struct_swap();
-    for (size_t i = 0; i < m_interface_pair_info_idx__; i++){
-        m_interface_pair_info[i].struct_swap();
-    }
+    tlvf_swap_array(m_interface_pair_info, m_interface_pair_info_idx__);
 }
 
 bool tlvTransmitterLinkMetric::finalize()
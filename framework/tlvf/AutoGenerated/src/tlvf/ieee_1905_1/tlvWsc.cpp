@@ -68,7 +68,7 @@ bool tlvWsc::alloc_payload(size_t count) {
     uint8_t *src = (uint8_t *)&m_payload[m_payload_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_payload_idx__ += count;
@@ -65,7 +65,7 @@ bool tlvTestVarList::alloc_simple_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_simple_list[*m_simple_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_test_string_length = (uint8_t *)((uint8_t *)(m_test_string_length) + len);
@@ -145,7 +145,7 @@ bool tlvTestVarList::alloc_test_string(size_t count) {
     uint8_t *src = (uint8_t *)&m_test_string[*m_test_string_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_complex_list_length = (uint8_t *)((uint8_t *)(m_complex_list_length) + len);
@@ -199,7 +199,7 @@ std::shared_ptr<cInner> tlvTestVarList::create_complex_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_var1 = (cInner *)((uint8_t *)(m_var1) + len);
@@ -278,7 +278,7 @@ std::shared_ptr<cInner> tlvTestVarList::create_var1() {
     uint8_t *src = (uint8_t *)m_var1;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_var3 = (cInner *)((uint8_t *)(m_var3) + len);
@@ -339,7 +339,7 @@ std::shared_ptr<cInner> tlvTestVarList::create_var3() {
     uint8_t *src = (uint8_t *)m_var3;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_var2 = (uint32_t *)((uint8_t *)(m_var2) + len);
@@ -423,7 +423,7 @@ std::shared_ptr<cInner> tlvTestVarList::create_unknown_length_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cInner>(getBuffPtr(), getBuffRemainingBytes(), m_parse__);
@@ -719,7 +719,7 @@ bool cInner::alloc_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_list[*m_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_var1 = (uint32_t *)((uint8_t *)(m_var1) + len);
@@ -785,7 +785,7 @@ bool cInner::alloc_unknown_length_list_inner(size_t count) {
     uint8_t *src = (uint8_t *)&m_unknown_length_list_inner[m_unknown_length_list_inner_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_unknown_length_list_inner_idx__ += count;
@@ -50,7 +50,7 @@ bool tlv1905EncapDpp::alloc_dest_sta_mac() {
     uint8_t *src = (uint8_t *)m_dest_sta_mac;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_frame_type = (eFrameType *)((uint8_t *)(m_frame_type) + len);
@@ -125,7 +125,7 @@ bool tlv1905EncapDpp::alloc_encapsulated_frame(size_t count) {
     uint8_t *src = (uint8_t *)&m_encapsulated_frame[*m_encapsulated_frame_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_encapsulated_frame_idx__ += count;
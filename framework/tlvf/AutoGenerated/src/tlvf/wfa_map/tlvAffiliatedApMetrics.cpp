@@ -108,7 +108,7 @@ bool tlvAffiliatedApMetrics::alloc_reserved(size_t count) {
     uint8_t *src = (uint8_t *)&m_reserved[m_reserved_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_reserved_idx__ += count;
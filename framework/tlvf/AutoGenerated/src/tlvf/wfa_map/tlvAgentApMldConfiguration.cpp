@@ -68,7 +68,7 @@ std::shared_ptr<cApMld> tlvAgentApMldConfiguration::create_ap_mld() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cApMld>(src, getBuffRemainingBytes(src), m_parse__);
@@ -269,7 +269,7 @@ bool cApMld::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ap_mld_mac_addr = (sMacAddr *)((uint8_t *)(m_ap_mld_mac_addr) + len);
@@ -349,7 +349,7 @@ std::shared_ptr<cAffiliatedAp> cApMld::create_affiliated_ap() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cAffiliatedAp>(src, getBuffRemainingBytes(src), m_parse__);
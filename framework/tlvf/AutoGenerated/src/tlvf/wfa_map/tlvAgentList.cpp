@@ -60,7 +60,7 @@ bool tlvAgentList::alloc_agents(size_t count) {
     uint8_t *src = (uint8_t *)&m_agents[*m_number_of_agents];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_agents_idx__ += count;
@@ -76,12 +76,17 @@ bool tlvAgentList::alloc_agents(size_t count) {
     return true;
 }
 
+tlvAgentList::sAgent* tlvAgentList::reserve_agents(size_t count) {
+    if (!alloc_agents(count)) {
+        return nullptr;
+    }
+    return &m_agents[m_agents_idx__ - count];
+}
+
 void tlvAgentList::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_agents_idx__; i++){
-        m_agents[i].struct_swap();
-    }
+    tlvf_swap_array(m_agents, m_agents_idx__);
 }
 
 bool tlvAgentList::finalize()
@@ -60,7 +60,7 @@ bool tlvAkmSuiteCapabilities::alloc_backhaul_bss_akm_suite_selectors(size_t coun
     uint8_t *src = (uint8_t *)&m_backhaul_bss_akm_suite_selectors[*m_number_of_bh_bss_akm_suite_selectors];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_number_of_fh_bss_akm_suite_selectors = (uint8_t *)((uint8_t *)(m_number_of_fh_bss_akm_suite_selectors) + len);
@@ -78,6 +78,13 @@ bool tlvAkmSuiteCapabilities::alloc_backhaul_bss_akm_suite_selectors(size_t coun
     return true;
 }
 
+tlvAkmSuiteCapabilities::sBssAkmSuiteSelector* tlvAkmSuiteCapabilities::reserve_backhaul_bss_akm_suite_selectors(size_t count) {
+    if (!alloc_backhaul_bss_akm_suite_selectors(count)) {
+        return nullptr;
+    }
+    return &m_backhaul_bss_akm_suite_selectors[m_backhaul_bss_akm_suite_selectors_idx__ - count];
+}
+
 uint8_t& tlvAkmSuiteCapabilities::number_of_fh_bss_akm_suite_selectors() {
     return (uint8_t&)(*m_number_of_fh_bss_akm_suite_selectors);
 }
@@ -105,7 +112,7 @@ bool tlvAkmSuiteCapabilities::alloc_fronthaul_bss_akm_suite_selectors(size_t cou
     uint8_t *src = (uint8_t *)&m_fronthaul_bss_akm_suite_selectors[*m_number_of_fh_bss_akm_suite_selectors];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_fronthaul_bss_akm_suite_selectors_idx__ += count;
@@ -121,15 +128,18 @@ bool tlvAkmSuiteCapabilities::alloc_fronthaul_bss_akm_suite_selectors(size_t cou
     return true;
 }
 
+tlvAkmSuiteCapabilities::sBssAkmSuiteSelector* tlvAkmSuiteCapabilities::reserve_fronthaul_bss_akm_suite_selectors(size_t count) {
+    if (!alloc_fronthaul_bss_akm_suite_selectors(count)) {
+        return nullptr;
+    }
+    return &m_fronthaul_bss_akm_suite_selectors[m_fronthaul_bss_akm_suite_selectors_idx__ - count];
+}
+
 void tlvAkmSuiteCapabilities::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_backhaul_bss_akm_suite_selectors_idx__; i++){
-        m_backhaul_bss_akm_suite_selectors[i].struct_swap();
-    }
-    for (size_t i = 0; i < m_fronthaul_bss_akm_suite_selectors_idx__; i++){
-        m_fronthaul_bss_akm_suite_selectors[i].struct_swap();
-    }
+    tlvf_swap_array(m_backhaul_bss_akm_suite_selectors, m_backhaul_bss_akm_suite_selectors_idx__);
+    tlvf_swap_array(m_fronthaul_bss_akm_suite_selectors, m_fronthaul_bss_akm_suite_selectors_idx__);
 }
 
 bool tlvAkmSuiteCapabilities::finalize()
@@ -68,7 +68,7 @@ std::shared_ptr<cAnticipatedOperatingClasses> tlvAnticipatedChannelPreference::c
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cAnticipatedOperatingClasses>(src, getBuffRemainingBytes(src), m_parse__);
@@ -257,7 +257,7 @@ bool cAnticipatedOperatingClasses::alloc_channel_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_channel_list[*m_channel_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_reserved = (uint32_t *)((uint8_t *)(m_reserved) + len);
@@ -60,7 +60,7 @@ bool tlvApMetricQuery::alloc_bssid_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_bssid_list[*m_bssid_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bssid_list_idx__ += count;
@@ -76,12 +76,17 @@ bool tlvApMetricQuery::alloc_bssid_list(size_t count) {
     return true;
 }
 
+sMacAddr* tlvApMetricQuery::reserve_bssid_list(size_t count) {
+    if (!alloc_bssid_list(count)) {
+        return nullptr;
+    }
+    return &m_bssid_list[m_bssid_list_idx__ - count];
+}
+
 void tlvApMetricQuery::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_bssid_list_idx__; i++){
-        m_bssid_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_bssid_list, m_bssid_list_idx__);
 }
 
 bool tlvApMetricQuery::finalize()
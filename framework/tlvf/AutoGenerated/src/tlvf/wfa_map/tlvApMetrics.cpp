@@ -84,7 +84,7 @@ bool tlvApMetrics::alloc_estimated_service_info_field(size_t count) {
     uint8_t *src = (uint8_t *)&m_estimated_service_info_field[m_estimated_service_info_field_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_estimated_service_info_field_idx__ += count;
@@ -68,7 +68,7 @@ std::shared_ptr<cRadioInfo> tlvApOperationalBSS::create_radio_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadioInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -253,7 +253,7 @@ std::shared_ptr<cRadioBssInfo> cRadioInfo::create_radio_bss_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadioBssInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -438,7 +438,7 @@ bool cRadioBssInfo::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ssid_idx__ += count;
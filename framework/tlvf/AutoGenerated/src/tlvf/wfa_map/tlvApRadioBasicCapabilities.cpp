@@ -76,7 +76,7 @@ std::shared_ptr<cOperatingClassesInfo> tlvApRadioBasicCapabilities::create_opera
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cOperatingClassesInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -285,7 +285,7 @@ bool cOperatingClassesInfo::alloc_statically_non_operable_channels_list(size_t c
     uint8_t *src = (uint8_t *)&m_statically_non_operable_channels_list[*m_statically_non_operable_channels_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_statically_non_operable_channels_list_idx__ += count;
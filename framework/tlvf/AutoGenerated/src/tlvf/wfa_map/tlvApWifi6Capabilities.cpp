@@ -72,7 +72,7 @@ std::shared_ptr<cRole> tlvApWifi6Capabilities::create_role() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRole>(src, getBuffRemainingBytes(src), m_parse__);
@@ -264,7 +264,7 @@ bool cRole::alloc_mcs_nss_160() {
     uint8_t *src = (uint8_t *)m_mcs_nss_160;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_mcs_nss_80_80 = (uint32_t *)((uint8_t *)(m_mcs_nss_80_80) + len);
@@ -311,7 +311,7 @@ bool cRole::alloc_mcs_nss_80_80() {
     uint8_t *src = (uint8_t *)m_mcs_nss_80_80;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_flags2 = (sFlags2 *)((uint8_t *)(m_flags2) + len);
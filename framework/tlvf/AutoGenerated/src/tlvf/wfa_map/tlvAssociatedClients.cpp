@@ -68,7 +68,7 @@ std::shared_ptr<cBssInfo> tlvAssociatedClients::create_bss_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cBssInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -253,7 +253,7 @@ std::shared_ptr<cClientInfo> cBssInfo::create_clients_associated_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cClientInfo>(src, getBuffRemainingBytes(src), m_parse__);
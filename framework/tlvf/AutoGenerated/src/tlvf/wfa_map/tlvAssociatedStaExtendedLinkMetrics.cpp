@@ -64,7 +64,7 @@ bool tlvAssociatedStaExtendedLinkMetrics::alloc_metrics_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_metrics_list[*m_metrics_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_metrics_list_idx__ += count;
@@ -80,13 +80,18 @@ bool tlvAssociatedStaExtendedLinkMetrics::alloc_metrics_list(size_t count) {
     return true;
 }
 
+tlvAssociatedStaExtendedLinkMetrics::sMetrics* tlvAssociatedStaExtendedLinkMetrics::reserve_metrics_list(size_t count) {
+    if (!alloc_metrics_list(count)) {
+        return nullptr;
+    }
+    return &m_metrics_list[m_metrics_list_idx__ - count];
+}
+
 void tlvAssociatedStaExtendedLinkMetrics::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
     m_associated_sta->struct_swap();
-    for (size_t i = 0; i < m_metrics_list_idx__; i++){
-        m_metrics_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_metrics_list, m_metrics_list_idx__);
 }
 
 bool tlvAssociatedStaExtendedLinkMetrics::finalize()
@@ -64,7 +64,7 @@ bool tlvAssociatedStaLinkMetrics::alloc_bssid_info_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_bssid_info_list[*m_bssid_info_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bssid_info_list_idx__ += count;
@@ -80,13 +80,18 @@ bool tlvAssociatedStaLinkMetrics::alloc_bssid_info_list(size_t count) {
     return true;
 }
 
+tlvAssociatedStaLinkMetrics::sBssidInfo* tlvAssociatedStaLinkMetrics::reserve_bssid_info_list(size_t count) {
+    if (!alloc_bssid_info_list(count)) {
+        return nullptr;
+    }
+    return &m_bssid_info_list[m_bssid_info_list_idx__ - count];
+}
+
 void tlvAssociatedStaLinkMetrics::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
     m_sta_mac->struct_swap();
-    for (size_t i = 0; i < m_bssid_info_list_idx__; i++){
-        m_bssid_info_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_bssid_info_list, m_bssid_info_list_idx__);
 }
 
 bool tlvAssociatedStaLinkMetrics::finalize()
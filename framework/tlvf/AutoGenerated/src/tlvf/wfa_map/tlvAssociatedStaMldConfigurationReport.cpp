@@ -100,7 +100,7 @@ std::shared_ptr<cAffiliatedSta> tlvAssociatedStaMldConfigurationReport::create_a
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cAffiliatedSta>(src, getBuffRemainingBytes(src), m_parse__);
@@ -64,7 +64,7 @@ bool tlvAssociatedWiFi6StaStatusReport::alloc_tid_queue_size_list(size_t count)
     uint8_t *src = (uint8_t *)&m_tid_queue_size_list[*m_tid_queue_size_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_tid_queue_size_list_idx__ += count;
@@ -80,13 +80,18 @@ bool tlvAssociatedWiFi6StaStatusReport::alloc_tid_queue_size_list(size_t count)
     return true;
 }
 
+tlvAssociatedWiFi6StaStatusReport::sTidQueueSize* tlvAssociatedWiFi6StaStatusReport::reserve_tid_queue_size_list(size_t count) {
+    if (!alloc_tid_queue_size_list(count)) {
+        return nullptr;
+    }
+    return &m_tid_queue_size_list[m_tid_queue_size_list_idx__ - count];
+}
+
 void tlvAssociatedWiFi6StaStatusReport::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
     m_sta_mac->struct_swap();
-    for (size_t i = 0; i < m_tid_queue_size_list_idx__; i++){
-        m_tid_queue_size_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_tid_queue_size_list, m_tid_queue_size_list_idx__);
 }
 
 bool tlvAssociatedWiFi6StaStatusReport::finalize()
@@ -68,7 +68,7 @@ bool tlvAvailableSpectrumInquiryResponse::alloc_available_spectrum_inquiry_respo
     uint8_t *src = (uint8_t *)&m_available_spectrum_inquiry_response_obj[m_available_spectrum_inquiry_response_obj_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_available_spectrum_inquiry_response_obj_idx__ += count;
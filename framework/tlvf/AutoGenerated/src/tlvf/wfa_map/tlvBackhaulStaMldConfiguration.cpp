@@ -104,7 +104,7 @@ std::shared_ptr<cAffiliatedBhSta> tlvBackhaulStaMldConfiguration::create_affilia
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cAffiliatedBhSta>(src, getBuffRemainingBytes(src), m_parse__);
@@ -54,7 +54,7 @@ bool tlvBackhaulStaRadioCapabilities::alloc_sta_mac() {
     uint8_t *src = (uint8_t *)m_sta_mac;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     if (!buffPtrIncrementSafe(len)) {
@@ -104,7 +104,7 @@ bool tlvBeaconMetricsQuery::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ap_channel_reports_list_length = (uint8_t *)((uint8_t *)(m_ap_channel_reports_list_length) + len);
@@ -156,7 +156,7 @@ std::shared_ptr<cApChannelReports> tlvBeaconMetricsQuery::create_ap_channel_repo
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_elemnt_id_list_length = (uint8_t *)((uint8_t *)(m_elemnt_id_list_length) + len);
@@ -239,7 +239,7 @@ bool tlvBeaconMetricsQuery::alloc_elemnt_id_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_elemnt_id_list[*m_elemnt_id_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_elemnt_id_list_idx__ += count;
@@ -466,7 +466,7 @@ bool cApChannelReports::alloc_ap_channel_report_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_ap_channel_report_list[*m_ap_channel_report_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ap_channel_report_list_idx__ += count;
@@ -76,7 +76,7 @@ std::shared_ptr<cMeasurementReportElement> tlvBeaconMetricsResponse::create_meas
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cMeasurementReportElement>(src, getBuffRemainingBytes(src), m_parse__);
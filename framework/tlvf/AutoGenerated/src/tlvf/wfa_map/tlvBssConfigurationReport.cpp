@@ -64,7 +64,7 @@ std::shared_ptr<cRadio> tlvBssConfigurationReport::create_radios() {
     uint8_t *src = (uint8_t *)m_radios;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadio>(src, getBuffRemainingBytes(src), m_parse__);
@@ -265,7 +265,7 @@ bool cBssConf::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ssid_idx__ += count;
@@ -409,7 +409,7 @@ std::shared_ptr<cBssConf> cRadio::create_bss_info() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cBssConf>(src, getBuffRemainingBytes(src), m_parse__);
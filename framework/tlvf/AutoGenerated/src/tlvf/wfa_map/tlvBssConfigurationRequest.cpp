@@ -68,7 +68,7 @@ bool tlvBssConfigurationRequest::alloc_dpp_configuration_request_object(size_t c
     uint8_t *src = (uint8_t *)&m_dpp_configuration_request_object[m_dpp_configuration_request_object_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_dpp_configuration_request_object_idx__ += count;
@@ -72,7 +72,7 @@ std::shared_ptr<cPreferenceOperatingClasses> tlvChannelPreference::create_operat
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cPreferenceOperatingClasses>(src, getBuffRemainingBytes(src), m_parse__);
@@ -270,7 +270,7 @@ bool cPreferenceOperatingClasses::alloc_channel_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_channel_list[*m_channel_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_flags = (sFlags *)((uint8_t *)(m_flags) + len);
@@ -68,7 +68,7 @@ std::shared_ptr<cRadiosWithScanCapabilities> tlvChannelScanCapabilities::create_
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadiosWithScanCapabilities>(src, getBuffRemainingBytes(src), m_parse__);
@@ -261,7 +261,7 @@ std::shared_ptr<cOperatingClasses> cRadiosWithScanCapabilities::create_operating
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cOperatingClasses>(src, getBuffRemainingBytes(src), m_parse__);
@@ -449,7 +449,7 @@ bool cOperatingClasses::alloc_channel_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_channel_list[*m_channel_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_channel_list_idx__ += count;
@@ -72,7 +72,7 @@ bool tlvClientAssociationControlRequest::alloc_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_sta_list[*m_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_sta_list_idx__ += count;
@@ -88,15 +88,20 @@ bool tlvClientAssociationControlRequest::alloc_sta_list(size_t count) {
     return true;
 }
 
+sMacAddr* tlvClientAssociationControlRequest::reserve_sta_list(size_t count) {
+    if (!alloc_sta_list(count)) {
+        return nullptr;
+    }
+    return &m_sta_list[m_sta_list_idx__ - count];
+}
+
 void tlvClientAssociationControlRequest::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
     m_bssid_to_block_client->struct_swap();
     tlvf_swap(8*sizeof(eAssociationControl), reinterpret_cast<uint8_t*>(m_association_control));
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_validity_period_sec));
-    for (size_t i = 0; i < m_sta_list_idx__; i++){
-        m_sta_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_sta_list, m_sta_list_idx__);
 }
 
 bool tlvClientAssociationControlRequest::finalize()
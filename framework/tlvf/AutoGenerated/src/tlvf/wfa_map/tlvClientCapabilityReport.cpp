@@ -72,7 +72,7 @@ bool tlvClientCapabilityReport::alloc_association_frame(size_t count) {
     uint8_t *src = (uint8_t *)&m_association_frame[m_association_frame_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_association_frame_idx__ += count;
@@ -80,7 +80,7 @@ bool ClientSecurityContext::alloc_ptk(size_t count) {
     uint8_t *src = (uint8_t *)&m_ptk[*m_key_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_tx_pn_length = (uint16_t *)((uint8_t *)(m_tx_pn_length) + len);
@@ -138,7 +138,7 @@ bool ClientSecurityContext::alloc_tx_packet_num(size_t count) {
     uint8_t *src = (uint8_t *)&m_tx_packet_num[*m_tx_pn_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_group_key_length = (uint16_t *)((uint8_t *)(m_group_key_length) + len);
@@ -194,7 +194,7 @@ bool ClientSecurityContext::alloc_gtk(size_t count) {
     uint8_t *src = (uint8_t *)&m_gtk[*m_group_key_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_group_tx_pn_length = (uint16_t *)((uint8_t *)(m_group_tx_pn_length) + len);
@@ -248,7 +248,7 @@ bool ClientSecurityContext::alloc_group_tx_packet_num(size_t count) {
     uint8_t *src = (uint8_t *)&m_group_tx_packet_num[*m_group_tx_pn_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_group_tx_packet_num_idx__ += count;
@@ -84,7 +84,7 @@ bool tlvDeviceInventory::alloc_serial_number(size_t count) {
     uint8_t *src = (uint8_t *)&m_serial_number[*m_serial_number_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_software_version_length = (uint8_t *)((uint8_t *)(m_software_version_length) + len);
@@ -154,7 +154,7 @@ bool tlvDeviceInventory::alloc_software_version(size_t count) {
     uint8_t *src = (uint8_t *)&m_software_version[*m_software_version_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_execution_environment_length = (uint8_t *)((uint8_t *)(m_execution_environment_length) + len);
@@ -222,7 +222,7 @@ bool tlvDeviceInventory::alloc_execution_environment(size_t count) {
     uint8_t *src = (uint8_t *)&m_execution_environment[*m_execution_environment_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_number_of_radios = (uint8_t *)((uint8_t *)(m_number_of_radios) + len);
@@ -272,7 +272,7 @@ std::shared_ptr<cRadioVendorInfo> tlvDeviceInventory::create_radios_vendor_info(
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadioVendorInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -518,7 +518,7 @@ bool cRadioVendorInfo::alloc_chipset_vendor(size_t count) {
     uint8_t *src = (uint8_t *)&m_chipset_vendor[*m_chipset_vendor_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_chipset_vendor_idx__ += count;
@@ -92,7 +92,7 @@ bool tlvDppBootstrappingUriNotification::alloc_dpp_uri(size_t count) {
     uint8_t *src = (uint8_t *)&m_dpp_uri[m_dpp_uri_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_dpp_uri_idx__ += count;
@@ -50,7 +50,7 @@ bool tlvDppChirpValue::alloc_dest_sta_mac() {
     uint8_t *src = (uint8_t *)m_dest_sta_mac;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_hash_length = (uint8_t *)((uint8_t *)(m_hash_length) + len);
@@ -120,7 +120,7 @@ bool tlvDppChirpValue::alloc_hash(size_t count) {
     uint8_t *src = (uint8_t *)&m_hash[*m_hash_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_hash_idx__ += count;
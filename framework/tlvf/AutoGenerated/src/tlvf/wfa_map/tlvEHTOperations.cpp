@@ -88,7 +88,7 @@ std::shared_ptr<cRadioEntry> tlvEHTOperations::create_radio_entries() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadioEntry>(src, getBuffRemainingBytes(src), m_parse__);
@@ -283,7 +283,7 @@ std::shared_ptr<cBssEntry> cRadioEntry::create_bss_entries() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_reserved = (uint8_t *)((uint8_t *)(m_reserved) + len);
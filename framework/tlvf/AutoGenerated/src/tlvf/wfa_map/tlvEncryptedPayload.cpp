@@ -100,7 +100,7 @@ bool tlvEncryptedPayload::alloc_aes_siv(size_t count) {
     uint8_t *src = (uint8_t *)&m_aes_siv[*m_aes_siv_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_aes_siv_idx__ += count;
@@ -100,7 +100,7 @@ bool tlvMic::alloc_mic(size_t count) {
     uint8_t *src = (uint8_t *)&m_mic[*m_mic_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_mic_idx__ += count;
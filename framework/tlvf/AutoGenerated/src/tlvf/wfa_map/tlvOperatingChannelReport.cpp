@@ -64,7 +64,7 @@ bool tlvOperatingChannelReport::alloc_operating_classes_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_operating_classes_list[*m_operating_classes_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_current_transmit_power = (int8_t *)((uint8_t *)(m_current_transmit_power) + len);
@@ -81,6 +81,13 @@ bool tlvOperatingChannelReport::alloc_operating_classes_list(size_t count) {
     return true;
 }
 
+tlvOperatingChannelReport::sOperatingClasses* tlvOperatingChannelReport::reserve_operating_classes_list(size_t count) {
+    if (!alloc_operating_classes_list(count)) {
+        return nullptr;
+    }
+    return &m_operating_classes_list[m_operating_classes_list_idx__ - count];
+}
+
 int8_t& tlvOperatingChannelReport::current_transmit_power() {
     return (int8_t&)(*m_current_transmit_power);
 }
@@ -89,9 +96,7 @@ void tlvOperatingChannelReport::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
     m_radio_uid->struct_swap();
-    for (size_t i = 0; i < m_operating_classes_list_idx__; i++){
-        m_operating_classes_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_operating_classes_list, m_operating_classes_list_idx__);
 }
 
 bool tlvOperatingChannelReport::finalize()
@@ -88,7 +88,7 @@ std::shared_ptr<cCacCapabilitiesRadio> tlvProfile2CacCapabilities::create_cac_ra
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cCacCapabilitiesRadio>(src, getBuffRemainingBytes(src), m_parse__);
@@ -283,7 +283,7 @@ std::shared_ptr<cCacTypes> cCacCapabilitiesRadio::create_cac_types() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cCacTypes>(src, getBuffRemainingBytes(src), m_parse__);
@@ -471,7 +471,7 @@ std::shared_ptr<cCacCapabilitiesOperatingClasses> cCacTypes::create_operating_cl
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cCacCapabilitiesOperatingClasses>(src, getBuffRemainingBytes(src), m_parse__);
@@ -648,7 +648,7 @@ bool cCacCapabilitiesOperatingClasses::alloc_channels(size_t count) {
     uint8_t *src = (uint8_t *)&m_channels[*m_number_of_channels];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_channels_idx__ += count;
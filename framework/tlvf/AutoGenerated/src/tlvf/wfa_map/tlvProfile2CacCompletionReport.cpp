@@ -68,7 +68,7 @@ std::shared_ptr<cCacCompletionReportRadio> tlvProfile2CacCompletionReport::creat
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cCacCompletionReportRadio>(src, getBuffRemainingBytes(src), m_parse__);
@@ -257,7 +257,7 @@ bool cCacCompletionReportRadio::alloc_detected_pairs(size_t count) {
     uint8_t *src = (uint8_t *)&m_detected_pairs[*m_number_of_detected_pairs];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_detected_pairs_idx__ += count;
@@ -272,12 +272,17 @@ bool cCacCompletionReportRadio::alloc_detected_pairs(size_t count) {
     return true;
 }
 
+cCacCompletionReportRadio::sCacDetectedPair* cCacCompletionReportRadio::reserve_detected_pairs(size_t count) {
+    if (!alloc_detected_pairs(count)) {
+        return nullptr;
+    }
+    return &m_detected_pairs[m_detected_pairs_idx__ - count];
+}
+
 void cCacCompletionReportRadio::class_swap()
 {
     m_radio_uid->struct_swap();
-    for (size_t i = 0; i < m_detected_pairs_idx__; i++){
-        m_detected_pairs[i].struct_swap();
-    }
+    tlvf_swap_array(m_detected_pairs, m_detected_pairs_idx__);
 }
 
 bool cCacCompletionReportRadio::finalize()
@@ -60,7 +60,7 @@ bool tlvProfile2CacRequest::alloc_cac_radios(size_t count) {
     uint8_t *src = (uint8_t *)&m_cac_radios[*m_number_of_cac_radios];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_cac_radios_idx__ += count;
@@ -76,12 +76,17 @@ bool tlvProfile2CacRequest::alloc_cac_radios(size_t count) {
     return true;
 }
 
+tlvProfile2CacRequest::sCacRequestRadio* tlvProfile2CacRequest::reserve_cac_radios(size_t count) {
+    if (!alloc_cac_radios(count)) {
+        return nullptr;
+    }
+    return &m_cac_radios[m_cac_radios_idx__ - count];
+}
+
 void tlvProfile2CacRequest::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_cac_radios_idx__; i++){
-        m_cac_radios[i].struct_swap();
-    }
+    tlvf_swap_array(m_cac_radios, m_cac_radios_idx__);
 }
 
 bool tlvProfile2CacRequest::finalize()
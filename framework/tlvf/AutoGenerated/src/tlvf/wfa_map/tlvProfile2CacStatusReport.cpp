@@ -60,7 +60,7 @@ bool tlvProfile2CacStatusReport::alloc_available_channels(size_t count) {
     uint8_t *src = (uint8_t *)&m_available_channels[*m_number_of_available_channels];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_number_of_detected_pairs = (uint8_t *)((uint8_t *)(m_number_of_detected_pairs) + len);
@@ -80,6 +80,13 @@ bool tlvProfile2CacStatusReport::alloc_available_channels(size_t count) {
     return true;
 }
 
+tlvProfile2CacStatusReport::sAvailableChannels* tlvProfile2CacStatusReport::reserve_available_channels(size_t count) {
+    if (!alloc_available_channels(count)) {
+        return nullptr;
+    }
+    return &m_available_channels[m_available_channels_idx__ - count];
+}
+
 uint8_t& tlvProfile2CacStatusReport::number_of_detected_pairs() {
     return (uint8_t&)(*m_number_of_detected_pairs);
 }
@@ -107,7 +114,7 @@ bool tlvProfile2CacStatusReport::alloc_detected_pairs(size_t count) {
     uint8_t *src = (uint8_t *)&m_detected_pairs[*m_number_of_detected_pairs];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_number_of_active_cac_pairs = (uint8_t *)((uint8_t *)(m_number_of_active_cac_pairs) + len);
@@ -125,6 +132,13 @@ bool tlvProfile2CacStatusReport::alloc_detected_pairs(size_t count) {
     return true;
 }
 
+tlvProfile2CacStatusReport::sDetectedPairs* tlvProfile2CacStatusReport::reserve_detected_pairs(size_t count) {
+    if (!alloc_detected_pairs(count)) {
+        return nullptr;
+    }
+    return &m_detected_pairs[m_detected_pairs_idx__ - count];
+}
+
 uint8_t& tlvProfile2CacStatusReport::number_of_active_cac_pairs() {
     return (uint8_t&)(*m_number_of_active_cac_pairs);
 }
@@ -152,7 +166,7 @@ bool tlvProfile2CacStatusReport::alloc_active_cac_pairs(size_t count) {
     uint8_t *src = (uint8_t *)&m_active_cac_pairs[*m_number_of_active_cac_pairs];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_active_cac_pairs_idx__ += count;
@@ -168,18 +182,19 @@ bool tlvProfile2CacStatusReport::alloc_active_cac_pairs(size_t count) {
     return true;
 }
 
+tlvProfile2CacStatusReport::sActiveCacPairs* tlvProfile2CacStatusReport::reserve_active_cac_pairs(size_t count) {
+    if (!alloc_active_cac_pairs(count)) {
+        return nullptr;
+    }
+    return &m_active_cac_pairs[m_active_cac_pairs_idx__ - count];
+}
+
 void tlvProfile2CacStatusReport::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_available_channels_idx__; i++){
-        m_available_channels[i].struct_swap();
-    }
-    for (size_t i = 0; i < m_detected_pairs_idx__; i++){
-        m_detected_pairs[i].struct_swap();
-    }
-    for (size_t i = 0; i < m_active_cac_pairs_idx__; i++){
-        m_active_cac_pairs[i].struct_swap();
-    }
+    tlvf_swap_array(m_available_channels, m_available_channels_idx__);
+    tlvf_swap_array(m_detected_pairs, m_detected_pairs_idx__);
+    tlvf_swap_array(m_active_cac_pairs, m_active_cac_pairs_idx__);
 }
 
 bool tlvProfile2CacStatusReport::finalize()
@@ -72,7 +72,7 @@ std::shared_ptr<cRadiosToScan> tlvProfile2ChannelScanRequest::create_radio_list(
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadiosToScan>(src, getBuffRemainingBytes(src), m_parse__);
@@ -265,7 +265,7 @@ std::shared_ptr<cOperatingClasses> cRadiosToScan::create_operating_classes_list(
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cOperatingClasses>(src, getBuffRemainingBytes(src), m_parse__);
@@ -100,7 +100,7 @@ bool tlvProfile2ChannelScanResult::alloc_timestamp(size_t count) {
     uint8_t *src = (uint8_t *)&m_timestamp[*m_timestamp_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_utilization = (uint8_t *)((uint8_t *)(m_utilization) + len);
@@ -162,7 +162,7 @@ std::shared_ptr<cNeighbors> tlvProfile2ChannelScanResult::create_neighbors_list(
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_aggregate_scan_duration = (uint32_t *)((uint8_t *)(m_aggregate_scan_duration) + len);
@@ -453,7 +453,7 @@ bool cNeighbors::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_signal_strength = (uint8_t *)((uint8_t *)(m_signal_strength) + len);
@@ -526,7 +526,7 @@ bool cNeighbors::alloc_channels_bw_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_channels_bw_list[*m_channel_bw_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bss_load_element_present = (eBssLoadElementPresent *)((uint8_t *)(m_bss_load_element_present) + len);
@@ -558,7 +558,7 @@ bool cNeighbors::alloc_channel_utilization() {
     uint8_t *src = (uint8_t *)m_channel_utilization;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_station_count = (uint16_t *)((uint8_t *)(m_station_count) + len);
@@ -600,7 +600,7 @@ bool cNeighbors::alloc_station_count() {
     uint8_t *src = (uint8_t *)m_station_count;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     if (!buffPtrIncrementSafe(len)) {
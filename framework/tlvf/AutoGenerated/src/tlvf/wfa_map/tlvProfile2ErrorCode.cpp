@@ -50,7 +50,7 @@ bool tlvProfile2ErrorCode::alloc_bssid() {
     uint8_t *src = (uint8_t *)m_bssid;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_service_prioritization_rule_id = (uint32_t *)((uint8_t *)(m_service_prioritization_rule_id) + len);
@@ -93,7 +93,7 @@ bool tlvProfile2ErrorCode::alloc_service_prioritization_rule_id() {
     uint8_t *src = (uint8_t *)m_service_prioritization_rule_id;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     if (!buffPtrIncrementSafe(len)) {
@@ -68,7 +68,7 @@ std::shared_ptr<cSsidVlanId> tlvProfile2TrafficSeparationPolicy::create_ssids_vl
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cSsidVlanId>(src, getBuffRemainingBytes(src), m_parse__);
@@ -265,7 +265,7 @@ bool cSsidVlanId::alloc_ssid_name(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid_name[*m_ssid_name_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_vlan_id = (uint16_t *)((uint8_t *)(m_vlan_id) + len);
@@ -80,7 +80,7 @@ bool tlvQoSManagementDescriptor::alloc_descriptor_element(size_t count) {
     uint8_t *src = (uint8_t *)&m_descriptor_element[m_descriptor_element_idx__];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_descriptor_element_idx__ += count;
@@ -60,7 +60,7 @@ bool tlvQoSManagementPolicy::alloc_mscs_disallowed_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_mscs_disallowed_sta_list[*m_mscs_disallowed_sta_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_scs_disallowed_sta_length = (uint8_t *)((uint8_t *)(m_scs_disallowed_sta_length) + len);
@@ -79,6 +79,13 @@ bool tlvQoSManagementPolicy::alloc_mscs_disallowed_sta_list(size_t count) {
     return true;
 }
 
+sMacAddr* tlvQoSManagementPolicy::reserve_mscs_disallowed_sta_list(size_t count) {
+    if (!alloc_mscs_disallowed_sta_list(count)) {
+        return nullptr;
+    }
+    return &m_mscs_disallowed_sta_list[m_mscs_disallowed_sta_list_idx__ - count];
+}
+
 uint8_t& tlvQoSManagementPolicy::scs_disallowed_sta_length() {
     return (uint8_t&)(*m_scs_disallowed_sta_length);
 }
@@ -106,7 +113,7 @@ bool tlvQoSManagementPolicy::alloc_scs_disallowed_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_scs_disallowed_sta_list[*m_scs_disallowed_sta_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_reserved = (uint8_t *)((uint8_t *)(m_reserved) + len);
@@ -123,6 +130,13 @@ bool tlvQoSManagementPolicy::alloc_scs_disallowed_sta_list(size_t count) {
     return true;
 }
 
+sMacAddr* tlvQoSManagementPolicy::reserve_scs_disallowed_sta_list(size_t count) {
+    if (!alloc_scs_disallowed_sta_list(count)) {
+        return nullptr;
+    }
+    return &m_scs_disallowed_sta_list[m_scs_disallowed_sta_list_idx__ - count];
+}
+
 uint8_t* tlvQoSManagementPolicy::reserved(size_t idx) {
     if ( (m_reserved_idx__ == 0) || (m_reserved_idx__ <= idx) ) {
         TLVF_LOG(ERROR) << "Requested index is greater than the number of available entries";
@@ -146,12 +160,8 @@ bool tlvQoSManagementPolicy::set_reserved(const void* buffer, size_t size) {
 void tlvQoSManagementPolicy::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_mscs_disallowed_sta_list_idx__; i++){
-        m_mscs_disallowed_sta_list[i].struct_swap();
-    }
-    for (size_t i = 0; i < m_scs_disallowed_sta_list_idx__; i++){
-        m_scs_disallowed_sta_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_mscs_disallowed_sta_list, m_mscs_disallowed_sta_list_idx__);
+    tlvf_swap_array(m_scs_disallowed_sta_list, m_scs_disallowed_sta_list_idx__);
 }
 
 bool tlvQoSManagementPolicy::finalize()
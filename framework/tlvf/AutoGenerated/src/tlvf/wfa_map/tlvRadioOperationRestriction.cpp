@@ -72,7 +72,7 @@ std::shared_ptr<cRestrictedOperatingClasses> tlvRadioOperationRestriction::creat
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRestrictedOperatingClasses>(src, getBuffRemainingBytes(src), m_parse__);
@@ -258,7 +258,7 @@ bool cRestrictedOperatingClasses::alloc_channel_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_channel_list[*m_channel_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_channel_list_idx__ += count;
@@ -273,11 +273,16 @@ bool cRestrictedOperatingClasses::alloc_channel_list(size_t count) {
     return true;
 }
 
+cRestrictedOperatingClasses::sChannelInfo* cRestrictedOperatingClasses::reserve_channel_list(size_t count) {
+    if (!alloc_channel_list(count)) {
+        return nullptr;
+    }
+    return &m_channel_list[m_channel_list_idx__ - count];
+}
+
 void cRestrictedOperatingClasses::class_swap()
 {
-    for (size_t i = 0; i < m_channel_list_idx__; i++){
-        m_channel_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_channel_list, m_channel_list_idx__);
 }
 
 bool cRestrictedOperatingClasses::finalize()
@@ -60,7 +60,7 @@ bool tlvSearchedService::alloc_searched_service_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_searched_service_list[*m_searched_service_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_searched_service_list_idx__ += count;
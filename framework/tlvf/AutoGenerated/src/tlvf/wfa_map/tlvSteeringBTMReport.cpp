@@ -58,7 +58,7 @@ bool tlvSteeringBTMReport::alloc_target_bssid() {
     uint8_t *src = (uint8_t *)m_target_bssid;
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     if (!buffPtrIncrementSafe(len)) {
@@ -60,7 +60,7 @@ bool tlvSteeringPolicy::alloc_local_steering_disallowed_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_local_steering_disallowed_sta_list[*m_local_steering_disallowed_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_btm_steering_disallowed_sta_list_length = (uint8_t *)((uint8_t *)(m_btm_steering_disallowed_sta_list_length) + len);
@@ -80,6 +80,13 @@ bool tlvSteeringPolicy::alloc_local_steering_disallowed_sta_list(size_t count) {
     return true;
 }
 
+sMacAddr* tlvSteeringPolicy::reserve_local_steering_disallowed_sta_list(size_t count) {
+    if (!alloc_local_steering_disallowed_sta_list(count)) {
+        return nullptr;
+    }
+    return &m_local_steering_disallowed_sta_list[m_local_steering_disallowed_sta_list_idx__ - count];
+}
+
 uint8_t& tlvSteeringPolicy::btm_steering_disallowed_sta_list_length() {
     return (uint8_t&)(*m_btm_steering_disallowed_sta_list_length);
 }
@@ -107,7 +114,7 @@ bool tlvSteeringPolicy::alloc_btm_steering_disallowed_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_btm_steering_disallowed_sta_list[*m_btm_steering_disallowed_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_radio_ap_control_policy_list_length = (uint8_t *)((uint8_t *)(m_radio_ap_control_policy_list_length) + len);
@@ -125,6 +132,13 @@ bool tlvSteeringPolicy::alloc_btm_steering_disallowed_sta_list(size_t count) {
     return true;
 }
 
+sMacAddr* tlvSteeringPolicy::reserve_btm_steering_disallowed_sta_list(size_t count) {
+    if (!alloc_btm_steering_disallowed_sta_list(count)) {
+        return nullptr;
+    }
+    return &m_btm_steering_disallowed_sta_list[m_btm_steering_disallowed_sta_list_idx__ - count];
+}
+
 uint8_t& tlvSteeringPolicy::radio_ap_control_policy_list_length() {
     return (uint8_t&)(*m_radio_ap_control_policy_list_length);
 }
@@ -152,7 +166,7 @@ bool tlvSteeringPolicy::alloc_radio_ap_control_policy_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_radio_ap_control_policy_list[*m_radio_ap_control_policy_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_radio_ap_control_policy_list_idx__ += count;
@@ -168,18 +182,19 @@ bool tlvSteeringPolicy::alloc_radio_ap_control_policy_list(size_t count) {
     return true;
 }
 
+tlvSteeringPolicy::sRadioApControlPolicy* tlvSteeringPolicy::reserve_radio_ap_control_policy_list(size_t count) {
+    if (!alloc_radio_ap_control_policy_list(count)) {
+        return nullptr;
+    }
+    return &m_radio_ap_control_policy_list[m_radio_ap_control_policy_list_idx__ - count];
+}
+
 void tlvSteeringPolicy::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_local_steering_disallowed_sta_list_idx__; i++){
-        m_local_steering_disallowed_sta_list[i].struct_swap();
-    }
-    for (size_t i = 0; i < m_btm_steering_disallowed_sta_list_idx__; i++){
-        m_btm_steering_disallowed_sta_list[i].struct_swap();
-    }
-    for (size_t i = 0; i < m_radio_ap_control_policy_list_idx__; i++){
-        m_radio_ap_control_policy_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_local_steering_disallowed_sta_list, m_local_steering_disallowed_sta_list_idx__);
+    tlvf_swap_array(m_btm_steering_disallowed_sta_list, m_btm_steering_disallowed_sta_list_idx__);
+    tlvf_swap_array(m_radio_ap_control_policy_list, m_radio_ap_control_policy_list_idx__);
 }
 
 bool tlvSteeringPolicy::finalize()
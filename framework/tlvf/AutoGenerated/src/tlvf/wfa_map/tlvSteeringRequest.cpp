@@ -76,7 +76,7 @@ bool tlvSteeringRequest::alloc_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_sta_list[*m_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_target_bssid_list_length = (uint8_t *)((uint8_t *)(m_target_bssid_list_length) + len);
@@ -94,6 +94,13 @@ bool tlvSteeringRequest::alloc_sta_list(size_t count) {
     return true;
 }
 
+sMacAddr* tlvSteeringRequest::reserve_sta_list(size_t count) {
+    if (!alloc_sta_list(count)) {
+        return nullptr;
+    }
+    return &m_sta_list[m_sta_list_idx__ - count];
+}
+
 uint8_t& tlvSteeringRequest::target_bssid_list_length() {
     return (uint8_t&)(*m_target_bssid_list_length);
 }
@@ -121,7 +128,7 @@ bool tlvSteeringRequest::alloc_target_bssid_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_target_bssid_list[*m_target_bssid_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_target_bssid_list_idx__ += count;
@@ -137,6 +144,13 @@ bool tlvSteeringRequest::alloc_target_bssid_list(size_t count) {
     return true;
 }
 
+tlvSteeringRequest::sTargetBssidInfo* tlvSteeringRequest::reserve_target_bssid_list(size_t count) {
+    if (!alloc_target_bssid_list(count)) {
+        return nullptr;
+    }
+    return &m_target_bssid_list[m_target_bssid_list_idx__ - count];
+}
+
 void tlvSteeringRequest::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
@@ -144,12 +158,8 @@ void tlvSteeringRequest::class_swap()
     m_request_flags->struct_swap();
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_steering_opportunity_window_sec));
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_btm_disassociation_timer_ms));
-    for (size_t i = 0; i < m_sta_list_idx__; i++){
-        m_sta_list[i].struct_swap();
-    }
-    for (size_t i = 0; i < m_target_bssid_list_idx__; i++){
-        m_target_bssid_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_sta_list, m_sta_list_idx__);
+    tlvf_swap_array(m_target_bssid_list, m_target_bssid_list_idx__);
 }
 
 bool tlvSteeringRequest::finalize()
@@ -100,7 +100,7 @@ std::shared_ptr<cMapping> tlvTidToLinkMappingPolicy::create_mapping() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cMapping>(src, getBuffRemainingBytes(src), m_parse__);
@@ -320,7 +320,7 @@ std::shared_ptr<cTidToLinkControlField> cMapping::create_tid_to_link_control_fie
     uint8_t *src = (uint8_t *)m_tid_to_link_control_field;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_tid_to_link_mapping = (sTidToLinkMapping *)((uint8_t *)(m_tid_to_link_mapping) + len);
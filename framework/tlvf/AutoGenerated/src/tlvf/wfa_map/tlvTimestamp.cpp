@@ -84,7 +84,7 @@ bool tlvTimestamp::alloc_timestamp(size_t count) {
     uint8_t *src = (uint8_t *)&m_timestamp[*m_timestamp_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_timestamp_idx__ += count;
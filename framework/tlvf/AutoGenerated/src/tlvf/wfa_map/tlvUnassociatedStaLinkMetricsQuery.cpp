@@ -72,7 +72,7 @@ std::shared_ptr<cChannelParameters> tlvUnassociatedStaLinkMetricsQuery::create_c
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cChannelParameters>(src, getBuffRemainingBytes(src), m_parse__);
@@ -256,7 +256,7 @@ bool cChannelParameters::alloc_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_sta_list[*m_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_sta_list_idx__ += count;
@@ -271,11 +271,16 @@ bool cChannelParameters::alloc_sta_list(size_t count) {
     return true;
 }
 
+sMacAddr* cChannelParameters::reserve_sta_list(size_t count) {
+    if (!alloc_sta_list(count)) {
+        return nullptr;
+    }
+    return &m_sta_list[m_sta_list_idx__ - count];
+}
+
 void cChannelParameters::class_swap()
 {
-    for (size_t i = 0; i < m_sta_list_idx__; i++){
-        m_sta_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_sta_list, m_sta_list_idx__);
 }
 
 bool cChannelParameters::finalize()
@@ -64,7 +64,7 @@ bool tlvUnassociatedStaLinkMetricsResponse::alloc_sta_list(size_t count) {
     uint8_t *src = (uint8_t *)&m_sta_list[*m_sta_list_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_sta_list_idx__ += count;
@@ -80,12 +80,17 @@ bool tlvUnassociatedStaLinkMetricsResponse::alloc_sta_list(size_t count) {
     return true;
 }
 
+tlvUnassociatedStaLinkMetricsResponse::sStaMetrics* tlvUnassociatedStaLinkMetricsResponse::reserve_sta_list(size_t count) {
+    if (!alloc_sta_list(count)) {
+        return nullptr;
+    }
+    return &m_sta_list[m_sta_list_idx__ - count];
+}
+
 void tlvUnassociatedStaLinkMetricsResponse::class_swap()
 {
     tlvf_swap(16, reinterpret_cast<uint8_t*>(m_length));
-    for (size_t i = 0; i < m_sta_list_idx__; i++){
-        m_sta_list[i].struct_swap();
-    }
+    tlvf_swap_array(m_sta_list, m_sta_list_idx__);
 }
 
 bool tlvUnassociatedStaLinkMetricsResponse::finalize()
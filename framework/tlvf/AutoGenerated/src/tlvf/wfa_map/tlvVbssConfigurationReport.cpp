@@ -72,7 +72,7 @@ std::shared_ptr<cVbssRadioInfo> VbssConfigurationReport::create_radio_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cVbssRadioInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -266,7 +266,7 @@ std::shared_ptr<cVbssBssInfo> cVbssRadioInfo::create_bss_list() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cVbssBssInfo>(src, getBuffRemainingBytes(src), m_parse__);
@@ -451,7 +451,7 @@ bool cVbssBssInfo::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_ssid_idx__ += count;
@@ -96,7 +96,7 @@ bool VirtualBssCreation::alloc_ssid(size_t count) {
     uint8_t *src = (uint8_t *)&m_ssid[*m_ssid_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_authentication_type = (uint16_t *)((uint8_t *)(m_authentication_type) + len);
@@ -181,7 +181,7 @@ bool VirtualBssCreation::alloc_pass(size_t count) {
     uint8_t *src = (uint8_t *)&m_pass[*m_pass_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_encryption_oui = (uint8_t *)((uint8_t *)(m_encryption_oui) + len);
@@ -283,7 +283,7 @@ bool VirtualBssCreation::alloc_dpp_connector(size_t count) {
     uint8_t *src = (uint8_t *)&m_dpp_connector[*m_dpp_connector_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_client_mac = (sMacAddr *)((uint8_t *)(m_client_mac) + len);
@@ -353,7 +353,7 @@ bool VirtualBssCreation::alloc_ptk(size_t count) {
     uint8_t *src = (uint8_t *)&m_ptk[*m_key_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_tx_pn_length = (uint16_t *)((uint8_t *)(m_tx_pn_length) + len);
@@ -411,7 +411,7 @@ bool VirtualBssCreation::alloc_tx_packet_num(size_t count) {
     uint8_t *src = (uint8_t *)&m_tx_packet_num[*m_tx_pn_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_group_key_length = (uint16_t *)((uint8_t *)(m_group_key_length) + len);
@@ -467,7 +467,7 @@ bool VirtualBssCreation::alloc_gtk(size_t count) {
     uint8_t *src = (uint8_t *)&m_gtk[*m_group_key_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_group_tx_pn_length = (uint16_t *)((uint8_t *)(m_group_tx_pn_length) + len);
@@ -521,7 +521,7 @@ bool VirtualBssCreation::alloc_group_tx_packet_num(size_t count) {
     uint8_t *src = (uint8_t *)&m_group_tx_packet_num[*m_group_tx_pn_length];
     uint8_t *dst = src + len;
     if (!m_parse__) {
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_group_tx_packet_num_idx__ += count;
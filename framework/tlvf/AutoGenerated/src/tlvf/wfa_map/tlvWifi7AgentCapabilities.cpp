@@ -100,7 +100,7 @@ std::shared_ptr<cRadioWifi7Capabilities> tlvWifi7AgentCapabilities::create_radio
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadioWifi7Capabilities>(src, getBuffRemainingBytes(src), m_parse__);
@@ -344,7 +344,7 @@ std::shared_ptr<cWifi7Capabilities> cRadioWifi7Capabilities::create_ap_wifi7_cap
     uint8_t *src = (uint8_t *)m_ap_wifi7_capabilities;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_bsta_wifi7_capabilities = (cWifi7Capabilities *)((uint8_t *)(m_bsta_wifi7_capabilities) + len);
@@ -400,7 +400,7 @@ std::shared_ptr<cWifi7Capabilities> cRadioWifi7Capabilities::create_bsta_wifi7_c
     uint8_t *src = (uint8_t *)m_bsta_wifi7_capabilities;
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cWifi7Capabilities>(src, getBuffRemainingBytes(src), m_parse__);
@@ -588,7 +588,7 @@ std::shared_ptr<cRadioConfig> cWifi7Capabilities::create_str_config() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_num_nstr_records = (uint8_t *)((uint8_t *)(m_num_nstr_records) + len);
@@ -674,7 +674,7 @@ std::shared_ptr<cRadioConfig> cWifi7Capabilities::create_nstr_config() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_num_emlsr_records = (uint8_t *)((uint8_t *)(m_num_emlsr_records) + len);
@@ -756,7 +756,7 @@ std::shared_ptr<cRadioConfig> cWifi7Capabilities::create_emlsr_config() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     m_num_emlmr_records = (uint8_t *)((uint8_t *)(m_num_emlmr_records) + len);
@@ -834,7 +834,7 @@ std::shared_ptr<cRadioConfig> cWifi7Capabilities::create_emlmr_config() {
     }
     if (!m_parse__) {
         uint8_t *dst = src + len;
-        size_t move_length = getBuffRemainingBytes(src) - len;
+        size_t move_length = getBuffMoveLength(src, len);
         std::copy_n(src, move_length, dst);
     }
     return std::make_shared<cRadioConfig>(src, getBuffRemainingBytes(src), m_parse__);
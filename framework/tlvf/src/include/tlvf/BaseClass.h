@@ -27,12 +27,32 @@ public:
     uint8_t *getStartBuffPtr();
     size_t getBuffRemainingBytes(void *start = nullptr);
     bool buffPtrIncrementSafe(size_t length);
+    /**
+     * @brief Get the number of bytes to move to make room for `length` bytes at `start`
+     *
+     * Without knowing what follows the class in the buffer, all the remaining bytes are moved.
+     * If the class is the last one in its buffer, only the bytes up to its end are.
+     */
+    size_t getBuffMoveLength(void *start, size_t length);
+    /**
+     * @brief Mark the class as the last one in its buffer (i.e. the bytes after it are unused)
+     */
+    void setLastInBuff(bool last) { m_last_in_buff__ = last; }
 
     size_t getLen();
     bool isInitialized();
     virtual bool isPostInitSucceeded() { return true; };
     virtual void class_swap() = 0;
     virtual bool finalize()   = 0;
+    /**
+     * @brief Get the type id of the class
+     *
+     * Generated classes hide it with their own non-zero id, which ClassList uses to look them
+     * up. Classes keeping the id 0 are looked up with dynamic_pointer_cast instead.
+     *
+     * @return the type id, or 0 if the class has none.
+     */
+    static constexpr uint64_t get_class_type_id() { return 0; }
     bool is_finalized() { return m_finalized__; };
     void addInnerClassList(std::shared_ptr<ClassList> list) { m_inner__ = list; };
     std::shared_ptr<ClassList> getInnerClassList() { return m_inner__; };
@@ -62,6 +82,7 @@ protected:
     const bool m_parse__;
     bool m_finalized__    = false;
     bool m_init_succeeded = false;
+    bool m_last_in_buff__ = false;
     std::shared_ptr<ClassList> m_inner__;
 };
 
@@ -0,0 +1,96 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _ClassArena_H_
+#define _ClassArena_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Bump allocator for the class objects of a ClassList.
+ *
+ * Memory is carved out of a chunk by moving a pointer, and reset() rewinds it in O(1) so that the
+ * objects of the next message reuse the same chunk. When the chunk is full, a larger one replaces
+ * it.
+ *
+ * The objects are owned by std::shared_ptr, which may outlive the message (e.g. a handler keeps a
+ * TLV around). Each chunk therefore counts its live allocations. A chunk still in use when it is
+ * replaced, when the arena is reset or when the arena is destroyed is detached instead of reused,
+ * and is freed by the last deallocate() from it.
+ *
+ * Not thread safe: the objects must be released on the thread using the arena.
+ */
+class ClassArena {
+public:
+    explicit ClassArena(size_t chunk_size = kDefaultChunkSize) : m_chunk_size(chunk_size) {}
+    ~ClassArena();
+
+    /**
+     * Copying a ClassList does not share its arena: the copy starts with an empty one, and the
+     * objects shared by both lists keep their chunk alive.
+     */
+    ClassArena(const ClassArena &other) : m_chunk_size(other.m_chunk_size) {}
+    ClassArena &operator=(const ClassArena &) = delete;
+
+    void *allocate(size_t size);
+    static void deallocate(void *ptr);
+
+    /**
+     * @brief Make the whole current chunk available again.
+     */
+    void reset();
+
+    static constexpr size_t kDefaultChunkSize = 4096;
+
+private:
+    struct sChunk {
+        size_t size;
+        size_t used;
+        size_t live;
+        bool detached;
+    };
+
+    static void detach(sChunk *chunk);
+
+    size_t m_chunk_size;
+    sChunk *m_chunk = nullptr;
+};
+
+/**
+ * @brief Allocator for std::allocate_shared, allocating from a ClassArena.
+ */
+template <class T> class ClassArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ClassArenaAllocator(ClassArena &arena) : m_arena(&arena) {}
+    template <class U>
+    ClassArenaAllocator(const ClassArenaAllocator<U> &other) : m_arena(other.m_arena)
+    {
+    }
+
+    T *allocate(size_t n) { return static_cast<T *>(m_arena->allocate(n * sizeof(T))); }
+    void deallocate(T *ptr, size_t) { ClassArena::deallocate(ptr); }
+
+    template <class U> bool operator==(const ClassArenaAllocator<U> &other) const
+    {
+        return m_arena == other.m_arena;
+    }
+    template <class U> bool operator!=(const ClassArenaAllocator<U> &other) const
+    {
+        return m_arena != other.m_arena;
+    }
+
+private:
+    template <class U> friend class ClassArenaAllocator;
+
+    ClassArena *m_arena;
+};
+
+#endif //_ClassArena_H_
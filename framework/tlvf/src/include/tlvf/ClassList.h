@@ -12,6 +12,8 @@
 #include <list>
 #include <memory>
 #include <tlvf/BaseClass.h>
+#include <tlvf/ClassArena.h>
+#include <unordered_map>
 #include <vector>
 
 class ClassList {
@@ -30,27 +32,42 @@ public:
      * sanity checks, etc, and it is not allowed to update previousely the
      * class after addClass is called for the next class.
      *
+     * The class is allocated from the ClassList arena, which is rewound on reset().
+     *
      * @tparam T class template type
      * @return std::shared_ptr<T> newly allocated class
      */
     template <class T> std::shared_ptr<T> addClass()
     {
         std::shared_ptr<T> ptr;
+        ClassArenaAllocator<T> allocator(m_arena);
         auto prev = m_class_vector.empty() ? nullptr : m_class_vector.back();
         if (!prev) {
-            ptr = std::make_shared<T>(m_buff, m_buff_len, m_parse);
+            ptr = std::allocate_shared<T>(allocator, m_buff, m_buff_len, m_parse);
         } else {
             // before adding a new class, finalize the previous one
             if (!m_parse) {
                 if (!prev->finalize())
                     return nullptr;
             }
-            ptr = std::make_shared<T>(prev, m_parse);
+            ptr = std::allocate_shared<T>(allocator, prev, m_parse);
         }
         if (!ptr || ptr->isInitialized() == false) {
             return nullptr;
         }
 
+        // Nothing is written after the class being built, so its lists can grow without moving
+        // the rest of the buffer
+        if (!m_parse) {
+            if (prev) {
+                prev->setLastInBuff(false);
+            }
+            ptr->setLastInBuff(true);
+        }
+
+        if (T::get_class_type_id()) {
+            m_class_index[T::get_class_type_id()].push_back(m_class_vector.size());
+        }
         m_class_vector.push_back(ptr);
         return ptr;
     }
@@ -73,6 +90,14 @@ public:
      */
     template <class T> std::shared_ptr<T> getClass(size_t idx) const
     {
+        if (T::get_class_type_id()) {
+            auto it = m_class_index.find(T::get_class_type_id());
+            if (it == m_class_index.end() || idx >= it->second.size()) {
+                return nullptr;
+            }
+            return std::static_pointer_cast<T>(m_class_vector[it->second[idx]]);
+        }
+
         size_t idx_ = 0;
         for (const auto &it : m_class_vector) {
             if (auto c = std::dynamic_pointer_cast<T>(it)) {
@@ -92,6 +117,16 @@ public:
     template <class T> std::list<std::shared_ptr<T>> getClassList() const
     {
         std::list<std::shared_ptr<T>> list;
+        if (T::get_class_type_id()) {
+            auto it = m_class_index.find(T::get_class_type_id());
+            if (it != m_class_index.end()) {
+                for (auto pos : it->second) {
+                    list.push_back(std::static_pointer_cast<T>(m_class_vector[pos]));
+                }
+            }
+            return list;
+        }
+
         for (const auto &it : m_class_vector) {
             if (auto c = std::dynamic_pointer_cast<T>(it)) {
                 list.push_back(std::move(c));
@@ -120,15 +155,22 @@ public:
     bool is_swapped() const { return m_swapped; };
     bool finalize();
     void reset(bool parse);
+    /**
+     * @brief Reset the list and move it to another buffer.
+     */
+    void reset(uint8_t *buff, size_t buff_len, bool parse);
 
 protected:
-    uint8_t *const m_buff;
+    uint8_t *m_buff;
     size_t m_buff_len;
 
     bool m_parse     = false;
     bool m_finalized = false;
     bool m_swapped   = false;
     std::vector<std::shared_ptr<BaseClass>> m_class_vector;
+    // Positions in m_class_vector of the classes of each type id, in order of addition
+    std::unordered_map<uint64_t, std::vector<size_t>> m_class_index;
+    ClassArena m_arena;
 };
 
 #endif //_TlvList_H_
@@ -33,7 +33,7 @@ class CmduMessage {
 public:
     CmduMessage() = delete;
     CmduMessage(uint8_t *buff, size_t buff_len) : msg(buff, buff_len){};
-    ~CmduMessage(){};
+    virtual ~CmduMessage(){};
 
     std::shared_ptr<cCmduHeader> getCmduHeader() const { return msg.getClass<cCmduHeader>(); };
     static uint16_t getCmduHeaderLength() { return kCmduHeaderLength; }
@@ -41,11 +41,32 @@ public:
     uint16_t getMessageId();
     void setMessageId(uint16_t mid);
 
-    size_t getMessageLength() const { return msg.getMessageLength(); };
+    size_t getMessageLength() const
+    {
+        parsePendingTlvs();
+        return msg.getMessageLength();
+    };
     size_t getMessageBuffLength() const { return msg.getMessageBuffLength(); };
     uint8_t *getMessageBuff() const { return msg.getMessageBuff(); };
-    template <class T> std::shared_ptr<T> getClass() { return msg.getClass<T>(); }
-    void swap() { msg.swap(); };
+    template <class T> std::shared_ptr<T> getClass() const
+    {
+        auto c = msg.getClass<T>();
+        // TLVs parsed on demand are parsed in order until the first one of type T is found
+        while (!c && parsePendingTlv()) {
+            c = msg.getClass<T>();
+        }
+        return c;
+    }
+    template <class T> std::list<std::shared_ptr<T>> getClassList() const
+    {
+        parsePendingTlvs();
+        return msg.getClassList<T>();
+    };
+    void swap()
+    {
+        parsePendingTlvs();
+        msg.swap();
+    };
     bool is_finalized() const { return msg.is_finalized(); };
     bool is_swapped() const { return msg.is_swapped(); };
 
@@ -56,6 +77,21 @@ public:
     std::chrono::time_point<std::chrono::system_clock> received_time = {};
 
 protected:
+    /**
+     * @brief Parse the next TLV not parsed yet, for messages that parse their TLVs on demand.
+     *
+     * Getters use it to complete the parsing before looking at the classes, parsed classes being
+     * logically part of the message.
+     *
+     * @return true if a TLV was parsed and false if there is none left or parsing failed.
+     */
+    virtual bool parsePendingTlv() const { return false; }
+    void parsePendingTlvs() const
+    {
+        while (parsePendingTlv()) {
+        }
+    }
+
     ClassList msg;
 };
 
@@ -13,26 +13,100 @@
 #include <tlvf/vendor_example/eVendorExampleTlvTypeMap.h>
 #include <tlvf/wfa_map/eTlvTypeMap.h>
 
+#include <functional>
+#include <vector>
+
 namespace ieee1905_1 {
 
 class CmduMessageRx : public CmduMessage {
 
 public:
     CmduMessageRx() = delete;
-    CmduMessageRx(uint8_t *buff, size_t buff_len) : CmduMessage(buff, buff_len){};
-    ~CmduMessageRx(){};
-
-    // Forward wrapper functions
-    template <class T> std::shared_ptr<T> getClass() const { return msg.getClass<T>(); };
-    template <class T> std::list<std::shared_ptr<T>> getClassList() const
-    {
-        return msg.getClassList<T>();
-    };
+    CmduMessageRx(uint8_t *buff, size_t buff_len)
+        : CmduMessage(buff, buff_len), m_rx_buff(buff), m_rx_buff_len(buff_len){};
+    ~CmduMessageRx() override{};
+
+    /**
+     * @brief Function that verifies a TLV while the TLV chain is walked in lazy mode.
+     *
+     * It is given the TLV (header included, in network byte order) and its total length, and
+     * returns false if the TLV is invalid, which fails the parsing.
+     */
+    using TlvVerifier = std::function<bool(uint8_t *tlv, size_t length)>;
+
+    /**
+     * @brief Parse the CMDU in the buffer.
+     *
+     * In lazy mode, only the CMDU header is parsed up front. The TLV chain is walked once to
+     * check that it fits in the buffer and ends with an End of Message TLV, recording the offset
+     * and type of each TLV (and verifying each TLV with the given function, if any). The TLV
+     * classes are created (and their contents converted to host byte order) on demand, the first
+     * time getClass() needs them, so the TLVs a handler never reads are not touched.
+     * getClassList(), getMessageLength() and swap() parse all the remaining TLVs first.
+     *
+     * A TLV that fails to parse on demand stops the parsing: getClass() returns nullptr for it
+     * and for the TLVs after it, and hasParseError() tells it apart from a missing TLV.
+     *
+     * @param lazy Defer parsing the TLVs until they are accessed.
+     * @param verify_tlv Function that verifies each TLV in lazy mode, or nullptr.
+     * @return true on success and false otherwise.
+     */
+    bool parse(bool lazy = false, const TlvVerifier &verify_tlv = nullptr);
+
+    /**
+     * @brief Parse a CMDU in place, in a buffer other than the one given on construction.
+     *
+     * Saves copying a received CMDU to the message buffer when the buffer it was received in is
+     * left untouched while the message is handled. The classes point into that buffer, and
+     * getMessageBuff() returns it, until the next parse().
+     *
+     * @param buff Buffer holding the CMDU, converted to host byte order in place.
+     * @param length Length of the CMDU.
+     * @param lazy Defer parsing the TLVs until they are accessed.
+     * @param verify_tlv Function that verifies each TLV in lazy mode, or nullptr.
+     * @return true on success and false otherwise.
+     */
+    bool parse(uint8_t *buff, size_t length, bool lazy = false,
+               const TlvVerifier &verify_tlv = nullptr);
+
+    /**
+     * @brief Copy a CMDU to the buffer given on construction and parse it.
+     *
+     * @param data CMDU to parse.
+     * @param length Length of the CMDU.
+     * @param lazy Defer parsing the TLVs until they are accessed.
+     * @param verify_tlv Function that verifies each TLV in lazy mode, or nullptr.
+     * @return true on success and false otherwise (including if the CMDU does not fit).
+     */
+    bool parseCopy(const uint8_t *data, size_t length, bool lazy = false,
+                   const TlvVerifier &verify_tlv = nullptr);
+
+    /**
+     * @brief Check if parsing a TLV on demand failed (in lazy mode).
+     *
+     * @return true if a TLV failed to parse since the last parse() and false otherwise.
+     */
+    bool hasParseError() const { return m_parse_error; }
 
-    bool parse();
     CmduMessageRx &operator=(const CmduMessageRx &) = delete;
 
+protected:
+    bool parsePendingTlv() const override;
+
 private:
+    struct sTlvIndexEntry {
+        uint32_t offset;
+        uint8_t type;
+    };
+
+    /**
+     * @brief Walk the TLV chain following the CMDU header and fill in the TLV index.
+     *
+     * @param verify_tlv Function that verifies each TLV, or nullptr.
+     * @return true if the chain is well-formed and all its TLVs are verified, false otherwise.
+     */
+    bool indexTlvs(const TlvVerifier &verify_tlv);
+
     int getNextTlvType() const;
     uint16_t getNextTlvLength() const;
     /*
@@ -45,6 +119,17 @@ private:
     std::shared_ptr<BaseClass> parseNextTlv(ieee1905_1::eTlvType tlv_type);
     std::shared_ptr<BaseClass> parseNextTlv(wfa_map::eTlvTypeMap tlv_type);
     std::shared_ptr<BaseClass> parseNextTlv(vendor_example::eVendorExampleTlvTypeMap tlv_type);
+
+    // Buffer given on construction
+    uint8_t *const m_rx_buff;
+    const size_t m_rx_buff_len;
+
+    // Offset and type of every TLV in the received message, in lazy mode
+    std::vector<sTlvIndexEntry> m_tlv_index;
+    // Index of the next TLV to parse in m_tlv_index
+    size_t m_next_tlv = 0;
+    // Whether a TLV failed to parse in lazy mode
+    bool m_parse_error = false;
 };
 
 }; // namespace ieee1905_1
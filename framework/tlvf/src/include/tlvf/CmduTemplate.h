@@ -0,0 +1,85 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _CmduTemplate_H_
+#define _CmduTemplate_H_
+
+#include <tlvf/CmduMessageTx.h>
+#include <tlvf/swap.h>
+
+#include <type_traits>
+
+namespace ieee1905_1 {
+
+/**
+ * @brief CMDU built once and sent many times.
+ *
+ * Periodic messages carry the same TLVs on every send, and only a few of their fields change.
+ * A template is built once with the CmduMessageTx API (create(), addClass(), ...) and then
+ * frozen: freeze() finalizes it, which fixes the offset of every field and leaves the message in
+ * network byte order. Between two sends, the fields that changed are updated in place with
+ * set(), and the template is sent as is: its TLVs are neither initialized nor finalized again.
+ *
+ * The fields to update must be referenced while building the template, since the accessors of
+ * the generated classes read list lengths from the buffer, which is in network byte order once
+ * frozen. The elements of a list can be updated, but a frozen template cannot change its layout
+ * (e.g. grow a list or add a TLV): it must be built again, starting with create().
+ */
+class CmduTemplate : public CmduMessageTx {
+public:
+    CmduTemplate(uint8_t *buff, size_t buff_len) : CmduMessageTx(buff, buff_len) {}
+
+    /**
+     * @brief Finalize the template, after which it is only updated through set().
+     *
+     * @return true on success and false otherwise.
+     */
+    bool freeze() { return finalize(); }
+
+    /**
+     * @brief Whether the template was built and frozen since the last create().
+     */
+    bool is_frozen() const { return is_finalized(); }
+
+    /**
+     * @brief Set a field of the template.
+     *
+     * Once the template is frozen, the value is converted to network byte order before it is
+     * stored.
+     *
+     * @param field Reference to the field, taken while building the template.
+     * @param value Value to set, in host byte order.
+     */
+    template <class T>
+    typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type
+    set(T &field, T value) const
+    {
+        if (is_frozen()) {
+            tlvf_swap(sizeof(T) * 8, reinterpret_cast<uint8_t *>(&value));
+        }
+        field = value;
+    }
+
+    /**
+     * @brief Set a struct field (or list element) of the template.
+     *
+     * @see set()
+     */
+    template <class T>
+    typename std::enable_if<std::is_class<T>::value>::type set(T &field, T value) const
+    {
+        if (is_frozen()) {
+            value.struct_swap();
+        }
+        field = value;
+    }
+};
+
+}; // namespace ieee1905_1
+
+#endif //_CmduTemplate_H_
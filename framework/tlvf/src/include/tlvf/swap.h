@@ -15,8 +15,16 @@
 #endif
 
 #include <arpa/inet.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <vector>
+
+// Shuffling bytes by table lookup is only faster than swapping the fields one by one on NEON,
+// where a single instruction looks 16 bytes up in a 32 bytes table
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define TLVF_SWAP_SIMD 1
+#endif
 
 inline uint64_t htonll(uint64_t x)
 {
@@ -85,4 +93,97 @@ inline void tlvf_swap(uint8_t size, int8_t *ptr)
     }
 }
 
+/**
+ * @brief Byte permutation done by the struct_swap() of a packed struct, applied to whole arrays
+ *
+ * The permutation is recorded by calling struct_swap() on a record whose bytes hold their own
+ * offset, so it follows the struct layout without the generator having to compute it. An array
+ * of records is then swapped 16 bytes at a time: since a swapped field is at most 8 bytes long,
+ * each 16 bytes block of the result is made of the bytes of the block and of the 8 bytes around
+ * it, gathered with a byte table lookup (NEON tbl). The blocks repeat every
+ * lcm(record size, 16) bytes, so their lookup indexes are built once per block of that period.
+ */
+class tlvf_swap_pattern {
+public:
+    template <class T> static const tlvf_swap_pattern &get()
+    {
+        static const tlvf_swap_pattern pattern(record_permutation<T>());
+        return pattern;
+    }
+
+    /**
+     * @brief Whether struct_swap() leaves the record unchanged (e.g. no multi-byte field, or a
+     * big endian host)
+     */
+    bool is_identity() const { return m_identity; }
+
+    /**
+     * @brief Whether the records can be swapped by blocks (i.e. the record is not too large)
+     */
+    bool is_supported() const { return !m_blocks.empty(); }
+
+    /**
+     * @brief Swap `count` records starting at `data`
+     *
+     * Must only be called if is_supported(). Uses the table lookup instruction when available,
+     * and otherwise looks the bytes up one at a time.
+     */
+    void apply(uint8_t *data, size_t count) const;
+
+    // Larger records are left to struct_swap()
+    static constexpr size_t kMaxRecordSize = 64;
+
+private:
+    template <class T> static std::vector<uint8_t> record_permutation()
+    {
+        if (sizeof(T) > kMaxRecordSize) {
+            return {};
+        }
+        uint8_t record[sizeof(T)];
+        for (size_t i = 0; i < sizeof(T); i++) {
+            record[i] = i;
+        }
+        reinterpret_cast<T *>(record)->struct_swap();
+        return std::vector<uint8_t>(record, record + sizeof(T));
+    }
+
+    explicit tlvf_swap_pattern(const std::vector<uint8_t> &permutation);
+
+    /**
+     * Table lookup indexes of the bytes of a block, among the 32 bytes starting 8 bytes before
+     * the block.
+     */
+    struct sBlockMasks {
+        uint8_t index[16];
+    };
+
+    // Source offset in the record of each byte of the swapped record
+    std::vector<uint8_t> m_permutation;
+    bool m_identity = true;
+    std::vector<sBlockMasks> m_blocks;
+};
+
+/**
+ * @brief Swap an array of packed structs
+ *
+ * Same as calling struct_swap() on each of the `count` records, but permutes 16 bytes at a time
+ * when the table lookup instruction is available.
+ */
+template <class T> inline void tlvf_swap_array(T *array, size_t count)
+{
+#ifdef TLVF_SWAP_SIMD
+    const auto &pattern = tlvf_swap_pattern::get<T>();
+    if (pattern.is_identity()) {
+        return;
+    }
+    if (pattern.is_supported()) {
+        pattern.apply(reinterpret_cast<uint8_t *>(array), count);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; i++) {
+        array[i].struct_swap();
+    }
+}
+
 #endif
@@ -23,6 +23,14 @@ size_t BaseClass::getBuffRemainingBytes(void *start)
             (size_t)(((uint8_t *)(start ? start : m_buff_ptr__)) - ((uint8_t *)m_buff__)));
 }
 
+size_t BaseClass::getBuffMoveLength(void *start, size_t length)
+{
+    if (m_last_in_buff__) {
+        return (size_t)(m_buff_ptr__ - (uint8_t *)start);
+    }
+    return getBuffRemainingBytes(start) - length;
+}
+
 size_t BaseClass::getLen() { return (size_t)((uint8_t *)m_buff_ptr__ - (uint8_t *)m_buff__); }
 
 bool BaseClass::isInitialized() { return m_init_succeeded; }
@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <tlvf/ClassArena.h>
+
+#include <algorithm>
+#include <new>
+
+// Allocations are aligned like malloc() ones, and start with a pointer to their chunk
+static constexpr size_t kAlignment  = alignof(std::max_align_t);
+static constexpr size_t kHeaderSize = kAlignment;
+
+static constexpr size_t align(size_t size) { return (size + kAlignment - 1) & ~(kAlignment - 1); }
+
+// Declaration of static members
+constexpr size_t ClassArena::kDefaultChunkSize;
+
+ClassArena::~ClassArena() { detach(m_chunk); }
+
+void *ClassArena::allocate(size_t size)
+{
+    constexpr size_t chunk_header = align(sizeof(sChunk));
+    size                          = kHeaderSize + align(size);
+
+    if (!m_chunk || m_chunk->used + size > m_chunk->size) {
+        // Grow geometrically so that a message needs a single chunk once the arena warmed up
+        size_t chunk_size = m_chunk ? 2 * m_chunk->size : m_chunk_size;
+        chunk_size        = std::max(chunk_size, size);
+
+        detach(m_chunk);
+        m_chunk           = static_cast<sChunk *>(::operator new(chunk_header + chunk_size));
+        m_chunk->size     = chunk_size;
+        m_chunk->used     = 0;
+        m_chunk->live     = 0;
+        m_chunk->detached = false;
+    }
+
+    uint8_t *block = reinterpret_cast<uint8_t *>(m_chunk) + chunk_header + m_chunk->used;
+
+    // Remember the chunk of the allocation for deallocate()
+    *reinterpret_cast<sChunk **>(block) = m_chunk;
+    m_chunk->used += size;
+    m_chunk->live++;
+
+    return block + kHeaderSize;
+}
+
+void ClassArena::deallocate(void *ptr)
+{
+    auto chunk = *reinterpret_cast<sChunk **>(static_cast<uint8_t *>(ptr) - kHeaderSize);
+    if (--chunk->live == 0 && chunk->detached) {
+        ::operator delete(chunk);
+    }
+}
+
+void ClassArena::reset()
+{
+    if (!m_chunk) {
+        return;
+    }
+
+    if (m_chunk->live == 0) {
+        m_chunk->used = 0;
+        return;
+    }
+
+    // Some objects are still referenced, leave the chunk to them and start over with a new one
+    // of the same size on next allocation
+    m_chunk_size = m_chunk->size;
+    detach(m_chunk);
+    m_chunk = nullptr;
+}
+
+void ClassArena::detach(sChunk *chunk)
+{
+    if (!chunk) {
+        return;
+    }
+
+    if (chunk->live == 0) {
+        ::operator delete(chunk);
+    } else {
+        chunk->detached = true;
+    }
+}
@@ -52,6 +52,15 @@ void ClassList::reset(bool parse)
         c.reset();
     }
     m_class_vector.clear();
+    m_class_index.clear();
+    m_arena.reset();
+}
+
+void ClassList::reset(uint8_t *buff, size_t buff_len, bool parse)
+{
+    m_buff     = buff;
+    m_buff_len = buff_len;
+    reset(parse);
 }
 
 bool ClassList::finalize()
@@ -146,6 +146,8 @@
 #include <tlvf/wfa_map/tlvVirtualBssEvent.h>
 #include <tlvf/wfa_map/tlvWifi7AgentCapabilities.h>
 
+#include <algorithm>
+
 using namespace ieee1905_1;
 
 int CmduMessageRx::getNextTlvType() const
@@ -651,13 +653,106 @@ std::shared_ptr<BaseClass> CmduMessageRx::parseNextTlv()
     }
 }
 
-bool CmduMessageRx::parse()
+bool CmduMessageRx::indexTlvs(const TlvVerifier &verify_tlv)
+{
+    uint8_t *buff      = msg.getMessageBuff();
+    size_t buff_length = msg.getMessageBuffLength();
+    size_t offset      = msg.prevClass()->getBuffPtr() - buff;
+
+    while (offset + kTlvHeaderLength <= buff_length) {
+        auto tlv            = reinterpret_cast<sTlvHeader *>(buff + offset);
+        uint16_t tlv_length = tlv->length;
+        swap_16(tlv_length);
+
+        if (offset + kTlvHeaderLength + tlv_length > buff_length) {
+            LOG(ERROR) << "TLV of type " << int(tlv->type) << " at offset " << offset
+                       << " has length " << tlv_length << " exceeding the buffer length "
+                       << buff_length;
+            return false;
+        }
+        if (verify_tlv && !verify_tlv(buff + offset, kTlvHeaderLength + tlv_length)) {
+            LOG(ERROR) << "Failed verifying TLV of type " << int(tlv->type) << " at offset "
+                       << offset;
+            return false;
+        }
+        m_tlv_index.push_back({static_cast<uint32_t>(offset), tlv->type});
+
+        if (tlv->type == uint8_t(eTlvType::TLV_END_OF_MESSAGE)) {
+            if (tlv_length != 0) {
+                LOG(ERROR) << "End of Message TLV has length " << tlv_length;
+                return false;
+            }
+            return true;
+        }
+        offset += kTlvHeaderLength + tlv_length;
+    }
+
+    LOG(ERROR) << "End of Message TLV not found";
+    return false;
+}
+
+bool CmduMessageRx::parsePendingTlv() const
+{
+    if (m_next_tlv >= m_tlv_index.size()) {
+        return false;
+    }
+
+    auto self         = const_cast<CmduMessageRx *>(this);
+    const auto &entry = m_tlv_index[m_next_tlv];
+
+    // TLV classes are added right after the previous one, which must end where the TLV starts
+    if (msg.prevClass()->getBuffPtr() != msg.getMessageBuff() + entry.offset) {
+        LOG(ERROR) << "Previous TLV does not end at offset " << entry.offset
+                   << " where the TLV of type " << int(entry.type) << " starts";
+        self->m_next_tlv    = m_tlv_index.size();
+        self->m_parse_error = true;
+        return false;
+    }
+
+    if (!self->parseNextTlv()) {
+        LOG(ERROR) << "Failed parsing TLV of type " << int(entry.type) << " at offset "
+                   << entry.offset;
+        self->m_next_tlv    = m_tlv_index.size();
+        self->m_parse_error = true;
+        return false;
+    }
+
+    self->m_next_tlv++;
+    return true;
+}
+
+bool CmduMessageRx::parse(bool lazy, const TlvVerifier &verify_tlv)
 {
-    msg.reset(true);
+    return parse(m_rx_buff, m_rx_buff_len, lazy, verify_tlv);
+}
+
+bool CmduMessageRx::parseCopy(const uint8_t *data, size_t length, bool lazy,
+                              const TlvVerifier &verify_tlv)
+{
+    if (length > m_rx_buff_len) {
+        LOG(ERROR) << "CMDU length (" << length << ") is greater than CMDU buffer size ("
+                   << m_rx_buff_len << ")";
+        return false;
+    }
+    std::copy_n(data, length, m_rx_buff);
+    return parse(m_rx_buff, length, lazy, verify_tlv);
+}
+
+bool CmduMessageRx::parse(uint8_t *buff, size_t length, bool lazy, const TlvVerifier &verify_tlv)
+{
+    msg.reset(buff, length, true);
+    m_tlv_index.clear();
+    m_next_tlv    = 0;
+    m_parse_error = false;
+
     auto cmduhdr = msg.addClass<cCmduHeader>();
     if (!cmduhdr)
         return false;
 
+    if (lazy) {
+        return indexTlvs(verify_tlv);
+    }
+
     while (auto tlv = parseNextTlv()) {
         if (std::dynamic_pointer_cast<tlvEndOfMessage>(tlv)) {
             return true;
@@ -75,6 +75,10 @@ std::shared_ptr<tlvVendorSpecific> CmduMessageTx::add_vs_tlv(tlvVendorSpecific::
 
 bool CmduMessageTx::finalize()
 {
+    // Already finalized (e.g. a CmduTemplate sent again), do not add another End of Message TLV
+    if (msg.is_finalized()) {
+        return true;
+    }
     if (!addClass<tlvEndOfMessage>())
         return false;
     return msg.finalize();
@@ -0,0 +1,121 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <tlvf/swap.h>
+
+#include <algorithm>
+
+#ifdef TLVF_SWAP_SIMD
+#include <arm_neon.h>
+#endif
+
+static constexpr size_t kBlockSize = 16;
+
+// Declaration of static members
+constexpr size_t tlvf_swap_pattern::kMaxRecordSize;
+
+tlvf_swap_pattern::tlvf_swap_pattern(const std::vector<uint8_t> &permutation)
+    : m_permutation(permutation)
+{
+    size_t record_size = m_permutation.size();
+    if (record_size == 0) {
+        // Record too large, left to struct_swap()
+        m_identity = false;
+        return;
+    }
+    for (size_t i = 0; i < record_size; i++) {
+        if (m_permutation[i] != i) {
+            m_identity = false;
+        }
+        // A byte may only come from the 8 bytes around it
+        if (m_permutation[i] + kBlockSize / 2 < i || m_permutation[i] >= i + kBlockSize / 2) {
+            return;
+        }
+    }
+    if (m_identity) {
+        return;
+    }
+
+    // Blocks repeat once a record starts at the start of a block again
+    size_t period = record_size;
+    while (period % kBlockSize) {
+        period += record_size;
+    }
+
+    m_blocks.resize(period / kBlockSize);
+    for (size_t block = 0; block < m_blocks.size(); block++) {
+        auto &masks        = m_blocks[block];
+        size_t block_start = block * kBlockSize;
+        for (size_t i = 0; i < kBlockSize; i++) {
+            size_t offset        = block_start + i;
+            size_t record_offset = offset % record_size;
+            size_t source        = offset - record_offset + m_permutation[record_offset];
+
+            // Offset of the source byte in the 32 bytes starting 8 bytes before the block
+            masks.index[i] = source + kBlockSize / 2 - block_start;
+        }
+    }
+}
+
+void tlvf_swap_pattern::apply(uint8_t *data, size_t count) const
+{
+    size_t record_size = m_permutation.size();
+    size_t length      = count * record_size;
+
+    // Each block is built from the 8 bytes before it and the 8 bytes after it, which must be
+    // loaded in full
+    size_t blocks = length > kBlockSize / 2 ? (length - kBlockSize / 2) / kBlockSize : 0;
+    size_t pos    = blocks * kBlockSize;
+
+    // The bytes after the blocks are swapped one at a time, before the blocks are stored over
+    // the start of their record
+    uint8_t tail[2 * kBlockSize + kMaxRecordSize];
+    size_t tail_start = pos - pos % record_size;
+    for (size_t i = tail_start; i < length; i++) {
+        size_t record_offset = i % record_size;
+        tail[i - tail_start] = data[i - record_offset + m_permutation[record_offset]];
+    }
+
+    if (blocks) {
+        // Kept in locals, as the stores to data could alias the members
+        const sBlockMasks *masks_begin = m_blocks.data();
+        const sBlockMasks *masks_end   = masks_begin + m_blocks.size();
+        const sBlockMasks *masks_it    = masks_begin;
+
+        // The bytes around the current block. The first block has no bytes before it, so these
+        // are padding that is never selected. Loading bytes of a block just stored would stall on
+        // the store, so each block is stored only after the bytes it shares with the next one
+        // are loaded.
+#ifdef TLVF_SWAP_SIMD
+        uint8x16x2_t bytes;
+        bytes.val[0] = vcombine_u8(vdup_n_u8(0), vld1_u8(data));
+#else
+        uint8_t bytes[2 * kBlockSize] = {};
+        std::copy_n(data, kBlockSize / 2, bytes + kBlockSize / 2);
+#endif
+        for (size_t block = 0; block < blocks; block++) {
+            uint8_t *block_data = data + block * kBlockSize;
+#ifdef TLVF_SWAP_SIMD
+            bytes.val[1] = vld1q_u8(block_data + kBlockSize / 2);
+            vst1q_u8(block_data, vqtbl2q_u8(bytes, vld1q_u8(masks_it->index)));
+            bytes.val[0] = bytes.val[1];
+#else
+            std::copy_n(block_data + kBlockSize / 2, kBlockSize, bytes + kBlockSize);
+            for (size_t i = 0; i < kBlockSize; i++) {
+                block_data[i] = bytes[masks_it->index[i]];
+            }
+            std::copy_n(bytes + kBlockSize, kBlockSize, bytes);
+#endif
+            if (++masks_it == masks_end) {
+                masks_it = masks_begin;
+            }
+        }
+    }
+
+    std::copy(tail + pos - tail_start, tail + length - tail_start, data + pos);
+}
@@ -0,0 +1,306 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/**
+ * tlvf round-trip benchmark driver.
+ *
+ * For each class registered by the generated code (see tlvf_bench.h), the class is built in a
+ * ClassList, finalized, swapped back and forth, parsed and read back, and the time and the bytes
+ * allocated per operation are reported for each of these steps. The values read back from the
+ * parsed class are checked against the ones read from the built class.
+ *
+ * The results are printed as a table, and optionally written as JSON (-j) so that runs before and
+ * after a change of the generator can be compared.
+ */
+
+#include "tlvf_bench.h"
+
+#include <mapf/common/logger.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <unistd.h>
+
+size_t tlvf_bench::list_size = 8;
+
+static std::atomic<size_t> allocated_bytes(0);
+
+void *operator new(size_t size)
+{
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    auto ptr = malloc(size);
+    if (!ptr) {
+        abort();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept { free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+
+enum eStep { BUILD, FINALIZE, SWAP, PARSE, READ, STEPS_COUNT };
+// Enum AutoPrint generated code snippet begining- DON'T EDIT!
+// clang-format off
+const char *eStep_str(eStep enum_value) {
+    switch (enum_value) {
+    case BUILD:       return "BUILD";
+    case FINALIZE:    return "FINALIZE";
+    case SWAP:        return "SWAP";
+    case PARSE:       return "PARSE";
+    case READ:        return "READ";
+    case STEPS_COUNT: return "STEPS_COUNT";
+    }
+    static std::string out_str = std::to_string(int(enum_value));
+    return out_str.c_str();
+}
+std::ostream &operator<<(std::ostream &out, eStep value) { return out << eStep_str(value); }
+// clang-format on
+// Enum AutoPrint generated code snippet end
+
+static const char *step_names[STEPS_COUNT] = {"build", "finalize", "swap", "parse", "read"};
+
+struct sResult {
+    const char *name;
+    const char *error = nullptr;
+    size_t length     = 0;
+    double ns[STEPS_COUNT]{};
+    double bytes[STEPS_COUNT]{};
+};
+
+class StepTimer {
+public:
+    explicit StepTimer(sResult &result) : m_result(result) {}
+
+    void start()
+    {
+        m_bytes = allocated_bytes.load(std::memory_order_relaxed);
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    void stop(eStep step)
+    {
+        auto end = std::chrono::steady_clock::now();
+        m_result.ns[step] += std::chrono::duration<double, std::nano>(end - m_start).count();
+        m_result.bytes[step] += allocated_bytes.load(std::memory_order_relaxed) - m_bytes;
+    }
+
+private:
+    sResult &m_result;
+    std::chrono::steady_clock::time_point m_start;
+    size_t m_bytes = 0;
+};
+
+/**
+ * Size of the buffer the message length is found with. The runs then use a buffer of the size of
+ * the message, so that resetting it does not cost more than the message itself.
+ */
+static constexpr size_t MAX_MESSAGE_LENGTH = UINT16_MAX;
+
+static bool run(const tlvf_bench::sBenchmark &bench, int iterations, sResult &result)
+{
+    std::vector<uint8_t> buffer(MAX_MESSAGE_LENGTH);
+
+    // Build once to find the message length, and the values to read back
+    uint64_t expected = 0;
+    {
+        ClassList tx(buffer.data(), buffer.size());
+        if (!bench.build(tx)) {
+            result.error = "build failed";
+            return false;
+        }
+        bench.read(tx, expected);
+        if (!tx.finalize()) {
+            result.error = "finalize failed";
+            return false;
+        }
+        result.length = tx.getMessageLength();
+    }
+
+    ClassList tx(buffer.data(), result.length);
+    ClassList rx(buffer.data(), result.length, true);
+    StepTimer timer(result);
+    for (int i = 0; i < iterations; i++) {
+        tx.reset(false);
+
+        timer.start();
+        bool built = bench.build(tx);
+        timer.stop(BUILD);
+        if (!built) {
+            result.error = "build failed";
+            return false;
+        }
+
+        timer.start();
+        bool finalized = tx.finalize();
+        timer.stop(FINALIZE);
+        if (!finalized) {
+            result.error = "finalize failed";
+            return false;
+        }
+
+        // Back to host byte order and to network byte order again
+        timer.start();
+        tx.swap();
+        tx.swap();
+        timer.stop(SWAP);
+
+        rx.reset(true);
+        timer.start();
+        bool parsed = bench.parse(rx);
+        timer.stop(PARSE);
+        if (!parsed) {
+            result.error = "parse failed";
+            return false;
+        }
+
+        uint64_t sink = 0;
+        timer.start();
+        bench.read(rx, sink);
+        timer.stop(READ);
+        if (sink != expected) {
+            result.error = "parsed values differ from the built ones";
+            return false;
+        }
+    }
+
+    for (int step = 0; step < STEPS_COUNT; step++) {
+        result.ns[step] /= iterations;
+        result.bytes[step] /= iterations;
+    }
+    // Two swaps per iteration
+    result.ns[SWAP] /= 2;
+    result.bytes[SWAP] /= 2;
+    return true;
+}
+
+static void print_table(const std::vector<sResult> &results)
+{
+    std::cout << std::left << std::setw(56) << "class" << std::right << std::setw(7) << "length";
+    for (auto name : step_names) {
+        std::cout << std::setw(12) << (std::string(name) + " ns");
+    }
+    std::cout << std::setw(12) << "alloc bytes" << std::endl;
+
+    std::cout << std::fixed << std::setprecision(0);
+    for (const auto &result : results) {
+        std::cout << std::left << std::setw(56) << result.name << std::right;
+        if (result.error) {
+            std::cout << "  " << result.error << std::endl;
+            continue;
+        }
+        std::cout << std::setw(7) << result.length;
+        double bytes = 0;
+        for (int step = 0; step < STEPS_COUNT; step++) {
+            std::cout << std::setw(12) << result.ns[step];
+            bytes += result.bytes[step];
+        }
+        std::cout << std::setw(12) << bytes << std::endl;
+    }
+}
+
+static void write_json(std::ostream &out, const std::vector<sResult> &results, int iterations)
+{
+    out << "{\n"
+        << "  \"iterations\": " << iterations << ",\n"
+        << "  \"list_size\": " << tlvf_bench::list_size << ",\n"
+        << "  \"benchmarks\": [";
+    out << std::fixed << std::setprecision(1);
+    const char *separator = "\n";
+    for (const auto &result : results) {
+        out << separator << "    {\"name\": \"" << result.name << "\"";
+        separator = ",\n";
+        if (result.error) {
+            out << ", \"error\": \"" << result.error << "\"}";
+            continue;
+        }
+        out << ", \"length\": " << result.length;
+        for (int step = 0; step < STEPS_COUNT; step++) {
+            out << ", \"" << step_names[step] << "_ns\": " << result.ns[step];
+        }
+        for (int step = 0; step < STEPS_COUNT; step++) {
+            out << ", \"" << step_names[step] << "_bytes\": " << result.bytes[step];
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    int iterations = 1000;
+    std::string filter;
+    std::string json_path;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:f:j:")) != -1) {
+        switch (opt) {
+        case 'n':
+            iterations = atoi(optarg);
+            break;
+        case 's':
+            tlvf_bench::list_size = atoi(optarg);
+            break;
+        case 'f':
+            filter = optarg;
+            break;
+        case 'j':
+            json_path = optarg;
+            break;
+        default:
+            std::cerr << "Usage: " << argv[0]
+                      << " [-n iterations] [-s list_size] [-f class_filter] [-j json_file]"
+                      << std::endl;
+            return 1;
+        }
+    }
+    if (iterations <= 0) {
+        std::cerr << "The number of iterations must be positive" << std::endl;
+        return 1;
+    }
+
+    // Keep the logging cost of a production build
+    mapf::Logger::Config log_config;
+    log_config.set_level("ERROR");
+    mapf::Logger::Instance().LoggerConfig(log_config);
+
+    std::vector<sResult> results;
+    bool success = true;
+    for (const auto &bench : tlvf_bench::benchmarks()) {
+        if (!filter.empty() && std::string(bench.name).find(filter) == std::string::npos) {
+            continue;
+        }
+        sResult result;
+        result.name = bench.name;
+        if (!run(bench, iterations, result)) {
+            std::cerr << bench.name << ": " << result.error << std::endl;
+            success = false;
+        }
+        results.push_back(result);
+    }
+
+    std::cout << results.size() << " classes, " << iterations << " iterations, "
+              << tlvf_bench::list_size << " entries per list" << std::endl;
+    print_table(results);
+
+    if (!json_path.empty()) {
+        std::ofstream json(json_path);
+        if (!json) {
+            std::cerr << "Failed opening " << json_path << std::endl;
+            return 1;
+        }
+        write_json(json, results, iterations);
+    }
+
+    return success ? 0 : 1;
+}
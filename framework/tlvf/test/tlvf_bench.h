@@ -0,0 +1,137 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef _TLVF_BENCH_H_
+#define _TLVF_BENCH_H_
+
+#include <tlvf/ClassList.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Round-trip benchmark of the tlvf classes.
+ *
+ * tlvf.py --bench-output generates a bench_build() and a bench_read() function for each class of
+ * the YAML schemas, and registers the classes in benchmarks(). bench_build() fills every member of
+ * a class and adds list_size entries to its variable length lists, and bench_read() reads all of
+ * them back. The driver (tlvf_bench.cpp) times the build, finalize, swap, parse and read of each
+ * class.
+ */
+namespace tlvf_bench {
+
+/**
+ * Number of entries added to each variable length list.
+ */
+extern size_t list_size;
+
+/**
+ * @brief Number of entries to add to a list holding at most @a max entries.
+ */
+inline size_t count(size_t max) { return std::min(list_size, max); }
+
+/**
+ * @brief Contents of a string list holding at most @a max characters.
+ */
+inline std::string text(size_t max) { return std::string(count(max), 'x'); }
+
+/**
+ * @brief Set a member or list entry to a non-zero value.
+ */
+template <class T>
+typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type
+fill(T &field)
+{
+    field = static_cast<T>(1);
+}
+
+/**
+ * @brief Structs keep the values set by their struct_init().
+ */
+template <class T> typename std::enable_if<std::is_class<T>::value>::type fill(T &) {}
+
+/**
+ * @brief Read a member or list entry, and add it to @a sink.
+ *
+ * Everything read ends up in the sink, which keeps the compiler from optimizing the reads out,
+ * and makes a checksum of the class contents.
+ */
+template <class T>
+typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type
+consume(uint64_t &sink, const T &value)
+{
+    sink += static_cast<uint64_t>(value);
+}
+
+template <class T>
+typename std::enable_if<std::is_class<T>::value>::type consume(uint64_t &sink, const T &value)
+{
+    auto bytes = reinterpret_cast<const uint8_t *>(&value);
+    for (size_t i = 0; i < sizeof(T); i++) {
+        sink += bytes[i];
+    }
+}
+
+inline void consume(uint64_t &sink, const std::string &value)
+{
+    for (auto c : value) {
+        sink += static_cast<uint8_t>(c);
+    }
+}
+
+/**
+ * Benchmarked class, with the steps of its round trip.
+ */
+struct sBenchmark {
+    const char *name;
+
+    /**
+     * Add the class to an empty ClassList, and fill it.
+     */
+    bool (*build)(ClassList &list);
+
+    /**
+     * Parse the class from a ClassList reset for parsing.
+     */
+    bool (*parse)(ClassList &list);
+
+    /**
+     * Read all the members of the class, parsed or built, in host byte order.
+     */
+    void (*read)(ClassList &list, uint64_t &sink);
+};
+
+template <class T> bool build(ClassList &list)
+{
+    auto c = list.addClass<T>();
+    return c && bench_build(*c);
+}
+
+template <class T> bool parse(ClassList &list) { return bool(list.addClass<T>()); }
+
+template <class T> void read(ClassList &list, uint64_t &sink)
+{
+    bench_read(*list.getClass<T>(), sink);
+}
+
+template <class T> sBenchmark make_benchmark(const char *name)
+{
+    return {name, &build<T>, &parse<T>, &read<T>};
+}
+
+/**
+ * @brief All the benchmarked classes, defined by the generated code.
+ */
+const std::vector<sBenchmark> &benchmarks();
+
+} // namespace tlvf_bench
+
+#endif // _TLVF_BENCH_H_
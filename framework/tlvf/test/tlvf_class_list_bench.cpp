@@ -0,0 +1,264 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/**
+ * ClassList lookup benchmark.
+ *
+ * Builds an AP Metrics Response carrying the per-STA traffic stats, link metrics and extended
+ * link metrics TLVs of a given number of associated STAs, parses it, and then runs the TLV lookups
+ * done by the controller when handling such a message. The lookups are run both through the
+ * ClassList type index and through a dynamic_pointer_cast scan of all the parsed classes (the way
+ * ClassList used to look classes up), and the time per message of each one is reported.
+ */
+
+#include <tlvf/CmduMessageRx.h>
+#include <tlvf/CmduMessageTx.h>
+#include <tlvf/tlvftypes.h>
+#include <tlvf/wfa_map/tlvApCapability.h>
+#include <tlvf/wfa_map/tlvApExtendedMetrics.h>
+#include <tlvf/wfa_map/tlvApHtCapabilities.h>
+#include <tlvf/wfa_map/tlvApMetrics.h>
+#include <tlvf/wfa_map/tlvApWifi6Capabilities.h>
+#include <tlvf/wfa_map/tlvAssociatedStaExtendedLinkMetrics.h>
+#include <tlvf/wfa_map/tlvAssociatedStaLinkMetrics.h>
+#include <tlvf/wfa_map/tlvAssociatedStaTrafficStats.h>
+#include <tlvf/wfa_map/tlvEHTOperations.h>
+#include <tlvf/wfa_map/tlvProfile2RadioMetrics.h>
+#include <tlvf/wfa_map/tlvWifi7AgentCapabilities.h>
+
+#include <mapf/common/logger.h>
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Looks the classes up through the ClassList type index.
+ */
+struct IndexedLookup {
+    explicit IndexedLookup(const ieee1905_1::CmduMessageRx &cmdu_rx) : m_cmdu_rx(cmdu_rx) {}
+
+    template <class T> std::list<std::shared_ptr<T>> getClassList() const
+    {
+        return m_cmdu_rx.getClassList<T>();
+    }
+    template <class T> std::shared_ptr<T> getClass() const { return m_cmdu_rx.getClass<T>(); }
+
+    const ieee1905_1::CmduMessageRx &m_cmdu_rx;
+};
+
+/**
+ * Looks the classes up by trying a dynamic_pointer_cast on each parsed class.
+ */
+struct ScanLookup {
+    explicit ScanLookup(const ieee1905_1::CmduMessageRx &cmdu_rx)
+        : m_classes(cmdu_rx.getClassList<BaseClass>())
+    {
+    }
+
+    template <class T> std::list<std::shared_ptr<T>> getClassList() const
+    {
+        std::list<std::shared_ptr<T>> list;
+        for (const auto &it : m_classes) {
+            if (auto c = std::dynamic_pointer_cast<T>(it)) {
+                list.push_back(std::move(c));
+            }
+        }
+        return list;
+    }
+    template <class T> std::shared_ptr<T> getClass() const
+    {
+        for (const auto &it : m_classes) {
+            if (auto c = std::dynamic_pointer_cast<T>(it)) {
+                return c;
+            }
+        }
+        return nullptr;
+    }
+
+    std::list<std::shared_ptr<BaseClass>> m_classes;
+};
+
+/**
+ * Runs the lookups of Controller::handle_cmdu_1905_ap_metric_response().
+ *
+ * @return Number of classes found.
+ */
+template <class Lookup> size_t lookup_ap_metrics_response(const Lookup &lookup)
+{
+    size_t found = 0;
+    found += lookup.template getClassList<wfa_map::tlvApMetrics>().size();
+    found += lookup.template getClassList<wfa_map::tlvProfile2RadioMetrics>().size();
+    found += lookup.template getClassList<wfa_map::tlvApHtCapabilities>().size();
+    found += lookup.template getClassList<wfa_map::tlvApWifi6Capabilities>().size();
+    found += bool(lookup.template getClass<wfa_map::tlvWifi7AgentCapabilities>());
+    found += bool(lookup.template getClass<wfa_map::tlvEHTOperations>());
+    found += bool(lookup.template getClass<wfa_map::tlvApCapability>());
+    found += lookup.template getClassList<wfa_map::tlvApExtendedMetrics>().size();
+    found += lookup.template getClassList<wfa_map::tlvAssociatedStaLinkMetrics>().size();
+    found += lookup.template getClassList<wfa_map::tlvAssociatedStaExtendedLinkMetrics>().size();
+    found += lookup.template getClassList<wfa_map::tlvAssociatedStaTrafficStats>().size();
+    return found;
+}
+
+static bool build_ap_metrics_response(ieee1905_1::CmduMessageTx &cmdu_tx, size_t sta_count)
+{
+    if (!cmdu_tx.create(0, ieee1905_1::eMessageType::AP_METRICS_RESPONSE_MESSAGE)) {
+        std::cerr << "Failed creating the CMDU" << std::endl;
+        return false;
+    }
+
+    auto bssid = tlvf::mac_from_string("02:00:00:00:00:01");
+
+    auto ap_metrics_tlv = cmdu_tx.addClass<wfa_map::tlvApMetrics>();
+    if (!ap_metrics_tlv) {
+        std::cerr << "Failed adding tlvApMetrics" << std::endl;
+        return false;
+    }
+    ap_metrics_tlv->bssid()                               = bssid;
+    ap_metrics_tlv->number_of_stas_currently_associated() = sta_count;
+    if (!ap_metrics_tlv->alloc_estimated_service_info_field(3)) {
+        std::cerr << "Failed allocating the estimated service info field" << std::endl;
+        return false;
+    }
+
+    auto ap_extended_metrics_tlv = cmdu_tx.addClass<wfa_map::tlvApExtendedMetrics>();
+    if (!ap_extended_metrics_tlv) {
+        std::cerr << "Failed adding tlvApExtendedMetrics" << std::endl;
+        return false;
+    }
+    ap_extended_metrics_tlv->bssid() = bssid;
+
+    for (size_t i = 0; i < sta_count; i++) {
+        auto sta_mac   = tlvf::mac_from_string("04:00:00:00:00:00");
+        sta_mac.oct[4] = i >> 8;
+        sta_mac.oct[5] = i & 0xFF;
+
+        auto traffic_stats_tlv = cmdu_tx.addClass<wfa_map::tlvAssociatedStaTrafficStats>();
+        if (!traffic_stats_tlv) {
+            std::cerr << "Failed adding tlvAssociatedStaTrafficStats" << std::endl;
+            return false;
+        }
+        traffic_stats_tlv->sta_mac()      = sta_mac;
+        traffic_stats_tlv->byte_sent()    = 1000 * i;
+        traffic_stats_tlv->packets_sent() = i;
+
+        auto link_metrics_tlv = cmdu_tx.addClass<wfa_map::tlvAssociatedStaLinkMetrics>();
+        if (!link_metrics_tlv || !link_metrics_tlv->alloc_bssid_info_list()) {
+            std::cerr << "Failed adding tlvAssociatedStaLinkMetrics" << std::endl;
+            return false;
+        }
+        link_metrics_tlv->sta_mac()                             = sta_mac;
+        std::get<1>(link_metrics_tlv->bssid_info_list(0)).bssid = bssid;
+
+        auto extended_link_metrics_tlv =
+            cmdu_tx.addClass<wfa_map::tlvAssociatedStaExtendedLinkMetrics>();
+        if (!extended_link_metrics_tlv || !extended_link_metrics_tlv->alloc_metrics_list()) {
+            std::cerr << "Failed adding tlvAssociatedStaExtendedLinkMetrics" << std::endl;
+            return false;
+        }
+        extended_link_metrics_tlv->associated_sta()                   = sta_mac;
+        std::get<1>(extended_link_metrics_tlv->metrics_list(0)).bssid = bssid;
+    }
+
+    if (!cmdu_tx.finalize()) {
+        std::cerr << "Failed finalizing the CMDU" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+template <class Lookup>
+static bool run(const char *name, const std::vector<uint8_t> &message, size_t expected,
+                int iterations)
+{
+    std::vector<uint8_t> buffer(message.size());
+    ieee1905_1::CmduMessageRx cmdu_rx(buffer.data(), buffer.size());
+
+    std::chrono::nanoseconds parse_time(0);
+    std::chrono::nanoseconds lookup_time(0);
+    for (int i = 0; i < iterations; i++) {
+        // Parsing swaps the buffer contents in place, start over from the received bytes
+        std::copy(message.begin(), message.end(), buffer.begin());
+
+        auto start = std::chrono::steady_clock::now();
+        if (!cmdu_rx.parse()) {
+            std::cerr << "Failed parsing the CMDU" << std::endl;
+            return false;
+        }
+        auto parsed = std::chrono::steady_clock::now();
+
+        Lookup lookup(cmdu_rx);
+        auto lookup_start = std::chrono::steady_clock::now();
+        auto found        = lookup_ap_metrics_response(lookup);
+        auto end          = std::chrono::steady_clock::now();
+
+        if (found != expected) {
+            std::cerr << name << ": found " << found << " classes instead of " << expected
+                      << std::endl;
+            return false;
+        }
+        parse_time += parsed - start;
+        lookup_time += end - lookup_start;
+    }
+
+    std::cout << std::left << std::setw(10) << name << std::right << std::setw(12)
+              << parse_time.count() / iterations << std::setw(12)
+              << lookup_time.count() / iterations << std::endl;
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    int iterations   = 1000;
+    size_t sta_count = 100;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+        case 'n':
+            iterations = atoi(optarg);
+            break;
+        case 's':
+            sta_count = atoi(optarg);
+            break;
+        default:
+            std::cerr << "Usage: " << argv[0] << " [-n iterations] [-s sta_count]" << std::endl;
+            return 1;
+        }
+    }
+
+    // Keep the logging cost of a production build
+    mapf::Logger::Config log_config;
+    log_config.set_level("ERROR");
+    mapf::Logger::Instance().LoggerConfig(log_config);
+
+    std::vector<uint8_t> message(UINT16_MAX);
+    ieee1905_1::CmduMessageTx cmdu_tx(message.data(), message.size());
+    if (!build_ap_metrics_response(cmdu_tx, sta_count)) {
+        return 1;
+    }
+    message.resize(cmdu_tx.getMessageLength());
+
+    // AP metrics and AP extended metrics, plus 3 TLVs per STA
+    size_t expected = 2 + 3 * sta_count;
+
+    std::cout << "AP Metrics Response with " << sta_count << " STAs (" << message.size()
+              << " bytes), " << iterations << " iterations" << std::endl;
+    std::cout << std::left << std::setw(10) << "lookup" << std::right << std::setw(12)
+              << "parse ns" << std::setw(12) << "lookup ns" << std::endl;
+    if (!run<IndexedLookup>("index", message, expected, iterations) ||
+        !run<ScanLookup>("scan", message, expected, iterations)) {
+        return 1;
+    }
+
+    return 0;
+}
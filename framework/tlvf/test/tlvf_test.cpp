@@ -8,6 +8,7 @@
 
 #include "tlvf/CmduMessageRx.h"
 #include "tlvf/CmduMessageTx.h"
+#include "tlvf/CmduTemplate.h"
 #include "tlvf/WSC/configData.h"
 #include "tlvf/WSC/m1.h"
 #include "tlvf/WSC/m2.h"
@@ -15,11 +16,13 @@
 #include "tlvf/ieee_1905_1/tlvLinkMetricQuery.h"
 #include "tlvf/ieee_1905_1/tlvMacAddress.h"
 #include "tlvf/ieee_1905_1/tlvNon1905neighborDeviceList.h"
+#include "tlvf/ieee_1905_1/tlvTransmitterLinkMetric.h"
 #include "tlvf/ieee_1905_1/tlvUnknown.h"
 #include "tlvf/ieee_1905_1/tlvVendorSpecific.h"
 #include "tlvf/ieee_1905_1/tlvWsc.h"
 #include "tlvf/wfa_map/tlvApCapability.h"
 #include "tlvf/wfa_map/tlvApRadioVbssCapabilities.h"
+#include "tlvf/wfa_map/tlvAssociatedStaLinkMetrics.h"
 #include "tlvf/wfa_map/tlvProfile2ChannelScanResult.h"
 #include "tlvf/wfa_map/tlvProfile2ErrorCode.h"
 #include "tlvf/wfa_map/tlvSpatialReuseRequest.h"
@@ -42,6 +45,7 @@
 #include <iostream>
 #include <iterator>
 #include <sstream>
+#include <vector>
 
 using namespace ieee1905_1;
 using namespace wfa_map;
@@ -2197,6 +2201,502 @@ int test_spatial_reuse_request_srg_bss_color_bitmap()
     return errors;
 }
 
+int test_lazy_parser()
+{
+    int errors = 0;
+
+    MAPF_INFO(__FUNCTION__ << " Start");
+    uint8_t buf[1024]              = {};
+    auto bitmap                    = (1 << 7) | (1 << 8) | (uint64_t(1) << 61);
+    uint8_t bitmap_network_order[] = {0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80};
+    auto mac                       = tlvf::mac_from_string("00:11:22:33:44:55");
+    size_t length;
+
+    {
+        ieee1905_1::CmduMessageTx cmdu_tx(buf, sizeof(buf));
+
+        if (!cmdu_tx.create(0, ieee1905_1::eMessageType::CHANNEL_SELECTION_REQUEST_MESSAGE)) {
+            LOG(ERROR) << "cmdu creation of type CHANNEL_SELECTION_REQUEST, has failed";
+            return ++errors;
+        }
+
+        auto mac_address_tlv = cmdu_tx.addClass<tlvMacAddress>();
+        if (!mac_address_tlv) {
+            LOG(ERROR) << "addClass tlvMacAddress has failed";
+            return ++errors;
+        }
+        mac_address_tlv->mac() = mac;
+
+        auto spatial_reuse_request_tlv = cmdu_tx.addClass<wfa_map::tlvSpatialReuseRequest>();
+        if (!spatial_reuse_request_tlv) {
+            LOG(ERROR) << "addClass wfa_map::tlvSpatialReuseRequest has failed";
+            return ++errors;
+        }
+        spatial_reuse_request_tlv->srg_bss_color_bitmap() = bitmap;
+
+        cmdu_tx.finalize();
+        length = cmdu_tx.getMessageLength();
+    }
+
+    // Network byte order representation of the bitmap, as long as its TLV is not parsed
+    auto bitmap_in_network_order = [&]() {
+        return std::search(buf, buf + length, std::begin(bitmap_network_order),
+                           std::end(bitmap_network_order)) != buf + length;
+    };
+
+    CmduMessageRx cmdu_rx(buf, sizeof(buf));
+    if (!cmdu_rx.parse(true)) {
+        LOG(ERROR) << "Failed parsing the buffer!";
+        return ++errors;
+    }
+
+    auto mac_address_tlv = cmdu_rx.getClass<tlvMacAddress>();
+    if (!mac_address_tlv) {
+        LOG(ERROR) << "getClass tlvMacAddress has failed";
+        return ++errors;
+    }
+    errors += check_field<sMacAddr>(mac_address_tlv->mac(), mac, "mac");
+
+    if (!bitmap_in_network_order()) {
+        LOG(ERROR) << "tlvSpatialReuseRequest was parsed before being accessed";
+        errors++;
+    }
+
+    auto spatial_reuse_request_tlv = cmdu_rx.getClass<wfa_map::tlvSpatialReuseRequest>();
+    if (!spatial_reuse_request_tlv) {
+        LOG(ERROR) << "getClass wfa_map::tlvSpatialReuseRequest has failed";
+        return ++errors;
+    }
+    errors += check_field<uint64_t>(spatial_reuse_request_tlv->srg_bss_color_bitmap(), bitmap,
+                                    "srg_bss_color_bitmap");
+
+    if (cmdu_rx.getClass<wfa_map::tlvApCapability>()) {
+        LOG(ERROR) << "getClass wfa_map::tlvApCapability should have failed";
+        errors++;
+    }
+
+    if (cmdu_rx.getMessageLength() != length) {
+        LOG(ERROR) << "Wrong message length " << cmdu_rx.getMessageLength() << ", expected "
+                   << length;
+        errors++;
+    }
+
+    // Swapping back to network byte order restores the received bytes
+    cmdu_rx.swap();
+    if (!bitmap_in_network_order()) {
+        LOG(ERROR) << "Wrong srg_bss_color_bitmap binary representation after swap!";
+        errors++;
+    }
+
+    // A TLV chain without End of Message TLV is rejected up front
+    CmduMessageRx truncated_cmdu_rx(buf, length - CmduMessage::kTlvHeaderLength);
+    if (truncated_cmdu_rx.parse(true)) {
+        LOG(ERROR) << "Parsing a CMDU without End of Message TLV should have failed";
+        errors++;
+    }
+
+    // TLVs are parsed on demand also when accessed through the base class
+    if (!cmdu_rx.parse(true)) {
+        LOG(ERROR) << "Failed parsing the buffer!";
+        return ++errors;
+    }
+    const CmduMessage &cmdu = cmdu_rx;
+    if (!cmdu.getClass<wfa_map::tlvSpatialReuseRequest>()) {
+        LOG(ERROR) << "getClass wfa_map::tlvSpatialReuseRequest through CmduMessage has failed";
+        errors++;
+    }
+    if (cmdu_rx.getClass<wfa_map::tlvApCapability>() || cmdu_rx.hasParseError()) {
+        LOG(ERROR) << "A missing TLV should not be reported as a parse error";
+        errors++;
+    }
+    cmdu_rx.swap();
+
+    // The TLVs are verified while walking the TLV chain
+    size_t verified_tlvs = 0;
+    auto verify_tlv      = [&](uint8_t *tlv, size_t tlv_length) {
+        verified_tlvs++;
+        return tlv[0] != uint8_t(wfa_map::eTlvTypeMap::TLV_SPATIAL_REUSE_REQUEST);
+    };
+    if (cmdu_rx.parse(true, verify_tlv)) {
+        LOG(ERROR) << "Parsing a CMDU with a TLV failing verification should have failed";
+        errors++;
+    }
+    if (verified_tlvs != 2) {
+        LOG(ERROR) << "Verified " << verified_tlvs << " TLVs, expected 2";
+        errors++;
+    }
+
+    // A TLV whose class does not match its length stops the parsing when it is reached, which is
+    // reported as a parse error rather than a missing TLV. The MAC address TLV claims 3 bytes,
+    // the other 3 bytes of the MAC address look like an empty TLV.
+    uint8_t corrupt_buf[1024];
+    std::copy_n(buf, length, corrupt_buf);
+    size_t mac_tlv_offset           = CmduMessage::kCmduHeaderLength;
+    corrupt_buf[mac_tlv_offset + 1] = 0;
+    corrupt_buf[mac_tlv_offset + 2] = 3;
+    corrupt_buf[mac_tlv_offset + 6] = uint8_t(eTlvType::TLV_AL_MAC_ADDRESS);
+    corrupt_buf[mac_tlv_offset + 7] = 0;
+    corrupt_buf[mac_tlv_offset + 8] = 0;
+    CmduMessageRx corrupt_cmdu_rx(corrupt_buf, sizeof(corrupt_buf));
+    if (!corrupt_cmdu_rx.parse(true)) {
+        LOG(ERROR) << "Failed indexing the corrupt CMDU";
+        return ++errors;
+    }
+    if (corrupt_cmdu_rx.getClass<wfa_map::tlvSpatialReuseRequest>()) {
+        LOG(ERROR) << "getClass wfa_map::tlvSpatialReuseRequest should have failed";
+        errors++;
+    }
+    if (!corrupt_cmdu_rx.hasParseError()) {
+        LOG(ERROR) << "The corrupt TLV should be reported as a parse error";
+        errors++;
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
+int test_class_arena()
+{
+    int errors = 0;
+
+    MAPF_INFO(__FUNCTION__ << " Start");
+    uint8_t buf[1024] = {};
+    auto mac          = tlvf::mac_from_string("00:11:22:33:44:55");
+
+    {
+        CmduMessageTx cmdu_tx(buf, sizeof(buf));
+        if (!cmdu_tx.create(0, eMessageType::TOPOLOGY_QUERY_MESSAGE)) {
+            LOG(ERROR) << "cmdu creation of type TOPOLOGY_QUERY, has failed";
+            return ++errors;
+        }
+        auto mac_address_tlv = cmdu_tx.addClass<tlvMacAddress>();
+        if (!mac_address_tlv) {
+            LOG(ERROR) << "addClass tlvMacAddress has failed";
+            return ++errors;
+        }
+        mac_address_tlv->mac() = mac;
+        cmdu_tx.finalize();
+    }
+
+    CmduMessageRx cmdu_rx(buf, sizeof(buf));
+    if (!cmdu_rx.parse()) {
+        LOG(ERROR) << "Failed parsing the buffer!";
+        return ++errors;
+    }
+
+    // A class kept after the message is reset must not be overwritten by the next message ones
+    auto mac_address_tlv = cmdu_rx.getClass<tlvMacAddress>();
+    for (int i = 0; i < 2; i++) {
+        cmdu_rx.swap();
+        if (!cmdu_rx.parse()) {
+            LOG(ERROR) << "Failed parsing the buffer again!";
+            return ++errors;
+        }
+    }
+    if (!mac_address_tlv) {
+        LOG(ERROR) << "getClass tlvMacAddress has failed";
+        return ++errors;
+    }
+    errors += check_field<sMacAddr>(mac_address_tlv->mac(), mac, "mac");
+
+    if (cmdu_rx.getClass<tlvMacAddress>() == mac_address_tlv) {
+        LOG(ERROR) << "Class of the previous message returned";
+        errors++;
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
+int test_reserve_list()
+{
+    int errors = 0;
+
+    MAPF_INFO(__FUNCTION__ << " Start");
+    uint8_t buf[1024] = {};
+    auto mac          = tlvf::mac_from_string("00:11:22:33:44:55");
+
+    // Grow the lists of the last TLV, both one element and several elements at a time
+    {
+        CmduMessageTx cmdu_tx(buf, sizeof(buf));
+        if (!cmdu_tx.create(0, eMessageType::TOPOLOGY_RESPONSE_MESSAGE)) {
+            LOG(ERROR) << "cmdu creation of type TOPOLOGY_RESPONSE, has failed";
+            return ++errors;
+        }
+        for (uint8_t i = 0; i < 2; i++) {
+            auto neighbors_tlv = cmdu_tx.addClass<tlvNon1905neighborDeviceList>();
+            if (!neighbors_tlv) {
+                LOG(ERROR) << "addClass tlvNon1905neighborDeviceList has failed";
+                return ++errors;
+            }
+            neighbors_tlv->mac_local_iface() = mac;
+            if (!neighbors_tlv->alloc_mac_non_1905_device()) {
+                LOG(ERROR) << "alloc_mac_non_1905_device has failed";
+                return ++errors;
+            }
+            std::get<1>(neighbors_tlv->mac_non_1905_device(0)).oct[5] = i;
+            auto neighbors = neighbors_tlv->reserve_mac_non_1905_device(10);
+            if (!neighbors) {
+                LOG(ERROR) << "reserve_mac_non_1905_device has failed";
+                return ++errors;
+            }
+            for (uint8_t j = 0; j < 10; j++) {
+                neighbors[j].oct[5] = 0x10 * (i + 1) + j;
+            }
+            if (neighbors_tlv->reserve_mac_non_1905_device(sizeof(buf))) {
+                LOG(ERROR) << "reserve_mac_non_1905_device beyond the buffer should have failed";
+                errors++;
+            }
+        }
+        cmdu_tx.finalize();
+    }
+
+    CmduMessageRx cmdu_rx(buf, sizeof(buf));
+    if (!cmdu_rx.parse()) {
+        LOG(ERROR) << "Failed parsing the buffer!";
+        return ++errors;
+    }
+
+    auto neighbors_tlvs = cmdu_rx.getClassList<tlvNon1905neighborDeviceList>();
+    if (neighbors_tlvs.size() != 2) {
+        LOG(ERROR) << "Found " << neighbors_tlvs.size() << " tlvNon1905neighborDeviceList";
+        return ++errors;
+    }
+    uint8_t i = 0;
+    for (const auto &neighbors_tlv : neighbors_tlvs) {
+        errors += check_field<sMacAddr>(neighbors_tlv->mac_local_iface(), mac, "mac_local_iface");
+        if (neighbors_tlv->mac_non_1905_device_length() != 11 * sizeof(sMacAddr)) {
+            LOG(ERROR) << "Wrong number of neighbors: "
+                       << neighbors_tlv->mac_non_1905_device_length() / sizeof(sMacAddr);
+            errors++;
+            continue;
+        }
+        errors += check_field<uint8_t>(std::get<1>(neighbors_tlv->mac_non_1905_device(0)).oct[5],
+                                       i, "neighbor 0");
+        for (uint8_t j = 0; j < 10; j++) {
+            errors += check_field<uint8_t>(
+                std::get<1>(neighbors_tlv->mac_non_1905_device(j + 1)).oct[5],
+                0x10 * (i + 1) + j, "neighbor");
+        }
+        i++;
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
+template <class T> int check_swap_array(const std::string &name)
+{
+    int errors = 0;
+
+    for (size_t count : {1, 2, 3, 7, 50}) {
+        std::vector<uint8_t> expected(count * sizeof(T));
+        for (size_t i = 0; i < expected.size(); i++) {
+            expected[i] = i * 37;
+        }
+        auto swapped = expected;
+        auto applied = expected;
+
+        for (size_t i = 0; i < count; i++) {
+            reinterpret_cast<T *>(expected.data())[i].struct_swap();
+        }
+        tlvf_swap_array(reinterpret_cast<T *>(swapped.data()), count);
+        if (swapped != expected) {
+            LOG(ERROR) << "tlvf_swap_array of " << count << " " << name << " differs";
+            errors++;
+        }
+
+        // Also check the byte by byte lookups when the table lookup instruction is used
+        const auto &pattern = tlvf_swap_pattern::get<T>();
+        if (pattern.is_identity()) {
+            continue;
+        }
+        if (!pattern.is_supported()) {
+            LOG(ERROR) << "Swapping " << name << " by blocks is not supported";
+            return ++errors;
+        }
+        pattern.apply(applied.data(), count);
+        if (applied != expected) {
+            LOG(ERROR) << "tlvf_swap_pattern of " << count << " " << name << " differs";
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+int test_swap_array()
+{
+    int errors = 0;
+
+    MAPF_INFO(__FUNCTION__ << " Start");
+
+    errors += check_swap_array<wfa_map::tlvAssociatedStaLinkMetrics::sBssidInfo>("sBssidInfo");
+    errors += check_swap_array<tlvTransmitterLinkMetric::sInterfacePairInfo>("sInterfacePairInfo");
+
+    if (!tlvf_swap_pattern::get<sMacAddr>().is_identity()) {
+        LOG(ERROR) << "Swapping sMacAddr should leave it unchanged";
+        errors++;
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
+int test_cmdu_template()
+{
+    int errors = 0;
+
+    MAPF_INFO(__FUNCTION__ << " Start");
+    uint8_t tx_buf[256];
+    uint8_t rx_buf[256];
+    auto reporter_mac = tlvf::mac_from_string("00:11:22:33:44:55");
+
+    CmduTemplate cmdu_template(tx_buf, sizeof(tx_buf));
+    if (cmdu_template.is_frozen()) {
+        LOG(ERROR) << "Template should not be frozen before it is built";
+        errors++;
+    }
+    auto cmdu_header = cmdu_template.create(0, eMessageType::LINK_METRIC_RESPONSE_MESSAGE);
+    if (!cmdu_header) {
+        LOG(ERROR) << "cmdu creation of type LINK_METRIC_RESPONSE, has failed";
+        return ++errors;
+    }
+    auto tx_link_metric_tlv = cmdu_template.addClass<tlvTransmitterLinkMetric>();
+    if (!tx_link_metric_tlv || !tx_link_metric_tlv->alloc_interface_pair_info(2)) {
+        LOG(ERROR) << "Failed adding tlvTransmitterLinkMetric";
+        return ++errors;
+    }
+    tx_link_metric_tlv->reporter_al_mac() = reporter_mac;
+    auto &pair_info_0 = std::get<1>(tx_link_metric_tlv->interface_pair_info(0));
+    auto &pair_info_1 = std::get<1>(tx_link_metric_tlv->interface_pair_info(1));
+
+    if (!cmdu_template.freeze() || !cmdu_template.is_frozen()) {
+        LOG(ERROR) << "Failed freezing the template";
+        return ++errors;
+    }
+    size_t length = cmdu_template.getMessageLength();
+
+    for (uint16_t i = 1; i <= 2; i++) {
+        // Update a single field, a struct field and a whole list element
+        cmdu_template.set(cmdu_header->message_id(), uint16_t(0x100 + i));
+
+        tlvTransmitterLinkMetric::sLinkMetricInfo link_metric_info = {};
+        link_metric_info.packet_errors                             = 0x10000 * i;
+        cmdu_template.set(pair_info_0.link_metric_info, link_metric_info);
+
+        // The template holds the element in network byte order
+        auto pair_info = pair_info_1;
+        pair_info.struct_swap();
+        pair_info.link_metric_info.phy_rate          = 100 * i;
+        pair_info.link_metric_info.link_availability = 50 + i;
+        pair_info.neighbor_interface_mac.oct[5]      = i;
+        cmdu_template.set(pair_info_1, pair_info);
+
+        // Sending the template again must not change it
+        if (!cmdu_template.finalize() || cmdu_template.getMessageLength() != length) {
+            LOG(ERROR) << "Finalizing the frozen template changed its length";
+            return ++errors;
+        }
+
+        CmduMessageRx cmdu_rx(rx_buf, sizeof(rx_buf));
+        if (!cmdu_rx.parseCopy(cmdu_template.getMessageBuff(), length)) {
+            LOG(ERROR) << "Failed parsing the template!";
+            return ++errors;
+        }
+        auto tlv = cmdu_rx.getClass<tlvTransmitterLinkMetric>();
+        if (!tlv || tlv->interface_pair_info_length() != 2 * sizeof(pair_info)) {
+            LOG(ERROR) << "Failed getting tlvTransmitterLinkMetric";
+            return ++errors;
+        }
+        errors += check_field<uint16_t>(cmdu_rx.getMessageId(), 0x100 + i, "message_id");
+        errors += check_field<sMacAddr>(tlv->reporter_al_mac(), reporter_mac, "reporter_al_mac");
+        auto &rx_pair_info_0 = std::get<1>(tlv->interface_pair_info(0));
+        auto &rx_pair_info_1 = std::get<1>(tlv->interface_pair_info(1));
+        errors += check_field<uint32_t>(rx_pair_info_0.link_metric_info.packet_errors,
+                                        0x10000 * i, "packet_errors");
+        errors += check_field<uint16_t>(rx_pair_info_0.link_metric_info.phy_rate, 0, "phy_rate 0");
+        errors += check_field<uint16_t>(rx_pair_info_1.link_metric_info.phy_rate, 100 * i,
+                                        "phy_rate 1");
+        errors += check_field<uint16_t>(rx_pair_info_1.link_metric_info.link_availability,
+                                        50 + i, "link_availability");
+        errors += check_field<uint8_t>(rx_pair_info_1.neighbor_interface_mac.oct[5], i,
+                                       "neighbor_interface_mac");
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
+int test_reserve_list_no_moves()
+{
+    int errors = 0;
+
+    MAPF_INFO(__FUNCTION__ << " Start");
+    uint8_t buf[1024] = {};
+
+    CmduMessageTx cmdu_tx(buf, sizeof(buf));
+    if (!cmdu_tx.create(0, eMessageType::TOPOLOGY_RESPONSE_MESSAGE)) {
+        LOG(ERROR) << "cmdu creation of type TOPOLOGY_RESPONSE, has failed";
+        return ++errors;
+    }
+    auto neighbors_tlv = cmdu_tx.addClass<tlvNon1905neighborDeviceList>();
+    if (!neighbors_tlv) {
+        LOG(ERROR) << "addClass tlvNon1905neighborDeviceList has failed";
+        return ++errors;
+    }
+
+    // Fill the unused part of the buffer with a pattern that any move of it would shift
+    for (auto p = neighbors_tlv->getBuffPtr(); p < buf + sizeof(buf); p++) {
+        *p = uint8_t(p - buf) ^ 0xa5;
+    }
+    auto check_tail = [&](const std::string &step) {
+        for (auto p = neighbors_tlv->getBuffPtr(); p < buf + sizeof(buf); p++) {
+            if (*p != (uint8_t(p - buf) ^ 0xa5)) {
+                LOG(ERROR) << "Unused buffer moved after " << step << " at offset " << (p - buf);
+                return 1;
+            }
+        }
+        return 0;
+    };
+
+    // The list is the last field of the last class, so growing it moves nothing
+    if (neighbors_tlv->getBuffMoveLength(neighbors_tlv->getBuffPtr(), sizeof(sMacAddr)) != 0) {
+        LOG(ERROR) << "Growing the list of the last class should move nothing";
+        errors++;
+    }
+    if (!neighbors_tlv->reserve_mac_non_1905_device(4)) {
+        LOG(ERROR) << "reserve_mac_non_1905_device has failed";
+        return ++errors;
+    }
+    errors += check_tail("reserve");
+    for (int i = 0; i < 8; i++) {
+        if (!neighbors_tlv->alloc_mac_non_1905_device()) {
+            LOG(ERROR) << "alloc_mac_non_1905_device has failed";
+            return ++errors;
+        }
+        errors += check_tail("alloc " + std::to_string(i));
+    }
+    if (neighbors_tlv->mac_non_1905_device_length() != 12 * sizeof(sMacAddr)) {
+        LOG(ERROR) << "Wrong number of neighbors: "
+                   << neighbors_tlv->mac_non_1905_device_length() / sizeof(sMacAddr);
+        errors++;
+    }
+
+    // Once another class follows it, growing the list has to move the rest of the buffer
+    if (!cmdu_tx.addClass<tlvNon1905neighborDeviceList>()) {
+        LOG(ERROR) << "addClass tlvNon1905neighborDeviceList has failed";
+        return ++errors;
+    }
+    if (neighbors_tlv->getBuffMoveLength(neighbors_tlv->getBuffPtr(), sizeof(sMacAddr)) == 0) {
+        LOG(ERROR) << "Growing the list of a class followed by another should move the buffer";
+        errors++;
+    }
+
+    MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
+    return errors;
+}
+
 int main(int argc, char *argv[])
 {
     int errors = 0;
@@ -2218,6 +2718,12 @@ int main(int argc, char *argv[])
     errors += test_virtual_bss_creation();
     errors += test_topology_response_including_vbss_configuration_report();
     errors += test_spatial_reuse_request_srg_bss_color_bitmap();
+    errors += test_lazy_parser();
+    errors += test_class_arena();
+    errors += test_reserve_list();
+    errors += test_reserve_list_no_moves();
+    errors += test_swap_array();
+    errors += test_cmdu_template();
     MAPF_INFO(__FUNCTION__ << " Finished, errors = " << errors << std::endl);
     return errors;
 }
@@ -238,6 +238,8 @@ class MetaData:
         self.list_index = 0
         self.lock_allocation_member_added = False
         self.lock_order_member_added = False
+        self.bench_params = []
+        self.bench_unfilled = []
         self.marker_post_init_method_added = False
 
     def errPrefix(self):
@@ -365,7 +367,8 @@ class MetaData:
 
 
 class TlvF:
-    def __init__(self, src_path, yaml_path, out_path, conf_path, print_dependencies, print_outputs):
+    def __init__(self, src_path, yaml_path, out_path, conf_path, print_dependencies, print_outputs,
+                 bench_output=None):
         self.CMAKE_PROPERTIES_VERSION = "1.0.0"
         self.CMAKE_SO_VERSION = "1.0.0"
 
@@ -412,17 +415,23 @@ class TlvF:
         self.conf_output_path = os.path.abspath(out_path)
         self.print_dependencies = print_dependencies
         self.print_outputs = print_outputs
+        self.bench_output = os.path.abspath(bench_output) if bench_output else None
         global logConsoleDisable
         if print_dependencies or print_outputs:
             logConsoleDisable = True
         self.logger = None
         self.yaml_file_list = []
         self.generated_file_list = []
+        self.class_type_ids = {}
         self.db = LastUpdatedOrderedDict()
         self.db_enum_storage_type = {}
         self.db_yaml_paths = {}
         self.output_directories_h = []
         self.output_directories_cpp = []
+        self.bench_includes = []
+        self.bench_class_names = []
+        self.bench_namespaces = OrderedDict()
+        self.bench_classes = []
 
         # processing flow #
         logConsole("TlvF started...\n")
@@ -435,10 +444,13 @@ class TlvF:
             sys.exit(0)
 
         self.loadAllYamlFilesToDB()
+        self.bench_class_names = [obj_name for (fname, obj_name) in self.db.keys()]
         self.generateCode()
+        if self.bench_output:
+            self.generateBench()
 
         if self.print_outputs:
-            outputs = ";".join(self.generated_file_list)
+            outputs = ";".join([self.bench_output] if self.bench_output else self.generated_file_list)
             sys.stdout.write(outputs)
 
         logConsole("All Done.\n")
@@ -565,6 +577,8 @@ class TlvF:
             elif obj_meta.type == MetaData.TYPE_CLASS:
                 if obj_meta.bit_field:
                     self.abort("%s.yaml --> _bit_field not allowed in class " % self.yaml_fname)
+                # before addClassParam(), which turns single class members into lists
+                self.addBenchParam(obj_meta, param_name, param_type, param_type_info, param_meta)
                 self.addClassParam(obj_meta, param_name, param_type, param_type_info, param_meta)
             else:
                 self.abort("%s.yaml --> unknown obj_meta.type:%s" %
@@ -837,7 +851,7 @@ class TlvF:
                     "if (m_%s_ptr) { m_%s_ptr->class_swap(); }" % (param_name, param_name)]
 
                 # Add allocation methods
-                self.addClassVarLenMethods(obj_meta, param_type, param_name,
+                self.addClassVarLenMethods(obj_meta, param_type, param_type_full, param_name,
                                            param_meta, param_length, False, False)
 
                 # Add function to return pointer
@@ -922,7 +936,7 @@ class TlvF:
                 lines_cpp.append("")
 
                 # Add function to allocate memory
-                self.addClassVarLenMethods(obj_meta, param_type, param_name,
+                self.addClassVarLenMethods(obj_meta, param_type, param_type_full, param_name,
                                            param_meta, param_length, is_var_len, is_dynamic_len)
 
                 # Add setter:
@@ -1239,10 +1253,14 @@ class TlvF:
                     t_length = ("m_" + param_name + "_idx__")
                 else:
                     t_length = str(param_meta.length)
-                swap_func_lines.append("for (size_t i = 0; i < %s; i++){" % (t_length))
-                swap_func_lines.append("%s%s%s%s;" % (self.getIndentation(
-                    1), param_type_info.swap_prefix, t_name, param_type_info.swap_suffix))
-                swap_func_lines.append("}")
+                if param_type_info.type == TypeInfo.STRUCT:
+                    # Packed array of fixed layout records, swapped as a whole
+                    swap_func_lines.append("tlvf_swap_array(m_%s, %s);" % (param_name, t_length))
+                else:
+                    swap_func_lines.append("for (size_t i = 0; i < %s; i++){" % (t_length))
+                    swap_func_lines.append("%s%s%s%s;" % (self.getIndentation(
+                        1), param_type_info.swap_prefix, t_name, param_type_info.swap_suffix))
+                    swap_func_lines.append("}")
 
             lines_h = []
             lines_cpp = []
@@ -1427,7 +1445,7 @@ class TlvF:
 
             # add function to allocate memory
             if is_var_len or is_dynamic_len:
-                self.addClassVarLenMethods(obj_meta, param_type, param_name,
+                self.addClassVarLenMethods(obj_meta, param_type, param_type_full, param_name,
                                            param_meta, param_length, is_var_len, is_dynamic_len)
         else:
             self.abort("%s.yaml --> unsupported length type: %r, param_name=%s" %
@@ -1438,7 +1456,7 @@ class TlvF:
         self.insertLineH(obj_meta.name, self.CODE_CLASS_PUBLIC_FUNC_INSERT, lines_h)
         self.insertLineCpp(obj_meta.name, self.CODE_CLASS_PUBLIC_FUNC_INSERT, lines_cpp)
 
-    def addClassVarLenMethods(self, obj_meta, param_type, param_name, param_meta, param_length, is_var_len, is_dynamic_len):
+    def addClassVarLenMethods(self, obj_meta, param_type, param_type_full, param_name, param_meta, param_length, is_var_len, is_dynamic_len):
         lines_cpp = []
         lines_h = []
         if TypeInfo(param_type).type == TypeInfo.CLASS:
@@ -1633,6 +1651,20 @@ class TlvF:
             lines_cpp.append("%sreturn true;" % (self.getIndentation(1)))
             lines_cpp.append("}")
             lines_cpp.append("")
+
+            # Bulk allocation of fixed-size records: a single bounds check, after which the
+            # caller fills the returned array in place
+            if TypeInfo(param_type).type == TypeInfo.STRUCT:
+                lines_h.append("%s* reserve_%s(size_t count);" % (param_type, param_name))
+                lines_cpp.append("%s* %s::reserve_%s(size_t count) {" % (
+                    param_type_full, obj_meta.name, param_name))
+                lines_cpp.append("%sif (!alloc_%s(count)) {" % (self.getIndentation(1), param_name))
+                lines_cpp.append("%sreturn nullptr;" % self.getIndentation(2))
+                lines_cpp.append("%s}" % self.getIndentation(1))
+                lines_cpp.append("%sreturn &m_%s[m_%s_idx__ - count];" % (
+                    self.getIndentation(1), param_name, param_name))
+                lines_cpp.append("}")
+                lines_cpp.append("")
         self.insertLineH(obj_meta.name, self.CODE_CLASS_PUBLIC_FUNC_INSERT, lines_h)
         self.insertLineCpp(obj_meta.name, self.CODE_CLASS_PUBLIC_FUNC_INSERT, lines_cpp)
 
@@ -1642,7 +1674,9 @@ class TlvF:
     # If this is a variable length list alloc, add a call to std::copy_n to
     # move the contents of the buffer starting at the current list entry pointer
     # till the new list pointer (ptr + allocation size). The number of bytes we
-    # move is the the calculated as END of buffer - current list pointer.
+    # move is the the calculated as END of buffer - current list pointer, or
+    # END of class - current list pointer if the class is the last one in the
+    # buffer (see BaseClass::getBuffMoveLength()).
     # Then, we need to add a marker so that on following members we will
     # update their pointers accordingly.
     #
@@ -1670,7 +1704,7 @@ class TlvF:
                 lines_cpp.append("%sif (!m_parse__) {" % self.getIndentation(1))
                 lines_cpp.append("%suint8_t *dst = src + len;" % (self.getIndentation(2)))
                 lines_cpp.append(
-                    "%ssize_t move_length = getBuffRemainingBytes(src) - len;" % self.getIndentation(2))
+                    "%ssize_t move_length = getBuffMoveLength(src, len);" % self.getIndentation(2))
                 lines_cpp.append("%sstd::copy_n(src, move_length, dst);" % self.getIndentation(2))
                 lines_cpp.append("%s}" % self.getIndentation(1))
 
@@ -1697,7 +1731,7 @@ class TlvF:
                 lines_cpp.append("%suint8_t *dst = src + len;" % (self.getIndentation(1)))
                 lines_cpp.append("%sif (!m_parse__) {" % self.getIndentation(1))
                 lines_cpp.append(
-                    "%ssize_t move_length = getBuffRemainingBytes(src) - len;" % self.getIndentation(2))
+                    "%ssize_t move_length = getBuffMoveLength(src, len);" % self.getIndentation(2))
                 lines_cpp.append("%sstd::copy_n(src, move_length, dst);" % self.getIndentation(2))
                 lines_cpp.append("%s}" % self.getIndentation(1))
 
@@ -1920,6 +1954,7 @@ class TlvF:
         self.addClassSwapMethod(insert_name, insert_marker, name)
         self.addClassFinalizeMethod(insert_name, insert_marker, name, obj_meta)
         self.addClassSizeMethod(insert_name, insert_marker, name)
+        self.addClassTypeIdMethod(insert_name, insert_marker, name)
 
         self.insertLineH(insert_name, insert_marker, "")
         self.insertLineH(insert_name, insert_marker, "%sprivate:" % self.getIndentation(1))
@@ -2121,6 +2156,22 @@ class TlvF:
         self.insertLineCpp(insert_name, insert_marker, "}")
         self.insertLineCpp(insert_name, insert_marker, "")
 
+    def addClassTypeIdMethod(self, insert_name, insert_marker, name):
+        # The id is the 64-bit FNV-1a hash of the qualified class name, so that it does not depend
+        # on the order in which the classes are generated, nor on the yaml files generated together
+        qualified_name = "%s::%s" % (self.namespace, name) if self.namespace else name
+        type_id = 0xcbf29ce484222325
+        for c in qualified_name.encode():
+            type_id = ((type_id ^ c) * 0x100000001b3) & 0xffffffffffffffff
+        if type_id in self.class_type_ids and self.class_type_ids[type_id] != qualified_name:
+            self.abort("%s.yaml --> class %s has the same type id as class %s" % (
+                self.yaml_fname, qualified_name, self.class_type_ids[type_id]))
+        self.class_type_ids[type_id] = qualified_name
+
+        self.insertLineH(insert_name, insert_marker,
+                         "%sstatic constexpr uint64_t get_class_type_id() { return 0x%016xULL; }" % (
+                             self.getIndentation(2), type_id))
+
     def closeObject(self, obj_meta):
         if obj_meta.type == MetaData.TYPE_CLASS:  # add class constractor
             # constractor 1
@@ -2151,8 +2202,223 @@ class TlvF:
                                "%s::~%s() {" % (obj_meta.name, obj_meta.name))
             self.insertLineCpp(obj_meta.name, self.CODE_CLASS_DISTRACTOR, "}")
 
+            self.addBenchClass(obj_meta)
+
         self.is_root_obj = False
 
+    ##############################################################################################
+    # round-trip benchmark support
+    #
+    # With --bench-output, a benchmark function pair is generated for each class:
+    # bench_build() fills every member and list of the class (adding tlvf_bench::list_size
+    # entries to variable length lists), and bench_read() reads them all back. The functions are
+    # registered in tlvf_bench::benchmarks(), which the tlvf_bench driver runs (see
+    # framework/tlvf/test/tlvf_bench.h).
+    # Conditional parameters and fixed length lists of classes are not filled.
+    ##############################################################################################
+    def addBenchParam(self, obj_meta, param_name, param_type, param_type_info, param_meta):
+        if not self.bench_output:
+            return
+        ident = self.getIndentation(1)
+        build = []
+        read = []
+        length_type = param_meta.length_type if param_meta else None
+        if param_meta and param_meta.condition is not None:
+            # leave the members of the condition untouched, so that it is not met
+            for member in param_meta.condition[MetaData.CONDITION_USING_MEMBERS]:
+                obj_meta.bench_unfilled.append(member[len("m_"):].split('.')[0])
+            return
+        if param_meta and param_meta.class_const:
+            return
+
+        is_class = (TypeInfo(param_type).type == TypeInfo.CLASS)
+        if is_class and not TypeInfo(param_type).type_str in self.bench_class_names:
+            # classes of another yaml tree (e.g. WSC classes in beerocks messages) have no bench
+            # functions here, they are added with their initial values
+            build_entry = "!entry || !c.add_%s(entry)" % param_name
+            read_entry = "tlvf_bench::consume(sink, %s.getLen());"
+        else:
+            build_entry = "!entry || !bench_build(*entry) || !c.add_%s(entry)" % param_name
+            read_entry = "bench_read(%s, sink);"
+
+        if length_type == None:
+            if is_class:
+                build.append("{")
+                build.append("%sauto entry = c.create_%s();" % (ident, param_name))
+                build.append("%sif (%s) {" % (ident, build_entry))
+                build.append("%sreturn false;" % self.getIndentation(2))
+                build.append("%s}" % ident)
+                build.append("}")
+                read.append("if (c.%s()) {" % param_name)
+                read.append(ident + read_entry % ("(*c.%s())" % param_name))
+                read.append("}")
+            else:
+                const = (param_meta and param_meta.value_const != None) or (
+                    obj_meta.is_tlv_class and param_name == MetaData.TLV_TYPE_LENGTH)
+                if param_type in ('int64_t', 'uint64_t'):
+                    if not const:
+                        build.append("c.%s() = 1;" % param_name)
+                    read.append("tlvf_bench::consume(sink, %s(c.%s()));" % (param_type, param_name))
+                else:
+                    if not const:
+                        build.append("tlvf_bench::fill(c.%s());" % param_name)
+                    read.append("tlvf_bench::consume(sink, c.%s());" % param_name)
+            obj_meta.bench_params.append((param_name, build, read))
+            return
+
+        is_fixed_len = (length_type == MetaData.LENGTH_TYPE_INT or
+                        length_type == MetaData.LENGTH_TYPE_CONST)
+        is_var_len = (length_type == MetaData.LENGTH_TYPE_VAR)
+        if is_fixed_len and is_class:
+            return
+
+        if is_fixed_len:
+            count = "(%s)" % param_meta.length
+        elif param_meta.length_max:
+            count = "tlvf_bench::count(%s)" % param_meta.length_max
+        else:
+            count = "tlvf_bench::list_size"
+
+        if param_type_info.type == TypeInfo.CHAR:
+            build.append("if (!c.set_%s(tlvf_bench::text(%s))) {" % (param_name, count))
+            build.append("%sreturn false;" % ident)
+            build.append("}")
+            read.append("tlvf_bench::consume(sink, c.%s_str());" % param_name)
+        elif is_class:
+            build.append("for (size_t i = 0; i < %s; i++) {" % count)
+            build.append("%sauto entry = c.create_%s();" % (ident, param_name))
+            build.append("%sif (%s) {" % (ident, build_entry))
+            build.append("%sreturn false;" % self.getIndentation(2))
+            build.append("%s}" % ident)
+            build.append("}")
+            if is_var_len:
+                read.append("for (size_t i = 0; i < size_t(c.%s()); i++) {" % param_meta.length)
+                read.append(ident + read_entry % ("std::get<1>(c.%s(i))" % param_name))
+                read.append("}")
+            else:
+                read.append("for (size_t i = 0, length = 0, total = c.%s_length(); length < total; i++) {" %
+                            param_name)
+                read.append("%sauto &entry = std::get<1>(c.%s(i));" % (ident, param_name))
+                read.append("%slength += entry.getLen();" % ident)
+                read.append(ident + read_entry % "entry")
+                read.append("}")
+        else:
+            if param_type_info.is_std_type:
+                entry = "*c.%s(i)" % param_name
+                entry_size = "sizeof(*c.%s(0))" % param_name
+            else:
+                entry = "std::get<1>(c.%s(i))" % param_name
+                entry_size = "sizeof(std::get<1>(c.%s(0)))" % param_name
+            if is_fixed_len:
+                read_count = count
+            else:
+                build.append("if (!c.alloc_%s(%s)) {" % (param_name, count))
+                build.append("%sreturn false;" % ident)
+                build.append("}")
+                if is_var_len:
+                    read_count = "size_t(c.%s())" % param_meta.length
+                else:
+                    read_count = "c.%s_length() / %s" % (param_name, entry_size)
+            build.append("for (size_t i = 0; i < %s; i++) {" % count)
+            build.append("%stlvf_bench::fill(%s);" % (ident, entry))
+            build.append("}")
+            read.append("for (size_t i = 0; i < %s; i++) {" % read_count)
+            read.append("%stlvf_bench::consume(sink, %s);" % (ident, entry))
+            read.append("}")
+
+        if is_var_len:
+            # the length is counted by the allocation functions
+            obj_meta.bench_unfilled.append(param_meta.length)
+        obj_meta.bench_params.append((param_name, build, read))
+
+    def addBenchClass(self, obj_meta):
+        if not self.bench_output:
+            return
+        ident = self.getIndentation(1)
+        include = "#include <%s/%s.h>" % (self.yaml_path, self.yaml_fname)
+        if not include in self.bench_includes:
+            self.bench_includes.append(include)
+        if not self.namespace in self.bench_namespaces:
+            self.bench_namespaces[self.namespace] = ([], [])
+        (declarations, code) = self.bench_namespaces[self.namespace]
+
+        build_func = "static bool bench_build(%s &c)" % obj_meta.name
+        read_func = "static void bench_read(%s &c, uint64_t &sink)" % obj_meta.name
+        declarations.append(build_func + ";")
+        declarations.append(read_func + ";")
+
+        build = []
+        read = []
+        for (param_name, param_build, param_read) in obj_meta.bench_params:
+            if not param_name in obj_meta.bench_unfilled:
+                build.extend(param_build)
+            read.extend(param_read)
+        if not build:
+            build.append("(void)c;")
+        if not read:
+            read.append("(void)c;")
+            read.append("(void)sink;")
+
+        code.append(build_func)
+        code.append("{")
+        code.extend([ident + line for line in build])
+        code.append("%sreturn true;" % ident)
+        code.append("}")
+        code.append("")
+        code.append(read_func)
+        code.append("{")
+        code.extend([ident + line for line in read])
+        code.append("}")
+        code.append("")
+
+        self.bench_classes.append(
+            self.namespace + "::" + obj_meta.name if self.namespace else obj_meta.name)
+
+    def generateBench(self):
+        logConsole("Generating the round-trip benchmark...\n")
+        ident = self.getIndentation(1)
+        lines = self.getFileHeaderLines()
+        lines.append('#include "tlvf_bench.h"')
+        lines.append("")
+        lines.extend(sorted(self.bench_includes))
+        lines.append("")
+        lines.append("#include <tuple>")
+        lines.append("")
+
+        # declare all functions first, since classes may contain classes of other files
+        for namespace, (declarations, code) in self.bench_namespaces.items():
+            if namespace:
+                lines.append("namespace %s {" % namespace)
+            lines.extend(declarations)
+            if namespace:
+                lines.append("} // namespace %s" % namespace)
+            lines.append("")
+        for namespace, (declarations, code) in self.bench_namespaces.items():
+            if namespace:
+                lines.append("namespace %s {" % namespace)
+                lines.append("")
+            lines.extend(code)
+            if namespace:
+                lines.append("} // namespace %s" % namespace)
+                lines.append("")
+
+        lines.append("const std::vector<tlvf_bench::sBenchmark> &tlvf_bench::benchmarks()")
+        lines.append("{")
+        lines.append("%sstatic const std::vector<sBenchmark> list = {" % ident)
+        for name in self.bench_classes:
+            lines.append('%smake_benchmark<%s>("%s"),' % (self.getIndentation(2), name, name))
+        lines.append("%s};" % ident)
+        lines.append("%sreturn list;" % ident)
+        lines.append("}")
+
+        self.mkdir_p(os.path.dirname(self.bench_output))
+        if not self.compareFile(self.bench_output, lines):
+            f = open(self.bench_output, "w+")
+            for line in lines:
+                f.write(line + "\n")
+            f.close()
+        logConsole("Done\n")
+
     def getIndentation(self, level):
         ident = ""
         for i in range(level):
@@ -2243,6 +2509,21 @@ class TlvF:
             return False
         return True
 
+    def getFileHeaderLines(self):
+        lines = [self.AUTO_GENERATED_MESSAGE]
+        # write source_license_header
+        if self.conf_source_license_header:
+            license_file_path = os.path.join(self.src_path, self.conf_source_license_header)
+            try:
+                fl = open(license_file_path, 'r')
+            except:
+                self.abort("can't open file %s" % license_file_path)
+            for line in fl:
+                lines.append(line.rstrip())
+            fl.close()
+            lines.append("")
+        return lines
+
     def writeFile(self, code_lines, file_suffix):
         if file_suffix == ".h":
             file_path = os.path.join(self.conf_output_path_include, self.yaml_path)
@@ -2262,18 +2543,7 @@ class TlvF:
         self.logger.debug("writing source file: %s" % file_path)
         self.generated_file_list.append(file_path)
 
-        lines = [self.AUTO_GENERATED_MESSAGE]
-        # write source_license_header
-        if self.conf_source_license_header:
-            license_file_path = os.path.join(self.src_path, self.conf_source_license_header)
-            try:
-                fl = open(license_file_path, 'r')
-            except:
-                self.abort("can't open file %s" % license_file_path)
-            for line in fl:
-                lines.append(line.rstrip())
-            fl.close()
-            lines.append("")
+        lines = self.getFileHeaderLines()
 
         # write include header protection start
         if file_suffix == ".h":
@@ -2290,6 +2560,9 @@ class TlvF:
         lines.extend(code_lines)
 
         # write code
+        if self.bench_output:
+            # the class sources are generated by the main invocation, only the benchmark is written
+            return
         if not self.compareFile(file_path, lines):
             f = open(file_path, "w+")
             for line in lines:
@@ -2538,13 +2811,16 @@ def main():
     parser.add_argument('--test', action='store_true', help='test')
     parser.add_argument('--print-dependencies', action='store_true', help='test print dependancies')
     parser.add_argument('--print-outputs', action='store_true', help='test print dependancies')
+    parser.add_argument('--bench-output', metavar='FILE',
+                        help='generate the round-trip benchmark of all classes to FILE, '
+                        'instead of the classes themselves')
     args = parser.parse_args()
 
     if args.test:
         test(args.conf, args.output, args.print_dependencies, args.print_outputs)
     else:
         tlvf = TlvF(args.src_path, args.yaml_path, args.out_path,
-                    args.conf, args.print_dependencies, args.print_outputs)
+                    args.conf, args.print_dependencies, args.print_outputs, args.bench_output)
 
 
 if __name__ == '__main__':
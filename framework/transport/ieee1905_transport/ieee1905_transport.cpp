@@ -14,20 +14,34 @@ namespace transport {
 Ieee1905Transport::Ieee1905Transport(
     std::shared_ptr<beerocks::net::InterfaceStateManager> interface_state_manager,
     std::shared_ptr<beerocks::net::BridgeStateManager> bridge_state_manager,
-    std::shared_ptr<broker::BrokerServer> broker, std::shared_ptr<EventLoop> event_loop)
+    std::shared_ptr<broker::BrokerServer> broker, std::shared_ptr<EventLoop> event_loop,
+    bool rx_pipeline)
     : m_interface_state_manager(interface_state_manager),
-      m_bridge_state_manager(bridge_state_manager), m_broker(broker), m_event_loop(event_loop)
+      m_bridge_state_manager(bridge_state_manager), m_broker(broker), m_event_loop(event_loop),
+      m_rx_pipeline(rx_pipeline)
 {
     LOG_IF(!m_interface_state_manager, FATAL) << "Interface state manager is a null pointer!";
     LOG_IF(!m_bridge_state_manager, FATAL) << "Bridge state manager is a null pointer!";
     LOG_IF(!m_broker, FATAL) << "Broker server is a null pointer!";
     LOG_IF(!m_event_loop, FATAL) << "Event loop is a null pointer!";
+
+    de_fragmentation_pool_.resize(kDeFragmentationPoolSlabs * kDeFragmentationSlabSize);
+    de_fragmentation_free_slabs_.reserve(kDeFragmentationPoolSlabs);
+    for (int slab = kDeFragmentationPoolSlabs - 1; slab >= 0; slab--) {
+        de_fragmentation_free_slabs_.push_back(slab);
+    }
 }
 
 bool Ieee1905Transport::start()
 {
     LOG(INFO) << "Starting 1905 transport...";
 
+    // The RX thread must be running before any interface is activated
+    if (m_rx_pipeline && !start_rx_pipeline()) {
+        LOG(ERROR) << "Failed to start the RX pipeline!";
+        return false;
+    }
+
     // Register broker handlers for internal and external messages
     m_broker->register_external_message_handler(
         [&](std::unique_ptr<messages::Message> &msg, broker::BrokerServer &broker) -> bool {
@@ -60,6 +74,10 @@ bool Ieee1905Transport::stop()
     m_interface_state_manager->clear_handler();
     m_bridge_state_manager->clear_handler();
 
+    stop_rx_pipeline();
+
+    capture_.stop();
+
     return true;
 }
 
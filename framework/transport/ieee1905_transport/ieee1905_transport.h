@@ -13,17 +13,29 @@
 #include <mapf/transport/ieee1905_transport_messages.h>
 
 #include <bcl/beerocks_event_loop.h>
+#include <bcl/beerocks_spsc_ring.h>
 #include <bcl/network/bridge_state_manager.h>
 #include <bcl/network/interface_state_manager.h>
 
 #include "ieee1905_transport_broker.h"
+#include "ieee1905_transport_capture.h"
 
 #include <tlvf/tlvftypes.h>
 
 #include <arpa/inet.h>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <list>
 #include <map>
+#include <mutex>
 #include <net/if.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 // Address is a multicast address if the most significant byte in the address is 0x01
 #ifndef ETHER_IS_MULTICAST
@@ -60,6 +72,14 @@ namespace beerocks {
 namespace transport {
 
 class Ieee1905Transport {
+#ifdef IEEE1905_TRANSPORT_STAGE_PROFILING
+    // Replay benchmark (test/ieee1905_transport_replay_bench.cpp), which feeds captured frames to
+    // handle_packet() and reads the stage profile
+    friend class Ieee1905TransportReplayBench;
+#endif
+    // Unit tests (test/ieee1905_transport_tests.cpp), which drive the internal stages directly
+    friend class Ieee1905TransportTest;
+
 public:
     /**
      * Class constructor
@@ -68,11 +88,13 @@ public:
      * @param interface_state_manager Bridge state manager.
      * @param broker Message broker.
      * @param event_loop Event loop to wait for I/O events.
+     * @param rx_pipeline Receive and pre-process the network frames in a separate thread (see
+     * start_rx_pipeline()).
      */
     Ieee1905Transport(std::shared_ptr<beerocks::net::InterfaceStateManager> interface_state_manager,
                       std::shared_ptr<beerocks::net::BridgeStateManager> bridge_state_manager,
                       std::shared_ptr<broker::BrokerServer> broker,
-                      std::shared_ptr<EventLoop> event_loop);
+                      std::shared_ptr<EventLoop> event_loop, bool rx_pipeline = false);
 
     /**
      * @brief Starts the transport process.
@@ -110,6 +132,11 @@ private:
      */
     std::shared_ptr<EventLoop> m_event_loop;
 
+    /**
+     * Run the receive stage in a separate thread.
+     */
+    bool m_rx_pipeline;
+
     std::string if_index2name(unsigned int index)
     {
         char ifname[IF_NAMESIZE] = {0};
@@ -130,6 +157,12 @@ private:
         std::string bridge_name;
         /// is this interface a bridge interface
         bool is_bridge = false;
+        /// receive frames through a memory-mapped TPACKET_V3 ring instead of recvfrom()
+        bool use_rx_ring = false;
+        /// the memory-mapped receive ring (or nullptr if frames are read with recvfrom())
+        uint8_t *rx_ring = nullptr;
+        /// index of the next receive ring block to be handed over by the kernel
+        unsigned int rx_ring_block = 0;
     };
     // network interface status table
     // this table holds all the network interfaces that are to be used by
@@ -152,6 +185,18 @@ private:
     // Bridge name that the transport monitors
     std::string bridge_name_;
 
+    // Use the receive ring on interfaces that are added to the monitored bridge later on
+    bool bridge_use_rx_ring_ = false;
+
+    // TPACKET_V3 receive ring geometry (per interface).
+    // The kernel fills one block at a time and hands it over to user space when it is full or when
+    // the block timeout expires, so a single wakeup can drain many frames without any copy.
+    // The total ring size matches the SO_RCVBUF size used in recvfrom() mode.
+    static constexpr unsigned int kRxRingBlockSize      = (64 * 1024);
+    static constexpr unsigned int kRxRingBlockCount     = 8;
+    static constexpr unsigned int kRxRingFrameSize      = 2048;
+    static constexpr unsigned int kRxRingBlockTimeoutMs = 10;
+
     // IEEE 802.1Q Protocol Identifier
     static constexpr uint16_t ieee_8021q_protocol_id = 0x8100;
 
@@ -212,18 +257,24 @@ private:
         OUTGOING_LOCAL_BUS_PACKETS,
         DUPLICATE_PACKETS,
         DEFRAGMENTATION_FAILURE,
+        DE_DUPLICATION_EVICTIONS,
+        DE_DUPLICATION_CAPACITY_HITS,
+        RX_PIPELINE_OVERFLOWS,
     };
     // Enum AutoPrint generated code snippet begining- DON'T EDIT!
     // clang-format off
     static const char *CounterId_str(CounterId enum_value) {
         switch (enum_value) {
-        case MESSAGE_ID_WRAPAROUND:       return "MESSAGE_ID_WRAPAROUND";
-        case INCOMMING_NETWORK_PACKETS:   return "INCOMMING_NETWORK_PACKETS";
-        case OUTGOING_NETWORK_PACKETS:    return "OUTGOING_NETWORK_PACKETS";
-        case INCOMMING_LOCAL_BUS_PACKETS: return "INCOMMING_LOCAL_BUS_PACKETS";
-        case OUTGOING_LOCAL_BUS_PACKETS:  return "OUTGOING_LOCAL_BUS_PACKETS";
-        case DUPLICATE_PACKETS:           return "DUPLICATE_PACKETS";
-        case DEFRAGMENTATION_FAILURE:     return "DEFRAGMENTATION_FAILURE";
+        case MESSAGE_ID_WRAPAROUND:        return "MESSAGE_ID_WRAPAROUND";
+        case INCOMMING_NETWORK_PACKETS:    return "INCOMMING_NETWORK_PACKETS";
+        case OUTGOING_NETWORK_PACKETS:     return "OUTGOING_NETWORK_PACKETS";
+        case INCOMMING_LOCAL_BUS_PACKETS:  return "INCOMMING_LOCAL_BUS_PACKETS";
+        case OUTGOING_LOCAL_BUS_PACKETS:   return "OUTGOING_LOCAL_BUS_PACKETS";
+        case DUPLICATE_PACKETS:            return "DUPLICATE_PACKETS";
+        case DEFRAGMENTATION_FAILURE:      return "DEFRAGMENTATION_FAILURE";
+        case DE_DUPLICATION_EVICTIONS:     return "DE_DUPLICATION_EVICTIONS";
+        case DE_DUPLICATION_CAPACITY_HITS: return "DE_DUPLICATION_CAPACITY_HITS";
+        case RX_PIPELINE_OVERFLOWS:        return "RX_PIPELINE_OVERFLOWS";
         }
         static std::string out_str = std::to_string(int(enum_value));
         return out_str.c_str();
@@ -233,6 +284,86 @@ private:
     // Enum AutoPrint generated code snippet end
     std::map<CounterId, unsigned long> counters_;
 
+    // per message type telemetry (reported with TransportTelemetryReportMessage)
+    //
+    // The table is indexed by get_telemetry_index(): the IEEE1905.1 message types come first,
+    // followed by the EasyMesh (0x8000 based) message types and a last entry for any other type.
+    static constexpr size_t kTelemetryIeee1905Types = 0x20;
+    static constexpr size_t kTelemetryEasyMeshTypes = 0x80;
+    static constexpr size_t kTelemetryEntries =
+        kTelemetryIeee1905Types + kTelemetryEasyMeshTypes + 1;
+    static constexpr uint16_t kTelemetryOtherType = 0xffff;
+    using TelemetryEntry   = messages::TransportTelemetryReportMessage::Entry;
+    using TelemetryLatency = messages::TransportTelemetryReportMessage::Latency;
+    std::array<TelemetryEntry, kTelemetryEntries> telemetry_ = {};
+
+#ifdef IEEE1905_TRANSPORT_STAGE_PROFILING
+    // Packet processing time per stage, accumulated while stage_profile_ is set (by the replay
+    // benchmark). The FORWARD stage includes the DE_FRAGMENT and PUBLISH stages it runs. Only
+    // used without the RX pipeline, since the stages then run on a single thread.
+    // Compiled in only for the benchmark, which builds the transport with
+    // IEEE1905_TRANSPORT_STAGE_PROFILING defined.
+    enum class Stage { VERIFY, DE_DUPLICATE, DE_FRAGMENT, FORWARD, PUBLISH, COUNT };
+    // Enum AutoPrint generated code snippet begining- DON'T EDIT!
+    // clang-format off
+    static const char *Stage_str(Stage enum_value) {
+        switch (enum_value) {
+        case Stage::VERIFY:       return "Stage::VERIFY";
+        case Stage::DE_DUPLICATE: return "Stage::DE_DUPLICATE";
+        case Stage::DE_FRAGMENT:  return "Stage::DE_FRAGMENT";
+        case Stage::FORWARD:      return "Stage::FORWARD";
+        case Stage::PUBLISH:      return "Stage::PUBLISH";
+        case Stage::COUNT:        return "Stage::COUNT";
+        }
+        static std::string out_str = std::to_string(int(enum_value));
+        return out_str.c_str();
+    }
+    friend inline std::ostream &operator<<(std::ostream &out, Stage value) { return out << Stage_str(value); }
+    // clang-format on
+    // Enum AutoPrint generated code snippet end
+    struct StageProfile {
+        uint64_t calls[size_t(Stage::COUNT)] = {};
+        uint64_t ns[size_t(Stage::COUNT)]    = {};
+    };
+    StageProfile *stage_profile_ = nullptr;
+
+    // Adds the time until it goes out of scope to a stage of the profile (if not null)
+    class StageTimer {
+    public:
+        StageTimer(StageProfile *profile, Stage stage) : m_profile(profile), m_stage(stage)
+        {
+            if (m_profile) {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+        ~StageTimer()
+        {
+            if (m_profile) {
+                m_profile->calls[size_t(m_stage)]++;
+                m_profile->ns[size_t(m_stage)] +=
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - m_start)
+                        .count();
+            }
+        }
+
+    private:
+        StageProfile *m_profile;
+        Stage m_stage;
+        std::chrono::steady_clock::time_point m_start;
+    };
+#define IEEE1905_TRANSPORT_STAGE_TIMER(stage) StageTimer stage_timer(stage_profile_, Stage::stage)
+#else
+#define IEEE1905_TRANSPORT_STAGE_TIMER(stage)
+#endif
+
+    static size_t get_telemetry_index(uint16_t msg_type);
+    static uint16_t get_telemetry_msg_type(size_t index);
+    static void update_telemetry_latency(TelemetryLatency &latency,
+                                         std::chrono::steady_clock::duration duration);
+
+    struct RxPipelineFrame;
+
     // an internal data structure used for manipulating packets (CMDUs, LLDP, etc.)
     class Packet {
     public:
@@ -246,6 +377,22 @@ private:
         struct iovec header       = {.iov_base = NULL, .iov_len = 0};
         struct iovec payload      = {.iov_base = NULL, .iov_len = 0};
 
+        // A de-fragmented CMDU is not contiguous in memory - its payload is the concatenation of
+        // payload_chain[0..payload_chain_len) and `payload` only refers to the first element (the
+        // IEEE1905 header). payload_chain is null for regular packets.
+        const struct iovec *payload_chain = nullptr;
+        size_t payload_chain_len          = 0;
+
+        // time the (last) frame of the packet was received from the network
+        std::chrono::steady_clock::time_point rx_time;
+
+        // the frame the packet was received in, if it went through the RX pipeline (which already
+        // did the de-fragmentation)
+        const RxPipelineFrame *rx_pipeline_frame = nullptr;
+
+        size_t payload_length() const;
+        void copy_payload(uint8_t *dst) const;
+
         virtual std::ostream &print(std::ostream &os) const;
 
         static const std::set<uint16_t> reliable_multicast_msg_types;
@@ -297,29 +444,48 @@ private:
         uint16_t messageId;
         uint8_t fragmentId;
     };
-    struct DeDuplicationKeyCompare {
-        // implement Compare for the std::map template
+    struct DeDuplicationKeyHash {
+        // implement Hash for the std::unordered_map template
+        size_t operator()(const DeDuplicationKey &key) const
+        {
+            // fold both addresses and the CMDU identifiers into a single 64 bit word and mix it
+            // (field by field - the struct padding is never read)
+            uint64_t h = key.fragmentId;
+            for (size_t i = 0; i < ETH_ALEN; i++) {
+                h = (h << 8) ^ (h >> 56) ^ key.src.oct[i];
+                h = (h << 8) ^ (h >> 56) ^ key.dst.oct[i];
+            }
+            h ^= (uint64_t(key.messageType) << 16) | key.messageId;
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return size_t(h);
+        }
+    };
+    struct DeDuplicationKeyEqual {
         bool operator()(const DeDuplicationKey &lhs, const DeDuplicationKey &rhs) const
         {
-            // compare based on src and dst address first then messageId, then fragmentId
-            int srccmp = memcmp(lhs.src.oct, rhs.src.oct, ETH_ALEN);
-            if (srccmp)
-                return srccmp < 0;
-            int dstcmp = memcmp(lhs.dst.oct, rhs.dst.oct, ETH_ALEN);
-            if (dstcmp)
-                return dstcmp < 0;
-            else if (lhs.messageType != rhs.messageType)
-                return lhs.messageType < rhs.messageType;
-            else if (lhs.messageId != rhs.messageId)
-                return lhs.messageId < rhs.messageId;
-            else
-                return lhs.fragmentId < rhs.fragmentId;
+            return lhs.messageId == rhs.messageId && lhs.fragmentId == rhs.fragmentId &&
+                   lhs.messageType == rhs.messageType && lhs.src == rhs.src && lhs.dst == rhs.dst;
         }
     };
     struct DeDuplicationValue {
         std::chrono::steady_clock::time_point time;
     };
-    std::map<DeDuplicationKey, DeDuplicationValue, DeDuplicationKeyCompare> de_duplication_map_;
+    std::unordered_map<DeDuplicationKey, DeDuplicationValue, DeDuplicationKeyHash,
+                       DeDuplicationKeyEqual>
+        de_duplication_map_;
+
+    // De-duplication entries are aged out by a coarse expiry wheel instead of scanning the whole
+    // map on every packet. Each slot covers kMaximumDeDuplicationAge / kDeDuplicationWheelSlots and
+    // holds the keys inserted during that tick. When the wheel comes back around to a slot, its keys
+    // are either evicted (expired) or re-filed into the current slot (refreshed by a duplicate since).
+    // Expiry is checked against the exact entry timestamp on lookup, so the wheel granularity only
+    // affects how long an expired entry may linger in memory, never the de-duplication decision.
+    static constexpr int kDeDuplicationWheelSlots = 8;
+    std::array<std::vector<DeDuplicationKey>, kDeDuplicationWheelSlots> de_duplication_wheel_;
+    int64_t de_duplication_wheel_tick_ = 0;
+    std::vector<DeDuplicationKey> de_duplication_wheel_scratch_;
 
     // de-fragmentation internal data structures
 
@@ -330,10 +496,23 @@ private:
     const std::chrono::milliseconds kMaximumDeFragmentationAge = std::chrono::milliseconds(1000);
 
     // limit the size of the de-fragmentation map (to prevent memory exhaustion attack)
-    const int kMaximumDeFragmentationThreads = 16;
+    const int kMaximumDeFragmentationThreads = 128;
 
     static const size_t kMaximumDeFragmentionSize = (64 * 1024);
 
+    // The fragment bodies of in-flight CMDUs are kept in fixed size slabs taken from a pool that is
+    // allocated once, by the constructor. A reassembly only holds the slabs of the fragments
+    // received so far, so the memory used is bounded by the pool rather than by
+    // kMaximumDeFragmentationThreads * kMaximumDeFragmentionSize. The fragments are never
+    // concatenated in the transport - the complete CMDU is handed over as an iovec chain and only
+    // coalesced when it is copied into the message published to the broker.
+    static constexpr size_t kDeFragmentationSlabSize      = ETH_DATA_LEN;
+    static constexpr int kDeFragmentationPoolSlabs        = 512;
+    static constexpr int kMaximumDeFragmentationFragments = 64;
+
+    std::vector<uint8_t> de_fragmentation_pool_;
+    std::vector<uint16_t> de_fragmentation_free_slabs_;
+
     struct DeFragmentationKey {
         sMacAddr src;
         uint16_t
@@ -356,17 +535,102 @@ private:
     };
     struct DeFragmentationValue {
         std::chrono::steady_clock::time_point time;
-        uint8_t numFragments                   = 0;
-        uint8_t buf[kMaximumDeFragmentionSize] = {0};
-        int bufIndex                           = 0;
-        bool complete                          = false;
+        // time the first fragment was received (for the reassembly latency telemetry)
+        std::chrono::steady_clock::time_point start_time;
+        uint8_t numFragments       = 0;
+        // IEEE1905 header of the first fragment, with the last fragment indicator set
+        Ieee1905CmduHeader header = {};
+        // chain[0] is the header, chain[1..numFragments] the fragment bodies in pool slabs
+        struct iovec chain[kMaximumDeFragmentationFragments + 1];
+        uint16_t slabs[kMaximumDeFragmentationFragments];
+        size_t length = 0;
+        bool complete = false;
+        // position in de_fragmentation_lru_
+        std::list<DeFragmentationKey>::iterator lru_it;
     };
-    std::map<DeFragmentationKey, DeFragmentationValue, DeFragmentationKeyCompare>
-        de_fragmentation_map_;
+    using DeFragmentationMap =
+        std::map<DeFragmentationKey, DeFragmentationValue, DeFragmentationKeyCompare>;
+    DeFragmentationMap de_fragmentation_map_;
+    // de-fragmentation map keys, least recently updated first (for O(1) aging)
+    std::list<DeFragmentationKey> de_fragmentation_lru_;
 
     static const int kIeee1905FragmentationThreashold = tlvf::
         MAX_TLV_SIZE; // IEEE1905 packets (CMDU) should be fragmented if larger than this threashold
 
+    // Batched egress: while a batch is open, frames sent to the network interfaces are copied into
+    // a queue and written to their sockets with one sendmmsg() call per socket when the batch is
+    // flushed (instead of one writev() per frame). This is used to fan out relayed multicast and
+    // reliable multicast (with all their fragments) to all interfaces and neighbors at once.
+    static constexpr size_t kTxBatchFrameSize = sizeof(ether_header_vlan) + ETH_DATA_LEN;
+
+    // Maximum number of frames queued before the batch is flushed (must not exceed UIO_MAXIOV)
+    static constexpr size_t kTxBatchMaxFrames = 256;
+
+    struct sTxBatchFrame {
+        int fd;
+        size_t len;
+        uint8_t buf[kTxBatchFrameSize];
+    };
+    bool tx_batch_active_ = false;
+    std::vector<sTxBatchFrame> tx_batch_frames_;
+    std::vector<struct iovec> tx_batch_iov_;
+    std::vector<struct mmsghdr> tx_batch_msgs_;
+
+    // RX pipeline: when enabled, the network interface sockets are owned by a separate RX thread,
+    // with its own event loop, which does the verification, de-duplication and de-fragmentation
+    // of the received frames. The frames are passed to the broker thread (m_event_loop) through a
+    // lock-free ring, together with the CMDU they complete (if any), and the broker thread does
+    // the neighbors tracking, the local bus delivery and the relaying (the whole TX path).
+    //
+    // The de-duplication and de-fragmentation tables belong to the RX thread. The broker thread
+    // records the CMDUs sent from the local bus (and forgets the ones it failed to forward) with
+    // updates posted to a second ring, which the RX thread applies before handling each frame
+    // (when the ring is full, the broker thread waits for the RX thread to apply them).
+    // Everything else the RX thread touches (the interface sockets and receive rings, the AL MAC
+    // address) is changed by the broker thread with rx_pipeline_call(), while the RX thread is
+    // idle.
+    static constexpr size_t kRxPipelineRingSize = 256;
+
+    struct RxPipelineFrame {
+        // the interface the frame was received on
+        unsigned int if_index = 0;
+        // the socket of the interface that failed (the item is an error notification), or -1
+        int error_fd = -1;
+        std::string error_ifname;
+        std::chrono::steady_clock::time_point rx_time;
+        size_t len = 0;
+        uint8_t buf[kRxRingFrameSize];
+        // false if the frame is a fragment buffered for reassembly (which is relayed but must not
+        // be delivered to the local bus)
+        bool deliver = false;
+        // the complete CMDU if the frame is the last fragment of a reassembled one (the capacity
+        // is kept when the ring slot is reused)
+        std::vector<uint8_t> cmdu;
+    };
+    struct RxPipelineDeDuplication {
+        bool remove = false;
+        sMacAddr src;
+        sMacAddr dst;
+        Ieee1905CmduHeader header;
+    };
+    std::unique_ptr<beerocks::spsc_ring<RxPipelineFrame>> rx_pipeline_frames_;
+    std::unique_ptr<beerocks::spsc_ring<RxPipelineDeDuplication>> rx_pipeline_de_duplication_;
+    std::shared_ptr<EventLoop> rx_pipeline_event_loop_;
+    std::thread rx_pipeline_thread_;
+    std::atomic<bool> rx_pipeline_running_{false};
+    // eventfd signaled by the RX thread when frames were added to the ring
+    int rx_pipeline_wake_fd_       = -1;
+    bool rx_pipeline_wake_pending_ = false;
+    // eventfd signaled by the broker thread to run rx_pipeline_call_ on the RX thread
+    int rx_pipeline_control_fd_ = -1;
+    std::mutex rx_pipeline_mutex_;
+    std::condition_variable rx_pipeline_cv_;
+    const std::function<void()> *rx_pipeline_call_ = nullptr;
+
+    // Capture of the frames sent and received on the network interfaces and of the CMDUs
+    // exchanged on the local bus, controlled with TransportCaptureControlMessage.
+    PcapngCapture capture_;
+
     // When fragmenting a message it is expected that only the last fragment will have an END OF MESSAGE TLV.
     // However, when sending a TLV smaller than then the minimum ethernet frame, a padding is added to the frame.
     // This padding might cause us having unwanted EOM TLV.
@@ -385,10 +649,12 @@ private:
      * @param[in] ifname The name of the interface that was added/removed.
      * @param[in] iface_added true if the interface was added to the bridge, false otherwise.
      * @param[in] is_bridge Shall be true if the interface is a bridge.
+     * @param[in] use_rx_ring Receive frames through a memory-mapped ring (if supported).
      * @return true on success and false otherwise.
      **/
     bool update_network_interface(const std::string &bridge_name, const std::string &ifname,
-                                  bool iface_added, bool is_bridge = false);
+                                  bool iface_added, bool is_bridge = false,
+                                  bool use_rx_ring = false);
     /**
      * @brief Removes an interface from the transport.
      *
@@ -397,15 +663,56 @@ private:
      **/
     bool remove_network_interface(const std::string &ifname);
     bool open_interface_socket(NetworkInterface &interface);
+    /**
+     * @brief Sets up a TPACKET_V3 receive ring on the interface socket.
+     *
+     * On failure the socket is left in its regular mode, so frames are read with recvfrom().
+     *
+     * @param[in] interface The interface to set up the ring for.
+     * @return true on success and false otherwise.
+     **/
+    bool open_interface_rx_ring(NetworkInterface &interface);
+    void close_interface_rx_ring(NetworkInterface &interface);
+    void drain_interface_rx_ring(NetworkInterface &interface);
     bool attach_interface_socket_filter(NetworkInterface &iface_name);
     void activate_interface(NetworkInterface &interface);
     void deactivate_interface(NetworkInterface &interface, bool remove_handlers = true);
     void handle_interface_state_change(const std::string &iface_name, bool is_active);
     void handle_bridge_state_change(const std::string &bridge_name, const std::string &iface_name,
                                     bool iface_added);
-    void handle_interface_pollin_event(int fd);
+    void handle_interface_rx_ring_event(NetworkInterface &interface);
+    void handle_interface_frame(uint8_t *buf, size_t len, unsigned int if_index);
+    /**
+     * @return The event loop the network interface sockets are registered on.
+     */
+    std::shared_ptr<EventLoop> &get_interface_event_loop()
+    {
+        return rx_pipeline_event_loop_ ? rx_pipeline_event_loop_ : m_event_loop;
+    }
     bool get_interface_mac_addr(unsigned int if_index, uint8_t *addr);
     bool send_packet_to_network_interface(unsigned int if_index, Packet &packet);
+    /**
+     * @brief Starts queuing the frames sent to the network interfaces.
+     *
+     * Frames sent with send_packet_to_network_interface() are copied into the batch until
+     * end_tx_batch() is called.
+     */
+    void begin_tx_batch();
+    /**
+     * @brief Writes all the queued frames, with one sendmmsg() call per socket.
+     *
+     * After a partial write, the remaining frames of the socket are written with another call.
+     * A frame which cannot be written is dropped, without dropping the frames queued after it.
+     *
+     * @return true if all the queued frames were written and false otherwise.
+     */
+    bool flush_tx_batch();
+    /**
+     * @brief Flushes the queued frames and stops queuing.
+     *
+     * @return true if all the queued frames were written and false otherwise.
+     */
+    bool end_tx_batch();
     void set_al_mac_addr(const uint8_t *addr);
     void set_primary_vlan_id(const uint16_t primary_vlan_id, bool add);
 
@@ -418,6 +725,11 @@ private:
         messages::InterfaceConfigurationRequestMessage &msg);
     void handle_al_mac_addr_configuration_message(messages::AlMacAddressConfigurationMessage &msg);
     void handle_vlan_configuration_request_message(messages::VlanConfigurationRequestMessage &msg);
+    void handle_transport_telemetry_query_message(messages::TransportTelemetryQueryMessage &msg);
+    void handle_transport_capture_control_message(messages::TransportCaptureControlMessage &msg);
+    // record a CMDU exchanged on the local bus, with an ethernet header built from the packet
+    void capture_local_bus_packet(const Packet &packet, const uint8_t *payload, size_t length,
+                                  PcapngCapture::Direction direction);
     bool send_packet_to_broker(Packet &packet);
     uint16_t get_next_message_id();
 
@@ -428,11 +740,53 @@ private:
     void update_neighbours(const Packet &packet);
     bool verify_packet(const Packet &packet);
     bool de_duplicate_packet(Packet &packet);
+    int64_t get_de_duplication_wheel_tick(std::chrono::steady_clock::time_point time);
+    void advance_de_duplication_wheel(std::chrono::steady_clock::time_point now);
+    void purge_de_duplication_map(std::chrono::steady_clock::time_point now);
     void remove_packet_from_de_duplication_map(const Packet &packet);
     bool de_fragment_packet(Packet &packet);
+    void erase_de_fragmentation_entry(DeFragmentationMap::iterator it);
     bool fragment_and_send_packet_to_network_interface(unsigned int if_index, Packet &packet);
     bool forward_packet_single(Packet &packet);
     bool forward_packet(Packet &Packet);
+    // the telemetry entry of the message type of a CMDU (or nullptr if the packet is not a CMDU)
+    TelemetryEntry *get_telemetry(const Packet &packet);
+    // count a packet received from the network in its telemetry entry (if not nullptr)
+    static void update_rx_telemetry(TelemetryEntry *telemetry, const Packet &packet);
+
+    //
+    // RX PIPELINE STUFF
+    //
+    /**
+     * @brief Starts the RX thread (if the RX pipeline is enabled).
+     *
+     * @return true on success and false otherwise.
+     */
+    bool start_rx_pipeline();
+    void stop_rx_pipeline();
+    void rx_pipeline_thread();
+    /**
+     * @brief Runs a function on the RX thread and waits for it to complete.
+     *
+     * The function is run directly if the RX thread is not running. It must not wait for the
+     * broker thread.
+     *
+     * @param function The function to run.
+     */
+    void rx_pipeline_call(const std::function<void()> &function);
+    // RX thread: pre-process a received packet and pass it to the broker thread
+    void rx_pipeline_handle_packet(Packet &packet);
+    // RX thread: pass an interface socket failure to the broker thread
+    void rx_pipeline_handle_interface_error(const NetworkInterface &interface, int fd);
+    // RX thread: signal the broker thread if frames were added to the ring
+    void rx_pipeline_flush();
+    // RX thread: apply the de-duplication updates posted by the broker thread
+    void rx_pipeline_apply_de_duplication_updates();
+    // broker thread: post a de-duplication update to the RX thread (waits for it if the ring is
+    // full, the updates that still do not fit are counted in the telemetry)
+    void rx_pipeline_post_de_duplication_update(const Packet &packet, bool remove);
+    // broker thread: handle the frames passed by the RX thread
+    void handle_rx_pipeline_frames();
 };
 
 inline std::ostream &operator<<(std::ostream &os, const Ieee1905Transport::Packet &m)
@@ -9,11 +9,15 @@
 #include "ieee1905_transport_broker.h"
 
 #include <beerocks/tlvf/beerocks_message.h>
+#include <tlvf/ieee_1905_1/eMessageType.h>
 #include <tlvf/ieee_1905_1/tlvVendorSpecific.h>
 
 // System
+#include <algorithm>
 #include <cerrno>
+#include <cstring>
 #include <sys/eventfd.h>
+#include <sys/socket.h>
 #include <sys/uio.h>
 
 #include <easylogging++.h>
@@ -50,6 +54,23 @@ BrokerServer::BrokerServer(std::shared_ptr<SocketServer> server_socket,
     LOG_IF(!m_server_socket->getError().empty(), FATAL)
         << "Failed opening server socket: " << m_server_socket
         << " [ERROR: " << m_server_socket->getError() << "]";
+
+    // Default egress policy: never drop messages that other messages (or the topology database)
+    // depend on, and drop the periodic metrics reports first
+    m_egress_policy.never_drop_types = {
+        uint16_t(ieee1905_1::eMessageType::ACK_MESSAGE),
+        uint16_t(ieee1905_1::eMessageType::TOPOLOGY_DISCOVERY_MESSAGE),
+        uint16_t(ieee1905_1::eMessageType::TOPOLOGY_NOTIFICATION_MESSAGE),
+        uint16_t(ieee1905_1::eMessageType::TOPOLOGY_QUERY_MESSAGE),
+        uint16_t(ieee1905_1::eMessageType::TOPOLOGY_RESPONSE_MESSAGE),
+    };
+    m_egress_policy.drop_first_types = {
+        uint16_t(ieee1905_1::eMessageType::LINK_METRIC_RESPONSE_MESSAGE),
+        uint16_t(ieee1905_1::eMessageType::AP_METRICS_RESPONSE_MESSAGE),
+        uint16_t(ieee1905_1::eMessageType::ASSOCIATED_STA_LINK_METRICS_RESPONSE_MESSAGE),
+        uint16_t(ieee1905_1::eMessageType::UNASSOCIATED_STA_LINK_METRICS_RESPONSE_MESSAGE),
+        uint16_t(ieee1905_1::eMessageType::BEACON_METRICS_RESPONSE_MESSAGE),
+    };
 }
 
 bool BrokerServer::start()
@@ -127,12 +148,57 @@ bool BrokerServer::publish(const messages::Message &msg)
         return true;
     }
 
+    // Copy CMDUs once into the shared memory for the subscribers that use it
+    bool shared_memory_published = false;
+    if (m_shared_memory && msg_opcode.bits.internal == 0) {
+        uint16_t consumers = 0;
+        for (const auto &soc : types_set_it->second) {
+            auto consumer_it = m_shared_memory_consumers.find(soc);
+            if (consumer_it != m_shared_memory_consumers.end()) {
+                consumers |= 1U << consumer_it->second;
+            }
+        }
+
+        uint32_t slot;
+        uint16_t generation;
+        if (consumers != 0) {
+            shared_memory_published = m_shared_memory->publish(
+                msg.frame().data(), msg.header().len, consumers, slot, generation);
+            if (shared_memory_published) {
+                m_shared_memory_descriptor.metadata()->slot       = slot;
+                m_shared_memory_descriptor.metadata()->generation = generation;
+            } else {
+                LOG(DEBUG) << "No shared memory slot available, falling back to the sockets";
+            }
+        }
+    }
+
     // Send the message to subscribed FDs
+    EgressMessage em;
+    em.priority = get_egress_priority(msg_opcode);
     for (auto soc : types_set_it->second) {
         LOG(DEBUG) << "Sending message with type (0x" << std::hex << msg_opcode.value << std::dec
                    << ") to FD (" << soc->getSocketFd() << ")";
 
-        if (!messages::send_transport_message(*soc, msg)) {
+        auto consumer_it = shared_memory_published ? m_shared_memory_consumers.find(soc)
+                                                   : m_shared_memory_consumers.end();
+        if (consumer_it != m_shared_memory_consumers.end()) {
+            EgressMessage descriptor_em = em;
+            descriptor_em.shared_memory = true;
+            descriptor_em.slot          = m_shared_memory_descriptor.metadata()->slot;
+            descriptor_em.generation    = m_shared_memory_descriptor.metadata()->generation;
+            descriptor_em.consumer      = consumer_it->second;
+
+            // The descriptor message is reused, so copy its frame if it gets queued
+            if (!send_message(soc, m_shared_memory_descriptor, descriptor_em, true)) {
+                LOG(ERROR) << "Failed sending shared memory descriptor with type (0x" << std::hex
+                           << msg_opcode.value << std::dec << ") to FD (" << soc->getSocketFd()
+                           << ")";
+            }
+            continue;
+        }
+
+        if (!send_message(soc, msg, em, false)) {
             LOG(ERROR) << "Failed sending message with type (0x" << std::hex << msg_opcode.value
                        << std::dec << ") to FD (" << soc->getSocketFd() << ")";
 
@@ -155,6 +221,203 @@ void BrokerServer::register_external_message_handler(const MessageHandler &handl
     m_external_message_handler = handler;
 }
 
+void BrokerServer::set_egress_policy(const EgressPolicy &policy)
+{
+    m_egress_policy = policy;
+    if (m_egress_policy.max_queue_length == 0) {
+        LOG(WARNING) << "Invalid egress queue length, using 1";
+        m_egress_policy.max_queue_length = 1;
+    }
+}
+
+std::vector<BrokerServer::SubscriberStats> BrokerServer::get_subscriber_stats() const
+{
+    std::vector<SubscriberStats> stats;
+    for (const auto &entry : m_egress_queues) {
+        const auto &queue = entry.second;
+        stats.push_back({entry.first->getSocketFd(), queue.messages.size(), queue.max_queue_depth,
+                         queue.sent, queue.dropped});
+    }
+
+    return stats;
+}
+
+BrokerServer::EgressPriority
+BrokerServer::get_egress_priority(const messages::SubscribeMessage::MsgType &msg_opcode) const
+{
+    // Internal messages are control messages (e.g. CMDU TX confirmations)
+    if (msg_opcode.bits.internal) {
+        return EgressPriority::NEVER_DROP;
+    }
+
+    if (m_egress_policy.never_drop_types.count(msg_opcode.bits.type)) {
+        return EgressPriority::NEVER_DROP;
+    }
+
+    if (m_egress_policy.drop_first_types.count(msg_opcode.bits.type)) {
+        return EgressPriority::DROP_FIRST;
+    }
+
+    return EgressPriority::NORMAL;
+}
+
+bool BrokerServer::send_message(std::shared_ptr<Socket> sd, const messages::Message &msg,
+                                EgressMessage em, bool copy_frame)
+{
+    auto &queue = m_egress_queues[sd];
+
+    em.header = msg.header();
+    em.frame  = msg.frame();
+    em.offset = 0;
+
+    // Preserve the messages order - write directly only if nothing is pending
+    if (queue.messages.empty()) {
+        auto ret = write_message(*sd, em);
+        if (ret > 0) {
+            ++queue.sent;
+            return true;
+        } else if (ret < 0) {
+            drop_message(queue, em);
+            return false;
+        }
+    }
+
+    if (copy_frame) {
+        em.frame = messages::Message::Frame(em.header.len, em.frame.data());
+    }
+
+    return enqueue_message(sd, queue, std::move(em));
+}
+
+int BrokerServer::write_message(Socket &sd, EgressMessage &em)
+{
+    size_t header_len = sizeof(em.header);
+    size_t total_len  = header_len + em.header.len;
+
+    iovec iov[2];
+    int iov_count = 0;
+    if (em.offset < header_len) {
+        iov[iov_count++] = {.iov_base = reinterpret_cast<uint8_t *>(&em.header) + em.offset,
+                            .iov_len  = header_len - em.offset};
+        iov[iov_count++] = {.iov_base = em.frame.data(), .iov_len = em.header.len};
+    } else {
+        iov[iov_count++] = {.iov_base = em.frame.data() + (em.offset - header_len),
+                            .iov_len  = total_len - em.offset};
+    }
+
+    struct msghdr msgh = {};
+    msgh.msg_iov       = iov;
+    msgh.msg_iovlen    = iov_count;
+
+    // Never block - a slow subscriber must not stall the broker
+    auto ret = sendmsg(sd.getSocketFd(), &msgh, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (ret < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+            return 0;
+        }
+        LOG(ERROR) << "sendmsg failed: " << strerror(errno);
+        return -1;
+    }
+
+    em.offset += ret;
+
+    return (em.offset == total_len) ? 1 : 0;
+}
+
+bool BrokerServer::enqueue_message(std::shared_ptr<Socket> sd, EgressQueue &queue,
+                                   EgressMessage em)
+{
+    if (queue.messages.size() >= m_egress_policy.max_queue_length) {
+        // Look for the oldest message of the lowest priority, that is not higher than the
+        // priority of the new message. The partially written head must be sent completely.
+        auto victim = queue.messages.end();
+        for (auto it = queue.messages.begin(); it != queue.messages.end(); ++it) {
+            if (it->offset > 0 || it->priority == EgressPriority::NEVER_DROP ||
+                it->priority > em.priority) {
+                continue;
+            }
+            if (victim == queue.messages.end() || it->priority < victim->priority) {
+                victim = it;
+                if (victim->priority == EgressPriority::DROP_FIRST) {
+                    break;
+                }
+            }
+        }
+
+        if (victim != queue.messages.end()) {
+            drop_message(queue, *victim);
+            queue.messages.erase(victim);
+        } else if (em.priority != EgressPriority::NEVER_DROP ||
+                   queue.messages.size() >= 2 * m_egress_policy.max_queue_length) {
+            drop_message(queue, em);
+            return false;
+        }
+    }
+
+    queue.messages.push_back(std::move(em));
+    queue.max_queue_depth = std::max(queue.max_queue_depth, queue.messages.size());
+
+    // Wait for the socket to become writable
+    if (!queue.write_pending) {
+        LOG(DEBUG) << "FD (" << sd->getSocketFd() << ") is not writable, queueing messages";
+        auto on_write = [sd, this](int fd, EventLoop &loop) {
+            // NOTE: Do NOT stop the broker on errors...
+            flush_egress_queue(sd);
+            return true;
+        };
+        if (!m_event_loop->set_write_handler(sd->getSocketFd(), on_write)) {
+            return false;
+        }
+        queue.write_pending = true;
+    }
+
+    return true;
+}
+
+bool BrokerServer::flush_egress_queue(std::shared_ptr<Socket> sd)
+{
+    auto queue_it = m_egress_queues.find(sd);
+    if (queue_it == m_egress_queues.end()) {
+        return true;
+    }
+
+    auto &queue = queue_it->second;
+    while (!queue.messages.empty()) {
+        auto ret = write_message(*sd, queue.messages.front());
+        if (ret == 0) {
+            // Still not writable - wait for the next event
+            return true;
+        }
+
+        if (ret > 0) {
+            ++queue.sent;
+        } else {
+            drop_message(queue, queue.messages.front());
+        }
+        queue.messages.pop_front();
+    }
+
+    // Queue drained - stop waiting for the socket to become writable
+    LOG(DEBUG) << "FD (" << sd->getSocketFd() << ") egress queue flushed (max depth "
+               << queue.max_queue_depth << ", dropped " << queue.dropped << ")";
+    queue.write_pending = false;
+
+    return m_event_loop->set_write_handler(sd->getSocketFd(), nullptr);
+}
+
+void BrokerServer::drop_message(EgressQueue &queue, const EgressMessage &em)
+{
+    ++queue.dropped;
+
+    LOG(DEBUG) << "Dropping message with length " << em.header.len << " (dropped "
+               << queue.dropped << ")";
+
+    // Drop the reference of the subscriber that will never read the slot
+    if (em.shared_memory && m_shared_memory) {
+        m_shared_memory->release(em.slot, em.generation, em.consumer);
+    }
+}
+
 bool BrokerServer::handle_msg(std::shared_ptr<Socket> sd)
 {
     // Check if the socket contains enough bytes for the header
@@ -256,6 +519,68 @@ bool BrokerServer::handle_subscribe(std::shared_ptr<Socket> sd,
     LOG(DEBUG) << "FD (" << sd->getSocketFd() << ") subscriptions: " << std::hex
                << m_soc_to_type[sd] << std::dec;
 
+    // Negotiate the shared memory mode if requested
+    if (subscribe && msg.metadata()->shared_memory) {
+        setup_shared_memory(sd);
+    }
+
+    return true;
+}
+
+bool BrokerServer::setup_shared_memory(std::shared_ptr<Socket> sd)
+{
+    if (m_shared_memory_consumers.count(sd)) {
+        return true;
+    }
+
+    // Each consumer has its own bit in the slots of the ring, take the first one not in use
+    uint32_t used_consumers = 0;
+    for (const auto &entry : m_shared_memory_consumers) {
+        used_consumers |= 1U << entry.second;
+    }
+    uint8_t consumer = 0;
+    while (consumer < messages::SharedMemoryRing::kMaxConsumers &&
+           (used_consumers & (1U << consumer))) {
+        ++consumer;
+    }
+    if (consumer == messages::SharedMemoryRing::kMaxConsumers) {
+        LOG(WARNING) << "Too many shared memory subscribers, FD (" << sd->getSocketFd()
+                     << ") keeps using the socket";
+        return false;
+    }
+
+    if (!m_shared_memory) {
+        m_shared_memory = messages::SharedMemoryRing::create_instance();
+        if (!m_shared_memory) {
+            LOG(WARNING) << "Failed creating the shared memory, FD (" << sd->getSocketFd()
+                         << ") keeps using the socket";
+            return false;
+        }
+    }
+
+    // The configuration is written directly, so it must not interleave with queued messages
+    auto queue_it = m_egress_queues.find(sd);
+    if (queue_it != m_egress_queues.end() && !queue_it->second.messages.empty()) {
+        LOG(WARNING) << "FD (" << sd->getSocketFd()
+                     << ") has pending messages, keeps using the socket";
+        return false;
+    }
+
+    messages::SharedMemoryConfigurationMessage config;
+    config.metadata()->consumer   = consumer;
+    config.metadata()->slot_count = messages::SharedMemoryRing::kSlotCount;
+    config.metadata()->slot_size  = messages::SharedMemoryRing::kSlotSize;
+
+    // The consumers get a read-only file descriptor of the data region
+    if (!messages::send_transport_message_with_fds(
+            *sd, config, {m_shared_memory->consumer_data_fd(), m_shared_memory->state_fd()})) {
+        LOG(WARNING) << "Failed sending the shared memory to FD (" << sd->getSocketFd() << ")";
+        return false;
+    }
+
+    LOG(INFO) << "FD (" << sd->getSocketFd() << ") switched to shared memory";
+    m_shared_memory_consumers[sd] = consumer;
+
     return true;
 }
 
@@ -279,42 +604,55 @@ bool BrokerServer::socket_connected()
     // We do this on internal (Unix Domain) sockets only, since we assume that external (Hardware)
     // sockets will never block indefinitely. Internal sockets are read by software processes,
     // which can potentially hang and result in the broker "hanging" on write operations.
+    // Published messages are written without blocking and queued if needed (see send_message()),
+    // the timeout still guards the few control messages that are written directly.
     if (!new_socket->setWriteTimeout(1)) {
         LOG(WARNING) << "Failed setting 'write' timeout for fd: " << new_socket->getSocketFd();
     }
 
     // Add the newly accepted socket into the poll
+    if (!register_socket_handlers(new_socket)) {
+        return false;
+    }
+
+    m_egress_queues[new_socket];
+
+    return true;
+}
+
+bool BrokerServer::register_socket_handlers(std::shared_ptr<Socket> sd)
+{
     EventLoop::EventHandlers handlers{
         // Handlers name
         .name = {},
 
         // Handle incoming data
         .on_read =
-            [new_socket, this](int fd, EventLoop &loop) {
+            [sd, this](int fd, EventLoop &loop) {
                 // NOTE: Do NOT stop the broker on parsing errors...
-                handle_msg(new_socket);
+                handle_msg(sd);
                 return true;
             },
 
-        // Not implemented
+        // Set while the egress queue is not empty (see enqueue_message())
         .on_write = nullptr,
 
         // Remove the socket on disconnections or errors
         .on_disconnect =
-            [new_socket, this](int fd, EventLoop &loop) {
+            [sd, this](int fd, EventLoop &loop) {
                 // NOTE: Do NOT stop the broker on errors...
-                socket_disconnected(new_socket);
+                socket_disconnected(sd);
                 return true;
             },
         .on_error =
-            [new_socket, this](int fd, EventLoop &loop) {
+            [sd, this](int fd, EventLoop &loop) {
                 // NOTE: Do NOT stop the broker on errors...
-                socket_disconnected(new_socket);
+                socket_disconnected(sd);
                 return true;
             },
     };
-    if (!m_event_loop->register_handlers(new_socket->getSocketFd(), handlers)) {
-        LOG(ERROR) << "Failed adding new socket into the poll!";
+    if (!m_event_loop->register_handlers(sd->getSocketFd(), handlers)) {
+        LOG(ERROR) << "Failed adding socket into the poll!";
         return false;
     }
 
@@ -333,6 +671,29 @@ bool BrokerServer::socket_disconnected(std::shared_ptr<Socket> sd)
     // Delete the type from the list of this Socket subscriptions
     m_soc_to_type.erase(sd);
 
+    // Release the shared memory slots the subscriber still references, its consumer index can
+    // then be reused
+    auto consumer_it = m_shared_memory_consumers.find(sd);
+    if (consumer_it != m_shared_memory_consumers.end()) {
+        m_shared_memory->release_consumer(consumer_it->second);
+        m_shared_memory_consumers.erase(consumer_it);
+    }
+
+    // Drop the pending messages
+    auto queue_it = m_egress_queues.find(sd);
+    if (queue_it != m_egress_queues.end()) {
+        auto &queue = queue_it->second;
+        for (const auto &em : queue.messages) {
+            drop_message(queue, em);
+        }
+
+        LOG(DEBUG) << "FD (" << sd->getSocketFd() << ") egress stats: sent = " << queue.sent
+                   << ", dropped = " << queue.dropped
+                   << ", max queue depth = " << queue.max_queue_depth;
+
+        m_egress_queues.erase(queue_it);
+    }
+
     return true;
 }
 
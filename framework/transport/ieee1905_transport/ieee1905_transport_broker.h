@@ -12,9 +12,12 @@
 #include <bcl/beerocks_event_loop.h>
 
 #include <mapf/transport/ieee1905_transport_messages.h>
+#include <mapf/transport/ieee1905_transport_shared_memory.h>
 
+#include <deque>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace beerocks {
 namespace transport {
@@ -45,6 +48,44 @@ public:
     using MessageHandler =
         std::function<bool(std::unique_ptr<messages::Message> &msg, BrokerServer &broker)>;
 
+    /**
+     * @brief Egress (broker to subscriber) queueing policy.
+     *
+     * Messages are written to the subscriber sockets without blocking. Messages that cannot be
+     * written right away are queued per subscriber and flushed once the socket becomes writable,
+     * so a slow subscriber does not stall the broker (and the other subscribers).
+     */
+    struct EgressPolicy {
+        /**
+         * Maximum number of messages queued for a single subscriber. When the queue is full, the
+         * oldest queued message of the lowest priority is dropped to make room for the new one.
+         */
+        size_t max_queue_length = 256;
+
+        /**
+         * CMDU types that are never dropped to make room for other messages. Such messages may
+         * exceed max_queue_length, up to twice its value. Internal messages are never dropped.
+         */
+        std::unordered_set<uint16_t> never_drop_types;
+
+        /**
+         * CMDU types that are dropped first (e.g. periodic metrics, whose newer reports supersede
+         * the queued ones).
+         */
+        std::unordered_set<uint16_t> drop_first_types;
+    };
+
+    /**
+     * @brief Egress statistics of a subscriber.
+     */
+    struct SubscriberStats {
+        int fd;
+        size_t queue_depth;
+        size_t max_queue_depth;
+        uint64_t sent;
+        uint64_t dropped;
+    };
+
     /**
      * Constructor.
      * 
@@ -99,6 +140,27 @@ public:
      */
     virtual void register_external_message_handler(const MessageHandler &handler);
 
+    /**
+     * @brief Set the egress queueing policy.
+     *
+     * @param [in] policy The policy to apply to all the subscribers.
+     */
+    void set_egress_policy(const EgressPolicy &policy);
+
+    /**
+     * @brief Get the egress queueing policy.
+     *
+     * @return The current policy (the default one unless set_egress_policy() was called).
+     */
+    const EgressPolicy &get_egress_policy() const { return m_egress_policy; }
+
+    /**
+     * @brief Get the egress statistics of the connected subscribers.
+     *
+     * @return List of the subscribers statistics.
+     */
+    std::vector<SubscriberStats> get_subscriber_stats() const;
+
 protected:
     /**
      * @brief Handle incoming message.
@@ -110,6 +172,130 @@ protected:
     virtual bool handle_msg(std::shared_ptr<Socket> sd);
 
 private:
+    /**
+     * Egress priority of a message (in ascending order).
+     */
+    enum class EgressPriority { DROP_FIRST, NORMAL, NEVER_DROP };
+    // Enum AutoPrint generated code snippet begining- DON'T EDIT!
+    // clang-format off
+    static const char *EgressPriority_str(EgressPriority enum_value) {
+        switch (enum_value) {
+        case EgressPriority::DROP_FIRST: return "EgressPriority::DROP_FIRST";
+        case EgressPriority::NORMAL:     return "EgressPriority::NORMAL";
+        case EgressPriority::NEVER_DROP: return "EgressPriority::NEVER_DROP";
+        }
+        static std::string out_str = std::to_string(int(enum_value));
+        return out_str.c_str();
+    }
+    friend inline std::ostream &operator<<(std::ostream &out, EgressPriority value) { return out << EgressPriority_str(value); }
+    // clang-format on
+    // Enum AutoPrint generated code snippet end
+
+    /**
+     * Message pending in an egress queue.
+     */
+    struct EgressMessage {
+        messages::Message::Header header;
+        messages::Message::Frame frame;
+        size_t offset = 0; // Number of bytes (header and frame) already written
+        EgressPriority priority;
+
+        // Shared memory slot referenced by a descriptor message, and consumer index of the
+        // subscriber (released if the message is dropped)
+        bool shared_memory  = false;
+        uint32_t slot       = 0;
+        uint16_t generation = 0;
+        uint8_t consumer    = 0;
+    };
+
+    /**
+     * Egress queue and statistics of a subscriber.
+     */
+    struct EgressQueue {
+        std::deque<EgressMessage> messages;
+        bool write_pending     = false; // Waiting for the socket to become writable
+        size_t max_queue_depth = 0;
+        uint64_t sent          = 0;
+        uint64_t dropped       = 0;
+    };
+
+    /**
+     * @brief Send a message to a subscriber without blocking.
+     *
+     * The message is written right away if the subscriber queue is empty, and queued (according
+     * to the egress policy) otherwise or if the socket is not writable.
+     *
+     * @param [in] sd The socket of the subscriber.
+     * @param [in] msg The message to send.
+     * @param [in] em Egress properties of the message (its header and frame are set here).
+     * @param [in] copy_frame Copy the frame if the message is queued (the frame of the message is
+     * reused by the caller).
+     *
+     * @return true if the message was sent or queued and false if it was dropped.
+     */
+    bool send_message(std::shared_ptr<Socket> sd, const messages::Message &msg, EgressMessage em,
+                      bool copy_frame);
+
+    /**
+     * @brief Write (the rest of) a message to a subscriber socket without blocking.
+     *
+     * @param [in] sd The socket of the subscriber.
+     * @param [in,out] em The message to write (its offset is updated).
+     *
+     * @return 1 if the message was written completely, 0 if the socket is not writable (the
+     * message may have been partially written) and -1 on errors.
+     */
+    int write_message(Socket &sd, EgressMessage &em);
+
+    /**
+     * @brief Add a message to the egress queue of a subscriber, applying the egress policy.
+     *
+     * @param [in] sd The socket of the subscriber.
+     * @param [in] queue The egress queue of the subscriber.
+     * @param [in] em The message to queue.
+     *
+     * @return true if the message was queued and false if it was dropped.
+     */
+    bool enqueue_message(std::shared_ptr<Socket> sd, EgressQueue &queue, EgressMessage em);
+
+    /**
+     * @brief Flush the egress queue of a subscriber (called once its socket is writable).
+     *
+     * @param [in] sd The socket of the subscriber.
+     *
+     * @return true on success and false otherwise.
+     */
+    bool flush_egress_queue(std::shared_ptr<Socket> sd);
+
+    /**
+     * @brief Drop a message, releasing the shared memory slot it references.
+     *
+     * @param [in] queue The egress queue of the subscriber.
+     * @param [in] em The dropped message.
+     */
+    void drop_message(EgressQueue &queue, const EgressMessage &em);
+
+    /**
+     * @brief Get the egress priority of a message.
+     *
+     * @param [in] msg_opcode The opcode of the message (as used for subscriptions).
+     *
+     * @return The egress priority.
+     */
+    EgressPriority
+    get_egress_priority(const messages::SubscribeMessage::MsgType &msg_opcode) const;
+
+    /**
+     * @brief Register the event handlers of a subscriber socket.
+     *
+     * The write handler is only set while the egress queue of the subscriber is not empty.
+     *
+     * @param [in] sd The socket of the subscriber.
+     *
+     * @return true on success and false otherwise.
+     */
+    bool register_socket_handlers(std::shared_ptr<Socket> sd);
+
     /**
      * @brief Handle broker subscribe/unsubscribe messages.
      * 
@@ -120,6 +306,18 @@ private:
      */
     bool handle_subscribe(std::shared_ptr<Socket> sd, const messages::SubscribeMessage &msg);
 
+    /**
+     * @brief Switch a subscriber to the shared memory mode.
+     *
+     * Creates the shared memory region (on first use) and sends its file descriptor to the
+     * subscriber. On failure the subscriber keeps receiving the messages through its socket.
+     *
+     * @param [in] sd The socket of the subscriber that requested the shared memory mode.
+     *
+     * @return true on success and false otherwise.
+     */
+    bool setup_shared_memory(std::shared_ptr<Socket> sd);
+
     /**
      * @brief Handler method to accept incoming socket connections.
      * 
@@ -157,6 +355,34 @@ private:
      */
     std::unordered_map<uint32_t, std::unordered_set<std::shared_ptr<Socket>>> m_type_to_soc;
 
+    /**
+     * Shared memory region for publishing CMDUs without copying them into every subscriber
+     * socket. Created when the first subscriber requests the shared memory mode.
+     */
+    std::unique_ptr<messages::SharedMemoryRing> m_shared_memory;
+
+    /**
+     * Subscribers that receive CMDUs through the shared memory, and their consumer index in the
+     * shared memory ring.
+     */
+    std::unordered_map<std::shared_ptr<Socket>, uint8_t> m_shared_memory_consumers;
+
+    /**
+     * Descriptor sent to the shared memory subscribers (reused to avoid allocating a frame on
+     * every publish).
+     */
+    messages::SharedMemoryCmduRxMessage m_shared_memory_descriptor;
+
+    /**
+     * Egress queueing policy.
+     */
+    EgressPolicy m_egress_policy;
+
+    /**
+     * Egress queues of the subscribers.
+     */
+    std::unordered_map<std::shared_ptr<Socket>, EgressQueue> m_egress_queues;
+
     /**
      * Handler for internal (non-CMDU) messages.
      */
@@ -0,0 +1,273 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "ieee1905_transport_capture.h"
+
+#include <mapf/common/logger.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace beerocks {
+namespace transport {
+
+namespace {
+
+// pcapng block types
+constexpr uint32_t kSectionHeaderBlock        = 0x0A0D0D0A;
+constexpr uint32_t kInterfaceDescriptionBlock = 0x00000001;
+constexpr uint32_t kEnhancedPacketBlock       = 0x00000006;
+// Block types with the most significant bit set are reserved for local use and skipped by readers
+constexpr uint32_t kFillerBlock = 0x80000001;
+
+// pcapng option codes
+constexpr uint16_t kOptEndOfOpt = 0;
+constexpr uint16_t kOptIfName   = 2;
+constexpr uint16_t kOptEpbFlags = 2;
+
+constexpr uint32_t kByteOrderMagic   = 0x1A2B3C4D;
+constexpr uint16_t kLinkTypeEthernet = 1;
+
+// Fixed part of an EPB: type, length, interface id, timestamp (2), captured and original length,
+// and the trailing length
+constexpr size_t kEpbFixedSize = 8 * sizeof(uint32_t);
+// EPB options: flags (header and 32-bit value) followed by the end of options marker
+constexpr size_t kEpbOptionsSize = 3 * sizeof(uint32_t);
+// Smallest valid block: type and length at both ends of an empty body
+constexpr size_t kFillerMinSize = 3 * sizeof(uint32_t);
+
+// Each slot holds an EPB with the largest captured frame, its options and a filler block
+constexpr size_t kSlotSize =
+    kEpbFixedSize + PcapngCapture::kSnapLength + kEpbOptionsSize + kFillerMinSize;
+static_assert(kSlotSize % 4 == 0, "pcapng blocks must be 32-bit aligned");
+
+constexpr size_t kMinSlotCount = 16;
+
+const char *const kInterfaceNames[] = {"network", "local_bus"};
+
+size_t pad4(size_t length) { return (length + 3) & ~size_t(3); }
+
+/**
+ * Helper for writing the 32-bit aligned fields of a block in host byte order.
+ */
+class BlockWriter {
+public:
+    explicit BlockWriter(uint8_t *buffer) : m_start(buffer), m_pos(buffer) {}
+
+    void u16(uint16_t value) { put(&value, sizeof(value)); }
+    void u32(uint32_t value) { put(&value, sizeof(value)); }
+    void raw(const void *data, size_t length) { put(data, length); }
+    void bytes(const void *data, size_t length)
+    {
+        put(data, length);
+        zero(pad4(length) - length);
+    }
+    void zero(size_t length)
+    {
+        std::memset(m_pos, 0, length);
+        m_pos += length;
+    }
+    size_t size() const { return m_pos - m_start; }
+
+private:
+    void put(const void *data, size_t length)
+    {
+        std::memcpy(m_pos, data, length);
+        m_pos += length;
+    }
+
+    uint8_t *m_start;
+    uint8_t *m_pos;
+};
+
+size_t write_section_header(uint8_t *buffer)
+{
+    constexpr uint32_t length = 28;
+    BlockWriter block(buffer);
+    block.u32(kSectionHeaderBlock);
+    block.u32(length);
+    block.u32(kByteOrderMagic);
+    block.u16(1);          // major version
+    block.u16(0);          // minor version
+    block.u32(0xFFFFFFFF); // section length is not specified
+    block.u32(0xFFFFFFFF);
+    block.u32(length);
+    return block.size();
+}
+
+size_t write_interface_description(uint8_t *buffer, const char *name)
+{
+    size_t name_length = std::strlen(name);
+    uint32_t length    = 20 + sizeof(uint32_t) + pad4(name_length) + sizeof(uint32_t);
+    BlockWriter block(buffer);
+    block.u32(kInterfaceDescriptionBlock);
+    block.u32(length);
+    block.u16(kLinkTypeEthernet);
+    block.u16(0); // reserved
+    block.u32(PcapngCapture::kSnapLength);
+    block.u16(kOptIfName);
+    block.u16(name_length);
+    block.bytes(name, name_length);
+    block.u16(kOptEndOfOpt);
+    block.u16(0);
+    block.u32(length);
+    return block.size();
+}
+
+void write_filler(uint8_t *buffer, size_t length)
+{
+    BlockWriter block(buffer);
+    block.u32(kFillerBlock);
+    block.u32(length);
+    block.zero(length - 3 * sizeof(uint32_t));
+    block.u32(length);
+}
+
+} // namespace
+
+// Declaration of static members
+constexpr size_t PcapngCapture::kSnapLength;
+constexpr size_t PcapngCapture::kDefaultSize;
+constexpr size_t PcapngCapture::kMaxSize;
+
+PcapngCapture::~PcapngCapture() { stop(); }
+
+bool PcapngCapture::start(const std::string &path, size_t size)
+{
+    stop();
+
+    // Room for the header blocks, computed by writing them into a scratch buffer
+    uint8_t header[128];
+    size_t header_size = write_section_header(header);
+    for (auto name : kInterfaceNames) {
+        header_size += write_interface_description(header + header_size, name);
+    }
+
+    if (size < header_size + kMinSlotCount * kSlotSize) {
+        LOG(ERROR) << "Capture size " << size << " is too small, at least "
+                   << header_size + kMinSlotCount * kSlotSize << " bytes are required";
+        return false;
+    }
+    if (size > kMaxSize) {
+        LOG(ERROR) << "Capture size " << size << " is too large, at most " << kMaxSize
+                   << " bytes are allowed";
+        return false;
+    }
+    size_t slot_count = (size - header_size) / kSlotSize;
+    size              = header_size + slot_count * kSlotSize;
+
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_NOFOLLOW | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        LOG(ERROR) << "Failed to open capture file " << path << ": " << strerror(errno);
+        return false;
+    }
+    if (ftruncate(fd, size) != 0) {
+        LOG(ERROR) << "Failed to resize capture file " << path << ": " << strerror(errno);
+        close(fd);
+        return false;
+    }
+    void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        LOG(ERROR) << "Failed to map capture file " << path << ": " << strerror(errno);
+        return false;
+    }
+
+    m_base       = static_cast<uint8_t *>(base);
+    m_size       = size;
+    m_slots      = m_base + header_size;
+    m_slot_count = slot_count;
+    m_next_slot  = 0;
+
+    std::memcpy(m_base, header, header_size);
+    for (size_t i = 0; i < m_slot_count; i++) {
+        write_filler(m_slots + i * kSlotSize, kSlotSize);
+    }
+
+    m_enabled.store(true, std::memory_order_release);
+
+    LOG(INFO) << "Capturing to " << path << " (" << m_slot_count << " packets)";
+    return true;
+}
+
+void PcapngCapture::stop()
+{
+    m_enabled.store(false, std::memory_order_release);
+
+    if (!m_base) {
+        return;
+    }
+
+    LOG(INFO) << "Capture stopped after " << m_next_slot.load() << " packets";
+
+    munmap(m_base, m_size);
+    m_base       = nullptr;
+    m_size       = 0;
+    m_slots      = nullptr;
+    m_slot_count = 0;
+}
+
+void PcapngCapture::record(Interface interface, Direction direction, const struct iovec *iov,
+                           size_t iovcnt)
+{
+    if (!enabled()) {
+        return;
+    }
+
+    size_t length = 0;
+    for (size_t i = 0; i < iovcnt; i++) {
+        length += iov[i].iov_len;
+    }
+    size_t captured_length = std::min(length, kSnapLength);
+
+    uint64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::system_clock::now().time_since_epoch())
+                             .count();
+
+    // Claim the next slot. Writers only contend on this counter: two writers end up in the same
+    // slot only if the whole ring is filled while the first one is still copying its frame.
+    uint64_t seq  = m_next_slot.fetch_add(1, std::memory_order_relaxed);
+    uint8_t *slot = m_slots + (seq % m_slot_count) * kSlotSize;
+
+    uint32_t epb_length = kEpbFixedSize + pad4(captured_length) + kEpbOptionsSize;
+
+    BlockWriter block(slot);
+    block.u32(kEnhancedPacketBlock);
+    block.u32(epb_length);
+    block.u32(static_cast<uint32_t>(interface));
+    block.u32(timestamp >> 32);
+    block.u32(timestamp & 0xFFFFFFFF);
+    block.u32(captured_length);
+    block.u32(length);
+
+    size_t remaining = captured_length;
+    for (size_t i = 0; i < iovcnt && remaining > 0; i++) {
+        size_t chunk = std::min(iov[i].iov_len, remaining);
+        block.raw(iov[i].iov_base, chunk);
+        remaining -= chunk;
+    }
+    block.zero(pad4(captured_length) - captured_length);
+
+    block.u16(kOptEpbFlags);
+    block.u16(sizeof(uint32_t));
+    block.u32(static_cast<uint32_t>(direction));
+    block.u16(kOptEndOfOpt);
+    block.u16(0);
+    block.u32(epb_length);
+
+    // Pad the rest of the slot so that the next block starts where readers expect it
+    write_filler(slot + epb_length, kSlotSize - epb_length);
+}
+
+} // namespace transport
+} // namespace beerocks
@@ -0,0 +1,141 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef IEEE1905_TRANSPORT_CAPTURE_H
+#define IEEE1905_TRANSPORT_CAPTURE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <sys/uio.h>
+
+namespace beerocks {
+namespace transport {
+
+/**
+ * @brief In-process pcapng recorder for the frames handled by the transport.
+ *
+ * Frames are written into a fixed-size memory-mapped file organized as a circular buffer: the
+ * Section Header Block and one Interface Description Block per capture point are followed by
+ * fixed-size slots, each one holding an Enhanced Packet Block padded up to the slot size (with
+ * EPB options and/or a local-use filler block). The file is therefore always a valid pcapng file
+ * that can be opened while the capture is running, at most the slots being written at that moment
+ * are incomplete. Once the ring wraps around, the oldest packets are overwritten and the packets
+ * in the file are no longer in chronological order (the oldest one follows the newest one).
+ *
+ * record() is lock-free and may be called concurrently from several threads: each caller claims
+ * a slot through an atomic counter and copies the frame into it. When the capture is disabled
+ * record() is never reached (callers check enabled() first), so nothing is copied.
+ *
+ * start() and stop() must not run concurrently with record().
+ */
+class PcapngCapture {
+public:
+    /**
+     * Capture points, in the order of the Interface Description Blocks in the file.
+     */
+    enum class Interface : uint32_t { NETWORK = 0, LOCAL_BUS = 1 };
+    // Enum AutoPrint generated code snippet begining- DON'T EDIT!
+    // clang-format off
+    static const char *Interface_str(Interface enum_value) {
+        switch (enum_value) {
+        case Interface::NETWORK:   return "Interface::NETWORK";
+        case Interface::LOCAL_BUS: return "Interface::LOCAL_BUS";
+        }
+        static std::string out_str = std::to_string(int(enum_value));
+        return out_str.c_str();
+    }
+    friend inline std::ostream &operator<<(std::ostream &out, Interface value) { return out << Interface_str(value); }
+    // clang-format on
+    // Enum AutoPrint generated code snippet end
+
+    /**
+     * Packet direction, as encoded in the EPB flags option.
+     */
+    enum class Direction : uint32_t { INBOUND = 1, OUTBOUND = 2 };
+    // Enum AutoPrint generated code snippet begining- DON'T EDIT!
+    // clang-format off
+    static const char *Direction_str(Direction enum_value) {
+        switch (enum_value) {
+        case Direction::INBOUND:  return "Direction::INBOUND";
+        case Direction::OUTBOUND: return "Direction::OUTBOUND";
+        }
+        static std::string out_str = std::to_string(int(enum_value));
+        return out_str.c_str();
+    }
+    friend inline std::ostream &operator<<(std::ostream &out, Direction value) { return out << Direction_str(value); }
+    // clang-format on
+    // Enum AutoPrint generated code snippet end
+
+    /**
+     * Maximum number of bytes captured per frame (longer frames are truncated).
+     */
+    static constexpr size_t kSnapLength = 2048;
+
+    /**
+     * Default size of the capture file.
+     */
+    static constexpr size_t kDefaultSize = 1024 * 1024;
+
+    /**
+     * Maximum size of the capture file.
+     */
+    static constexpr size_t kMaxSize = 64 * 1024 * 1024;
+
+    PcapngCapture() = default;
+    ~PcapngCapture();
+
+    PcapngCapture(const PcapngCapture &) = delete;
+    PcapngCapture &operator=(const PcapngCapture &) = delete;
+
+    /**
+     * @brief Creates the capture file and starts recording.
+     *
+     * @param path Path of the capture file (truncated if it already exists, but not followed if it
+     * is a symbolic link).
+     * @param size Size of the capture file, rounded down to a whole number of slots (at most
+     * kMaxSize).
+     * @return true on success and false otherwise.
+     */
+    bool start(const std::string &path, size_t size = kDefaultSize);
+
+    /**
+     * @brief Stops recording and unmaps the capture file.
+     */
+    void stop();
+
+    /**
+     * @brief Checks if the capture is running.
+     */
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Records a frame given as a list of buffers.
+     *
+     * @param interface Capture point the frame was seen at.
+     * @param direction Direction of the frame.
+     * @param iov Buffers holding the frame, starting with its ethernet header.
+     * @param iovcnt Number of buffers.
+     */
+    void record(Interface interface, Direction direction, const struct iovec *iov, size_t iovcnt);
+
+private:
+    uint8_t *m_base     = nullptr;
+    size_t m_size       = 0;
+    uint8_t *m_slots    = nullptr;
+    size_t m_slot_count = 0;
+    std::atomic<uint64_t> m_next_slot{0};
+    std::atomic<bool> m_enabled{false};
+};
+
+} // namespace transport
+} // namespace beerocks
+
+#endif // IEEE1905_TRANSPORT_CAPTURE_H
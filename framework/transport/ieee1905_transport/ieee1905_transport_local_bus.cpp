@@ -40,6 +40,16 @@ void Ieee1905Transport::handle_broker_pollin_event(std::unique_ptr<messages::Mes
         MAPF_DBG("received VlanConfigurationRequestMessage message:" << std::endl
                                                                      << *vlan_configuration_msg);
         handle_vlan_configuration_request_message(*vlan_configuration_msg);
+    } else if (auto *telemetry_query_msg =
+                   dynamic_cast<TransportTelemetryQueryMessage *>(msg.get())) {
+        MAPF_DBG("received TransportTelemetryQueryMessage message:" << std::endl
+                                                                    << *telemetry_query_msg);
+        handle_transport_telemetry_query_message(*telemetry_query_msg);
+    } else if (auto *capture_control_msg =
+                   dynamic_cast<TransportCaptureControlMessage *>(msg.get())) {
+        MAPF_DBG("received TransportCaptureControlMessage message:" << std::endl
+                                                                    << *capture_control_msg);
+        handle_transport_capture_control_message(*capture_control_msg);
     } else {
         // should never receive messages which we are not subscribed to
         MAPF_WARN("received un-expected message:" << std::endl << *msg);
@@ -95,6 +105,11 @@ void Ieee1905Transport::handle_broker_cmdu_tx_message(CmduTxMessage &msg)
         }
     }
 
+    if (capture_.enabled()) {
+        capture_local_bus_packet(packet, msg.data(), msg.metadata()->length,
+                                 PcapngCapture::Direction::INBOUND);
+    }
+
     counters_[CounterId::OUTGOING_LOCAL_BUS_PACKETS]++;
     handle_packet(packet);
 }
@@ -106,11 +121,15 @@ void Ieee1905Transport::handle_broker_interface_configuration_request_message(
     std::map<std::string, NetworkInterface> removed_network_interfaces;
 
     LOG(DEBUG) << "handle_broker_interface_configuration_request_message(): "
-               << "iface_name=" << msg.metadata()->iface_name << ", add= " << msg.metadata()->add;
+               << "iface_name=" << msg.metadata()->iface_name << ", add= " << msg.metadata()->add
+               << ", rx_ring= " << msg.metadata()->rx_ring;
+
+    bool use_rx_ring = msg.metadata()->rx_ring;
 
     if (msg.metadata()->is_bridge) {
-        auto bridge_name = msg.metadata()->iface_name;
-        bridge_name_     = bridge_name;
+        auto bridge_name    = msg.metadata()->iface_name;
+        bridge_name_        = bridge_name;
+        bridge_use_rx_ring_ = use_rx_ring;
         MAPF_INFO("Using bridge: " << bridge_name);
 
         // fill a set with the interfaces that are part of the bridge:
@@ -133,6 +152,7 @@ void Ieee1905Transport::handle_broker_interface_configuration_request_message(
                 added_updated_network_interfaces[ifname].ifname      = ifname;
                 added_updated_network_interfaces[ifname].bridge_name = bridge_name;
                 added_updated_network_interfaces[ifname].is_bridge   = false;
+                added_updated_network_interfaces[ifname].use_rx_ring = use_rx_ring;
             }
         }
     }
@@ -144,6 +164,7 @@ void Ieee1905Transport::handle_broker_interface_configuration_request_message(
             added_updated_network_interfaces[iface_name].ifname      = iface_name;
             added_updated_network_interfaces[iface_name].bridge_name = bridge_name;
             added_updated_network_interfaces[iface_name].is_bridge   = false;
+            added_updated_network_interfaces[iface_name].use_rx_ring = use_rx_ring;
         } else {
             removed_network_interfaces[iface_name].ifname      = iface_name;
             removed_network_interfaces[iface_name].bridge_name = bridge_name;
@@ -172,8 +193,92 @@ void Ieee1905Transport::handle_vlan_configuration_request_message(
     set_primary_vlan_id(primary_vlan_id, msg.metadata()->add);
 }
 
+void Ieee1905Transport::handle_transport_telemetry_query_message(
+    TransportTelemetryQueryMessage &msg)
+{
+    // Report the message types that were seen and the broker subscribers, splitting the report
+    // if it does not fit in a single message
+    TransportTelemetryReportMessage report;
+    auto flush_report = [&](bool more) {
+        report.metadata()->more = more;
+        if (!m_broker->publish(report)) {
+            MAPF_ERR("failed to publish the telemetry report.");
+        }
+        report.metadata()->entry_count      = 0;
+        report.metadata()->subscriber_count = 0;
+    };
+
+    // With the RX pipeline, the receive side of the table is updated by the RX thread
+    decltype(telemetry_) telemetry;
+    rx_pipeline_call([&]() { telemetry = telemetry_; });
+
+    for (size_t index = 0; index < telemetry.size(); index++) {
+        const auto &entry = telemetry[index];
+        if (!entry.rx_packets && !entry.tx_packets && !entry.de_duplication_drops) {
+            continue;
+        }
+
+        if (report.metadata()->entry_count == TransportTelemetryReportMessage::kMaxEntries) {
+            flush_report(true);
+        }
+
+        auto &report_entry    = report.metadata()->entries[report.metadata()->entry_count++];
+        report_entry          = entry;
+        report_entry.msg_type = get_telemetry_msg_type(index);
+    }
+
+    for (const auto &stats : m_broker->get_subscriber_stats()) {
+        if (report.metadata()->subscriber_count ==
+            TransportTelemetryReportMessage::kMaxSubscribers) {
+            flush_report(true);
+        }
+
+        auto &subscriber = report.metadata()->subscribers[report.metadata()->subscriber_count++];
+        subscriber.fd              = stats.fd;
+        subscriber.queue_depth     = stats.queue_depth;
+        subscriber.max_queue_depth = stats.max_queue_depth;
+        subscriber.sent            = stats.sent;
+        subscriber.dropped         = stats.dropped;
+    }
+
+    flush_report(false);
+}
+
+void Ieee1905Transport::handle_transport_capture_control_message(
+    TransportCaptureControlMessage &msg)
+{
+    // Any local bus client can send this request, so it only names a file in the temporary
+    // directory: paths (and so "." and "..") are rejected
+    std::string name(msg.metadata()->path,
+                     strnlen(msg.metadata()->path, TransportCaptureControlMessage::kMaxPathLength));
+    if (name.empty()) {
+        name = "ieee1905_transport.pcapng";
+    }
+    if (name.find('/') != std::string::npos || name.find("..") != std::string::npos ||
+        name == ".") {
+        LOG(ERROR) << "Invalid capture file name: " << name;
+        return;
+    }
+    std::string path = std::string(TMP_PATH) + "/" + name;
+    size_t size = msg.metadata()->size ? msg.metadata()->size : PcapngCapture::kDefaultSize;
+
+    // The RX thread records the received frames, so the capture file is (un)mapped while it is
+    // idle
+    bool success = true;
+    rx_pipeline_call([&]() {
+        capture_.stop();
+        if (msg.metadata()->enable) {
+            success = capture_.start(path, size);
+        }
+    });
+
+    LOG_IF(!success, ERROR) << "Failed to start the capture to " << path;
+}
+
 bool Ieee1905Transport::send_packet_to_broker(Packet &packet)
 {
+    IEEE1905_TRANSPORT_STAGE_TIMER(PUBLISH);
+
     // Create and fill an CmduRxMessage to be sent to the broker
     CmduRxMessage msg;
 
@@ -183,11 +288,12 @@ bool Ieee1905Transport::send_packet_to_broker(Packet &packet)
     msg.metadata()->ether_type    = packet.ether_type;
     msg.metadata()->if_type       = packet.src_if_type;
     msg.metadata()->if_index      = packet.src_if_index;
-    msg.metadata()->length        = packet.payload.iov_len;
+    msg.metadata()->length        = packet.payload_length();
     msg.metadata()->received_time = std::chrono::duration_cast<std::chrono::seconds>(
                                         std::chrono::system_clock::now().time_since_epoch())
                                         .count();
-    std::copy_n((uint8_t *)packet.payload.iov_base, packet.payload.iov_len, msg.data());
+    // a de-fragmented CMDU is coalesced here, straight into the published message
+    packet.copy_payload(msg.data());
 
     if (packet.ether_type == ETH_P_1905_1) {
         Ieee1905CmduHeader *ch   = reinterpret_cast<Ieee1905CmduHeader *>(packet.payload.iov_base);
@@ -200,15 +306,41 @@ bool Ieee1905Transport::send_packet_to_broker(Packet &packet)
 
     counters_[CounterId::INCOMMING_LOCAL_BUS_PACKETS]++;
 
+    if (capture_.enabled()) {
+        capture_local_bus_packet(packet, msg.data(), msg.metadata()->length,
+                                 PcapngCapture::Direction::OUTBOUND);
+    }
+
     MAPF_DBG("publishing CmduRxMessage:" << std::endl << msg);
     if (!m_broker->publish(msg)) {
         MAPF_ERR("failed to publish message to broker.");
         return false;
     }
 
+    if (packet.src_if_type == CmduRxMessage::IF_TYPE_NET) {
+        if (auto telemetry = get_telemetry(packet)) {
+            update_telemetry_latency(telemetry->publish_latency,
+                                     std::chrono::steady_clock::now() - packet.rx_time);
+        }
+    }
+
     return true;
 }
 
+void Ieee1905Transport::capture_local_bus_packet(const Packet &packet, const uint8_t *payload,
+                                                 size_t length,
+                                                 PcapngCapture::Direction direction)
+{
+    struct ether_header eh;
+    tlvf::mac_to_array(packet.dst, eh.ether_dhost);
+    tlvf::mac_to_array(packet.src, eh.ether_shost);
+    eh.ether_type = htons(packet.ether_type);
+
+    struct iovec frame[] = {{.iov_base = &eh, .iov_len = sizeof(eh)},
+                            {.iov_base = const_cast<uint8_t *>(payload), .iov_len = length}};
+    capture_.record(PcapngCapture::Interface::LOCAL_BUS, direction, frame, 2);
+}
+
 uint16_t Ieee1905Transport::get_next_message_id()
 {
     message_id_++;
@@ -8,6 +8,7 @@
 
 #include <mapf/transport/ieee1905_transport_messages.h>
 
+#include <sys/socket.h>
 #include <sys/uio.h>
 
 #include <easylogging++.h>
@@ -20,6 +21,12 @@ namespace messages {
 constexpr uint32_t Message::kMessageMagic;
 constexpr uint32_t Message::kMaxFrameLength;
 constexpr uint8_t SubscribeMessage::MAX_SUBSCRIBE_TYPES;
+constexpr uint8_t TransportTelemetryReportMessage::kMaxEntries;
+constexpr uint8_t TransportTelemetryReportMessage::kMaxSubscribers;
+constexpr size_t TransportCaptureControlMessage::kMaxPathLength;
+
+static_assert(sizeof(TransportTelemetryReportMessage::Metadata) <= Message::kMaxFrameLength,
+              "Telemetry report does not fit in a message frame");
 
 //////////////////////////////////////////////////////////////////////////////
 ////////////////////////////// Helper Functions //////////////////////////////
@@ -47,6 +54,21 @@ create_transport_message(Type type, std::initializer_list<messages::Message::Fra
     case messages::Type::VlanConfigurationRequestMessage:
         return std::unique_ptr<messages::VlanConfigurationRequestMessage>{
             new messages::VlanConfigurationRequestMessage(frame)};
+    case messages::Type::SharedMemoryConfigurationMessage:
+        return std::unique_ptr<messages::SharedMemoryConfigurationMessage>{
+            new messages::SharedMemoryConfigurationMessage(frame)};
+    case messages::Type::SharedMemoryCmduRxMessage:
+        return std::unique_ptr<messages::SharedMemoryCmduRxMessage>{
+            new messages::SharedMemoryCmduRxMessage(frame)};
+    case messages::Type::TransportTelemetryQueryMessage:
+        return std::unique_ptr<messages::TransportTelemetryQueryMessage>{
+            new messages::TransportTelemetryQueryMessage(frame)};
+    case messages::Type::TransportTelemetryReportMessage:
+        return std::unique_ptr<messages::TransportTelemetryReportMessage>{
+            new messages::TransportTelemetryReportMessage(frame)};
+    case messages::Type::TransportCaptureControlMessage:
+        return std::unique_ptr<messages::TransportCaptureControlMessage>{
+            new messages::TransportCaptureControlMessage(frame)};
     default:
         LOG(WARNING) << "Received unknown message type: " << int(type);
         return std::unique_ptr<messages::Message>{new messages::Message(Type::Invalid, frame)};
@@ -147,6 +169,43 @@ bool send_transport_message(Socket &sd, const Message &msg, const Message::Heade
     return true;
 }
 
+bool send_transport_message_with_fds(Socket &sd, const Message &msg, const std::vector<int> &fds)
+{
+    if (fds.empty() || fds.size() > kMaxPassedFds) {
+        LOG(ERROR) << "Invalid number of file descriptors to pass: " << fds.size();
+        return false;
+    }
+
+    auto hdr    = msg.header();
+    iovec iov[] = {{.iov_base = (void *)&hdr, .iov_len = sizeof(hdr)},
+                   {.iov_base = (void *)(msg.frame().data()), .iov_len = hdr.len}};
+
+    union {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(sizeof(int) * kMaxPassedFds)];
+    } control = {};
+
+    size_t fds_size      = sizeof(int) * fds.size();
+    struct msghdr msgh   = {};
+    msgh.msg_iov         = iov;
+    msgh.msg_iovlen      = sizeof(iov) / sizeof(struct iovec);
+    msgh.msg_control     = control.buf;
+    msgh.msg_controllen  = CMSG_SPACE(fds_size);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msgh);
+    cmsg->cmsg_level     = SOL_SOCKET;
+    cmsg->cmsg_type      = SCM_RIGHTS;
+    cmsg->cmsg_len       = CMSG_LEN(fds_size);
+    std::copy_n(reinterpret_cast<const uint8_t *>(fds.data()), fds_size, CMSG_DATA(cmsg));
+
+    // Write the header and the data to the socket
+    if (sendmsg(sd.getSocketFd(), &msgh, MSG_NOSIGNAL) < 0) {
+        LOG(ERROR) << "sendmsg failed: " << strerror(errno);
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace messages
 } // namespace transport
 } // namespace beerocks
@@ -12,10 +12,11 @@
 #include <bpl/bpl_cfg.h>
 #include <iomanip>
 #include <linux/filter.h>
+#include <linux/if_packet.h>
 #include <net/if.h>
 #include <netinet/ether.h>
-#include <netpacket/packet.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <sys/uio.h>
 #include <unistd.h>
@@ -26,6 +27,13 @@ namespace transport {
 // Use transport messaging classes
 using namespace beerocks::transport::messages;
 
+constexpr unsigned int Ieee1905Transport::kRxRingBlockSize;
+constexpr unsigned int Ieee1905Transport::kRxRingBlockCount;
+constexpr unsigned int Ieee1905Transport::kRxRingFrameSize;
+constexpr unsigned int Ieee1905Transport::kRxRingBlockTimeoutMs;
+constexpr size_t Ieee1905Transport::kTxBatchFrameSize;
+constexpr size_t Ieee1905Transport::kTxBatchMaxFrames;
+
 void Ieee1905Transport::update_network_interfaces(
     const std::map<std::string, NetworkInterface> &added_updated_network_interfaces,
     const std::map<std::string, NetworkInterface> &removed_network_interfaces)
@@ -42,7 +50,9 @@ void Ieee1905Transport::update_network_interfaces(
         auto &network_interface = iface_it->second;
 
         if (network_interface.fd) {
-            m_event_loop->remove_handlers(network_interface.fd->getSocketFd());
+            rx_pipeline_call([&]() {
+                get_interface_event_loop()->remove_handlers(network_interface.fd->getSocketFd());
+            });
             network_interface.fd = nullptr;
         }
 
@@ -56,15 +66,16 @@ void Ieee1905Transport::update_network_interfaces(
         auto &bridge_name = updated_network_interface.bridge_name;
         auto &ifname      = updated_network_interface.ifname;
         auto is_bridge    = updated_network_interface.is_bridge;
+        auto use_rx_ring  = updated_network_interface.use_rx_ring;
         LOG(DEBUG) << "Adding iface " << ifname << ", is_bridge=" << is_bridge
-                   << ", bridge_name=" << bridge_name;
-        update_network_interface(bridge_name, ifname, true, is_bridge);
+                   << ", bridge_name=" << bridge_name << ", use_rx_ring=" << use_rx_ring;
+        update_network_interface(bridge_name, ifname, true, is_bridge, use_rx_ring);
     }
 }
 
 bool Ieee1905Transport::update_network_interface(const std::string &bridge_name,
                                                  const std::string &ifname, bool iface_added,
-                                                 bool is_bridge)
+                                                 bool is_bridge, bool use_rx_ring)
 {
     if (iface_added) {
         // Add the new interface to network_interfaces_
@@ -82,6 +93,7 @@ bool Ieee1905Transport::update_network_interface(const std::string &bridge_name,
         interface.ifname      = ifname;
         interface.bridge_name = bridge_name;
         interface.is_bridge   = is_bridge;
+        interface.use_rx_ring = use_rx_ring;
 
         // must be called before open_interface_socket (address is used for packet filtering)
         if (!get_interface_mac_addr(if_index, interface.addr)) {
@@ -194,11 +206,90 @@ bool Ieee1905Transport::open_interface_socket(NetworkInterface &interface)
     MAPF_DBG("Raw socket on interface " << interface.ifname << " opened with FD (" << sockfd
                                         << ").");
 
+    // The bridge socket is used for sending only, so it never needs a receive ring
+    if (interface.use_rx_ring && !interface.is_bridge) {
+        if (!open_interface_rx_ring(interface)) {
+            MAPF_WARN("Receive ring not available on interface "
+                      << interface.ifname << ", falling back to the event loop receive.");
+        }
+    }
+
     attach_interface_socket_filter(interface);
 
     return true;
 }
 
+bool Ieee1905Transport::open_interface_rx_ring(NetworkInterface &interface)
+{
+    int fd = interface.fd->getSocketFd();
+
+    int version = TPACKET_V3;
+    if (setsockopt(fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0) {
+        MAPF_ERR("Failed setting PACKET_VERSION on FD (" << fd << "): " << strerror(errno));
+        return false;
+    }
+
+    struct tpacket_req3 req = {};
+    req.tp_block_size       = kRxRingBlockSize;
+    req.tp_block_nr         = kRxRingBlockCount;
+    req.tp_frame_size       = kRxRingFrameSize;
+    req.tp_frame_nr         = (kRxRingBlockSize * kRxRingBlockCount) / kRxRingFrameSize;
+    req.tp_retire_blk_tov   = kRxRingBlockTimeoutMs;
+    if (setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0) {
+        MAPF_ERR("Failed setting PACKET_RX_RING on FD (" << fd << "): " << strerror(errno));
+        return false;
+    }
+
+    size_t ring_size = size_t(kRxRingBlockSize) * kRxRingBlockCount;
+    void *ring       = mmap(nullptr, ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ring == MAP_FAILED) {
+        MAPF_ERR("Failed mapping the receive ring of FD (" << fd << "): " << strerror(errno));
+
+        // Release the ring so that frames are queued on the socket again
+        req = {};
+        setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req));
+        return false;
+    }
+
+    interface.rx_ring       = static_cast<uint8_t *>(ring);
+    interface.rx_ring_block = 0;
+
+    MAPF_DBG("Receive ring of " << ring_size << " bytes mapped on interface " << interface.ifname
+                                << " FD (" << fd << ").");
+
+    return true;
+}
+
+void Ieee1905Transport::close_interface_rx_ring(NetworkInterface &interface)
+{
+    if (!interface.rx_ring) {
+        return;
+    }
+
+    munmap(interface.rx_ring, size_t(kRxRingBlockSize) * kRxRingBlockCount);
+    interface.rx_ring       = nullptr;
+    interface.rx_ring_block = 0;
+}
+
+void Ieee1905Transport::drain_interface_rx_ring(NetworkInterface &interface)
+{
+    if (!interface.rx_ring) {
+        return;
+    }
+
+    // Give back to the kernel all the blocks that are currently owned by user space
+    for (unsigned int i = 0; i < kRxRingBlockCount; i++) {
+        auto block = reinterpret_cast<struct tpacket_block_desc *>(
+            interface.rx_ring + size_t(interface.rx_ring_block) * kRxRingBlockSize);
+        if (!(block->hdr.bh1.block_status & TP_STATUS_USER)) {
+            break;
+        }
+        __sync_synchronize();
+        block->hdr.bh1.block_status = TP_STATUS_KERNEL;
+        interface.rx_ring_block     = (interface.rx_ring_block + 1) % kRxRingBlockCount;
+    }
+}
+
 bool Ieee1905Transport::attach_interface_socket_filter(NetworkInterface &interface)
 {
     int fd = interface.fd->getSocketFd();
@@ -239,6 +330,8 @@ bool Ieee1905Transport::attach_interface_socket_filter(NetworkInterface &interfa
     // here we choose to ignore the error code such as EINTR
     while (recv(fd, &drain, sizeof(drain), MSG_DONTWAIT) >= 0)
         ;
+    // when a receive ring is used, buffered frames are held in the ring instead of the socket
+    rx_pipeline_call([&]() { drain_interface_rx_ring(interface); });
 
     // This BPF is designed to accepts the following packets:
     // - IEEE1905 multicast packets (with IEEE1905 Multicast Address [01:80:c2:00:00:13] set as destination address)
@@ -295,7 +388,8 @@ void Ieee1905Transport::handle_interface_state_change(const std::string &ifname,
         auto iter = std::find(pending_network_interfaces_.begin(),
                               pending_network_interfaces_.end(), ifname);
         if (iter != pending_network_interfaces_.end() && is_active) {
-            if (update_network_interface(bridge_name_, ifname, true, false)) {
+            if (update_network_interface(bridge_name_, ifname, true, false,
+                                         bridge_use_rx_ring_)) {
                 MAPF_INFO("Activated pending network interface " << ifname << ".");
                 pending_network_interfaces_.erase(iter);
             } else {
@@ -323,7 +417,7 @@ void Ieee1905Transport::handle_bridge_state_change(const std::string &bridge_nam
               << iface_name << " " << (iface_added ? "added to" : "removed from") << " bridge "
               << bridge_name << ".");
 
-    update_network_interface(bridge_name, iface_name, iface_added, false);
+    update_network_interface(bridge_name, iface_name, iface_added, false, bridge_use_rx_ring_);
 }
 
 void Ieee1905Transport::deactivate_interface(NetworkInterface &interface, bool remove_handlers)
@@ -338,12 +432,16 @@ void Ieee1905Transport::deactivate_interface(NetworkInterface &interface, bool r
     // The bridge interface is not used for receiving but for sending packets only. Since no
     // event handlers were registered when the socket was open, neither they have to be removed
     // when the socket is closed.
-    if (!interface.is_bridge) {
-        // If requested, remove event handlers for the connected socket
-        if (remove_handlers) {
-            m_event_loop->remove_handlers(interface.fd->getSocketFd());
+    // With the RX pipeline, wait for the RX thread to stop using the socket and its ring
+    rx_pipeline_call([&]() {
+        if (!interface.is_bridge) {
+            // If requested, remove event handlers for the connected socket
+            if (remove_handlers) {
+                get_interface_event_loop()->remove_handlers(interface.fd->getSocketFd());
+            }
         }
-    }
+        close_interface_rx_ring(interface);
+    });
     MAPF_INFO("Closing interface " << interface.ifname
                                    << " socket fd=" << interface.fd->getSocketFd());
     close(interface.fd->getSocketFd());
@@ -378,12 +476,13 @@ void Ieee1905Transport::activate_interface(NetworkInterface &interface)
             // Handlers name
             .name = socket_name,
 
-            // Accept incoming connections
+            // Walk the receive ring. Without one, the frames are received by on_data (see below).
             .on_read =
                 [&](int fd, EventLoop &loop) {
                     LOG(DEBUG) << "Incoming message on interface " << interface.ifname << " FD ("
                                << fd << ")";
-                    handle_interface_pollin_event(fd);
+                    handle_interface_rx_ring_event(interface);
+                    rx_pipeline_flush();
                     return true;
                 },
 
@@ -406,43 +505,82 @@ void Ieee1905Transport::activate_interface(NetworkInterface &interface)
                     LOG(ERROR) << "Error on FD (" << fd << ")" << error_message
                                << ". Disabling interface " << interface.ifname;
 
+                    // The event loop already removed the handlers. On the RX thread, leave the
+                    // rest to the broker thread, which owns the interfaces.
+                    if (&loop != m_event_loop.get()) {
+                        rx_pipeline_handle_interface_error(interface, fd);
+                        return true;
+                    }
                     deactivate_interface(interface, false);
                     return true;
                 },
         };
-        m_event_loop->register_handlers(interface.fd->getSocketFd(), handlers);
+
+        // Without a receive ring, let the event loop receive the frames itself (with io_uring,
+        // without any system call per frame). The socket is bound to the interface, so all the
+        // frames come from it.
+        if (!interface.rx_ring) {
+            unsigned int if_index = if_nametoindex(interface.ifname.c_str());
+
+            handlers.on_read = nullptr;
+            handlers.on_data = [&, if_index](int fd, uint8_t *data, size_t length,
+                                             EventLoop &loop) {
+                handle_interface_frame(data, length, if_index);
+                rx_pipeline_flush();
+                return true;
+            };
+        }
+
+        rx_pipeline_call([&]() {
+            get_interface_event_loop()->register_handlers(interface.fd->getSocketFd(), handlers);
+        });
     }
 }
 
-void Ieee1905Transport::handle_interface_pollin_event(int fd)
+void Ieee1905Transport::handle_interface_rx_ring_event(NetworkInterface &interface)
 {
-    if (fd < 0) {
-        MAPF_ERR("Illegal file descriptor FD (" << fd << ")");
-        return;
-    }
+    // Walk all the blocks that the kernel has retired to user space. The frames are handled in
+    // place, and each block is given back to the kernel once all of its frames were handled.
+    for (unsigned int i = 0; i < kRxRingBlockCount && interface.rx_ring; i++) {
+        auto block = reinterpret_cast<struct tpacket_block_desc *>(
+            interface.rx_ring + size_t(interface.rx_ring_block) * kRxRingBlockSize);
+        if (!(block->hdr.bh1.block_status & TP_STATUS_USER)) {
+            break;
+        }
 
-    // Note to developer: add support for VLAN ethernet header (if required)?
+        auto frame = reinterpret_cast<struct tpacket3_hdr *>(reinterpret_cast<uint8_t *>(block) +
+                                                             block->hdr.bh1.offset_to_first_pkt);
+        for (uint32_t n = 0; n < block->hdr.bh1.num_pkts; n++) {
+            auto addr = reinterpret_cast<struct sockaddr_ll *>(
+                reinterpret_cast<uint8_t *>(frame) + TPACKET_ALIGN(sizeof(struct tpacket3_hdr)));
+            if (frame->tp_snaplen < frame->tp_len) {
+                MAPF_WARN("received oversized packet (truncated).");
+            }
 
-    uint8_t buf[ETH_FRAME_LEN];
-    struct sockaddr_ll addr;
-    socklen_t addr_len = sizeof(addr);
-    ssize_t len = recvfrom(fd, buf, sizeof(buf), MSG_DONTWAIT | MSG_TRUNC, (struct sockaddr *)&addr,
-                           &addr_len);
-    if (len == -1 && (errno == EWOULDBLOCK || errno == EAGAIN)) {
-        return;
-    }
-    if (len == -1) {
-        MAPF_ERR("cannot read from socket with FD (" << fd << "), error: \"" << strerror(errno)
-                                                     << "\" (" << errno << ").");
-        return;
+            handle_interface_frame(reinterpret_cast<uint8_t *>(frame) + frame->tp_mac,
+                                   frame->tp_snaplen, (unsigned int)addr->sll_ifindex);
+
+            frame = reinterpret_cast<struct tpacket3_hdr *>(reinterpret_cast<uint8_t *>(frame) +
+                                                            frame->tp_next_offset);
+        }
+
+        __sync_synchronize();
+        block->hdr.bh1.block_status = TP_STATUS_KERNEL;
+        interface.rx_ring_block     = (interface.rx_ring_block + 1) % kRxRingBlockCount;
     }
-    if (len < (ssize_t)sizeof(struct ether_header)) {
+}
+
+void Ieee1905Transport::handle_interface_frame(uint8_t *buf, size_t len, unsigned int if_index)
+{
+    if (len < sizeof(struct ether_header)) {
         MAPF_WARN("received packet smaller than ethernet header size (dropped).");
         return;
     }
-    if (len > int(sizeof(buf))) {
-        MAPF_WARN("received oversized packet (truncated).");
-        len = sizeof(buf);
+
+    if (capture_.enabled()) {
+        struct iovec frame = {.iov_base = buf, .iov_len = len};
+        capture_.record(PcapngCapture::Interface::NETWORK, PcapngCapture::Direction::INBOUND,
+                        &frame, 1);
     }
 
     // convert packet to internal data structure for further handling
@@ -451,15 +589,20 @@ void Ieee1905Transport::handle_interface_pollin_event(int fd)
     packet.dst_if_type  = CmduRxMessage::IF_TYPE_NONE;
     packet.dst_if_index = 0;
     packet.src_if_type  = CmduRxMessage::IF_TYPE_NET;
-    packet.src_if_index = (unsigned int)addr.sll_ifindex;
+    packet.src_if_index = if_index;
     packet.dst          = tlvf::mac_from_array(eh->ether_dhost);
     packet.src          = tlvf::mac_from_array(eh->ether_shost);
     packet.ether_type   = ntohs(eh->ether_type);
     packet.header       = {.iov_base = buf, .iov_len = sizeof(struct ether_header)};
     packet.payload      = {.iov_base = buf + sizeof(struct ether_header),
                       .iov_len  = len - sizeof(struct ether_header)};
+    packet.rx_time      = std::chrono::steady_clock::now();
 
     counters_[CounterId::INCOMMING_NETWORK_PACKETS]++;
+    if (rx_pipeline_frames_) {
+        rx_pipeline_handle_packet(packet);
+        return;
+    }
     handle_packet(packet);
 }
 
@@ -520,6 +663,14 @@ bool Ieee1905Transport::send_packet_to_network_interface(unsigned int if_index,
     }
 
     counters_[CounterId::OUTGOING_NETWORK_PACKETS]++;
+    if (auto telemetry = get_telemetry(packet)) {
+        auto ch = reinterpret_cast<Ieee1905CmduHeader *>(packet.payload.iov_base);
+        telemetry->tx_packets++;
+        telemetry->tx_bytes += packet.payload.iov_len;
+        if (ch->fragmentId != 0 || !ch->GetLastFragmentIndicator()) {
+            telemetry->tx_fragments++;
+        }
+    }
 
     uint8_t eh_buffer[sizeof(ether_header_vlan)];
     uint8_t size;
@@ -544,7 +695,39 @@ bool Ieee1905Transport::send_packet_to_network_interface(unsigned int if_index,
         packet.header  = {.iov_base = eh, .iov_len = size};
     }
 
-    int fd             = network_interfaces_[ifname].fd->getSocketFd();
+    if (capture_.enabled()) {
+        struct iovec frame[] = {packet.header, packet.payload};
+        capture_.record(PcapngCapture::Interface::NETWORK, PcapngCapture::Direction::OUTBOUND,
+                        frame, 2);
+    }
+
+    int fd = network_interfaces_[ifname].fd->getSocketFd();
+
+    // Queue the frame if a batch is open (frames too large for a batch slot are written directly)
+    if (tx_batch_active_ && size + packet.payload.iov_len <= kTxBatchFrameSize) {
+        if (tx_batch_frames_.size() >= kTxBatchMaxFrames && !flush_tx_batch()) {
+            packet.header = {.iov_base = nullptr, .iov_len = size};
+            return false;
+        }
+
+        tx_batch_frames_.emplace_back();
+        auto &frame = tx_batch_frames_.back();
+        frame.fd    = fd;
+        frame.len   = size + packet.payload.iov_len;
+        std::copy_n(eh_buffer, size, frame.buf);
+        std::copy_n(static_cast<uint8_t *>(packet.payload.iov_base), packet.payload.iov_len,
+                    frame.buf + size);
+
+        packet.header = {.iov_base = nullptr, .iov_len = size};
+        return true;
+    }
+
+    // Keep the frames order on the socket
+    if (tx_batch_active_ && !flush_tx_batch()) {
+        packet.header = {.iov_base = nullptr, .iov_len = size};
+        return false;
+    }
+
     struct iovec iov[] = {packet.header, packet.payload};
     int n              = writev(fd, iov, sizeof(iov) / sizeof(struct iovec));
 
@@ -557,12 +740,95 @@ bool Ieee1905Transport::send_packet_to_network_interface(unsigned int if_index,
     return true;
 }
 
+void Ieee1905Transport::begin_tx_batch()
+{
+    tx_batch_active_ = true;
+    tx_batch_frames_.clear();
+}
+
+bool Ieee1905Transport::flush_tx_batch()
+{
+    if (tx_batch_frames_.empty()) {
+        return true;
+    }
+
+    bool success = true;
+
+    tx_batch_iov_.resize(tx_batch_frames_.size());
+
+    // Frames are grouped per socket (keeping their order within the socket), and all the frames of
+    // a socket are written with a single sendmmsg() call. The fd of a grouped frame is reset so
+    // that it is skipped by the next groups.
+    for (size_t first = 0; first < tx_batch_frames_.size(); first++) {
+        int fd = tx_batch_frames_[first].fd;
+        if (fd < 0) {
+            continue;
+        }
+
+        tx_batch_msgs_.clear();
+        for (size_t i = first; i < tx_batch_frames_.size(); i++) {
+            auto &frame = tx_batch_frames_[i];
+            if (frame.fd != fd) {
+                continue;
+            }
+            frame.fd = -1;
+
+            tx_batch_iov_[i] = {.iov_base = frame.buf, .iov_len = frame.len};
+
+            struct mmsghdr msg     = {};
+            msg.msg_hdr.msg_iov    = &tx_batch_iov_[i];
+            msg.msg_hdr.msg_iovlen = 1;
+            tx_batch_msgs_.push_back(msg);
+        }
+
+        // sendmmsg() stops at the first frame it fails to write, and only reports the error if
+        // no frame was written. The remaining frames are retried, and a frame which fails is
+        // dropped on its own (like a failed writev() of an unbatched frame).
+        size_t written = 0;
+        while (written < tx_batch_msgs_.size()) {
+            int n = sendmmsg(fd, &tx_batch_msgs_[written], tx_batch_msgs_.size() - written, 0);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                MAPF_ERR("cannot write frame to socket FD (" << fd << "), error: \""
+                                                             << strerror(errno) << "\" (" << errno
+                                                             << ").");
+                success = false;
+                written++;
+                continue;
+            }
+            for (int i = 0; i < n; i++) {
+                auto &msg = tx_batch_msgs_[written + i];
+                if (msg.msg_len != msg.msg_hdr.msg_iov->iov_len) {
+                    MAPF_ERR("short write to socket FD (" << fd << "): " << msg.msg_len << "/"
+                                                          << msg.msg_hdr.msg_iov->iov_len);
+                    success = false;
+                }
+            }
+            written += n;
+        }
+    }
+
+    tx_batch_frames_.clear();
+
+    return success;
+}
+
+bool Ieee1905Transport::end_tx_batch()
+{
+    bool success     = flush_tx_batch();
+    tx_batch_active_ = false;
+    return success;
+}
+
 void Ieee1905Transport::set_al_mac_addr(const uint8_t *addr)
 {
     if (!addr)
         return;
 
-    std::copy_n(addr, ETH_ALEN, al_mac_addr_);
+    // the address is used by the de-duplication, on the RX thread
+    rx_pipeline_call([&]() { std::copy_n(addr, ETH_ALEN, al_mac_addr_); });
 
     // refresh packet filtering on all active interfaces to use the new AL MAC address
     for (auto it = network_interfaces_.begin(); it != network_interfaces_.end(); ++it) {
@@ -9,6 +9,7 @@
 #include "ieee1905_transport.h"
 #include <tlvf/ieee_1905_1/eMessageType.h>
 
+#include <algorithm>
 #include <arpa/inet.h>
 #include <chrono>
 
@@ -22,6 +23,14 @@ using namespace beerocks::transport::messages;
 
 static const uint8_t ieee1905_max_message_version = 0x00;
 constexpr sMacAddr Ieee1905Transport::ieee1905_multicast_addr;
+constexpr int Ieee1905Transport::kDeDuplicationWheelSlots;
+constexpr size_t Ieee1905Transport::kDeFragmentationSlabSize;
+constexpr int Ieee1905Transport::kDeFragmentationPoolSlabs;
+constexpr int Ieee1905Transport::kMaximumDeFragmentationFragments;
+constexpr size_t Ieee1905Transport::kTelemetryIeee1905Types;
+constexpr size_t Ieee1905Transport::kTelemetryEasyMeshTypes;
+constexpr size_t Ieee1905Transport::kTelemetryEntries;
+constexpr uint16_t Ieee1905Transport::kTelemetryOtherType;
 const std::set<uint16_t> Ieee1905Transport::Packet::reliable_multicast_msg_types = {
     static_cast<uint16_t>(ieee1905_1::eMessageType::TOPOLOGY_NOTIFICATION_MESSAGE),
     static_cast<uint16_t>(ieee1905_1::eMessageType::ASSOCIATION_STATUS_NOTIFICATION_MESSAGE)};
@@ -91,10 +100,27 @@ void Ieee1905Transport::handle_packet(Packet &packet)
         return;
     }
 
+    auto telemetry = get_telemetry(packet);
+    update_rx_telemetry(telemetry, packet);
+
     update_neighbours(packet);
 
+    // With the RX pipeline, the de-duplication table belongs to the RX thread - record the packet
+    // there (it is not checked against the table)
+    if (rx_pipeline_frames_) {
+        rx_pipeline_post_de_duplication_update(packet, false);
+        if (!forward_packet(packet)) {
+            MAPF_ERR("packet forwarding failed.");
+            rx_pipeline_post_de_duplication_update(packet, true);
+        }
+        return;
+    }
+
     if (!de_duplicate_packet(packet)) {
         MAPF_DBG("packet is duplicate (will not be forwarded)");
+        if (telemetry) {
+            telemetry->duplicates++;
+        }
         return;
     }
 
@@ -107,6 +133,8 @@ void Ieee1905Transport::handle_packet(Packet &packet)
 // do some basic sanity checking on the packet
 bool Ieee1905Transport::verify_packet(const Packet &packet)
 {
+    IEEE1905_TRANSPORT_STAGE_TIMER(VERIFY);
+
     if (packet.ether_type == ETH_P_1905_1) {
         // verify minimum packet length (should at least contain an IEEE1905 header + End of Message TLV)
         if (packet.payload.iov_len < sizeof(Ieee1905CmduHeader) + 3) {
@@ -173,6 +201,66 @@ void Ieee1905Transport::remove_packet_from_de_duplication_map(const Packet &pack
     }
 }
 
+int64_t
+Ieee1905Transport::get_de_duplication_wheel_tick(std::chrono::steady_clock::time_point time)
+{
+    auto tick_duration = kMaximumDeDuplicationAge / kDeDuplicationWheelSlots;
+    return time.time_since_epoch() / tick_duration;
+}
+
+void Ieee1905Transport::advance_de_duplication_wheel(std::chrono::steady_clock::time_point now)
+{
+    int64_t tick = get_de_duplication_wheel_tick(now);
+    if (tick <= de_duplication_wheel_tick_) {
+        return;
+    }
+
+    // a long idle period is handled by visiting every slot once
+    int64_t first_tick =
+        std::max(de_duplication_wheel_tick_ + 1, tick - kDeDuplicationWheelSlots + 1);
+    de_duplication_wheel_tick_ = tick;
+
+    for (int64_t t = first_tick; t <= tick; t++) {
+        auto &slot = de_duplication_wheel_[t % kDeDuplicationWheelSlots];
+        if (slot.empty()) {
+            continue;
+        }
+
+        // the slot is refilled with the entries that are still alive, so iterate over a copy
+        de_duplication_wheel_scratch_.swap(slot);
+        for (const auto &key : de_duplication_wheel_scratch_) {
+            auto it = de_duplication_map_.find(key);
+            if (it == de_duplication_map_.end()) {
+                // already removed (see remove_packet_from_de_duplication_map)
+                continue;
+            }
+            if (now > it->second.time + kMaximumDeDuplicationAge) {
+                de_duplication_map_.erase(it);
+                counters_[CounterId::DE_DUPLICATION_EVICTIONS]++;
+            } else {
+                de_duplication_wheel_[get_de_duplication_wheel_tick(it->second.time) %
+                                      kDeDuplicationWheelSlots]
+                    .push_back(key);
+            }
+        }
+        de_duplication_wheel_scratch_.clear();
+    }
+}
+
+void Ieee1905Transport::purge_de_duplication_map(std::chrono::steady_clock::time_point now)
+{
+    // full scan - only used when the map is full, the stale keys left in the wheel are skipped
+    // when their slot comes around
+    for (auto it = de_duplication_map_.begin(); it != de_duplication_map_.end();) {
+        if (now > it->second.time + kMaximumDeDuplicationAge) {
+            it = de_duplication_map_.erase(it);
+            counters_[CounterId::DE_DUPLICATION_EVICTIONS]++;
+        } else {
+            ++it;
+        }
+    }
+}
+
 // Check if the specified packet is a duplicate (based on src address and messageId)
 //
 // return false iff the packet is duplicate
@@ -189,6 +277,8 @@ void Ieee1905Transport::remove_packet_from_de_duplication_map(const Packet &pack
 //
 bool Ieee1905Transport::de_duplicate_packet(Packet &packet)
 {
+    IEEE1905_TRANSPORT_STAGE_TIMER(DE_DUPLICATE);
+
     // only try to detect duplicate IEEE1905 packets
     if (packet.ether_type != ETH_P_1905_1) {
         MAPF_WARN("Ignoring non-1905 packet");
@@ -197,16 +287,8 @@ bool Ieee1905Transport::de_duplicate_packet(Packet &packet)
 
     std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
 
-    // de-duplication map aging - go over all entries and remove old ones
-    for (auto it = de_duplication_map_.begin(); it != de_duplication_map_.end();) {
-        auto &dupval = it->second;
-
-        if (now > dupval.time + kMaximumDeDuplicationAge) {
-            it = de_duplication_map_.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    // de-duplication map aging - evict the entries of the wheel slots that came around again
+    advance_de_duplication_wheel(now);
 
     // search for entry matching packet
     DeDuplicationKey key;
@@ -216,8 +298,11 @@ bool Ieee1905Transport::de_duplicate_packet(Packet &packet)
     key.messageId   = static_cast<Ieee1905CmduHeader *>(packet.payload.iov_base)->messageId;
     key.fragmentId  = static_cast<Ieee1905CmduHeader *>(packet.payload.iov_base)->fragmentId;
 
+    // an entry that outlived kMaximumDeDuplicationAge but was not evicted yet (the wheel is coarse)
+    // is not a match - it is simply reused below
     auto it           = de_duplication_map_.find(key);
-    bool is_duplicate = (it != de_duplication_map_.end());
+    bool is_duplicate = (it != de_duplication_map_.end() &&
+                         now <= it->second.time + kMaximumDeDuplicationAge);
 
     // On reliable multicast messages, we receive the same message twice, one with multicast
     // destination address, and a second one with a unicast destination address.
@@ -232,18 +317,39 @@ bool Ieee1905Transport::de_duplicate_packet(Packet &packet)
         else if (ETHER_IS_SAME(Ieee1905Transport::ieee1905_multicast_addr.oct, key.dst.oct)) {
             memcpy(key.dst.oct, al_mac_addr_, ETH_ALEN);
         }
-        it           = de_duplication_map_.find(key);
-        is_duplicate = (it != de_duplication_map_.end());
+        auto alt_it = de_duplication_map_.find(key);
+        if (alt_it != de_duplication_map_.end() &&
+            now <= alt_it->second.time + kMaximumDeDuplicationAge) {
+            it           = alt_it;
+            is_duplicate = true;
+        }
     }
 
     if (is_duplicate) {
-        // this is a duplicate packet - update timestamp
+        // this is a duplicate packet - update timestamp (the wheel re-files the entry once its
+        // original slot comes around)
         counters_[CounterId::DUPLICATE_PACKETS]++;
         auto &val = it->second;
         val.time  = now;
-    } else if (int(de_duplication_map_.size()) >= kMaximumDeDuplicationThreads) {
+        return false;
+    }
+
+    // reuse an expired entry left over for this key - it is already filed in the wheel
+    it = de_duplication_map_.find(key);
+    if (it != de_duplication_map_.end()) {
+        it->second.time = now;
+        return true;
+    }
+
+    if (int(de_duplication_map_.size()) >= kMaximumDeDuplicationThreads) {
+        // expired entries may still be waiting for their wheel slot - drop them before giving up
+        purge_de_duplication_map(now);
+    }
+
+    if (int(de_duplication_map_.size()) >= kMaximumDeDuplicationThreads) {
         // this is not really a duplicate but we cannot track it so it will be dropped now
         MAPF_WARN("too many de-duplication threads - dropping packet as duplicate");
+        counters_[CounterId::DE_DUPLICATION_CAPACITY_HITS]++;
         is_duplicate = true;
     } else {
         // this is not a duplicate packet - add new entry to the de-duplication map
@@ -251,11 +357,26 @@ bool Ieee1905Transport::de_duplicate_packet(Packet &packet)
 
         val.time                 = now;
         de_duplication_map_[key] = val;
+        de_duplication_wheel_[get_de_duplication_wheel_tick(now) % kDeDuplicationWheelSlots]
+            .push_back(key);
     }
 
     return !is_duplicate;
 }
 
+void Ieee1905Transport::erase_de_fragmentation_entry(DeFragmentationMap::iterator it)
+{
+    auto &val = it->second;
+
+    // return the slabs of the received fragments to the pool
+    for (int i = 0; i < val.numFragments; i++) {
+        de_fragmentation_free_slabs_.push_back(val.slabs[i]);
+    }
+
+    de_fragmentation_lru_.erase(val.lru_it);
+    de_fragmentation_map_.erase(it);
+}
+
 // De-fragmentation (reassembly) of received packets will be done before publishing a CMDU to the broker (defragmentation is
 // not required for tunneling and relayed packets).
 //
@@ -268,6 +389,8 @@ bool Ieee1905Transport::de_duplicate_packet(Packet &packet)
 // see paragraph 7.1.2 of IEEE1905.1-2013
 bool Ieee1905Transport::de_fragment_packet(Packet &packet)
 {
+    IEEE1905_TRANSPORT_STAGE_TIMER(DE_FRAGMENT);
+
     // only try to de-fragment IEEE1905 packets
     if (packet.ether_type != ETH_P_1905_1) {
         return true;
@@ -278,22 +401,36 @@ bool Ieee1905Transport::de_fragment_packet(Packet &packet)
         return true; // not a fragmented CMDU.
     }
 
-    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    // the RX thread already did the de-fragmentation
+    if (packet.rx_pipeline_frame) {
+        auto &frame = *packet.rx_pipeline_frame;
+        if (!frame.deliver) {
+            return false;
+        }
+        packet.payload = {.iov_base = const_cast<uint8_t *>(frame.cmdu.data()),
+                          .iov_len  = frame.cmdu.size()};
+        return true;
+    }
 
-    // de-fragmentation map cleanup - go over all entries and remove old ones or complete ones
-    for (auto it = de_fragmentation_map_.begin(); it != de_fragmentation_map_.end();) {
-        auto &val = it->second;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
 
-        if (val.complete) {
-            it = de_fragmentation_map_.erase(it);
-        } else if (now > val.time + kMaximumDeFragmentationAge) {
-            // Note: this is not necessarily related to the current fragment referenced by the argument to this method
-            MAPF_DBG("defragmentation timeout - dropping a packet from defragmentation buffer");
-            it = de_fragmentation_map_.erase(it);
-            counters_[CounterId::DEFRAGMENTATION_FAILURE]++;
-        } else {
-            ++it;
+    // de-fragmentation map cleanup - the CMDU completed by the previous invocation is the most
+    // recently updated entry and the entries to age out are the least recently updated ones
+    if (!de_fragmentation_lru_.empty()) {
+        auto it = de_fragmentation_map_.find(de_fragmentation_lru_.back());
+        if (it->second.complete) {
+            erase_de_fragmentation_entry(it);
+        }
+    }
+    while (!de_fragmentation_lru_.empty()) {
+        auto it = de_fragmentation_map_.find(de_fragmentation_lru_.front());
+        if (now <= it->second.time + kMaximumDeFragmentationAge) {
+            break;
         }
+        // Note: this is not necessarily related to the current fragment referenced by the argument to this method
+        MAPF_DBG("defragmentation timeout - dropping a packet from defragmentation buffer");
+        erase_de_fragmentation_entry(it);
+        counters_[CounterId::DEFRAGMENTATION_FAILURE]++;
     }
 
     // build the key to the de-fragmentation map
@@ -302,17 +439,27 @@ bool Ieee1905Transport::de_fragment_packet(Packet &packet)
     key.messageType = ch->messageType;
     key.messageId   = ch->messageId;
 
-    auto &val = de_fragmentation_map_[key]; // find a match (or create a new entry)
+    auto it = de_fragmentation_map_.find(key);
+    if (it == de_fragmentation_map_.end()) {
+        // a reassembly can only be started by the first fragment
+        if (ch->fragmentId != 0) {
+            MAPF_DBG("dropping an out-of-order fragment");
+            return false;
+        }
 
-    // limit the map size (to prevent a possible memory exhaustion attack)
-    // Note: at this stage there could be one extra entry in the map (this is still effective and the code is simple)
-    if (int(de_fragmentation_map_.size()) > kMaximumDeFragmentationThreads) {
-        de_fragmentation_map_.erase(key);
-        MAPF_WARN("too many de-fragmentation threads - dropping packet");
-        return false;
+        // limit the map size (to prevent a possible memory exhaustion attack)
+        if (int(de_fragmentation_map_.size()) >= kMaximumDeFragmentationThreads) {
+            MAPF_WARN("too many de-fragmentation threads - dropping packet");
+            return false;
+        }
+
+        it = de_fragmentation_map_.emplace(key, DeFragmentationValue()).first;
+        it->second.lru_it = de_fragmentation_lru_.insert(de_fragmentation_lru_.end(), key);
     }
 
-    val.time = now;
+    auto &val = it->second;
+    val.time  = now;
+    de_fragmentation_lru_.splice(de_fragmentation_lru_.end(), de_fragmentation_lru_, val.lru_it);
 
     // only accept fragments in order - check if this is the expected fragment
     if (val.numFragments != ch->fragmentId) {
@@ -322,18 +469,21 @@ bool Ieee1905Transport::de_fragment_packet(Packet &packet)
 
     // copy the IEEE1905 header from the first fragment
     if (ch->fragmentId == 0) {
-        std::copy_n((uint8_t *)packet.payload.iov_base, sizeof(Ieee1905CmduHeader),
-                    (uint8_t *)val.buf);
-        val.bufIndex = sizeof(Ieee1905CmduHeader);
+        val.header     = *ch;
+        val.start_time = now;
 
         // set the last fragment indicator flag as this will be the header of a complete CMDU
-        Ieee1905CmduHeader *hdr = reinterpret_cast<Ieee1905CmduHeader *>(val.buf);
-        hdr->SetLastFragmentIndicator(1);
+        val.header.SetLastFragmentIndicator(1);
+
+        val.chain[0].iov_base = &val.header;
+        val.chain[0].iov_len  = sizeof(Ieee1905CmduHeader);
+        val.length            = sizeof(Ieee1905CmduHeader);
     }
 
-    // concat the fragment body (excluding the IEEE1905 header)
+    // chain the fragment body (excluding the IEEE1905 header)
     size_t fragmentTlvsLength = packet.payload.iov_len - sizeof(Ieee1905CmduHeader);
-    if (val.bufIndex + fragmentTlvsLength >= kMaximumDeFragmentionSize) {
+    if (val.length + fragmentTlvsLength >= kMaximumDeFragmentionSize ||
+        val.numFragments >= kMaximumDeFragmentationFragments) {
         MAPF_WARN("defragmentation buffer overflow - dropping fragment");
         return false;
     }
@@ -367,17 +517,44 @@ bool Ieee1905Transport::de_fragment_packet(Packet &packet)
         fragmentTlvsLength -= tlvsLength;
     }
 
+    if (fragmentTlvsLength > kDeFragmentationSlabSize) {
+        MAPF_WARN("fragment larger than a defragmentation slab - dropping fragment");
+        return false;
+    }
+
+    if (de_fragmentation_free_slabs_.empty()) {
+        // the reassembly cannot complete without this fragment - release what it holds
+        MAPF_WARN("defragmentation pool exhausted - dropping packet");
+        erase_de_fragmentation_entry(it);
+        counters_[CounterId::DEFRAGMENTATION_FAILURE]++;
+        return false;
+    }
+
+    uint16_t slab = de_fragmentation_free_slabs_.back();
+    de_fragmentation_free_slabs_.pop_back();
+
+    uint8_t *slab_buf = de_fragmentation_pool_.data() + slab * kDeFragmentationSlabSize;
     std::copy_n((uint8_t *)packet.payload.iov_base + sizeof(Ieee1905CmduHeader), fragmentTlvsLength,
-                val.buf + val.bufIndex);
-    val.bufIndex += fragmentTlvsLength;
+                slab_buf);
+
+    val.slabs[val.numFragments]              = slab;
+    val.chain[val.numFragments + 1].iov_base = slab_buf;
+    val.chain[val.numFragments + 1].iov_len  = fragmentTlvsLength;
+    val.length += fragmentTlvsLength;
     val.numFragments++;
 
     // detect defragmentation completion and update Packet object
     if (ch->GetLastFragmentIndicator()) {
         val.complete =
             true; // mark as complete - the map entry will be deleted on the next invocation
-        packet.payload.iov_base = val.buf; // buffer is valid until next invocation of this method
-        packet.payload.iov_len  = val.bufIndex;
+        // the chain is valid until next invocation of this method
+        packet.payload           = val.chain[0];
+        packet.payload_chain     = val.chain;
+        packet.payload_chain_len = val.numFragments + 1;
+
+        if (auto telemetry = get_telemetry(packet)) {
+            update_telemetry_latency(telemetry->reassembly_latency, now - val.start_time);
+        }
 
         return true;
     }
@@ -687,16 +864,23 @@ bool Ieee1905Transport::forward_packet_single(Packet &packet)
  */
 bool Ieee1905Transport::forward_packet(Packet &packet)
 {
+    IEEE1905_TRANSPORT_STAGE_TIMER(FORWARD);
+
     // only try to forward IEEE1905 packets
     if (packet.ether_type != ETH_P_1905_1) {
         MAPF_WARN("Ignoring non-1905 packet");
         return false;
     }
+    // All the frames sent to the network below (the packet itself, its fragments and the reliable
+    // multicast copies) are queued and written with one sendmmsg() call per socket at the end.
+    begin_tx_batch();
+
     // First, forward the packet as is.
     MAPF_DBG("First forward_packet_single");
     bool success = forward_packet_single(packet);
     if (!success) {
         MAPF_DBG("Failed to forward packet " << packet);
+        end_tx_batch();
         return false;
     }
 
@@ -705,18 +889,18 @@ bool Ieee1905Transport::forward_packet(Packet &packet)
     LOG(DEBUG) << "ETHER_IS_MULTICAST=" << std::hex << std::boolalpha
                << bool(ETHER_IS_MULTICAST(packet.dst.oct));
     if (!ETHER_IS_MULTICAST(packet.dst.oct)) {
-        return true;
+        return end_tx_batch();
     }
     // 2. Message is relayed multicast
     Ieee1905CmduHeader *ch = reinterpret_cast<Ieee1905CmduHeader *>(packet.payload.iov_base);
     LOG(DEBUG) << "GetRelayIndicator=" << ch->GetRelayIndicator();
     if (!ch->GetRelayIndicator()) {
-        return true;
+        return end_tx_batch();
     }
     // 3. If Message type is a reliable multicast according to the EasyMesh specification (See EasyMesh
     //    specification Table 5) need to send it also as unicast. Otherwise stop handling.
     if (!packet.is_reliable_multicast()) {
-        return true;
+        return end_tx_batch();
     }
 
     // 4. Message is locally generated - the spec says to duplicate the message as part
@@ -724,12 +908,13 @@ bool Ieee1905Transport::forward_packet(Packet &packet)
     // the reception procedure (section 7.6 of 1905.1).
     LOG(DEBUG) << "packet.src_if_type=" << packet.src_if_type;
     if (packet.src_if_type != CmduRxMessage::IF_TYPE_LOCAL_BUS) {
-        return true;
+        return end_tx_batch();
     }
 
     // Reliable multicast - send to all known neighbors.
     // Note - we are reusing the same packet, so this part has to come
-    // after the original packet (relayed multicast) has been sent.
+    // after the original packet (relayed multicast) has been sent (queued frames are copies, so
+    // changing the packet below doesn't affect them).
     // Change the packet destination each time to the neighbor AL MAC
     MAPF_DBG("Second forward_packet_single");
     ch->SetRelayIndicator(false);
@@ -741,9 +926,39 @@ bool Ieee1905Transport::forward_packet(Packet &packet)
         }
     }
 
+    if (!end_tx_batch()) {
+        MAPF_ERR("Failed writing the batched frames of packet: " << packet);
+        success = false;
+    }
+
     return success;
 }
 
+size_t Ieee1905Transport::Packet::payload_length() const
+{
+    if (!payload_chain) {
+        return payload.iov_len;
+    }
+
+    size_t length = 0;
+    for (size_t i = 0; i < payload_chain_len; i++) {
+        length += payload_chain[i].iov_len;
+    }
+    return length;
+}
+
+void Ieee1905Transport::Packet::copy_payload(uint8_t *dst) const
+{
+    if (!payload_chain) {
+        std::copy_n((uint8_t *)payload.iov_base, payload.iov_len, dst);
+        return;
+    }
+
+    for (size_t i = 0; i < payload_chain_len; i++) {
+        dst = std::copy_n((uint8_t *)payload_chain[i].iov_base, payload_chain[i].iov_len, dst);
+    }
+}
+
 std::ostream &Ieee1905Transport::Packet::print(std::ostream &os) const
 {
     std::stringstream ss;
@@ -776,18 +991,83 @@ std::ostream &Ieee1905Transport::Packet::print(std::ostream &os) const
     // dump payload
     if (payload.iov_base) {
         ss << "  payload:" << std::endl << "    ";
-        uint8_t *p = (uint8_t *)payload.iov_base;
-        for (size_t i = 0; i < payload.iov_len; i++) {
-            ss << std::hex << std::setfill('0') << std::setw(2) << (unsigned)p[i] << " ";
-            if (i % 16 == 15)
-                ss << std::endl << "    ";
-            else if (i % 8 == 7)
-                ss << " ";
+        const struct iovec *chunks = payload_chain ? payload_chain : &payload;
+        size_t num_chunks          = payload_chain ? payload_chain_len : 1;
+        size_t i                   = 0;
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            uint8_t *p = (uint8_t *)chunks[chunk].iov_base;
+            for (size_t j = 0; j < chunks[chunk].iov_len; j++, i++) {
+                ss << std::hex << std::setfill('0') << std::setw(2) << (unsigned)p[j] << " ";
+                if (i % 16 == 15)
+                    ss << std::endl << "    ";
+                else if (i % 8 == 7)
+                    ss << " ";
+            }
         }
     }
 
     return os << ss.str();
 }
 
+size_t Ieee1905Transport::get_telemetry_index(uint16_t msg_type)
+{
+    if (msg_type < kTelemetryIeee1905Types) {
+        return msg_type;
+    }
+
+    if (msg_type >= 0x8000 && msg_type < 0x8000 + kTelemetryEasyMeshTypes) {
+        return kTelemetryIeee1905Types + (msg_type - 0x8000);
+    }
+
+    return kTelemetryEntries - 1;
+}
+
+uint16_t Ieee1905Transport::get_telemetry_msg_type(size_t index)
+{
+    if (index < kTelemetryIeee1905Types) {
+        return index;
+    }
+
+    if (index < kTelemetryIeee1905Types + kTelemetryEasyMeshTypes) {
+        return 0x8000 + (index - kTelemetryIeee1905Types);
+    }
+
+    return kTelemetryOtherType;
+}
+
+void Ieee1905Transport::update_rx_telemetry(TelemetryEntry *telemetry, const Packet &packet)
+{
+    if (!telemetry || packet.src_if_type != CmduRxMessage::IF_TYPE_NET) {
+        return;
+    }
+
+    auto ch = reinterpret_cast<Ieee1905CmduHeader *>(packet.payload.iov_base);
+    telemetry->rx_packets++;
+    telemetry->rx_bytes += packet.payload.iov_len;
+    if (ch->fragmentId != 0 || !ch->GetLastFragmentIndicator()) {
+        telemetry->rx_fragments++;
+    }
+}
+
+void Ieee1905Transport::update_telemetry_latency(TelemetryLatency &latency,
+                                                 std::chrono::steady_clock::duration duration)
+{
+    uint64_t us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+    latency.count++;
+    latency.sum_us += us;
+    latency.max_us = std::max(latency.max_us, us);
+}
+
+Ieee1905Transport::TelemetryEntry *Ieee1905Transport::get_telemetry(const Packet &packet)
+{
+    if (packet.ether_type != ETH_P_1905_1 || packet.payload.iov_len < sizeof(Ieee1905CmduHeader)) {
+        return nullptr;
+    }
+
+    auto ch = reinterpret_cast<const Ieee1905CmduHeader *>(packet.payload.iov_base);
+    return &telemetry_[get_telemetry_index(ntohs(ch->messageType))];
+}
+
 } // namespace transport
 } // namespace beerocks
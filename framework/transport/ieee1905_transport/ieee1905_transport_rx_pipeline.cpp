@@ -0,0 +1,362 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include "ieee1905_transport.h"
+
+#include <bcl/beerocks_event_loop_impl.h>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace beerocks {
+namespace transport {
+
+// Use transport messaging classes
+using namespace beerocks::transport::messages;
+
+constexpr size_t Ieee1905Transport::kRxPipelineRingSize;
+
+bool Ieee1905Transport::start_rx_pipeline()
+{
+    rx_pipeline_wake_fd_    = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    rx_pipeline_control_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (rx_pipeline_wake_fd_ < 0 || rx_pipeline_control_fd_ < 0) {
+        LOG(ERROR) << "Failed creating eventfd: " << strerror(errno);
+        stop_rx_pipeline();
+        return false;
+    }
+
+    // Both threads update the counters - create all of them now, so that the map itself is never
+    // modified concurrently (every counter is only updated by one of the threads)
+    for (int id = MESSAGE_ID_WRAPAROUND; id <= RX_PIPELINE_OVERFLOWS; id++) {
+        counters_[CounterId(id)];
+    }
+
+    rx_pipeline_frames_ = std::unique_ptr<beerocks::spsc_ring<RxPipelineFrame>>(
+        new beerocks::spsc_ring<RxPipelineFrame>(kRxPipelineRingSize));
+    rx_pipeline_de_duplication_ = std::unique_ptr<beerocks::spsc_ring<RxPipelineDeDuplication>>(
+        new beerocks::spsc_ring<RxPipelineDeDuplication>(kRxPipelineRingSize));
+    rx_pipeline_event_loop_ = std::make_shared<EventLoopImpl>();
+
+    // Frames passed by the RX thread are handled on the broker thread
+    EventLoop::EventHandlers wake_handlers = {
+        .name = "RX Pipeline",
+        .on_read =
+            [&](int fd, EventLoop &loop) {
+                eventfd_t value;
+                eventfd_read(fd, &value);
+                handle_rx_pipeline_frames();
+                return true;
+            },
+        .on_write      = nullptr,
+        .on_disconnect = nullptr,
+        .on_error =
+            [&](int fd, EventLoop &loop) {
+                LOG(ERROR) << "Error on RX pipeline FD (" << fd << ")";
+                return true;
+            },
+    };
+    if (!m_event_loop->register_handlers(rx_pipeline_wake_fd_, wake_handlers)) {
+        LOG(ERROR) << "Failed registering the RX pipeline handlers";
+        stop_rx_pipeline();
+        return false;
+    }
+
+    // Functions passed to rx_pipeline_call() are run on the RX thread
+    EventLoop::EventHandlers control_handlers = {
+        .name = "RX Pipeline Control",
+        .on_read =
+            [&](int fd, EventLoop &loop) {
+                eventfd_t value;
+                eventfd_read(fd, &value);
+
+                std::lock_guard<std::mutex> lock(rx_pipeline_mutex_);
+                if (rx_pipeline_call_) {
+                    (*rx_pipeline_call_)();
+                    rx_pipeline_call_ = nullptr;
+                    rx_pipeline_cv_.notify_all();
+                }
+                return true;
+            },
+        .on_write      = nullptr,
+        .on_disconnect = nullptr,
+        .on_error =
+            [&](int fd, EventLoop &loop) {
+                LOG(ERROR) << "Error on RX pipeline control FD (" << fd << ")";
+                return true;
+            },
+    };
+    if (!rx_pipeline_event_loop_->register_handlers(rx_pipeline_control_fd_, control_handlers)) {
+        LOG(ERROR) << "Failed registering the RX pipeline control handlers";
+        stop_rx_pipeline();
+        return false;
+    }
+
+    rx_pipeline_running_ = true;
+    rx_pipeline_thread_  = std::thread(&Ieee1905Transport::rx_pipeline_thread, this);
+
+    LOG(INFO) << "RX pipeline started";
+
+    return true;
+}
+
+void Ieee1905Transport::stop_rx_pipeline()
+{
+    if (rx_pipeline_thread_.joinable()) {
+        rx_pipeline_running_ = false;
+        eventfd_write(rx_pipeline_control_fd_, 1);
+        rx_pipeline_thread_.join();
+    }
+
+    // The interface sockets stay registered on the (stopped) RX event loop, so that they are
+    // removed from it as usual when the interfaces are deactivated
+    if (rx_pipeline_control_fd_ >= 0) {
+        if (rx_pipeline_event_loop_) {
+            rx_pipeline_event_loop_->remove_handlers(rx_pipeline_control_fd_);
+        }
+        close(rx_pipeline_control_fd_);
+        rx_pipeline_control_fd_ = -1;
+    }
+    if (rx_pipeline_wake_fd_ >= 0) {
+        m_event_loop->remove_handlers(rx_pipeline_wake_fd_);
+        close(rx_pipeline_wake_fd_);
+        rx_pipeline_wake_fd_ = -1;
+    }
+}
+
+void Ieee1905Transport::rx_pipeline_thread()
+{
+    MAPF_INFO("RX thread started");
+
+    while (rx_pipeline_running_) {
+        if (rx_pipeline_event_loop_->run() < 0) {
+            LOG(ERROR) << "RX pipeline event loop failure!";
+            break;
+        }
+    }
+
+    // Let a pending (and any later) rx_pipeline_call() run its function on the broker thread
+    std::lock_guard<std::mutex> lock(rx_pipeline_mutex_);
+    rx_pipeline_running_ = false;
+    rx_pipeline_cv_.notify_all();
+
+    MAPF_INFO("RX thread stopped");
+}
+
+void Ieee1905Transport::rx_pipeline_call(const std::function<void()> &function)
+{
+    std::unique_lock<std::mutex> lock(rx_pipeline_mutex_);
+    if (!rx_pipeline_running_) {
+        function();
+        return;
+    }
+
+    rx_pipeline_call_ = &function;
+    if (eventfd_write(rx_pipeline_control_fd_, 1) < 0) {
+        LOG(ERROR) << "Failed signaling the RX thread: " << strerror(errno);
+    }
+    rx_pipeline_cv_.wait(lock, [&]() { return !rx_pipeline_call_ || !rx_pipeline_running_; });
+
+    // the RX thread stopped before running the function
+    if (rx_pipeline_call_) {
+        rx_pipeline_call_ = nullptr;
+        function();
+    }
+}
+
+void Ieee1905Transport::rx_pipeline_handle_packet(Packet &packet)
+{
+    if (!verify_packet(packet)) {
+        // Silently drop packets that failed verification
+        return;
+    }
+
+    MAPF_DBG("handling packet (RX pipeline):" << std::endl << packet);
+
+    if (packet.ether_type != ETH_P_1905_1) {
+        // Silently ignore non IEEE 1905.1 packets
+        return;
+    }
+
+    size_t len = packet.header.iov_len + packet.payload.iov_len;
+    if (len > sizeof(RxPipelineFrame::buf)) {
+        MAPF_WARN("received oversized packet (dropped).");
+        return;
+    }
+
+    auto telemetry = get_telemetry(packet);
+    update_rx_telemetry(telemetry, packet);
+
+    rx_pipeline_apply_de_duplication_updates();
+
+    if (!de_duplicate_packet(packet)) {
+        MAPF_DBG("packet is duplicate (will not be forwarded)");
+        if (telemetry) {
+            telemetry->duplicates++;
+        }
+        return;
+    }
+
+    auto frame = rx_pipeline_frames_->produce_slot();
+    if (!frame) {
+        // The broker thread is not keeping up - drop the packet, and forget it so that a
+        // retransmission is not taken for a duplicate
+        MAPF_DBG("RX pipeline ring is full - dropping packet");
+        counters_[CounterId::RX_PIPELINE_OVERFLOWS]++;
+        remove_packet_from_de_duplication_map(packet);
+        return;
+    }
+
+    frame->if_index = packet.src_if_index;
+    frame->error_fd = -1;
+    frame->rx_time  = packet.rx_time;
+    frame->len      = len;
+    std::copy_n((uint8_t *)packet.header.iov_base, packet.header.iov_len, frame->buf);
+    std::copy_n((uint8_t *)packet.payload.iov_base, packet.payload.iov_len,
+                frame->buf + packet.header.iov_len);
+
+    // Nearly all the frames accepted by the socket filter are delivered to the local bus, so the
+    // de-fragmentation is done up front (de_fragment_packet may modify the Packet)
+    Packet defragmented_packet = packet;
+    frame->deliver             = de_fragment_packet(defragmented_packet);
+    if (frame->deliver && defragmented_packet.payload_chain) {
+        frame->cmdu.resize(defragmented_packet.payload_length());
+        defragmented_packet.copy_payload(frame->cmdu.data());
+    } else {
+        frame->cmdu.clear();
+    }
+
+    rx_pipeline_frames_->produce();
+    rx_pipeline_wake_pending_ = true;
+}
+
+void Ieee1905Transport::rx_pipeline_handle_interface_error(const NetworkInterface &interface,
+                                                           int fd)
+{
+    auto frame = rx_pipeline_frames_->produce_slot();
+    if (!frame) {
+        LOG(ERROR) << "RX pipeline ring is full - cannot disable interface " << interface.ifname;
+        return;
+    }
+
+    frame->error_fd     = fd;
+    frame->error_ifname = interface.ifname;
+
+    rx_pipeline_frames_->produce();
+    rx_pipeline_wake_pending_ = true;
+    rx_pipeline_flush();
+}
+
+void Ieee1905Transport::rx_pipeline_flush()
+{
+    if (!rx_pipeline_wake_pending_) {
+        return;
+    }
+
+    rx_pipeline_wake_pending_ = false;
+    if (eventfd_write(rx_pipeline_wake_fd_, 1) < 0) {
+        LOG(ERROR) << "Failed signaling the broker thread: " << strerror(errno);
+    }
+}
+
+void Ieee1905Transport::rx_pipeline_apply_de_duplication_updates()
+{
+    while (auto update = rx_pipeline_de_duplication_->consume_slot()) {
+        Packet packet;
+        packet.src_if_type = CmduRxMessage::IF_TYPE_LOCAL_BUS;
+        packet.src         = update->src;
+        packet.dst         = update->dst;
+        packet.ether_type  = ETH_P_1905_1;
+        packet.payload     = {.iov_base = &update->header, .iov_len = sizeof(update->header)};
+
+        if (update->remove) {
+            remove_packet_from_de_duplication_map(packet);
+        } else {
+            de_duplicate_packet(packet);
+        }
+
+        rx_pipeline_de_duplication_->consume();
+    }
+}
+
+void Ieee1905Transport::rx_pipeline_post_de_duplication_update(const Packet &packet, bool remove)
+{
+    if (packet.ether_type != ETH_P_1905_1) {
+        return;
+    }
+
+    auto update = rx_pipeline_de_duplication_->produce_slot();
+    if (!update) {
+        // The RX thread applies the updates before each frame it handles, so the ring only fills
+        // up while it is idle or busy with another interface - have it empty the ring now (this
+        // waits for the frame it is handling, if any)
+        MAPF_DBG("RX pipeline de-duplication ring is full - waiting for the RX thread");
+        rx_pipeline_call([&]() { rx_pipeline_apply_de_duplication_updates(); });
+
+        update = rx_pipeline_de_duplication_->produce_slot();
+        if (!update) {
+            MAPF_WARN("RX pipeline de-duplication ring is full - dropping update");
+            auto telemetry = get_telemetry(packet);
+            if (telemetry) {
+                telemetry->de_duplication_drops++;
+            }
+            return;
+        }
+    }
+
+    update->remove = remove;
+    update->src    = packet.src;
+    update->dst    = packet.dst;
+    update->header = *reinterpret_cast<Ieee1905CmduHeader *>(packet.payload.iov_base);
+
+    rx_pipeline_de_duplication_->produce();
+}
+
+void Ieee1905Transport::handle_rx_pipeline_frames()
+{
+    while (auto frame = rx_pipeline_frames_->consume_slot()) {
+        if (frame->error_fd >= 0) {
+            // Skip interfaces that were deactivated (or re-activated) meanwhile
+            auto it = network_interfaces_.find(frame->error_ifname);
+            if (it != network_interfaces_.end() && it->second.fd &&
+                it->second.fd->getSocketFd() == frame->error_fd) {
+                deactivate_interface(it->second, false);
+            }
+            rx_pipeline_frames_->consume();
+            continue;
+        }
+
+        // convert the frame to internal data structure for further handling
+        struct ether_header *eh = (struct ether_header *)frame->buf;
+        struct Packet packet;
+        packet.dst_if_type       = CmduRxMessage::IF_TYPE_NONE;
+        packet.dst_if_index      = 0;
+        packet.src_if_type       = CmduRxMessage::IF_TYPE_NET;
+        packet.src_if_index      = frame->if_index;
+        packet.dst               = tlvf::mac_from_array(eh->ether_dhost);
+        packet.src               = tlvf::mac_from_array(eh->ether_shost);
+        packet.ether_type        = ntohs(eh->ether_type);
+        packet.header            = {.iov_base = frame->buf, .iov_len = sizeof(struct ether_header)};
+        packet.payload           = {.iov_base = frame->buf + sizeof(struct ether_header),
+                          .iov_len  = frame->len - sizeof(struct ether_header)};
+        packet.rx_time           = frame->rx_time;
+        packet.rx_pipeline_frame = frame;
+
+        update_neighbours(packet);
+
+        if (!forward_packet(packet)) {
+            MAPF_ERR("packet forwarding failed.");
+            rx_pipeline_post_de_duplication_update(packet, true);
+        }
+
+        rx_pipeline_frames_->consume();
+    }
+}
+
+} // namespace transport
+} // namespace beerocks
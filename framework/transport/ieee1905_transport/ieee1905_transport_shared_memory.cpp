@@ -0,0 +1,297 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <mapf/transport/ieee1905_transport_shared_memory.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <easylogging++.h>
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+namespace beerocks {
+namespace transport {
+namespace messages {
+
+// Declaration of static members
+constexpr uint32_t SharedMemoryRing::kSlotCount;
+constexpr uint32_t SharedMemoryRing::kSlotSize;
+constexpr uint32_t SharedMemoryRing::kMaxConsumers;
+
+// The state word is shared between processes, so it must not fall back to a process-local lock
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "32 bit atomics must be lock free");
+
+static constexpr uint32_t slot_state(uint16_t generation, uint16_t consumers)
+{
+    return (uint32_t(generation) << 16) | consumers;
+}
+
+static constexpr uint16_t slot_generation(uint32_t state) { return state >> 16; }
+
+static constexpr uint16_t slot_consumers(uint32_t state) { return state & 0xffff; }
+
+static_assert(SharedMemoryRing::kMaxConsumers <= 16, "Consumer mask is 16 bits wide");
+
+/**
+ * @brief Creates a memfd region of the given size.
+ *
+ * @return File descriptor of the region on success and -1 otherwise.
+ */
+static int create_region(const char *name, size_t size)
+{
+    // Use the raw system call - memfd_create() is not exposed by all the supported C libraries
+    int fd = syscall(__NR_memfd_create, name, MFD_CLOEXEC);
+    if (fd < 0) {
+        LOG(ERROR) << "memfd_create failed: " << strerror(errno);
+        return -1;
+    }
+
+    if (ftruncate(fd, size) < 0) {
+        LOG(ERROR) << "ftruncate failed: " << strerror(errno);
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+ * @brief Maps a region created by the producer, after checking its size.
+ *
+ * @return Address of the mapping on success and nullptr otherwise.
+ */
+static void *map_region(int fd, size_t size, int prot)
+{
+    struct stat st;
+    if (fstat(fd, &st) < 0 || size_t(st.st_size) < size) {
+        LOG(ERROR) << "Broker shared memory is too small";
+        return nullptr;
+    }
+
+    void *mem = mmap(nullptr, size, prot, MAP_SHARED, fd, 0);
+    if (mem == MAP_FAILED) {
+        LOG(ERROR) << "mmap failed: " << strerror(errno);
+        return nullptr;
+    }
+
+    return mem;
+}
+
+SharedMemoryRing::SharedMemoryRing(int data_fd, int consumer_data_fd, int state_fd, Slot *slots,
+                                   std::atomic<uint32_t> *states, uint32_t slot_count)
+    : m_data_fd(data_fd), m_consumer_data_fd(consumer_data_fd), m_state_fd(state_fd),
+      m_slots(slots), m_states(states), m_slot_count(slot_count)
+{
+}
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+    munmap(m_slots, m_slot_count * sizeof(Slot));
+    munmap(m_states, m_slot_count * sizeof(std::atomic<uint32_t>));
+    close(m_data_fd);
+    if (m_consumer_data_fd >= 0) {
+        close(m_consumer_data_fd);
+    }
+    close(m_state_fd);
+}
+
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::create_instance()
+{
+    size_t data_size  = kSlotCount * sizeof(Slot);
+    size_t state_size = kSlotCount * sizeof(std::atomic<uint32_t>);
+
+    int data_fd = create_region("ieee1905_broker", data_size);
+    if (data_fd < 0) {
+        return nullptr;
+    }
+
+    // A memfd is not writable through a file descriptor opened read-only, which is what the
+    // consumers get
+    std::string data_path = "/proc/self/fd/" + std::to_string(data_fd);
+    int consumer_data_fd  = open(data_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (consumer_data_fd < 0) {
+        LOG(ERROR) << "Failed reopening " << data_path << ": " << strerror(errno);
+        close(data_fd);
+        return nullptr;
+    }
+
+    int state_fd = create_region("ieee1905_broker_state", state_size);
+    if (state_fd < 0) {
+        close(consumer_data_fd);
+        close(data_fd);
+        return nullptr;
+    }
+
+    void *slots  = map_region(data_fd, data_size, PROT_READ | PROT_WRITE);
+    void *states = slots ? map_region(state_fd, state_size, PROT_READ | PROT_WRITE) : nullptr;
+    if (!states) {
+        if (slots) {
+            munmap(slots, data_size);
+        }
+        close(state_fd);
+        close(consumer_data_fd);
+        close(data_fd);
+        return nullptr;
+    }
+
+    // The regions are zero filled: every slot is free (no references) and invalid (generation 0)
+    std::unique_ptr<SharedMemoryRing> ring(new SharedMemoryRing(
+        data_fd, consumer_data_fd, state_fd, static_cast<Slot *>(slots),
+        static_cast<std::atomic<uint32_t> *>(states), kSlotCount));
+
+    LOG(DEBUG) << "Created broker shared memory: data fd = " << data_fd
+               << ", state fd = " << state_fd << ", size = " << data_size + state_size;
+
+    return ring;
+}
+
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::attach_instance(int data_fd, int state_fd,
+                                                                    uint32_t slot_count,
+                                                                    uint32_t slot_size)
+{
+    if (slot_size != kSlotSize || slot_count == 0) {
+        LOG(ERROR) << "Incompatible broker shared memory: slot_count = " << slot_count
+                   << ", slot_size = " << slot_size;
+        close(data_fd);
+        close(state_fd);
+        return nullptr;
+    }
+
+    size_t data_size  = slot_count * sizeof(Slot);
+    size_t state_size = slot_count * sizeof(std::atomic<uint32_t>);
+
+    // The messages are only read by the consumers, only the slot states are written
+    void *slots  = map_region(data_fd, data_size, PROT_READ);
+    void *states = slots ? map_region(state_fd, state_size, PROT_READ | PROT_WRITE) : nullptr;
+    if (!states) {
+        if (slots) {
+            munmap(slots, data_size);
+        }
+        close(data_fd);
+        close(state_fd);
+        return nullptr;
+    }
+
+    return std::unique_ptr<SharedMemoryRing>(
+        new SharedMemoryRing(data_fd, -1, state_fd, static_cast<Slot *>(slots),
+                             static_cast<std::atomic<uint32_t> *>(states), slot_count));
+}
+
+bool SharedMemoryRing::publish(const uint8_t *data, size_t length, uint16_t consumers,
+                               uint32_t &slot, uint16_t &generation)
+{
+    // The data region is read-only on the consumer side
+    if (m_consumer_data_fd < 0) {
+        LOG(ERROR) << "Messages can only be published by the producer";
+        return false;
+    }
+
+    if (length > kSlotSize || consumers == 0) {
+        return false;
+    }
+
+    // Look for a free slot, starting with the one after the last used. Slots still referenced
+    // are never taken over, however old: the caller falls back to the sockets instead.
+    for (uint32_t i = 0; i < m_slot_count; i++) {
+        uint32_t index = (m_next_slot + i) % m_slot_count;
+        auto &s        = m_slots[index];
+        auto &s_state  = m_states[index];
+        uint32_t state = s_state.load(std::memory_order_acquire);
+
+        if (slot_consumers(state) != 0) {
+            continue;
+        }
+
+        // Invalidate the slot while it is written, so that a stale descriptor of the previous
+        // message is not accepted by get()
+        if (!s_state.compare_exchange_strong(state, slot_state(0, 0), std::memory_order_acq_rel)) {
+            continue;
+        }
+
+        std::copy_n(data, length, s.data);
+        s.length = length;
+
+        // Generation 0 is reserved for slots being written
+        if (++m_generation == 0) {
+            ++m_generation;
+        }
+        s_state.store(slot_state(m_generation, consumers), std::memory_order_release);
+
+        m_next_slot = (index + 1) % m_slot_count;
+
+        slot       = index;
+        generation = m_generation;
+        return true;
+    }
+
+    return false;
+}
+
+const uint8_t *SharedMemoryRing::get(uint32_t slot, uint16_t generation, size_t &length) const
+{
+    if (slot >= m_slot_count || generation == 0) {
+        return nullptr;
+    }
+
+    auto &s = m_slots[slot];
+    if (slot_generation(m_states[slot].load(std::memory_order_acquire)) != generation ||
+        s.length > kSlotSize) {
+        return nullptr;
+    }
+
+    length = s.length;
+    return s.data;
+}
+
+bool SharedMemoryRing::release(uint32_t slot, uint16_t generation, uint8_t consumer)
+{
+    if (slot >= m_slot_count || consumer >= kMaxConsumers) {
+        return false;
+    }
+
+    uint32_t bit   = 1U << consumer;
+    auto &s_state  = m_states[slot];
+    uint32_t state = s_state.load(std::memory_order_acquire);
+    do {
+        if (slot_generation(state) != generation || !(slot_consumers(state) & bit)) {
+            return false;
+        }
+    } while (!s_state.compare_exchange_weak(state, state & ~bit, std::memory_order_acq_rel));
+
+    return true;
+}
+
+void SharedMemoryRing::release_consumer(uint8_t consumer)
+{
+    if (consumer >= kMaxConsumers) {
+        return;
+    }
+
+    uint32_t bit = 1U << consumer;
+    for (uint32_t i = 0; i < m_slot_count; i++) {
+        auto &s_state  = m_states[i];
+        uint32_t state = s_state.load(std::memory_order_acquire);
+        // Retry if another consumer released the slot meanwhile
+        while ((slot_consumers(state) & bit) &&
+               !s_state.compare_exchange_weak(state, state & ~bit, std::memory_order_acq_rel)) {
+        }
+    }
+}
+
+} // namespace messages
+} // namespace transport
+} // namespace beerocks
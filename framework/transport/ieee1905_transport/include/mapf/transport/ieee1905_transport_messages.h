@@ -21,6 +21,7 @@
 #include <iomanip>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #ifndef ETH_P_1905_1
 #define ETH_P_1905_1 0x893a
@@ -44,7 +45,12 @@ enum class Type {
     CmduTxConfirmationMessage            = 4,
     InterfaceConfigurationRequestMessage = 5,
     AlMacAddressConfigurationMessage     = 6,
-    VlanConfigurationRequestMessage      = 7
+    VlanConfigurationRequestMessage      = 7,
+    SharedMemoryConfigurationMessage     = 8,
+    SharedMemoryCmduRxMessage            = 9,
+    TransportTelemetryQueryMessage       = 10,
+    TransportTelemetryReportMessage      = 11,
+    TransportCaptureControlMessage       = 12
 };
 // Enum AutoPrint generated code snippet begining- DON'T EDIT!
 // clang-format off
@@ -58,6 +64,11 @@ static const char *Type_str(Type enum_value) {
     case Type::InterfaceConfigurationRequestMessage: return "Type::InterfaceConfigurationRequestMessage";
     case Type::AlMacAddressConfigurationMessage:     return "Type::AlMacAddressConfigurationMessage";
     case Type::VlanConfigurationRequestMessage:      return "Type::VlanConfigurationRequestMessage";
+    case Type::SharedMemoryConfigurationMessage:     return "Type::SharedMemoryConfigurationMessage";
+    case Type::SharedMemoryCmduRxMessage:            return "Type::SharedMemoryCmduRxMessage";
+    case Type::TransportTelemetryQueryMessage:       return "Type::TransportTelemetryQueryMessage";
+    case Type::TransportTelemetryReportMessage:      return "Type::TransportTelemetryReportMessage";
+    case Type::TransportCaptureControlMessage:       return "Type::TransportCaptureControlMessage";
     }
     static std::string out_str = std::to_string(int(enum_value));
     return out_str.c_str();
@@ -340,6 +351,9 @@ public:
         ReqType type            = ReqType::INVALID;
         uint8_t msg_types_count = 0;
         MsgType msg_types[MAX_SUBSCRIBE_TYPES];
+        // Request CMDUs to be delivered through the broker shared memory (see
+        // SharedMemoryConfigurationMessage). The broker keeps using the socket if it can't.
+        bool shared_memory = false;
     };
 
     explicit SubscribeMessage(std::initializer_list<Frame> frames = {})
@@ -457,6 +471,11 @@ public:
 
         // true for adding the interface to interfaces list, otherwise false.
         bool add;
+
+        // true for receiving frames through a memory-mapped ring (TPACKET_V3) on the interface
+        // (or on all the bridge interfaces if is_bridge is set). The transport falls back to
+        // recvfrom() if the ring can't be set up.
+        bool rx_ring;
     };
 
     explicit InterfaceConfigurationRequestMessage(std::initializer_list<Frame> frames = {})
@@ -568,6 +587,281 @@ public:
     }
 };
 
+/**
+ * Sent by the broker in reply to a SubscribeMessage requesting the shared memory mode.
+ * The file descriptors of the shared memory regions (@see SharedMemoryRing) are attached to the
+ * message as SCM_RIGHTS ancillary data: the read-only data region first, then the state region.
+ */
+class SharedMemoryConfigurationMessage : public Message {
+    static const uint8_t kVersion = 1;
+
+public:
+    struct Metadata {
+        uint8_t version     = kVersion;
+        uint8_t consumer    = 0; // index of the consumer, to release the slots with
+        uint32_t slot_count = 0;
+        uint32_t slot_size  = 0;
+    };
+
+    explicit SharedMemoryConfigurationMessage(std::initializer_list<Frame> frames = {})
+        : Message(Type::SharedMemoryConfigurationMessage, frames)
+    {
+        // maximum one frame is allowed (if none are given we will allocate one below)
+        mapf_assert(this->frames().size() <= 1);
+
+        if (this->frames().empty()) {
+            Message::Frame frame(sizeof(Metadata));
+            Add(frame);
+        } else if (this->frames().back().len() < sizeof(Metadata)) {
+            this->frames().back().set_size(sizeof(Metadata));
+        }
+    }
+
+    Metadata *metadata() const { return reinterpret_cast<Metadata *>(frames().back().data()); };
+
+    virtual std::ostream &print(std::ostream &os) const override
+    {
+        Message::print(os);
+
+        std::stringstream ss;
+        Metadata *m = metadata();
+        ss << " metadata:" << std::endl;
+        ss << " version: " << (unsigned)m->version << std::endl;
+        ss << " consumer: " << (unsigned)m->consumer << std::endl;
+        ss << " slot_count: " << m->slot_count << std::endl;
+        ss << " slot_size: " << m->slot_size;
+
+        return os << ss.str();
+    }
+};
+
+/**
+ * Descriptor of a CmduRxMessage published through the broker shared memory.
+ * The slot holds the frame of the CmduRxMessage (metadata followed by the CMDU).
+ */
+class SharedMemoryCmduRxMessage : public Message {
+    static const uint8_t kVersion = 0;
+
+public:
+    struct Metadata {
+        uint8_t version     = kVersion;
+        uint16_t generation = 0;
+        uint32_t slot       = 0;
+    };
+
+    explicit SharedMemoryCmduRxMessage(std::initializer_list<Frame> frames = {})
+        : Message(Type::SharedMemoryCmduRxMessage, frames)
+    {
+        // maximum one frame is allowed (if none are given we will allocate one below)
+        mapf_assert(this->frames().size() <= 1);
+
+        if (this->frames().empty()) {
+            Message::Frame frame(sizeof(Metadata));
+            Add(frame);
+        } else if (this->frames().back().len() < sizeof(Metadata)) {
+            this->frames().back().set_size(sizeof(Metadata));
+        }
+    }
+
+    Metadata *metadata() const { return reinterpret_cast<Metadata *>(frames().back().data()); };
+
+    virtual std::ostream &print(std::ostream &os) const override
+    {
+        Message::print(os);
+
+        std::stringstream ss;
+        Metadata *m = metadata();
+        ss << " metadata:" << std::endl;
+        ss << " version: " << (unsigned)m->version << std::endl;
+        ss << " slot: " << m->slot << std::endl;
+        ss << " generation: " << m->generation;
+
+        return os << ss.str();
+    }
+};
+
+/**
+ * Request for the per message type telemetry of the transport.
+ * The transport replies by publishing one or more TransportTelemetryReportMessage.
+ */
+class TransportTelemetryQueryMessage : public Message {
+    static const uint8_t kVersion = 0;
+
+public:
+    struct Metadata {
+        uint8_t version = kVersion;
+    };
+
+    explicit TransportTelemetryQueryMessage(std::initializer_list<Frame> frames = {})
+        : Message(Type::TransportTelemetryQueryMessage, frames)
+    {
+        // maximum one frame is allowed (if none are given we will allocate one below)
+        mapf_assert(this->frames().size() <= 1);
+
+        if (this->frames().empty()) {
+            Message::Frame frame(sizeof(Metadata));
+            Add(frame);
+        } else if (this->frames().back().len() < sizeof(Metadata)) {
+            this->frames().back().set_size(sizeof(Metadata));
+        }
+    }
+
+    Metadata *metadata() const { return reinterpret_cast<Metadata *>(frames().back().data()); };
+
+    virtual std::ostream &print(std::ostream &os) const override
+    {
+        Message::print(os);
+
+        std::stringstream ss;
+        Metadata *m = metadata();
+        ss << " metadata:" << std::endl;
+        ss << " version: " << (unsigned)m->version;
+
+        return os << ss.str();
+    }
+};
+
+/**
+ * Per message type telemetry of the transport, sent in reply to TransportTelemetryQueryMessage,
+ * followed by the egress statistics of the broker subscribers. Only the message types that were
+ * seen are reported. If they do not fit in a single message, the report is split, and all but the
+ * last message of the report have the more flag set.
+ */
+class TransportTelemetryReportMessage : public Message {
+    static const uint8_t kVersion = 0;
+
+public:
+    /**
+     * Maximal number of entries in a single report message
+     */
+    static constexpr uint8_t kMaxEntries = 64;
+
+    /**
+     * Maximal number of subscribers in a single report message
+     */
+    static constexpr uint8_t kMaxSubscribers = 8;
+
+    /**
+     * Latency statistics (in microseconds)
+     */
+    struct Latency {
+        uint64_t count  = 0;
+        uint64_t sum_us = 0;
+        uint64_t max_us = 0;
+    };
+
+    struct Entry {
+        uint16_t msg_type;             // CMDU message type
+        uint64_t rx_packets;           // frames received from the network
+        uint64_t rx_bytes;             // CMDU bytes received from the network
+        uint64_t rx_fragments;         // frames received from the network holding a fragment
+        uint64_t tx_packets;           // frames sent to the network
+        uint64_t tx_bytes;             // CMDU bytes sent to the network
+        uint64_t tx_fragments;         // frames sent to the network holding a fragment
+        uint64_t duplicates;           // frames dropped by the de-duplication
+        Latency reassembly_latency;    // first to last fragment of a CMDU
+        Latency publish_latency;       // frame received from the network to CMDU published
+        uint64_t de_duplication_drops; // sent CMDUs not recorded by the RX pipeline
+    };
+
+    struct Subscriber {
+        int32_t fd;               // socket of the subscriber in the broker
+        uint32_t queue_depth;     // messages in the egress queue
+        uint32_t max_queue_depth; // highest number of messages in the egress queue
+        uint64_t sent;            // messages sent
+        uint64_t dropped;         // messages dropped by the egress policy
+    };
+
+    struct Metadata {
+        uint8_t version          = kVersion;
+        uint8_t more             = 0; // more report messages follow
+        uint8_t entry_count      = 0;
+        uint8_t subscriber_count = 0;
+        Entry entries[kMaxEntries];
+        Subscriber subscribers[kMaxSubscribers];
+    };
+
+    explicit TransportTelemetryReportMessage(std::initializer_list<Frame> frames = {})
+        : Message(Type::TransportTelemetryReportMessage, frames)
+    {
+        // maximum one frame is allowed (if none are given we will allocate one below)
+        mapf_assert(this->frames().size() <= 1);
+
+        if (this->frames().empty()) {
+            Message::Frame frame(sizeof(Metadata));
+            Add(frame);
+        } else if (this->frames().back().len() < sizeof(Metadata)) {
+            this->frames().back().set_size(sizeof(Metadata));
+        }
+    }
+
+    Metadata *metadata() const { return reinterpret_cast<Metadata *>(frames().back().data()); };
+
+    virtual std::ostream &print(std::ostream &os) const override
+    {
+        Message::print(os);
+
+        std::stringstream ss;
+        Metadata *m = metadata();
+        ss << " metadata:" << std::endl;
+        ss << " version: " << (unsigned)m->version << std::endl;
+        ss << " more: " << (unsigned)m->more << std::endl;
+        ss << " entry_count: " << (unsigned)m->entry_count << std::endl;
+        ss << " subscriber_count: " << (unsigned)m->subscriber_count;
+
+        return os << ss.str();
+    }
+};
+
+/**
+ * Request to start or stop the pcapng capture of the frames handled by the transport.
+ */
+class TransportCaptureControlMessage : public Message {
+    static const uint8_t kVersion = 0;
+
+public:
+    static constexpr size_t kMaxPathLength = 128;
+
+    struct Metadata {
+        uint8_t version = kVersion;
+        uint8_t enable  = 0;       // start (1) or stop (0) the capture
+        uint32_t size   = 0;       // capture file size in bytes (0 for the default size)
+        char path[kMaxPathLength]; // capture file name, in the temporary directory of the
+                                   // transport (empty for the default name)
+    };
+
+    explicit TransportCaptureControlMessage(std::initializer_list<Frame> frames = {})
+        : Message(Type::TransportCaptureControlMessage, frames)
+    {
+        // maximum one frame is allowed (if none are given we will allocate one below)
+        mapf_assert(this->frames().size() <= 1);
+
+        if (this->frames().empty()) {
+            Message::Frame frame(sizeof(Metadata));
+            Add(frame);
+        } else if (this->frames().back().len() < sizeof(Metadata)) {
+            this->frames().back().set_size(sizeof(Metadata));
+        }
+    }
+
+    Metadata *metadata() const { return reinterpret_cast<Metadata *>(frames().back().data()); };
+
+    virtual std::ostream &print(std::ostream &os) const override
+    {
+        Message::print(os);
+
+        std::stringstream ss;
+        Metadata *m = metadata();
+        ss << " metadata:" << std::endl;
+        ss << " version: " << (unsigned)m->version << std::endl;
+        ss << " enable: " << (unsigned)m->enable << std::endl;
+        ss << " size: " << m->size << std::endl;
+        ss << " path: " << std::string(m->path, strnlen(m->path, kMaxPathLength));
+
+        return os << ss.str();
+    }
+};
+
 /**
  * @brief Create a message of the given type with provided frame.
  *
@@ -601,6 +895,22 @@ std::unique_ptr<Message> read_transport_message(Socket &sd);
 bool send_transport_message(Socket &sd, const Message &msg,
                             const Message::Header *header = nullptr);
 
+/**
+ * Maximum number of file descriptors passed along with a message.
+ */
+static constexpr size_t kMaxPassedFds = 2;
+
+/**
+ * @brief Send internal message to a socket, passing file descriptors along with it.
+ *
+ * @param [in] sd Unix domain socket for sending the message.
+ * @param [in] msg The message to send.
+ * @param [in] fds File descriptors to pass (as SCM_RIGHTS ancillary data), at most kMaxPassedFds.
+ *
+ * @return true on success of false otherwise.
+ */
+bool send_transport_message_with_fds(Socket &sd, const Message &msg, const std::vector<int> &fds);
+
 } // namespace messages
 } // namespace transport
 } // namespace beerocks
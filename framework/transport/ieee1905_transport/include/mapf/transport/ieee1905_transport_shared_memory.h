@@ -0,0 +1,172 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#ifndef MAP_IEEE1905_TRANSPORT_SHARED_MEMORY_H_
+#define MAP_IEEE1905_TRANSPORT_SHARED_MEMORY_H_
+
+#include <mapf/transport/ieee1905_transport_messages.h>
+
+#include <atomic>
+#include <memory>
+
+namespace beerocks {
+namespace transport {
+namespace messages {
+
+/**
+ * @brief Ring of reference-counted message slots in memfd shared memory regions.
+ *
+ * The broker server (producer) creates the regions and passes their file descriptors to the
+ * clients that negotiated the shared memory mode at subscribe time (consumers), along with an
+ * index that identifies each consumer. A published message is copied once into a free slot, with
+ * the bits of the consumers it is sent to set in the slot state. Consumers receive a
+ * SharedMemoryCmduRxMessage descriptor through the broker socket, copy the message out of the
+ * slot and release their bit.
+ *
+ * The ring is made of two regions:
+ * - The data region holds the messages. Consumers get a read-only file descriptor of it and map
+ *   it read-only, so that a faulty consumer cannot corrupt the messages of the others.
+ * - The state region holds one state word per slot. It is small and writable by all, since
+ *   consumers release their references in it.
+ *
+ * The slot state word holds a generation number (upper 16 bits) and the mask of the consumers
+ * still referencing the slot (lower 16 bits). A slot is reused only once its mask is empty: when
+ * a consumer disconnects, the producer releases the slots it still references on its behalf (see
+ * release_consumer()). If no slot is free, publish() fails and the producer falls back to the
+ * sockets. The generation changes every time a slot is reused, so that a stale descriptor is
+ * detected (see get() and release()). Generation 0 marks a slot that is being written.
+ */
+class SharedMemoryRing {
+public:
+    /**
+     * Number of slots in the ring.
+     */
+    static constexpr uint32_t kSlotCount = 64;
+
+    /**
+     * Maximum size of the message (frame) stored in a slot.
+     */
+    static constexpr uint32_t kSlotSize = Message::kMaxFrameLength;
+
+    /**
+     * Maximum number of consumers (one bit each in the slot state word).
+     */
+    static constexpr uint32_t kMaxConsumers = 16;
+
+    struct Slot {
+        uint32_t length;
+        uint8_t data[kSlotSize];
+    };
+
+    /**
+     * @brief Creates the shared memory regions (producer side).
+     *
+     * @return The ring on success and nullptr otherwise.
+     */
+    static std::unique_ptr<SharedMemoryRing> create_instance();
+
+    /**
+     * @brief Maps the shared memory regions created by the producer (consumer side).
+     *
+     * The data region is mapped read-only.
+     *
+     * @param data_fd Read-only file descriptor of the data region (ownership is taken, even on
+     * failure).
+     * @param state_fd File descriptor of the state region (ownership is taken, even on failure).
+     * @param slot_count Number of slots announced by the producer.
+     * @param slot_size Size of the slots announced by the producer.
+     * @return The ring on success and nullptr otherwise.
+     */
+    static std::unique_ptr<SharedMemoryRing> attach_instance(int data_fd, int state_fd,
+                                                             uint32_t slot_count,
+                                                             uint32_t slot_size);
+
+    /**
+     * @brief Class destructor - unmaps the regions and closes their file descriptors.
+     */
+    ~SharedMemoryRing();
+
+    /**
+     * @return Read-only file descriptor of the data region, to pass to the consumers (producer
+     * side only, -1 on the consumer side).
+     */
+    int consumer_data_fd() const { return m_consumer_data_fd; }
+
+    /**
+     * @return File descriptor of the state region.
+     */
+    int state_fd() const { return m_state_fd; }
+
+    /**
+     * @brief Copies a message into a free slot (producer side).
+     *
+     * @param[in] data Message data.
+     * @param[in] length Message length.
+     * @param[in] consumers Mask of the consumers the slot descriptor is going to be sent to (bit
+     * N for consumer index N).
+     * @param[out] slot Index of the slot used.
+     * @param[out] generation Generation of the slot used.
+     * @return true on success and false if the message does not fit, no slot is free or the ring
+     * was attached (consumer side).
+     */
+    bool publish(const uint8_t *data, size_t length, uint16_t consumers, uint32_t &slot,
+                 uint16_t &generation);
+
+    /**
+     * @brief Gets the message stored in a slot (consumer side).
+     *
+     * The returned memory is shared - it must be copied before calling release(), and the copy
+     * must be discarded if release() fails.
+     *
+     * @param[in] slot Slot index from the descriptor.
+     * @param[in] generation Slot generation from the descriptor.
+     * @param[out] length Message length.
+     * @return Pointer to the message or nullptr if the descriptor is not valid (anymore).
+     */
+    const uint8_t *get(uint32_t slot, uint16_t generation, size_t &length) const;
+
+    /**
+     * @brief Releases the reference of a consumer to a slot.
+     *
+     * @param slot Slot index from the descriptor.
+     * @param generation Slot generation from the descriptor.
+     * @param consumer Index of the consumer.
+     * @return true on success and false if the consumer does not reference the slot (anymore).
+     */
+    bool release(uint32_t slot, uint16_t generation, uint8_t consumer);
+
+    /**
+     * @brief Releases all the references of a consumer (producer side, when it disconnects).
+     *
+     * @param consumer Index of the consumer.
+     */
+    void release_consumer(uint8_t consumer);
+
+private:
+    SharedMemoryRing(int data_fd, int consumer_data_fd, int state_fd, Slot *slots,
+                     std::atomic<uint32_t> *states, uint32_t slot_count);
+
+    int m_data_fd;
+    int m_consumer_data_fd;
+    int m_state_fd;
+    Slot *m_slots;
+    std::atomic<uint32_t> *m_states;
+    uint32_t m_slot_count;
+
+    /**
+     * Producer side only: next slot to try and generation of the last slot published.
+     */
+    uint32_t m_next_slot  = 0;
+    uint16_t m_generation = 0;
+};
+
+} // namespace messages
+} // namespace transport
+} // namespace beerocks
+
+#endif // MAP_IEEE1905_TRANSPORT_SHARED_MEMORY_H_
@@ -11,6 +11,7 @@
 #include <bcl/beerocks_backport.h>
 #include <bcl/beerocks_defines.h>
 #include <bcl/beerocks_event_loop_impl.h>
+#include <bcl/beerocks_event_loop_uring_impl.h>
 #include <bcl/network/bridge_state_manager_impl.h>
 #include <bcl/network/bridge_state_monitor_impl.h>
 #include <bcl/network/bridge_state_reader_impl.h>
@@ -24,6 +25,10 @@
 #include <net/if.h>
 #include <unistd.h>
 
+#include <cerrno>
+#include <sstream>
+#include <unordered_set>
+
 #ifdef INCLUDE_BREAKPAD
 #include "breakpad_wrapper.h"
 #endif
@@ -32,8 +37,16 @@ using namespace beerocks;
 using namespace beerocks::net;
 using namespace beerocks::transport;
 
-static bool g_running = true;
-static int s_signal   = 0;
+static bool g_running     = true;
+static int s_signal       = 0;
+static bool g_rx_pipeline = false;
+static bool g_io_uring    = false;
+
+// Egress queueing policy of the broker (see BrokerServer::EgressPolicy), the broker defaults are
+// kept for the options that are not given
+static size_t g_egress_queue_length = 0;
+static std::unique_ptr<std::unordered_set<uint16_t>> g_egress_never_drop_types;
+static std::unique_ptr<std::unordered_set<uint16_t>> g_egress_drop_first_types;
 
 static void handle_signal()
 {
@@ -75,9 +88,88 @@ static void init_signals()
     sigaction(SIGINT, &sigint_action, NULL);
 }
 
+/**
+ * @brief Parses a comma separated list of CMDU message types (e.g. "0x0002,0x8006").
+ *
+ * @param list The list to parse.
+ * @param types The parsed message types.
+ * @return true on success and false otherwise.
+ */
+static bool parse_message_types(const char *list,
+                                std::unique_ptr<std::unordered_set<uint16_t>> &types)
+{
+    types = std::make_unique<std::unordered_set<uint16_t>>();
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        char *end;
+        errno      = 0;
+        auto value = strtoul(item.c_str(), &end, 0);
+        if (item.empty() || *end || errno || value > UINT16_MAX) {
+            std::cout << "Invalid message type: '" << item << "'" << std::endl;
+            return false;
+        }
+        types->insert(uint16_t(value));
+    }
+    return true;
+}
+
+static bool parse_arguments(int argc, char *argv[])
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "puq:n:d:")) != -1) {
+        switch (opt) {
+        case 'p': // receive and pre-process network frames in a separate thread
+        {
+            g_rx_pipeline = true;
+            break;
+        }
+        case 'u': // use io_uring instead of epoll, if supported by the kernel
+        {
+            g_io_uring = true;
+            break;
+        }
+        case 'q': // maximum number of messages queued for a single subscriber
+        {
+            g_egress_queue_length = strtoul(optarg, nullptr, 0);
+            if (!g_egress_queue_length) {
+                std::cout << "Invalid egress queue length: '" << optarg << "'" << std::endl;
+                return false;
+            }
+            break;
+        }
+        case 'n': // message types never dropped from the egress queues
+        {
+            if (!parse_message_types(optarg, g_egress_never_drop_types)) {
+                return false;
+            }
+            break;
+        }
+        case 'd': // message types dropped first from the egress queues
+        {
+            if (!parse_message_types(optarg, g_egress_drop_first_types)) {
+                return false;
+            }
+            break;
+        }
+        case '?': {
+            return false;
+        }
+        }
+    }
+    return true;
+}
+
 static std::shared_ptr<EventLoop> create_event_loop()
 {
     // Create application event loop to wait for blocking I/O operations.
+    if (g_io_uring) {
+        if (EventLoopUringImpl::is_supported()) {
+            LOG(INFO) << "Using the io_uring event loop";
+            return std::make_shared<EventLoopUringImpl>();
+        }
+        LOG(WARNING) << "io_uring is not supported, falling back to the epoll event loop";
+    }
     return std::make_shared<EventLoopImpl>();
 }
 
@@ -94,7 +186,22 @@ create_broker_server(std::shared_ptr<EventLoop> event_loop)
     auto server_socket = std::make_shared<SocketServer>(broker_uds_path, listen_buffer_size);
 
     // Create the broker server
-    return std::make_shared<broker::BrokerServer>(server_socket, event_loop);
+    auto broker = std::make_shared<broker::BrokerServer>(server_socket, event_loop);
+
+    // Apply the egress queueing policy given on the command line
+    auto policy = broker->get_egress_policy();
+    if (g_egress_queue_length) {
+        policy.max_queue_length = g_egress_queue_length;
+    }
+    if (g_egress_never_drop_types) {
+        policy.never_drop_types = *g_egress_never_drop_types;
+    }
+    if (g_egress_drop_first_types) {
+        policy.drop_first_types = *g_egress_drop_first_types;
+    }
+    broker->set_egress_policy(policy);
+
+    return broker;
 }
 
 static std::shared_ptr<NetlinkEventListener>
@@ -164,6 +271,13 @@ int main(int argc, char *argv[])
 
     init_signals();
 
+    if (!parse_arguments(argc, argv)) {
+        std::cout << "Usage: " << argv[0]
+                  << " [-p] [-u] [-q <egress queue length>] [-n <never dropped types>]"
+                  << " [-d <dropped first types>]" << std::endl;
+        return 1;
+    }
+
     mapf::Logger::Instance().LoggerInit("transport");
 
     /**
@@ -188,7 +302,7 @@ int main(int argc, char *argv[])
      * Create the IEEE1905 transport process.
      */
     Ieee1905Transport ieee1905_transport(interface_state_manager, bridge_state_manager, broker,
-                                         event_loop);
+                                         event_loop, g_rx_pipeline);
 
     /**
      * Start the message broker
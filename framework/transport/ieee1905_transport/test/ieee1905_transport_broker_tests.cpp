@@ -74,6 +74,93 @@ protected:
     }
 };
 
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////////// Helper Functions //////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Message types used by the egress queue tests. The filler messages fill the socket buffer of the
+// subscriber, and are never dropped so that only the tested messages are.
+static constexpr uint16_t FILLER_TYPE     = 0x8001;
+static constexpr uint16_t NORMAL_TYPE     = 0x8002;
+static constexpr uint16_t DROP_FIRST_TYPE = 0x8003;
+static constexpr uint16_t NEVER_DROP_TYPE = 0x8004;
+
+// Payload length of the published CMDUs
+static constexpr uint16_t CMDU_LENGTH = 4000;
+
+// Egress queue length used by the tests
+static constexpr size_t EGRESS_QUEUE_LENGTH = 4;
+
+// Connects a subscriber for the egress queue tests message types
+static std::unique_ptr<SocketClient> connect_subscriber(EventLoop &event_loop)
+{
+    SubscribeMessage subscribe;
+    subscribe.metadata()->type            = SubscribeMessage::ReqType::SUBSCRIBE;
+    subscribe.metadata()->msg_types_count = 4;
+    for (uint16_t type = FILLER_TYPE; type <= NEVER_DROP_TYPE; type++) {
+        subscribe.metadata()->msg_types[type - FILLER_TYPE].bits = {
+            .internal = 0, .vendor_specific = 0, .reserved = 0, .type = type};
+    }
+
+    auto sock = std::make_unique<SocketClient>(broker_uds_file);
+    if (event_loop.run() != 1 || !messages::send_transport_message(*sock, subscribe) ||
+        event_loop.run() != 1) {
+        return nullptr;
+    }
+
+    return sock;
+}
+
+// Publishes a CMDU, identified by its cookie
+static void publish_cmdu(BrokerServer &broker, uint16_t type, uint16_t cookie)
+{
+    CmduRxMessage cmdu;
+    cmdu.metadata()->msg_type = type;
+    cmdu.metadata()->cookie   = cookie;
+    cmdu.metadata()->length   = CMDU_LENGTH;
+    std::fill_n(cmdu.data(), CMDU_LENGTH, uint8_t(cookie));
+
+    broker.publish(cmdu);
+}
+
+// Publishes filler CMDUs until the broker starts queueing the messages of the (only) subscriber
+static size_t fill_subscriber_socket(BrokerServer &broker)
+{
+    for (int i = 0; i < 10000 && broker.get_subscriber_stats().at(0).queue_depth == 0; i++) {
+        publish_cmdu(broker, FILLER_TYPE, 0);
+    }
+
+    return broker.get_subscriber_stats().at(0).queue_depth;
+}
+
+// Reads the CMDUs received by the subscriber, letting the broker flush its egress queue, and
+// returns the cookies of the ones that are not fillers
+static std::vector<uint16_t> receive_cmdus(SocketClient &sock, EventLoop &event_loop,
+                                           BrokerServer &broker)
+{
+    std::vector<uint16_t> cookies;
+    for (int i = 0; i < 10000; i++) {
+        while (sock.getBytesReady() > 0) {
+            auto msg = messages::read_transport_message(sock);
+            if (!msg) {
+                // Received partially
+                break;
+            }
+            auto cmdu = dynamic_cast<CmduRxMessage *>(msg.get());
+            if (cmdu && cmdu->metadata()->msg_type != FILLER_TYPE) {
+                cookies.push_back(cmdu->metadata()->cookie);
+            }
+        }
+
+        if (broker.get_subscriber_stats().at(0).queue_depth == 0 && sock.getBytesReady() == 0) {
+            break;
+        }
+        event_loop.run();
+    }
+
+    return cookies;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////// Tests ////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -317,6 +404,116 @@ TEST(broker_server, subscribe_unsubscribe)
     ASSERT_TRUE(broker_wrapper.stop());
 }
 
+TEST(broker_server, egress_overflow_should_drop_oldest_message)
+{
+    auto server_socket = std::make_shared<SocketServer>(broker_uds_file, broker_listen_buffer);
+    auto event_loop    = std::make_shared<EventLoopImpl>(broker_timeout);
+    BrokerServer broker(server_socket, event_loop);
+
+    BrokerServer::EgressPolicy policy;
+    policy.max_queue_length = EGRESS_QUEUE_LENGTH;
+    policy.never_drop_types = {FILLER_TYPE};
+    broker.set_egress_policy(policy);
+    ASSERT_TRUE(broker.start());
+
+    auto sock = connect_subscriber(*event_loop);
+    ASSERT_TRUE(sock);
+    ASSERT_EQ(1U, fill_subscriber_socket(broker));
+
+    // The queue holds the filler and 3 messages, each new message replaces the oldest one
+    for (uint16_t cookie = 1; cookie <= 6; cookie++) {
+        publish_cmdu(broker, NORMAL_TYPE, cookie);
+    }
+    auto stats = broker.get_subscriber_stats().at(0);
+    EXPECT_EQ(EGRESS_QUEUE_LENGTH, stats.queue_depth);
+    EXPECT_EQ(EGRESS_QUEUE_LENGTH, stats.max_queue_depth);
+    EXPECT_EQ(3U, stats.dropped);
+
+    EXPECT_EQ(std::vector<uint16_t>({4, 5, 6}), receive_cmdus(*sock, *event_loop, broker));
+    EXPECT_EQ(0U, broker.get_subscriber_stats().at(0).queue_depth);
+
+    // Once the queue is flushed, the messages are written directly again
+    publish_cmdu(broker, NORMAL_TYPE, 7);
+    EXPECT_EQ(0U, broker.get_subscriber_stats().at(0).queue_depth);
+    EXPECT_EQ(std::vector<uint16_t>({7}), receive_cmdus(*sock, *event_loop, broker));
+
+    ASSERT_TRUE(broker.stop());
+}
+
+TEST(broker_server, egress_overflow_should_drop_lowest_priority_first)
+{
+    auto server_socket = std::make_shared<SocketServer>(broker_uds_file, broker_listen_buffer);
+    auto event_loop    = std::make_shared<EventLoopImpl>(broker_timeout);
+    BrokerServer broker(server_socket, event_loop);
+
+    BrokerServer::EgressPolicy policy;
+    policy.max_queue_length = EGRESS_QUEUE_LENGTH;
+    policy.never_drop_types = {FILLER_TYPE};
+    policy.drop_first_types = {DROP_FIRST_TYPE};
+    broker.set_egress_policy(policy);
+    ASSERT_TRUE(broker.start());
+
+    auto sock = connect_subscriber(*event_loop);
+    ASSERT_TRUE(sock);
+    ASSERT_EQ(1U, fill_subscriber_socket(broker));
+
+    publish_cmdu(broker, NORMAL_TYPE, 1);
+    publish_cmdu(broker, DROP_FIRST_TYPE, 2);
+    publish_cmdu(broker, NORMAL_TYPE, 3);
+
+    // A message that is dropped first only replaces another one
+    publish_cmdu(broker, DROP_FIRST_TYPE, 4);
+
+    // A normal message replaces it rather than an older normal message
+    publish_cmdu(broker, NORMAL_TYPE, 5);
+
+    // And a message that is dropped first does not replace a normal message
+    publish_cmdu(broker, DROP_FIRST_TYPE, 6);
+
+    EXPECT_EQ(3U, broker.get_subscriber_stats().at(0).dropped);
+    EXPECT_EQ(std::vector<uint16_t>({1, 3, 5}), receive_cmdus(*sock, *event_loop, broker));
+
+    ASSERT_TRUE(broker.stop());
+}
+
+TEST(broker_server, egress_overflow_should_keep_never_drop_messages)
+{
+    auto server_socket = std::make_shared<SocketServer>(broker_uds_file, broker_listen_buffer);
+    auto event_loop    = std::make_shared<EventLoopImpl>(broker_timeout);
+    BrokerServer broker(server_socket, event_loop);
+
+    BrokerServer::EgressPolicy policy;
+    policy.max_queue_length = EGRESS_QUEUE_LENGTH;
+    policy.never_drop_types = {FILLER_TYPE, NEVER_DROP_TYPE};
+    broker.set_egress_policy(policy);
+    ASSERT_TRUE(broker.start());
+
+    auto sock = connect_subscriber(*event_loop);
+    ASSERT_TRUE(sock);
+    ASSERT_EQ(1U, fill_subscriber_socket(broker));
+
+    for (uint16_t cookie = 1; cookie <= 3; cookie++) {
+        publish_cmdu(broker, NORMAL_TYPE, cookie);
+    }
+
+    // The never dropped messages replace the normal ones, then exceed the queue length up to
+    // twice its value
+    for (uint16_t cookie = 11; cookie <= 18; cookie++) {
+        publish_cmdu(broker, NEVER_DROP_TYPE, cookie);
+    }
+
+    // Normal messages are dropped while the queue is full of messages that are never dropped
+    publish_cmdu(broker, NORMAL_TYPE, 4);
+
+    auto stats = broker.get_subscriber_stats().at(0);
+    EXPECT_EQ(2 * EGRESS_QUEUE_LENGTH, stats.queue_depth);
+    EXPECT_EQ(5U, stats.dropped);
+    EXPECT_EQ(std::vector<uint16_t>({11, 12, 13, 14, 15, 16, 17}),
+              receive_cmdus(*sock, *event_loop, broker));
+
+    ASSERT_TRUE(broker.stop());
+}
+
 } // namespace tests
 } // namespace broker
 } // namespace transport
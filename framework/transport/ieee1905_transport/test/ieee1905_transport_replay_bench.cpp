@@ -0,0 +1,629 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+/**
+ * Transport replay benchmark.
+ *
+ * Feeds the frames of a capture file (pcap, or pcapng such as the ones written by the transport
+ * capture) through Ieee1905Transport::handle_packet() and reports the packet rate, the time spent
+ * per packet in each processing stage and the number of memory allocations per packet.
+ *
+ * The broker is replaced by a stub that drops the published messages, and the frames forwarded to
+ * the network are written to a socket pair registered as the loopback interface. Each iteration
+ * replays the capture to a new transport instance, so that the frames are not detected as
+ * duplicates of the previous iteration ones.
+ *
+ * Without a capture file, a built-in mix of topology, fragmented, duplicate and locally generated
+ * CMDUs is replayed.
+ */
+
+#include "../ieee1905_transport.h"
+
+#include <bcl/beerocks_event_loop_impl.h>
+#include <bcl/network/bridge_state_manager.h>
+#include <bcl/network/interface_state_manager.h>
+
+#include <tlvf/CmduMessageTx.h>
+#include <tlvf/ieee_1905_1/eMessageType.h>
+#include <tlvf/ieee_1905_1/tlvVendorSpecific.h>
+
+#include <mapf/common/logger.h>
+
+#include <arpa/inet.h>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <unordered_map>
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////// Allocation Counting /////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+static bool g_count_allocations = false;
+static uint64_t g_allocations   = 0;
+
+void *operator new(size_t size)
+{
+    if (g_count_allocations) {
+        g_allocations++;
+    }
+    if (auto ptr = malloc(size ? size : 1)) {
+        return ptr;
+    }
+    // Built without exceptions
+    abort();
+}
+
+void operator delete(void *ptr) noexcept { free(ptr); }
+
+void operator delete(void *ptr, size_t size) noexcept { free(ptr); }
+
+namespace beerocks {
+namespace transport {
+
+//////////////////////////////////////////////////////////////////////////////
+/////////////////////////////// Helper Classes ///////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+class InterfaceStateManagerStub : public net::InterfaceStateManager {
+public:
+    bool read_state(const std::string &iface_name, bool &iface_state) override
+    {
+        iface_state = true;
+        return true;
+    }
+};
+
+class BridgeStateManagerStub : public net::BridgeStateManager {
+public:
+    bool read_state(const std::string &bridge_name, std::set<std::string> &iface_names) override
+    {
+        return true;
+    }
+};
+
+// Broker which drops the published messages
+class BrokerServerStub : public broker::BrokerServer {
+public:
+    using BrokerServer::BrokerServer;
+
+    bool publish(const messages::Message &msg) override
+    {
+        published++;
+        return true;
+    }
+
+    uint64_t published = 0;
+};
+
+// A frame of the capture, received either from the network or from the local bus
+struct ReplayFrame {
+    bool local_bus = false;
+    std::vector<uint8_t> data;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////////// Capture Reading ///////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+static constexpr uint32_t kPcapMagic         = 0xa1b2c3d4;
+static constexpr uint32_t kPcapMagicNsec     = 0xa1b23c4d;
+static constexpr uint32_t kPcapngSectionType = 0x0A0D0D0A;
+static constexpr uint32_t kPcapngByteOrder   = 0x1A2B3C4D;
+static constexpr uint16_t kLinkTypeEthernet  = 1;
+
+// Reads the integers of a capture in its byte order
+class CaptureReader {
+public:
+    explicit CaptureReader(const std::vector<uint8_t> &data) : m_data(data) {}
+
+    bool has(size_t offset, size_t length) const
+    {
+        return offset <= m_data.size() && length <= m_data.size() - offset;
+    }
+    uint16_t u16(size_t offset) const
+    {
+        uint16_t value;
+        memcpy(&value, &m_data[offset], sizeof(value));
+        return m_swapped ? __builtin_bswap16(value) : value;
+    }
+    uint32_t u32(size_t offset) const
+    {
+        uint32_t value;
+        memcpy(&value, &m_data[offset], sizeof(value));
+        return m_swapped ? __builtin_bswap32(value) : value;
+    }
+    void set_swapped(bool swapped) { m_swapped = swapped; }
+    const uint8_t *data(size_t offset) const { return &m_data[offset]; }
+    size_t size() const { return m_data.size(); }
+
+private:
+    const std::vector<uint8_t> &m_data;
+    bool m_swapped = false;
+};
+
+static bool read_pcap(CaptureReader &reader, std::vector<ReplayFrame> &frames)
+{
+    constexpr size_t kFileHeaderSize   = 24;
+    constexpr size_t kRecordHeaderSize = 16;
+
+    if (!reader.has(0, kFileHeaderSize) || reader.u32(20) != kLinkTypeEthernet) {
+        std::cerr << "Only ethernet captures are supported" << std::endl;
+        return false;
+    }
+
+    for (size_t offset = kFileHeaderSize; reader.has(offset, kRecordHeaderSize);) {
+        uint32_t captured_length = reader.u32(offset + 8);
+        offset += kRecordHeaderSize;
+        if (!reader.has(offset, captured_length)) {
+            std::cerr << "Truncated capture record" << std::endl;
+            return false;
+        }
+        frames.push_back({false, {reader.data(offset), reader.data(offset) + captured_length}});
+        offset += captured_length;
+    }
+    return true;
+}
+
+static bool read_pcapng(CaptureReader &reader, std::vector<ReplayFrame> &frames)
+{
+    constexpr uint32_t kInterfaceDescriptionType = 1;
+    constexpr uint32_t kEnhancedPacketType       = 6;
+    constexpr uint16_t kOptIfName                = 2;
+    constexpr uint16_t kOptEpbFlags              = 2;
+    constexpr uint32_t kDirectionOutbound        = 2;
+
+    // the local bus interface of the transport capture (see PcapngCapture)
+    std::vector<bool> local_bus_interfaces;
+
+    for (size_t offset = 0; reader.has(offset, 12);) {
+        if (reader.u32(offset) == kPcapngSectionType) {
+            reader.set_swapped(false);
+            reader.set_swapped(reader.u32(offset + 8) != kPcapngByteOrder);
+            local_bus_interfaces.clear();
+        }
+
+        uint32_t type   = reader.u32(offset);
+        uint32_t length = reader.u32(offset + 4);
+        if (length < 12 || length % 4 || !reader.has(offset, length)) {
+            std::cerr << "Invalid pcapng block at offset " << offset << std::endl;
+            return false;
+        }
+
+        // options are 32-bit aligned (code, length, value) and run to the block trailer
+        auto find_option = [&](size_t options, uint16_t code, size_t &value, uint16_t &size) {
+            size_t end = offset + length - 4;
+            while (options + 4 <= end) {
+                uint16_t option_code   = reader.u16(options);
+                uint16_t option_length = reader.u16(options + 2);
+                if (option_code == 0) {
+                    break;
+                }
+                if (option_code == code) {
+                    value = options + 4;
+                    size  = option_length;
+                    return true;
+                }
+                options += 4 + ((option_length + 3) & ~3);
+            }
+            return false;
+        };
+
+        size_t value;
+        uint16_t size;
+        if (type == kInterfaceDescriptionType) {
+            if (reader.u16(offset + 8) != kLinkTypeEthernet) {
+                std::cerr << "Only ethernet captures are supported" << std::endl;
+                return false;
+            }
+            bool local_bus = false;
+            if (find_option(offset + 16, kOptIfName, value, size)) {
+                auto name = reinterpret_cast<const char *>(reader.data(value));
+                local_bus = std::string(name, strnlen(name, size)) == "local_bus";
+            }
+            local_bus_interfaces.push_back(local_bus);
+        } else if (type == kEnhancedPacketType && length >= 32) {
+            uint32_t interface       = reader.u32(offset + 8);
+            uint32_t captured_length = reader.u32(offset + 20);
+            if (interface >= local_bus_interfaces.size() || 28 + captured_length > length - 4) {
+                std::cerr << "Invalid enhanced packet block at offset " << offset << std::endl;
+                return false;
+            }
+            // replay the frames received by the device only
+            bool outbound = find_option(offset + 28 + ((captured_length + 3) & ~3),
+                                        kOptEpbFlags, value, size) &&
+                            size == 4 && (reader.u32(value) & 3) == kDirectionOutbound;
+            if (!outbound) {
+                auto data = reader.data(offset + 28);
+                frames.push_back({local_bus_interfaces[interface], {data, data + captured_length}});
+            }
+        }
+        offset += length;
+    }
+    return true;
+}
+
+static bool read_capture(const std::string &path, std::vector<ReplayFrame> &frames)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Failed to open " << path << std::endl;
+        return false;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+
+    CaptureReader reader(data);
+    if (!reader.has(0, 4)) {
+        std::cerr << "Empty capture file " << path << std::endl;
+        return false;
+    }
+
+    uint32_t magic = reader.u32(0);
+    if (magic == kPcapngSectionType) {
+        return read_pcapng(reader, frames);
+    }
+    if (magic == kPcapMagic || magic == kPcapMagicNsec) {
+        return read_pcap(reader, frames);
+    }
+    if (magic == __builtin_bswap32(kPcapMagic) || magic == __builtin_bswap32(kPcapMagicNsec)) {
+        reader.set_swapped(true);
+        return read_pcap(reader, frames);
+    }
+
+    std::cerr << "Unknown capture file format: " << path << std::endl;
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+///////////////////////////// Synthetic Traffic //////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+static const sMacAddr kMulticastAddr = {0x01, 0x80, 0xc2, 0x00, 0x00, 0x13};
+static const sMacAddr kLocalAlMac    = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+static const sMacAddr kNeighborAlMac = {0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+
+// Appends a CMDU as one frame per fragment (fragments hold whole TLVs, as the transport does)
+static void add_cmdu(std::vector<ReplayFrame> &frames, ieee1905_1::CmduMessageTx &cmdu,
+                     const sMacAddr &src, const sMacAddr &dst, bool local_bus = false)
+{
+    const size_t kHeaderLength       = ieee1905_1::CmduMessage::getCmduHeaderLength();
+    constexpr size_t kMaxTlvsLength  = 1400;
+    constexpr size_t kTlvHeaderSize  = 3;
+    constexpr uint8_t kLastFragment  = 0x80;
+    constexpr size_t kFlagsOffset    = 7;
+    constexpr size_t kFragmentOffset = 6;
+
+    const uint8_t *buffer = cmdu.getMessageBuff();
+    size_t length         = cmdu.getMessageLength();
+
+    uint8_t fragment = 0;
+    for (size_t tlvs = kHeaderLength; tlvs < length; fragment++) {
+        size_t end = tlvs;
+        while (end < length) {
+            size_t tlv_length = kTlvHeaderSize + ((buffer[end + 1] << 8) | buffer[end + 2]);
+            if (end > tlvs && end + tlv_length - tlvs > kMaxTlvsLength) {
+                break;
+            }
+            end += tlv_length;
+        }
+
+        ReplayFrame frame;
+        frame.local_bus = local_bus;
+        frame.data.resize(sizeof(ether_header));
+        auto eh = reinterpret_cast<ether_header *>(frame.data.data());
+        tlvf::mac_to_array(dst, eh->ether_dhost);
+        tlvf::mac_to_array(src, eh->ether_shost);
+        eh->ether_type = htons(ETH_P_1905_1);
+        frame.data.insert(frame.data.end(), buffer, buffer + kHeaderLength);
+        frame.data.insert(frame.data.end(), buffer + tlvs, buffer + end);
+
+        uint8_t *header          = frame.data.data() + sizeof(ether_header);
+        header[kFragmentOffset]  = fragment;
+        header[kFlagsOffset]    &= ~kLastFragment;
+        if (end == length) {
+            header[kFlagsOffset] |= kLastFragment;
+        }
+        frames.push_back(std::move(frame));
+        tlvs = end;
+    }
+}
+
+static void create_synthetic_traffic(std::vector<ReplayFrame> &frames)
+{
+    uint8_t buffer[4096];
+    uint16_t mid = 1;
+
+    // Small multicast CMDUs, relayed to the network
+    for (int i = 0; i < 4; i++) {
+        ieee1905_1::CmduMessageTx cmdu(buffer, sizeof(buffer));
+        cmdu.create(mid++, ieee1905_1::eMessageType::TOPOLOGY_NOTIFICATION_MESSAGE);
+        cmdu.finalize();
+        add_cmdu(frames, cmdu, kNeighborAlMac, kMulticastAddr);
+    }
+
+    // Unicast CMDU, received twice (the second one is a duplicate)
+    {
+        ieee1905_1::CmduMessageTx cmdu(buffer, sizeof(buffer));
+        cmdu.create(mid++, ieee1905_1::eMessageType::TOPOLOGY_QUERY_MESSAGE);
+        cmdu.finalize();
+        add_cmdu(frames, cmdu, kNeighborAlMac, kLocalAlMac);
+        add_cmdu(frames, cmdu, kNeighborAlMac, kLocalAlMac);
+    }
+
+    // Large unicast CMDU, received in 3 fragments
+    {
+        ieee1905_1::CmduMessageTx cmdu(buffer, sizeof(buffer));
+        cmdu.create(mid++, ieee1905_1::eMessageType::VENDOR_SPECIFIC_MESSAGE);
+        for (int i = 0; i < 3; i++) {
+            auto tlv = cmdu.addClass<ieee1905_1::tlvVendorSpecific>();
+            tlv->alloc_payload(1000);
+        }
+        cmdu.finalize();
+        add_cmdu(frames, cmdu, kNeighborAlMac, kLocalAlMac);
+    }
+
+    // Locally generated CMDU, sent to the network
+    {
+        ieee1905_1::CmduMessageTx cmdu(buffer, sizeof(buffer));
+        cmdu.create(mid++, ieee1905_1::eMessageType::TOPOLOGY_RESPONSE_MESSAGE);
+        cmdu.finalize();
+        add_cmdu(frames, cmdu, kLocalAlMac, kNeighborAlMac, true);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////////////// Benchmark /////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Interface the frames forwarded to the network are sent on
+static const char *const kNetworkInterface = "lo";
+
+// UDS file of the (unused) broker server socket
+static const char *const kBrokerUdsPath = "ieee1905_transport_replay_bench_uds";
+
+class Ieee1905TransportReplayBench {
+public:
+    explicit Ieee1905TransportReplayBench(const sMacAddr &al_mac) : m_al_mac(al_mac) {}
+
+    ~Ieee1905TransportReplayBench()
+    {
+        for (auto fd : m_network_fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    bool init()
+    {
+        // The transport forwards frames to the network interfaces by name, so the socket pair
+        // is registered as an interface which exists on every host
+        if (!if_nametoindex(kNetworkInterface)) {
+            std::cerr << "Network interface " << kNetworkInterface << " not found" << std::endl;
+            return false;
+        }
+
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, m_network_fds) != 0) {
+            std::cerr << "Failed to create the network socket pair: " << strerror(errno)
+                      << std::endl;
+            return false;
+        }
+
+        m_event_loop = std::make_shared<EventLoopImpl>();
+        m_broker     = std::make_shared<BrokerServerStub>(
+            std::make_shared<SocketServer>(kBrokerUdsPath, 1), m_event_loop);
+        unlink(kBrokerUdsPath);
+        return true;
+    }
+
+    void replay(const std::vector<ReplayFrame> &frames)
+    {
+        // A new transport, without de-duplication and de-fragmentation state
+        auto transport = std::make_unique<Ieee1905Transport>(
+            std::make_shared<InterfaceStateManagerStub>(),
+            std::make_shared<BridgeStateManagerStub>(), m_broker, m_event_loop);
+        transport->stage_profile_ = &m_profile;
+        tlvf::mac_to_array(m_al_mac, transport->al_mac_addr_);
+
+        auto &interface  = transport->network_interfaces_[kNetworkInterface];
+        interface.ifname = kNetworkInterface;
+        interface.fd     = std::make_shared<Socket>(dup(m_network_fds[0]));
+
+        for (const auto &frame : frames) {
+            if (frame.data.size() < sizeof(ether_header)) {
+                continue;
+            }
+            std::vector<uint8_t> buffer(frame.data);
+
+            Ieee1905Transport::Packet packet;
+            auto eh = reinterpret_cast<ether_header *>(buffer.data());
+            if (frame.local_bus) {
+                packet.dst_if_type  = messages::CmduRxMessage::IF_TYPE_NET;
+                packet.src_if_type  = messages::CmduRxMessage::IF_TYPE_LOCAL_BUS;
+                packet.src_if_index = 0;
+                packet.header       = {.iov_base = nullptr, .iov_len = 0};
+            } else {
+                packet.dst_if_type  = messages::CmduRxMessage::IF_TYPE_NONE;
+                packet.src_if_type  = messages::CmduRxMessage::IF_TYPE_NET;
+                packet.src_if_index = kReplayIfIndex;
+                packet.header       = {.iov_base = buffer.data(), .iov_len = sizeof(ether_header)};
+            }
+            packet.dst_if_index = 0;
+            packet.dst          = tlvf::mac_from_array(eh->ether_dhost);
+            packet.src          = tlvf::mac_from_array(eh->ether_shost);
+            packet.ether_type   = ntohs(eh->ether_type);
+            packet.payload      = {.iov_base = buffer.data() + sizeof(ether_header),
+                              .iov_len  = buffer.size() - sizeof(ether_header)};
+            packet.rx_time      = std::chrono::steady_clock::now();
+
+            g_count_allocations = true;
+            auto start          = std::chrono::steady_clock::now();
+            transport->handle_packet(packet);
+            m_total_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+            g_count_allocations = false;
+            m_packets++;
+
+            drain_network();
+        }
+
+    }
+
+    void report(std::ostream &os) const
+    {
+        auto stage_ns = [&](Ieee1905Transport::Stage stage) {
+            return m_profile.ns[size_t(stage)];
+        };
+        auto per_packet = [&](uint64_t value) { return m_packets ? double(value) / m_packets : 0; };
+
+        // The forward stage includes the stages it runs
+        uint64_t forward_ns = stage_ns(Ieee1905Transport::Stage::FORWARD) -
+                              stage_ns(Ieee1905Transport::Stage::DE_FRAGMENT) -
+                              stage_ns(Ieee1905Transport::Stage::PUBLISH);
+
+        os << std::fixed << std::setprecision(1);
+        os << "packets:             " << m_packets << std::endl;
+        os << "packets/s:           " << (m_total_ns ? m_packets * 1e9 / m_total_ns : 0)
+           << std::endl;
+        os << "ns/packet:           " << per_packet(m_total_ns) << std::endl;
+        os << "allocations/packet:  " << per_packet(g_allocations) << std::endl;
+        os << "published messages:  " << m_broker->published << std::endl;
+        os << "network bytes:       " << m_network_bytes << std::endl;
+        os << std::endl;
+
+        os << std::left << std::setw(16) << "stage" << std::right << std::setw(12) << "calls"
+           << std::setw(12) << "ns/call" << std::setw(12) << "ns/packet" << std::endl;
+        auto print_stage = [&](const char *name, uint64_t calls, uint64_t ns) {
+            os << std::left << std::setw(16) << name << std::right << std::setw(12) << calls
+               << std::setw(12) << (calls ? double(ns) / calls : 0) << std::setw(12)
+               << per_packet(ns) << std::endl;
+        };
+        auto calls = [&](Ieee1905Transport::Stage stage) {
+            return m_profile.calls[size_t(stage)];
+        };
+        print_stage("verify", calls(Ieee1905Transport::Stage::VERIFY),
+                    stage_ns(Ieee1905Transport::Stage::VERIFY));
+        print_stage("de-duplicate", calls(Ieee1905Transport::Stage::DE_DUPLICATE),
+                    stage_ns(Ieee1905Transport::Stage::DE_DUPLICATE));
+        print_stage("de-fragment", calls(Ieee1905Transport::Stage::DE_FRAGMENT),
+                    stage_ns(Ieee1905Transport::Stage::DE_FRAGMENT));
+        print_stage("forward", calls(Ieee1905Transport::Stage::FORWARD), forward_ns);
+        print_stage("publish", calls(Ieee1905Transport::Stage::PUBLISH),
+                    stage_ns(Ieee1905Transport::Stage::PUBLISH));
+        os << "(forward excludes the de-fragment and publish stages it runs)" << std::endl;
+    }
+
+private:
+    // interface index of the frames received from the network (not a real interface, so that
+    // they are relayed to the registered one)
+    static constexpr unsigned int kReplayIfIndex = 0xffff;
+
+    void drain_network()
+    {
+        uint8_t buffer[4096];
+        ssize_t length;
+        while ((length = recv(m_network_fds[1], buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+            m_network_bytes += length;
+        }
+    }
+
+    sMacAddr m_al_mac;
+    int m_network_fds[2] = {-1, -1};
+    std::shared_ptr<EventLoop> m_event_loop;
+    std::shared_ptr<BrokerServerStub> m_broker;
+    Ieee1905Transport::StageProfile m_profile;
+    uint64_t m_packets       = 0;
+    uint64_t m_total_ns      = 0;
+    uint64_t m_network_bytes = 0;
+};
+
+// The most common unicast destination of the frames received from the network, taken as the
+// AL MAC address of the captured device
+static sMacAddr guess_al_mac(const std::vector<ReplayFrame> &frames)
+{
+    std::unordered_map<sMacAddr, size_t> destinations;
+    for (const auto &frame : frames) {
+        if (!frame.local_bus && frame.data.size() >= sizeof(ether_header) &&
+            !ETHER_IS_MULTICAST(frame.data.data())) {
+            destinations[tlvf::mac_from_array(frame.data.data())]++;
+        }
+    }
+
+    auto most_common = std::max_element(
+        destinations.begin(), destinations.end(),
+        [](const std::pair<const sMacAddr, size_t> &a, const std::pair<const sMacAddr, size_t> &b) {
+            return a.second < b.second;
+        });
+    return most_common != destinations.end() ? most_common->first : kLocalAlMac;
+}
+
+} // namespace transport
+} // namespace beerocks
+
+using namespace beerocks::transport;
+
+int main(int argc, char *argv[])
+{
+    int iterations = 1000;
+    std::string al_mac;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:a:")) != -1) {
+        switch (opt) {
+        case 'n':
+            iterations = atoi(optarg);
+            break;
+        case 'a':
+            al_mac = optarg;
+            break;
+        default:
+            std::cerr << "Usage: " << argv[0] << " [-n iterations] [-a al_mac] [capture_file]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    // Keep the logging cost of a production build
+    mapf::Logger::Config log_config;
+    log_config.set_level("ERROR");
+    mapf::Logger::Instance().LoggerConfig(log_config);
+
+    std::vector<ReplayFrame> frames;
+    if (optind < argc) {
+        if (!read_capture(argv[optind], frames)) {
+            return 1;
+        }
+    } else {
+        create_synthetic_traffic(frames);
+    }
+    if (frames.empty()) {
+        std::cerr << "No frames to replay" << std::endl;
+        return 1;
+    }
+
+    Ieee1905TransportReplayBench bench(al_mac.empty() ? guess_al_mac(frames)
+                                                      : tlvf::mac_from_string(al_mac));
+    if (!bench.init()) {
+        return 1;
+    }
+
+    std::cout << "Replaying " << frames.size() << " frames " << iterations << " times"
+              << std::endl;
+    for (int i = 0; i < iterations; i++) {
+        bench.replay(frames);
+    }
+    bench.report(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,540 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../ieee1905_transport_broker.h"
+
+#include <bcl/beerocks_event_loop_impl.h>
+#include <btl/broker_client_factory_factory.h>
+
+#include <mapf/transport/ieee1905_transport_messages.h>
+#include <mapf/transport/ieee1905_transport_shared_memory.h>
+
+#include <tlvf/CmduMessageTx.h>
+
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace beerocks {
+namespace transport {
+namespace broker {
+namespace tests {
+
+using namespace beerocks::transport::messages;
+
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////////// Global Variables //////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// UDS file for the tests
+static const std::string broker_uds_file = "beerocks_broker_shared_memory_test_uds";
+
+// Broker SocketServer listen buffer depth
+static constexpr int broker_listen_buffer = 1;
+
+// Default broker server timeout
+static constexpr auto broker_timeout = std::chrono::milliseconds(100);
+
+// Message type of the CMDUs published by the tests
+static constexpr uint16_t CMDU_TYPE = 0x8001;
+
+// Payload length of the published CMDUs
+static constexpr uint16_t CMDU_LENGTH = 100;
+
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////////// Helper Functions //////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Publishes a message filled with the given value, referenced by the given consumers
+static bool publish(SharedMemoryRing &ring, uint8_t value, uint16_t consumers, uint32_t &slot,
+                    uint16_t &generation)
+{
+    std::vector<uint8_t> data(CMDU_LENGTH, value);
+    return ring.publish(data.data(), data.size(), consumers, slot, generation);
+}
+
+// Returns the first byte of the message in a slot, or -1 if the descriptor is not valid
+static int get_value(const SharedMemoryRing &ring, uint32_t slot, uint16_t generation)
+{
+    size_t length;
+    auto data = ring.get(slot, generation, length);
+    if (!data || length != CMDU_LENGTH) {
+        return -1;
+    }
+    return data[0];
+}
+
+// Attaches a consumer to the ring of the producer, as a subscriber does with the file
+// descriptors received from the broker
+static std::unique_ptr<SharedMemoryRing> attach_consumer(const SharedMemoryRing &producer)
+{
+    return SharedMemoryRing::attach_instance(
+        fcntl(producer.consumer_data_fd(), F_DUPFD_CLOEXEC, 0),
+        fcntl(producer.state_fd(), F_DUPFD_CLOEXEC, 0), SharedMemoryRing::kSlotCount,
+        SharedMemoryRing::kSlotSize);
+}
+
+// Connects a subscriber requesting the shared memory mode
+static std::unique_ptr<SocketClient> connect_subscriber(EventLoop &event_loop)
+{
+    SubscribeMessage subscribe;
+    subscribe.metadata()->type              = SubscribeMessage::ReqType::SUBSCRIBE;
+    subscribe.metadata()->msg_types_count   = 1;
+    subscribe.metadata()->msg_types[0].bits = {
+        .internal = 0, .vendor_specific = 0, .reserved = 0, .type = CMDU_TYPE};
+    subscribe.metadata()->shared_memory = true;
+
+    auto sock = std::make_unique<SocketClient>(broker_uds_file);
+    if (event_loop.run() != 1 || !messages::send_transport_message(*sock, subscribe) ||
+        event_loop.run() != 1) {
+        return nullptr;
+    }
+
+    return sock;
+}
+
+// Receives the shared memory configuration sent by the broker, with the file descriptors passed
+// along with it
+static bool receive_configuration(SocketClient &sock,
+                                  SharedMemoryConfigurationMessage::Metadata &config,
+                                  std::vector<int> &fds)
+{
+    Message::Header header;
+    uint8_t buffer[sizeof(header) + sizeof(config)];
+    struct iovec iov = {.iov_base = buffer, .iov_len = sizeof(buffer)};
+
+    union {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(sizeof(int) * kMaxPassedFds)];
+    } control;
+
+    struct msghdr msgh  = {};
+    msgh.msg_iov        = &iov;
+    msgh.msg_iovlen     = 1;
+    msgh.msg_control    = control.buf;
+    msgh.msg_controllen = sizeof(control.buf);
+
+    if (recvmsg(sock.getSocketFd(), &msgh, MSG_CMSG_CLOEXEC) != sizeof(buffer)) {
+        return false;
+    }
+    std::copy_n(buffer, sizeof(header), reinterpret_cast<uint8_t *>(&header));
+    if (header.type != uint32_t(Type::SharedMemoryConfigurationMessage)) {
+        return false;
+    }
+
+    for (auto cmsg = CMSG_FIRSTHDR(&msgh); cmsg; cmsg = CMSG_NXTHDR(&msgh, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+            fds.resize((cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+            std::copy_n(CMSG_DATA(cmsg), fds.size() * sizeof(int),
+                        reinterpret_cast<uint8_t *>(fds.data()));
+        }
+    }
+
+    std::copy_n(buffer + sizeof(header), sizeof(config), reinterpret_cast<uint8_t *>(&config));
+    return true;
+}
+
+// Receives the shared memory configuration and attaches to the shared memory
+static std::unique_ptr<SharedMemoryRing> attach_subscriber(SocketClient &sock, uint8_t &consumer)
+{
+    SharedMemoryConfigurationMessage::Metadata config;
+    std::vector<int> fds;
+    if (!receive_configuration(sock, config, fds) || fds.size() != 2) {
+        return nullptr;
+    }
+
+    consumer = config.consumer;
+    return SharedMemoryRing::attach_instance(fds[0], fds[1], config.slot_count, config.slot_size);
+}
+
+// Publishes a CMDU, identified by its cookie
+static void publish_cmdu(BrokerServer &broker, uint16_t cookie)
+{
+    CmduRxMessage cmdu;
+    cmdu.metadata()->msg_type = CMDU_TYPE;
+    cmdu.metadata()->cookie   = cookie;
+    cmdu.metadata()->length   = CMDU_LENGTH;
+    std::fill_n(cmdu.data(), CMDU_LENGTH, uint8_t(cookie));
+
+    broker.publish(cmdu);
+}
+
+// Counts the mappings of the broker data region in this process with the given permissions
+static int count_data_mappings(const std::string &permissions)
+{
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    int count = 0;
+    while (std::getline(maps, line)) {
+        if (line.find("/memfd:ieee1905_broker ") != std::string::npos &&
+            line.find(" " + permissions + " ") != std::string::npos) {
+            count++;
+        }
+    }
+    return count;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////// Tests ////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+TEST(shared_memory_ring, publish_should_use_consecutive_slots)
+{
+    auto ring = SharedMemoryRing::create_instance();
+    ASSERT_TRUE(ring);
+
+    uint32_t slot[2];
+    uint16_t generation[2];
+    ASSERT_TRUE(publish(*ring, 1, 0x1, slot[0], generation[0]));
+    ASSERT_TRUE(publish(*ring, 2, 0x1, slot[1], generation[1]));
+    EXPECT_EQ(slot[0] + 1, slot[1]);
+    EXPECT_NE(0U, generation[0]);
+    EXPECT_NE(generation[0], generation[1]);
+
+    EXPECT_EQ(1, get_value(*ring, slot[0], generation[0]));
+    EXPECT_EQ(2, get_value(*ring, slot[1], generation[1]));
+
+    // Invalid descriptors
+    EXPECT_EQ(-1, get_value(*ring, slot[0], generation[1]));
+    EXPECT_EQ(-1, get_value(*ring, slot[0], 0));
+    EXPECT_EQ(-1, get_value(*ring, SharedMemoryRing::kSlotCount, generation[0]));
+}
+
+TEST(shared_memory_ring, publish_should_fail_on_invalid_message)
+{
+    auto ring = SharedMemoryRing::create_instance();
+    ASSERT_TRUE(ring);
+
+    std::vector<uint8_t> data(SharedMemoryRing::kSlotSize + 1);
+    uint32_t slot;
+    uint16_t generation;
+    EXPECT_FALSE(ring->publish(data.data(), data.size(), 0x1, slot, generation));
+    EXPECT_TRUE(ring->publish(data.data(), SharedMemoryRing::kSlotSize, 0x1, slot, generation));
+
+    // The message must be sent to at least one consumer
+    EXPECT_FALSE(publish(*ring, 1, 0, slot, generation));
+}
+
+TEST(shared_memory_ring, release_should_clear_consumer_bit_only)
+{
+    auto ring = SharedMemoryRing::create_instance();
+    ASSERT_TRUE(ring);
+
+    uint32_t slot;
+    uint16_t generation;
+    ASSERT_TRUE(publish(*ring, 1, 0x5, slot, generation));
+
+    // Consumer 1 does not reference the slot
+    EXPECT_FALSE(ring->release(slot, generation, 1));
+    EXPECT_FALSE(ring->release(slot, generation, SharedMemoryRing::kMaxConsumers));
+
+    EXPECT_TRUE(ring->release(slot, generation, 0));
+    EXPECT_FALSE(ring->release(slot, generation, 0));
+
+    // The slot is still referenced by consumer 2, so its message remains valid
+    EXPECT_EQ(1, get_value(*ring, slot, generation));
+    EXPECT_FALSE(ring->release(slot, generation + 1, 2));
+    EXPECT_TRUE(ring->release(slot, generation, 2));
+}
+
+TEST(shared_memory_ring, publish_should_reuse_released_slots_only)
+{
+    auto ring = SharedMemoryRing::create_instance();
+    ASSERT_TRUE(ring);
+
+    std::vector<uint32_t> slots(SharedMemoryRing::kSlotCount);
+    std::vector<uint16_t> generations(SharedMemoryRing::kSlotCount);
+    for (uint32_t i = 0; i < SharedMemoryRing::kSlotCount; i++) {
+        ASSERT_TRUE(publish(*ring, i, 0x1, slots[i], generations[i]));
+    }
+
+    // The ring is full, slots still referenced are never taken over
+    uint32_t slot;
+    uint16_t generation;
+    EXPECT_FALSE(publish(*ring, 0xff, 0x1, slot, generation));
+
+    // Once released, a slot is reused with a new generation, invalidating the old descriptor
+    ASSERT_TRUE(ring->release(slots[3], generations[3], 0));
+    ASSERT_TRUE(publish(*ring, 0xff, 0x1, slot, generation));
+    EXPECT_EQ(slots[3], slot);
+    EXPECT_NE(generations[3], generation);
+    EXPECT_EQ(-1, get_value(*ring, slots[3], generations[3]));
+    EXPECT_FALSE(ring->release(slots[3], generations[3], 0));
+    EXPECT_EQ(0xff, get_value(*ring, slot, generation));
+
+    // The search for a free slot wraps around the end of the ring
+    ASSERT_TRUE(ring->release(slots[1], generations[1], 0));
+    ASSERT_TRUE(publish(*ring, 0xfe, 0x1, slot, generation));
+    EXPECT_EQ(slots[1], slot);
+}
+
+TEST(shared_memory_ring, release_consumer_should_release_all_its_slots)
+{
+    auto ring = SharedMemoryRing::create_instance();
+    ASSERT_TRUE(ring);
+
+    uint32_t slot = 0;
+    uint16_t generation;
+    for (uint32_t i = 0; i < SharedMemoryRing::kSlotCount; i++) {
+        ASSERT_TRUE(publish(*ring, i, i % 2 ? 0x3 : 0x2, slot, generation));
+    }
+
+    // Consumer 0 references every other slot, consumer 1 all of them
+    ring->release_consumer(0);
+    EXPECT_FALSE(publish(*ring, 0xff, 0x1, slot, generation));
+    EXPECT_FALSE(ring->release(slot, generation, 0));
+
+    ring->release_consumer(1);
+    for (uint32_t i = 0; i < SharedMemoryRing::kSlotCount; i++) {
+        EXPECT_TRUE(publish(*ring, i, 0x1, slot, generation));
+    }
+}
+
+TEST(shared_memory_ring, consumer_should_map_data_read_only)
+{
+    auto producer = SharedMemoryRing::create_instance();
+    ASSERT_TRUE(producer);
+
+    // The data region cannot be written through the file descriptor given to the consumers
+    EXPECT_EQ(O_RDONLY, fcntl(producer->consumer_data_fd(), F_GETFL) & O_ACCMODE);
+    void *mem = mmap(nullptr, sizeof(SharedMemoryRing::Slot), PROT_READ | PROT_WRITE, MAP_SHARED,
+                     producer->consumer_data_fd(), 0);
+    EXPECT_EQ(MAP_FAILED, mem);
+    EXPECT_EQ(EACCES, errno);
+
+    auto consumer = attach_consumer(*producer);
+    ASSERT_TRUE(consumer);
+    EXPECT_EQ(-1, consumer->consumer_data_fd());
+
+    uint32_t slot;
+    uint16_t generation;
+    EXPECT_FALSE(publish(*consumer, 1, 0x1, slot, generation));
+
+    // Messages published by the producer are visible to the consumer, and releases by the
+    // consumer are visible to the producer
+    for (uint32_t i = 0; i < 2 * SharedMemoryRing::kSlotCount; i++) {
+        ASSERT_TRUE(publish(*producer, i, 0x1, slot, generation));
+        EXPECT_EQ(int(i & 0xff), get_value(*consumer, slot, generation));
+        EXPECT_TRUE(consumer->release(slot, generation, 0));
+    }
+}
+
+TEST(shared_memory_ring, attach_should_fail_on_incompatible_configuration)
+{
+    auto producer = SharedMemoryRing::create_instance();
+    ASSERT_TRUE(producer);
+
+    auto dup_fd = [](int fd) { return fcntl(fd, F_DUPFD_CLOEXEC, 0); };
+    EXPECT_FALSE(SharedMemoryRing::attach_instance(dup_fd(producer->consumer_data_fd()),
+                                                   dup_fd(producer->state_fd()),
+                                                   SharedMemoryRing::kSlotCount,
+                                                   SharedMemoryRing::kSlotSize + 1));
+
+    // The regions are smaller than announced
+    EXPECT_FALSE(SharedMemoryRing::attach_instance(dup_fd(producer->consumer_data_fd()),
+                                                   dup_fd(producer->state_fd()),
+                                                   SharedMemoryRing::kSlotCount + 1,
+                                                   SharedMemoryRing::kSlotSize));
+}
+
+TEST(broker_server, shared_memory_should_be_negotiated_at_subscribe_time)
+{
+    auto server_socket = std::make_shared<SocketServer>(broker_uds_file, broker_listen_buffer);
+    auto event_loop    = std::make_shared<EventLoopImpl>(broker_timeout);
+    BrokerServer broker(server_socket, event_loop);
+    ASSERT_TRUE(broker.start());
+
+    auto sock = connect_subscriber(*event_loop);
+    ASSERT_TRUE(sock);
+
+    // The data region is passed read-only, the state region writable
+    SharedMemoryConfigurationMessage::Metadata config;
+    std::vector<int> fds;
+    ASSERT_TRUE(receive_configuration(*sock, config, fds));
+    ASSERT_EQ(2U, fds.size());
+    EXPECT_EQ(O_RDONLY, fcntl(fds[0], F_GETFL) & O_ACCMODE);
+    EXPECT_EQ(O_RDWR, fcntl(fds[1], F_GETFL) & O_ACCMODE);
+    EXPECT_EQ(0U, config.consumer);
+    EXPECT_EQ(SharedMemoryRing::kSlotCount, config.slot_count);
+    EXPECT_EQ(SharedMemoryRing::kSlotSize, config.slot_size);
+
+    auto ring =
+        SharedMemoryRing::attach_instance(fds[0], fds[1], config.slot_count, config.slot_size);
+    ASSERT_TRUE(ring);
+
+    // CMDUs are then received as descriptors of the slot holding the CmduRxMessage frame
+    publish_cmdu(broker, 1);
+    auto msg        = messages::read_transport_message(*sock);
+    auto descriptor = dynamic_cast<SharedMemoryCmduRxMessage *>(msg.get());
+    ASSERT_TRUE(descriptor);
+
+    size_t length;
+    auto data = ring->get(descriptor->metadata()->slot, descriptor->metadata()->generation, length);
+    ASSERT_TRUE(data);
+    ASSERT_EQ(sizeof(CmduRxMessage::Metadata) + CMDU_LENGTH, length);
+    CmduRxMessage::Metadata metadata;
+    std::copy_n(data, sizeof(metadata), reinterpret_cast<uint8_t *>(&metadata));
+    EXPECT_EQ(CMDU_TYPE, metadata.msg_type);
+    EXPECT_EQ(1U, metadata.cookie);
+    EXPECT_EQ(1U, data[sizeof(metadata)]);
+
+    EXPECT_TRUE(ring->release(descriptor->metadata()->slot, descriptor->metadata()->generation,
+                              config.consumer));
+
+    ASSERT_TRUE(broker.stop());
+}
+
+TEST(broker_server, shared_memory_should_fall_back_to_socket_when_full)
+{
+    auto server_socket = std::make_shared<SocketServer>(broker_uds_file, broker_listen_buffer);
+    auto event_loop    = std::make_shared<EventLoopImpl>(broker_timeout);
+    BrokerServer broker(server_socket, event_loop);
+    ASSERT_TRUE(broker.start());
+
+    auto sock = connect_subscriber(*event_loop);
+    ASSERT_TRUE(sock);
+    uint8_t consumer;
+    auto ring = attach_subscriber(*sock, consumer);
+    ASSERT_TRUE(ring);
+
+    // Slots released by the subscriber are reused
+    for (uint16_t cookie = 1; cookie <= 2 * SharedMemoryRing::kSlotCount; cookie++) {
+        publish_cmdu(broker, cookie);
+        auto msg        = messages::read_transport_message(*sock);
+        auto descriptor = dynamic_cast<SharedMemoryCmduRxMessage *>(msg.get());
+        ASSERT_TRUE(descriptor);
+        EXPECT_TRUE(ring->release(descriptor->metadata()->slot,
+                                  descriptor->metadata()->generation, consumer));
+    }
+
+    // Slots not released are not, and the broker falls back to the socket
+    for (uint16_t cookie = 1; cookie <= SharedMemoryRing::kSlotCount; cookie++) {
+        publish_cmdu(broker, cookie);
+        auto msg = messages::read_transport_message(*sock);
+        ASSERT_TRUE(dynamic_cast<SharedMemoryCmduRxMessage *>(msg.get()));
+    }
+    publish_cmdu(broker, 0xffff);
+    auto msg  = messages::read_transport_message(*sock);
+    auto cmdu = dynamic_cast<CmduRxMessage *>(msg.get());
+    ASSERT_TRUE(cmdu);
+    EXPECT_EQ(0xffff, cmdu->metadata()->cookie);
+
+    ASSERT_TRUE(broker.stop());
+}
+
+TEST(broker_server, shared_memory_should_be_released_on_disconnect)
+{
+    auto server_socket = std::make_shared<SocketServer>(broker_uds_file, broker_listen_buffer);
+    auto event_loop    = std::make_shared<EventLoopImpl>(broker_timeout);
+    BrokerServer broker(server_socket, event_loop);
+    ASSERT_TRUE(broker.start());
+
+    auto sock = connect_subscriber(*event_loop);
+    ASSERT_TRUE(sock);
+    uint8_t consumer;
+    ASSERT_TRUE(attach_subscriber(*sock, consumer));
+    EXPECT_EQ(0U, consumer);
+
+    // A second subscriber gets its own consumer index
+    auto other_sock = connect_subscriber(*event_loop);
+    ASSERT_TRUE(other_sock);
+    uint8_t other_consumer;
+    auto other_ring = attach_subscriber(*other_sock, other_consumer);
+    ASSERT_TRUE(other_ring);
+    EXPECT_EQ(1U, other_consumer);
+
+    // The first subscriber never releases its slots, until it disconnects
+    for (uint16_t cookie = 1; cookie <= SharedMemoryRing::kSlotCount; cookie++) {
+        publish_cmdu(broker, cookie);
+        auto msg        = messages::read_transport_message(*other_sock);
+        auto descriptor = dynamic_cast<SharedMemoryCmduRxMessage *>(msg.get());
+        ASSERT_TRUE(descriptor);
+        EXPECT_TRUE(other_ring->release(descriptor->metadata()->slot,
+                                        descriptor->metadata()->generation, other_consumer));
+    }
+    sock.reset();
+    ASSERT_EQ(1, event_loop->run());
+
+    // Its slots are released, and its consumer index is given to the next subscriber
+    for (uint16_t cookie = 1; cookie <= SharedMemoryRing::kSlotCount; cookie++) {
+        publish_cmdu(broker, cookie);
+        auto msg = messages::read_transport_message(*other_sock);
+        ASSERT_TRUE(dynamic_cast<SharedMemoryCmduRxMessage *>(msg.get()));
+    }
+
+    sock = connect_subscriber(*event_loop);
+    ASSERT_TRUE(sock);
+    ASSERT_TRUE(attach_subscriber(*sock, consumer));
+    EXPECT_EQ(0U, consumer);
+
+    ASSERT_TRUE(broker.stop());
+}
+
+TEST(broker_server, shared_memory_should_deliver_cmdus_to_broker_client)
+{
+    auto server_socket = std::make_shared<SocketServer>(broker_uds_file, broker_listen_buffer);
+    auto event_loop    = std::make_shared<EventLoopImpl>(broker_timeout);
+    BrokerServer broker(server_socket, event_loop);
+    ASSERT_TRUE(broker.start());
+
+    auto factory = btl::create_broker_client_factory(broker_uds_file, event_loop, true);
+    ASSERT_TRUE(factory);
+    auto client = factory->create_instance();
+    ASSERT_TRUE(client);
+
+    std::vector<uint16_t> message_ids;
+    btl::BrokerClient::EventHandlers handlers;
+    handlers.on_cmdu_received = [&](uint32_t iface_index, const sMacAddr &dst_mac,
+                                    const sMacAddr &src_mac, ieee1905_1::CmduMessageRx &cmdu_rx) {
+        message_ids.push_back(cmdu_rx.getMessageId());
+    };
+    client->set_handlers(handlers);
+    ASSERT_TRUE(client->subscribe({ieee1905_1::eMessageType::TOPOLOGY_QUERY_MESSAGE}));
+
+    // Accept the connection, handle the subscription, then map the shared memory
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(1, event_loop->run());
+    }
+
+    // Besides the broker mapping, the client maps the data region read-only
+    EXPECT_EQ(1, count_data_mappings("rw-s"));
+    EXPECT_EQ(1, count_data_mappings("r--s"));
+
+    // More CMDUs than slots, so that the slots released by the client are reused
+    std::vector<uint16_t> expected_message_ids;
+    for (uint16_t message_id = 1; message_id <= 2 * SharedMemoryRing::kSlotCount; message_id++) {
+        uint8_t buffer[256];
+        ieee1905_1::CmduMessageTx cmdu_tx(buffer, sizeof(buffer));
+        cmdu_tx.create(message_id, ieee1905_1::eMessageType::TOPOLOGY_QUERY_MESSAGE);
+        cmdu_tx.finalize();
+
+        CmduRxMessage cmdu;
+        cmdu.metadata()->msg_type   = uint16_t(ieee1905_1::eMessageType::TOPOLOGY_QUERY_MESSAGE);
+        cmdu.metadata()->ether_type = ETH_P_1905_1;
+        cmdu.metadata()->length     = cmdu_tx.getMessageLength();
+        std::copy_n(cmdu_tx.getMessageBuff(), cmdu_tx.getMessageLength(), cmdu.data());
+        ASSERT_TRUE(broker.publish(cmdu));
+        expected_message_ids.push_back(message_id);
+
+        ASSERT_EQ(1, event_loop->run());
+    }
+    EXPECT_EQ(expected_message_ids, message_ids);
+    EXPECT_EQ(0U, broker.get_subscriber_stats().at(0).dropped);
+
+    client.reset();
+    ASSERT_TRUE(broker.stop());
+}
+
+} // namespace tests
+} // namespace broker
+} // namespace transport
+} // namespace beerocks
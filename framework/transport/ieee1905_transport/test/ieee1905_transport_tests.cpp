@@ -0,0 +1,932 @@
+/* SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ * SPDX-FileCopyrightText: 2016-2020 the prplMesh contributors (see AUTHORS.md)
+ *
+ * This code is subject to the terms of the BSD+Patent license.
+ * See LICENSE file for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../ieee1905_transport.h"
+
+#include <bcl/beerocks_event_loop_impl.h>
+#include <bcl/network/bridge_state_manager.h>
+#include <bcl/network/interface_state_manager.h>
+
+#include <tlvf/CmduMessageTx.h>
+#include <tlvf/ieee_1905_1/eMessageType.h>
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <linux/if_packet.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+namespace beerocks {
+namespace transport {
+
+//////////////////////////////////////////////////////////////////////////////
+////////////////////////////// Global Variables //////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// UDS file of the (unused) broker server socket
+static const char *const kBrokerUdsPath = "ieee1905_transport_tests_uds";
+
+// Event loop timeout, after which the loop is considered idle
+static constexpr auto kEventLoopTimeout = std::chrono::milliseconds(20);
+
+// Index of the interface the frames are received on
+static constexpr unsigned int kIfIndex = 1;
+
+// Message type of the CMDUs used by the tests
+static constexpr auto kMessageType = ieee1905_1::eMessageType::TOPOLOGY_QUERY_MESSAGE;
+
+static const sMacAddr kNeighborMac = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+//////////////////////////////////////////////////////////////////////////////
+/////////////////////////////// Helper Classes ///////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+class InterfaceStateManagerStub : public net::InterfaceStateManager {
+public:
+    bool read_state(const std::string &iface_name, bool &iface_state) override
+    {
+        iface_state = true;
+        return true;
+    }
+};
+
+class BridgeStateManagerStub : public net::BridgeStateManager {
+public:
+    bool read_state(const std::string &bridge_name, std::set<std::string> &iface_names) override
+    {
+        return true;
+    }
+};
+
+// Memory laid out as a TPACKET_V3 receive ring, with blocks filled in the way the kernel does
+class RxRingStub {
+public:
+    RxRingStub(size_t block_size, size_t block_count)
+        : m_block_size(block_size), m_memory(block_size * block_count)
+    {
+    }
+
+    uint8_t *data() { return m_memory.data(); }
+
+    struct tpacket_block_desc *block(size_t index)
+    {
+        return reinterpret_cast<struct tpacket_block_desc *>(&m_memory[index * m_block_size]);
+    }
+
+    // Fills in a block with the given frames and hands it over to user space
+    void retire_block(size_t index, const std::vector<std::vector<uint8_t>> &frames,
+                      unsigned int if_index)
+    {
+        auto desc = block(index);
+
+        desc->version                     = TPACKET_V3;
+        desc->hdr.bh1.num_pkts            = frames.size();
+        desc->hdr.bh1.offset_to_first_pkt = TPACKET_ALIGN(sizeof(struct tpacket_block_desc));
+
+        auto offset = desc->hdr.bh1.offset_to_first_pkt;
+        for (const auto &frame : frames) {
+            auto hdr  = reinterpret_cast<struct tpacket3_hdr *>(&m_memory[index * m_block_size] +
+                                                               offset);
+            auto addr = reinterpret_cast<struct sockaddr_ll *>(
+                reinterpret_cast<uint8_t *>(hdr) + TPACKET_ALIGN(sizeof(struct tpacket3_hdr)));
+            addr->sll_ifindex = if_index;
+
+            hdr->tp_mac         = TPACKET_ALIGN(sizeof(struct tpacket3_hdr)) +
+                                  TPACKET_ALIGN(sizeof(struct sockaddr_ll));
+            hdr->tp_len         = frame.size();
+            hdr->tp_snaplen     = frame.size();
+            hdr->tp_next_offset = TPACKET_ALIGN(hdr->tp_mac + frame.size());
+            std::copy(frame.begin(), frame.end(), reinterpret_cast<uint8_t *>(hdr) + hdr->tp_mac);
+
+            offset += hdr->tp_next_offset;
+        }
+        desc->hdr.bh1.blk_len = offset;
+
+        desc->hdr.bh1.block_status = TP_STATUS_USER;
+    }
+
+    uint32_t block_status(size_t index) { return block(index)->hdr.bh1.block_status; }
+
+private:
+    size_t m_block_size;
+    std::vector<uint8_t> m_memory;
+};
+
+// Pair of connected datagram sockets, standing for the socket of a network interface (the frames
+// written to it are read back from the peer socket)
+class DatagramSocketPair {
+public:
+    DatagramSocketPair()
+    {
+        if (socketpair(AF_UNIX, SOCK_DGRAM, 0, m_fds) < 0) {
+            m_fds[0] = m_fds[1] = -1;
+        }
+    }
+
+    ~DatagramSocketPair()
+    {
+        close(m_fds[0]);
+        close(m_fds[1]);
+    }
+
+    int fd() const { return m_fds[0]; }
+
+    // Makes writes fail once a few frames are waiting in the peer socket
+    bool limit_queue()
+    {
+        int size = 1; // rounded up by the kernel to its minimum
+        return setsockopt(m_fds[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size)) == 0 &&
+               fcntl(m_fds[0], F_SETFL, O_NONBLOCK) == 0;
+    }
+
+    // Reads all the frames written so far, and returns the message ID of their CMDU
+    std::vector<uint16_t> read_message_ids()
+    {
+        std::vector<uint16_t> message_ids;
+        uint8_t buffer[ETH_FRAME_LEN];
+        ssize_t len;
+        while ((len = recv(m_fds[1], buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+            if (size_t(len) < sizeof(ether_header) + 6) {
+                continue;
+            }
+            uint16_t message_id;
+            std::copy_n(buffer + sizeof(ether_header) + 4, sizeof(message_id),
+                        reinterpret_cast<uint8_t *>(&message_id));
+            message_ids.push_back(ntohs(message_id));
+        }
+        return message_ids;
+    }
+
+private:
+    int m_fds[2];
+};
+
+// Broker which records the message ID of the published CMDUs, and the published telemetry reports
+class BrokerServerStub : public broker::BrokerServer {
+public:
+    using BrokerServer::BrokerServer;
+
+    bool publish(const messages::Message &msg) override
+    {
+        auto cmdu = dynamic_cast<const messages::CmduRxMessage *>(&msg);
+        if (cmdu) {
+            uint16_t message_id;
+            std::copy_n(cmdu->data() + 4, sizeof(message_id),
+                        reinterpret_cast<uint8_t *>(&message_id));
+            published.push_back(ntohs(message_id));
+            publish_thread_id = std::this_thread::get_id();
+        } else if (auto report =
+                       dynamic_cast<const messages::TransportTelemetryReportMessage *>(&msg)) {
+            telemetry_reports.push_back(*report->metadata());
+        }
+        return true;
+    }
+
+    std::vector<uint16_t> published;
+    std::vector<messages::TransportTelemetryReportMessage::Metadata> telemetry_reports;
+    std::thread::id publish_thread_id;
+};
+
+// Drives the internal stages of the transport, without any network interface (the tests only
+// have access to the transport through the fixture)
+class Ieee1905TransportTest : public ::testing::Test {
+protected:
+    static constexpr size_t kRxPipelineRingSize    = Ieee1905Transport::kRxPipelineRingSize;
+    static constexpr size_t kRxRingBlockSize       = Ieee1905Transport::kRxRingBlockSize;
+    static constexpr size_t kRxRingBlockCount      = Ieee1905Transport::kRxRingBlockCount;
+    static constexpr int kDeDuplicationWheelSlots  = Ieee1905Transport::kDeDuplicationWheelSlots;
+    static constexpr int kDeFragmentationPoolSlabs = Ieee1905Transport::kDeFragmentationPoolSlabs;
+    static constexpr size_t kTelemetryEntries      = Ieee1905Transport::kTelemetryEntries;
+
+    using NetworkInterface = Ieee1905Transport::NetworkInterface;
+    using CounterId        = Ieee1905Transport::CounterId;
+    using TimePoint        = std::chrono::steady_clock::time_point;
+
+    void SetUp() override
+    {
+        m_event_loop = std::make_shared<EventLoopImpl>(kEventLoopTimeout);
+        m_broker     = std::make_shared<BrokerServerStub>(
+            std::make_shared<SocketServer>(kBrokerUdsPath, 1), m_event_loop);
+        unlink(kBrokerUdsPath);
+        m_transport = std::make_unique<Ieee1905Transport>(
+            std::make_shared<InterfaceStateManagerStub>(),
+            std::make_shared<BridgeStateManagerStub>(), m_broker, m_event_loop, true);
+    }
+
+    void TearDown() override { m_transport->stop_rx_pipeline(); }
+
+    // Builds an Ethernet frame holding a CMDU (without any TLV) from the neighbor
+    static std::vector<uint8_t> make_frame(uint16_t message_id)
+    {
+        uint8_t buffer[256];
+        ieee1905_1::CmduMessageTx cmdu(buffer, sizeof(buffer));
+        cmdu.create(message_id, kMessageType);
+        cmdu.finalize();
+
+        std::vector<uint8_t> frame(sizeof(ether_header));
+        auto eh = reinterpret_cast<ether_header *>(frame.data());
+        tlvf::mac_to_array(Ieee1905Transport::ieee1905_multicast_addr, eh->ether_dhost);
+        tlvf::mac_to_array(kNeighborMac, eh->ether_shost);
+        eh->ether_type = htons(ETH_P_1905_1);
+        frame.insert(frame.end(), cmdu.getMessageBuff(),
+                     cmdu.getMessageBuff() + cmdu.getMessageLength());
+        return frame;
+    }
+
+    bool start_rx_pipeline() { return m_transport->start_rx_pipeline(); }
+
+    void stop_rx_pipeline() { m_transport->stop_rx_pipeline(); }
+
+    bool rx_pipeline_running() const { return m_transport->rx_pipeline_thread_.joinable(); }
+
+    void rx_pipeline_call(const std::function<void()> &function)
+    {
+        m_transport->rx_pipeline_call(function);
+    }
+
+    // Receives a frame from the network, on the RX thread
+    void receive_frame(std::vector<uint8_t> frame)
+    {
+        rx_pipeline_call([&]() {
+            m_transport->handle_interface_frame(frame.data(), frame.size(), kIfIndex);
+            m_transport->rx_pipeline_flush();
+        });
+    }
+
+    // Records a CMDU sent from the local bus (as if it was the frame), or forgets it
+    void post_sent_cmdu(std::vector<uint8_t> frame, bool remove = false)
+    {
+        auto eh = reinterpret_cast<ether_header *>(frame.data());
+        Ieee1905Transport::Packet packet;
+        packet.src_if_type = messages::CmduRxMessage::IF_TYPE_LOCAL_BUS;
+        packet.dst         = tlvf::mac_from_array(eh->ether_dhost);
+        packet.src         = tlvf::mac_from_array(eh->ether_shost);
+        packet.ether_type  = ETH_P_1905_1;
+        packet.payload     = {.iov_base = frame.data() + sizeof(ether_header),
+                          .iov_len  = frame.size() - sizeof(ether_header)};
+        m_transport->rx_pipeline_post_de_duplication_update(packet, remove);
+    }
+
+    // Handles the blocks retired to user space in the receive ring of the interface
+    void handle_rx_ring_event(NetworkInterface &interface)
+    {
+        m_transport->handle_interface_rx_ring_event(interface);
+    }
+
+    // Gives the blocks owned by user space back to the kernel, without handling them
+    void drain_rx_ring(NetworkInterface &interface)
+    {
+        m_transport->drain_interface_rx_ring(interface);
+    }
+
+    // Queues a frame to the TX batch, as if it was sent to the interface of the given socket
+    void queue_tx_frame(int fd, const std::vector<uint8_t> &frame)
+    {
+        m_transport->tx_batch_frames_.emplace_back();
+        auto &batch_frame = m_transport->tx_batch_frames_.back();
+        batch_frame.fd    = fd;
+        batch_frame.len   = frame.size();
+        std::copy(frame.begin(), frame.end(), batch_frame.buf);
+    }
+
+    bool flush_tx_batch() { return m_transport->flush_tx_batch(); }
+
+    size_t tx_batch_size() const { return m_transport->tx_batch_frames_.size(); }
+
+    // The helpers below access the RX stages directly, so they must not be used while the RX
+    // pipeline is running
+
+    std::chrono::milliseconds max_de_duplication_age() const
+    {
+        return m_transport->kMaximumDeDuplicationAge;
+    }
+
+    // Duration covered by a slot of the de-duplication expiry wheel
+    std::chrono::steady_clock::duration de_duplication_wheel_tick() const
+    {
+        return m_transport->kMaximumDeDuplicationAge / kDeDuplicationWheelSlots;
+    }
+
+    // Moves the de-duplication expiry wheel to the beginning of its first slot, and returns that
+    // time
+    TimePoint start_de_duplication_wheel()
+    {
+        auto start = TimePoint(de_duplication_wheel_tick() * kDeDuplicationWheelSlots * 100);
+        m_transport->advance_de_duplication_wheel(start);
+        return start;
+    }
+
+    // Key of a CMDU sent by the neighbor to the 1905 multicast address
+    static Ieee1905Transport::DeDuplicationKey de_duplication_key(uint16_t message_id)
+    {
+        Ieee1905Transport::DeDuplicationKey key = {};
+
+        key.src         = kNeighborMac;
+        key.dst         = Ieee1905Transport::ieee1905_multicast_addr;
+        key.messageType = htons(uint16_t(kMessageType));
+        key.messageId   = htons(message_id);
+        return key;
+    }
+
+    // Records a CMDU in the de-duplication map, as if it was received at the given time
+    void add_de_duplication_entry(uint16_t message_id, TimePoint time)
+    {
+        auto key                                   = de_duplication_key(message_id);
+        m_transport->de_duplication_map_[key].time = time;
+        m_transport->de_duplication_wheel_[m_transport->get_de_duplication_wheel_tick(time) %
+                                           kDeDuplicationWheelSlots]
+            .push_back(key);
+    }
+
+    // Updates the time of a recorded CMDU, as if a duplicate was received at the given time
+    void refresh_de_duplication_entry(uint16_t message_id, TimePoint time)
+    {
+        m_transport->de_duplication_map_[de_duplication_key(message_id)].time = time;
+    }
+
+    bool has_de_duplication_entry(uint16_t message_id)
+    {
+        return m_transport->de_duplication_map_.count(de_duplication_key(message_id)) > 0;
+    }
+
+    void advance_de_duplication_wheel(TimePoint now)
+    {
+        m_transport->advance_de_duplication_wheel(now);
+    }
+
+    // Builds the IEEE1905 payload of a fragment of a CMDU. The body of the fragment is a single
+    // TLV filled with the fragment ID, followed by the end of message TLV in the last fragment.
+    static std::vector<uint8_t> make_fragment(uint16_t message_id, uint8_t fragment_id, bool last)
+    {
+        std::vector<uint8_t> payload(sizeof(Ieee1905Transport::Ieee1905CmduHeader));
+        auto header = reinterpret_cast<Ieee1905Transport::Ieee1905CmduHeader *>(payload.data());
+
+        header->messageType = htons(uint16_t(kMessageType));
+        header->messageId   = htons(message_id);
+        header->fragmentId  = fragment_id;
+        header->SetLastFragmentIndicator(last);
+
+        append_fragment_tlv(payload, fragment_id);
+        if (last) {
+            payload.insert(payload.end(), 3, 0);
+        }
+        return payload;
+    }
+
+    // Builds the IEEE1905 payload of the CMDU reassembled from the given number of fragments
+    static std::vector<uint8_t> make_de_fragmented_cmdu(uint16_t message_id, uint8_t fragments)
+    {
+        auto payload = make_fragment(message_id, 0, true);
+        payload.resize(payload.size() - 3);
+        for (uint8_t fragment_id = 1; fragment_id < fragments; fragment_id++) {
+            append_fragment_tlv(payload, fragment_id);
+        }
+        payload.insert(payload.end(), 3, 0);
+        return payload;
+    }
+
+    static void append_fragment_tlv(std::vector<uint8_t> &payload, uint8_t fragment_id)
+    {
+        const uint8_t length = 100;
+        payload.insert(payload.end(), {0x80, 0x00, length});
+        payload.insert(payload.end(), length, fragment_id);
+    }
+
+    // Passes a fragment received from the neighbor to the de-fragmentation stage, and copies the
+    // CMDU it completes (if any)
+    bool de_fragment(uint16_t message_id, uint8_t fragment_id, bool last,
+                     std::vector<uint8_t> *cmdu = nullptr)
+    {
+        auto payload = make_fragment(message_id, fragment_id, last);
+
+        Ieee1905Transport::Packet packet;
+        packet.src_if_type  = messages::CmduRxMessage::IF_TYPE_NET;
+        packet.src_if_index = kIfIndex;
+        packet.dst          = Ieee1905Transport::ieee1905_multicast_addr;
+        packet.src          = kNeighborMac;
+        packet.ether_type   = ETH_P_1905_1;
+        packet.payload      = {.iov_base = payload.data(), .iov_len = payload.size()};
+        if (!m_transport->de_fragment_packet(packet)) {
+            return false;
+        }
+
+        if (cmdu) {
+            cmdu->resize(packet.payload_length());
+            packet.copy_payload(cmdu->data());
+        }
+        return true;
+    }
+
+    // Slabs of the pool holding the fragments received so far for a CMDU
+    std::vector<uint16_t> de_fragmentation_slabs(uint16_t message_id)
+    {
+        for (const auto &entry : m_transport->de_fragmentation_map_) {
+            if (entry.first.messageId == htons(message_id)) {
+                return std::vector<uint16_t>(entry.second.slabs,
+                                             entry.second.slabs + entry.second.numFragments);
+            }
+        }
+        return {};
+    }
+
+    size_t de_fragmentation_free_slabs() const
+    {
+        return m_transport->de_fragmentation_free_slabs_.size();
+    }
+
+    // Moves the last update of all the reassemblies in progress past the de-fragmentation timeout
+    void expire_de_fragmentation_entries()
+    {
+        for (auto &entry : m_transport->de_fragmentation_map_) {
+            entry.second.time -= m_transport->kMaximumDeFragmentationAge + std::chrono::seconds(1);
+        }
+    }
+
+    unsigned long counter(CounterId id) { return m_transport->counters_[id]; }
+
+    // Runs the broker thread event loop until it is idle
+    void run_event_loop()
+    {
+        while (m_event_loop->run() > 0) {
+        }
+    }
+
+    Ieee1905Transport::TelemetryEntry telemetry()
+    {
+        Ieee1905Transport::TelemetryEntry entry;
+        rx_pipeline_call([&]() {
+            entry = m_transport->telemetry_[m_transport->get_telemetry_index(
+                uint16_t(kMessageType))];
+        });
+        return entry;
+    }
+
+    // Sends a telemetry query from the local bus
+    void query_telemetry()
+    {
+        messages::TransportTelemetryQueryMessage msg;
+        m_transport->handle_transport_telemetry_query_message(msg);
+    }
+
+    // Counts a different number of received frames in every entry of the telemetry table
+    void fill_telemetry()
+    {
+        rx_pipeline_call([&]() {
+            for (size_t index = 0; index < m_transport->telemetry_.size(); index++) {
+                m_transport->telemetry_[index].rx_packets = index + 1;
+            }
+        });
+    }
+
+    size_t de_duplication_map_size()
+    {
+        size_t size = 0;
+        rx_pipeline_call([&]() { size = m_transport->de_duplication_map_.size(); });
+        return size;
+    }
+
+    std::shared_ptr<EventLoop> m_event_loop;
+    std::shared_ptr<BrokerServerStub> m_broker;
+    std::unique_ptr<Ieee1905Transport> m_transport;
+};
+
+constexpr size_t Ieee1905TransportTest::kRxPipelineRingSize;
+constexpr size_t Ieee1905TransportTest::kRxRingBlockSize;
+constexpr size_t Ieee1905TransportTest::kRxRingBlockCount;
+constexpr int Ieee1905TransportTest::kDeDuplicationWheelSlots;
+constexpr int Ieee1905TransportTest::kDeFragmentationPoolSlabs;
+constexpr size_t Ieee1905TransportTest::kTelemetryEntries;
+
+//////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////// Tests ////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+TEST_F(Ieee1905TransportTest, rx_pipeline_call_should_run_on_rx_thread)
+{
+    ASSERT_TRUE(start_rx_pipeline());
+
+    // The call returns once the function completed on the RX thread
+    std::thread::id rx_thread_id;
+    bool done = false;
+    rx_pipeline_call([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        rx_thread_id = std::this_thread::get_id();
+        done         = true;
+    });
+    EXPECT_TRUE(done);
+    EXPECT_NE(std::this_thread::get_id(), rx_thread_id);
+}
+
+TEST_F(Ieee1905TransportTest, rx_pipeline_should_hand_frames_to_broker_thread)
+{
+    ASSERT_TRUE(start_rx_pipeline());
+
+    // The frame is pre-processed on the RX thread, and published once the broker thread handles
+    // the ring
+    receive_frame(make_frame(1));
+    EXPECT_TRUE(m_broker->published.empty());
+
+    run_event_loop();
+    EXPECT_EQ(std::vector<uint16_t>({1}), m_broker->published);
+    EXPECT_EQ(std::this_thread::get_id(), m_broker->publish_thread_id);
+
+    auto entry = telemetry();
+    EXPECT_EQ(1U, entry.rx_packets);
+    EXPECT_EQ(0U, entry.duplicates);
+}
+
+TEST_F(Ieee1905TransportTest, rx_pipeline_should_drop_duplicate_frames)
+{
+    ASSERT_TRUE(start_rx_pipeline());
+
+    receive_frame(make_frame(1));
+    receive_frame(make_frame(1));
+    receive_frame(make_frame(2));
+    run_event_loop();
+
+    EXPECT_EQ(std::vector<uint16_t>({1, 2}), m_broker->published);
+    EXPECT_EQ(1U, telemetry().duplicates);
+}
+
+TEST_F(Ieee1905TransportTest, rx_pipeline_should_apply_de_duplication_updates)
+{
+    ASSERT_TRUE(start_rx_pipeline());
+
+    // A CMDU sent from the local bus makes the same frame received from the network a duplicate
+    post_sent_cmdu(make_frame(1));
+    post_sent_cmdu(make_frame(2));
+    receive_frame(make_frame(1));
+
+    // ... until it is forgotten (it failed to be forwarded)
+    post_sent_cmdu(make_frame(2), true);
+    receive_frame(make_frame(2));
+    run_event_loop();
+
+    EXPECT_EQ(std::vector<uint16_t>({2}), m_broker->published);
+    EXPECT_EQ(1U, telemetry().duplicates);
+}
+
+TEST_F(Ieee1905TransportTest, rx_pipeline_should_not_drop_updates_when_ring_is_full)
+{
+    constexpr uint16_t num_updates = 3 * kRxPipelineRingSize;
+    ASSERT_TRUE(start_rx_pipeline());
+
+    // The RX thread is idle, so the updates pile up in the ring until the broker thread waits for
+    // the RX thread to apply them
+    for (uint16_t message_id = 1; message_id <= num_updates; message_id++) {
+        post_sent_cmdu(make_frame(message_id));
+    }
+    receive_frame(make_frame(num_updates + 1));
+
+    EXPECT_EQ(size_t(num_updates + 1), de_duplication_map_size());
+    EXPECT_EQ(0U, telemetry().de_duplication_drops);
+
+    receive_frame(make_frame(1));
+    receive_frame(make_frame(num_updates));
+    run_event_loop();
+
+    EXPECT_EQ(std::vector<uint16_t>({num_updates + 1}), m_broker->published);
+    EXPECT_EQ(2U, telemetry().duplicates);
+}
+
+TEST_F(Ieee1905TransportTest, rx_pipeline_stop_should_join_rx_thread)
+{
+    ASSERT_TRUE(start_rx_pipeline());
+    receive_frame(make_frame(1));
+    run_event_loop();
+
+    stop_rx_pipeline();
+    EXPECT_FALSE(rx_pipeline_running());
+
+    // Functions are then run directly on the calling thread, and stopping again is harmless
+    std::thread::id call_thread_id;
+    rx_pipeline_call([&]() { call_thread_id = std::this_thread::get_id(); });
+    EXPECT_EQ(std::this_thread::get_id(), call_thread_id);
+
+    stop_rx_pipeline();
+    EXPECT_EQ(std::vector<uint16_t>({1}), m_broker->published);
+}
+
+TEST_F(Ieee1905TransportTest, rx_ring_should_walk_retired_blocks_and_release_them)
+{
+    RxRingStub ring(kRxRingBlockSize, kRxRingBlockCount);
+    NetworkInterface interface;
+    interface.rx_ring = ring.data();
+
+    // The walk starts at the last block, and wraps around to the first one
+    const size_t last       = kRxRingBlockCount - 1;
+    interface.rx_ring_block = last;
+    ring.retire_block(last, {make_frame(1), make_frame(2)}, kIfIndex);
+    ring.retire_block(0, {make_frame(3)}, kIfIndex);
+
+    handle_rx_ring_event(interface);
+
+    EXPECT_EQ(std::vector<uint16_t>({1, 2, 3}), m_broker->published);
+    EXPECT_EQ(uint32_t(TP_STATUS_KERNEL), ring.block_status(last));
+    EXPECT_EQ(uint32_t(TP_STATUS_KERNEL), ring.block_status(0));
+    EXPECT_EQ(1U, interface.rx_ring_block);
+
+    // The walk stops at the first block still owned by the kernel
+    handle_rx_ring_event(interface);
+    EXPECT_EQ(3U, m_broker->published.size());
+    EXPECT_EQ(1U, interface.rx_ring_block);
+
+    ring.retire_block(1, {make_frame(4)}, kIfIndex);
+    handle_rx_ring_event(interface);
+    EXPECT_EQ(std::vector<uint16_t>({1, 2, 3, 4}), m_broker->published);
+    EXPECT_EQ(2U, interface.rx_ring_block);
+}
+
+TEST_F(Ieee1905TransportTest, rx_ring_drain_should_release_blocks_without_handling_them)
+{
+    RxRingStub ring(kRxRingBlockSize, kRxRingBlockCount);
+    NetworkInterface interface;
+    interface.rx_ring       = ring.data();
+    interface.rx_ring_block = 2;
+
+    ring.retire_block(2, {make_frame(1)}, kIfIndex);
+    ring.retire_block(3, {make_frame(2), make_frame(3)}, kIfIndex);
+
+    drain_rx_ring(interface);
+
+    EXPECT_TRUE(m_broker->published.empty());
+    EXPECT_EQ(uint32_t(TP_STATUS_KERNEL), ring.block_status(2));
+    EXPECT_EQ(uint32_t(TP_STATUS_KERNEL), ring.block_status(3));
+    EXPECT_EQ(4U, interface.rx_ring_block);
+
+    // Frames retired afterwards are handled as usual
+    ring.retire_block(4, {make_frame(4)}, kIfIndex);
+    handle_rx_ring_event(interface);
+    EXPECT_EQ(std::vector<uint16_t>({4}), m_broker->published);
+}
+
+TEST_F(Ieee1905TransportTest, tx_batch_should_write_frames_per_socket_in_order)
+{
+    DatagramSocketPair socket1, socket2;
+    ASSERT_LE(0, socket1.fd());
+    ASSERT_LE(0, socket2.fd());
+
+    queue_tx_frame(socket1.fd(), make_frame(1));
+    queue_tx_frame(socket2.fd(), make_frame(2));
+    queue_tx_frame(socket1.fd(), make_frame(3));
+    queue_tx_frame(socket2.fd(), make_frame(4));
+
+    EXPECT_TRUE(flush_tx_batch());
+    EXPECT_EQ(0U, tx_batch_size());
+    EXPECT_EQ(std::vector<uint16_t>({1, 3}), socket1.read_message_ids());
+    EXPECT_EQ(std::vector<uint16_t>({2, 4}), socket2.read_message_ids());
+}
+
+TEST_F(Ieee1905TransportTest, tx_batch_should_retry_after_partial_write)
+{
+    DatagramSocketPair full_socket, socket;
+    ASSERT_LE(0, full_socket.fd());
+    ASSERT_LE(0, socket.fd());
+    ASSERT_TRUE(full_socket.limit_queue());
+
+    // More frames than the peer socket can queue, so the first sendmmsg() call is partial
+    const uint16_t frame_count = 64;
+    for (uint16_t message_id = 1; message_id <= frame_count; message_id++) {
+        queue_tx_frame(full_socket.fd(), make_frame(message_id));
+    }
+    queue_tx_frame(socket.fd(), make_frame(100));
+
+    EXPECT_FALSE(flush_tx_batch());
+    EXPECT_EQ(0U, tx_batch_size());
+
+    // The frames written are the first ones, in order. The frames which could not be written are
+    // dropped one by one, and do not affect the other sockets.
+    auto written = full_socket.read_message_ids();
+    ASSERT_LT(0U, written.size());
+    ASSERT_GT(size_t(frame_count), written.size());
+    for (size_t i = 0; i < written.size(); i++) {
+        EXPECT_EQ(i + 1, written[i]);
+    }
+    EXPECT_EQ(std::vector<uint16_t>({100}), socket.read_message_ids());
+
+    // Once the peer socket is drained, frames are written again
+    queue_tx_frame(full_socket.fd(), make_frame(frame_count + 1));
+    queue_tx_frame(full_socket.fd(), make_frame(frame_count + 2));
+    EXPECT_TRUE(flush_tx_batch());
+    EXPECT_EQ(std::vector<uint16_t>({frame_count + 1, frame_count + 2}),
+              full_socket.read_message_ids());
+}
+
+TEST_F(Ieee1905TransportTest, de_duplication_wheel_should_evict_expired_entries_at_wrap_around)
+{
+    using namespace std::chrono;
+
+    const auto tick  = de_duplication_wheel_tick();
+    const auto start = start_de_duplication_wheel();
+
+    add_de_duplication_entry(1, start + milliseconds(10));
+    add_de_duplication_entry(2, start + 7 * tick + milliseconds(10));
+
+    // An entry is kept until the wheel comes back around to its slot, even if it expired
+    advance_de_duplication_wheel(start + max_de_duplication_age() - tick);
+    EXPECT_TRUE(has_de_duplication_entry(1));
+    EXPECT_TRUE(has_de_duplication_entry(2));
+
+    // Wrapping around to the first slot evicts the first entry, the second one is still alive
+    advance_de_duplication_wheel(start + max_de_duplication_age() + milliseconds(20));
+    EXPECT_FALSE(has_de_duplication_entry(1));
+    EXPECT_TRUE(has_de_duplication_entry(2));
+    EXPECT_EQ(1U, counter(CounterId::DE_DUPLICATION_EVICTIONS));
+
+    // The last slot comes around once more, after the second entry expired
+    advance_de_duplication_wheel(start + 2 * max_de_duplication_age());
+    EXPECT_FALSE(has_de_duplication_entry(2));
+    EXPECT_EQ(2U, counter(CounterId::DE_DUPLICATION_EVICTIONS));
+}
+
+TEST_F(Ieee1905TransportTest, de_duplication_wheel_should_keep_refreshed_entries)
+{
+    using namespace std::chrono;
+
+    const auto tick  = de_duplication_wheel_tick();
+    const auto start = start_de_duplication_wheel();
+
+    // A duplicate received later moves the expiry of the entry to another slot
+    add_de_duplication_entry(1, start + milliseconds(10));
+    refresh_de_duplication_entry(1, start + 4 * tick + milliseconds(10));
+
+    advance_de_duplication_wheel(start + max_de_duplication_age() + milliseconds(20));
+    EXPECT_TRUE(has_de_duplication_entry(1));
+    EXPECT_EQ(0U, counter(CounterId::DE_DUPLICATION_EVICTIONS));
+
+    advance_de_duplication_wheel(start + max_de_duplication_age() + 4 * tick + milliseconds(20));
+    EXPECT_FALSE(has_de_duplication_entry(1));
+    EXPECT_EQ(1U, counter(CounterId::DE_DUPLICATION_EVICTIONS));
+}
+
+TEST_F(Ieee1905TransportTest, de_duplication_wheel_should_evict_all_entries_after_idle_period)
+{
+    const auto tick  = de_duplication_wheel_tick();
+    const auto start = start_de_duplication_wheel();
+
+    for (uint16_t slot = 0; slot < kDeDuplicationWheelSlots; slot++) {
+        add_de_duplication_entry(slot, start + slot * tick);
+    }
+
+    // Every slot is visited once, however many times the wheel went around
+    advance_de_duplication_wheel(start + 10 * max_de_duplication_age());
+    for (uint16_t slot = 0; slot < kDeDuplicationWheelSlots; slot++) {
+        EXPECT_FALSE(has_de_duplication_entry(slot));
+    }
+    EXPECT_EQ(unsigned(kDeDuplicationWheelSlots), counter(CounterId::DE_DUPLICATION_EVICTIONS));
+}
+
+TEST_F(Ieee1905TransportTest, de_fragmentation_should_reassemble_fragments_and_reuse_slabs)
+{
+    std::vector<uint8_t> cmdu;
+    EXPECT_FALSE(de_fragment(1, 0, false));
+    EXPECT_FALSE(de_fragment(1, 1, false));
+    EXPECT_TRUE(de_fragment(1, 2, true, &cmdu));
+    EXPECT_EQ(make_de_fragmented_cmdu(1, 3), cmdu);
+
+    // The slabs are held until the next fragment is handled (the CMDU is chained in them)
+    auto slabs = de_fragmentation_slabs(1);
+    EXPECT_EQ(3U, slabs.size());
+    EXPECT_EQ(size_t(kDeFragmentationPoolSlabs - 3), de_fragmentation_free_slabs());
+
+    // The next reassembly takes the slabs released by the previous one
+    EXPECT_FALSE(de_fragment(2, 0, false));
+    EXPECT_EQ(size_t(kDeFragmentationPoolSlabs - 1), de_fragmentation_free_slabs());
+    auto reused = de_fragmentation_slabs(2);
+    ASSERT_EQ(1U, reused.size());
+    EXPECT_NE(slabs.end(), std::find(slabs.begin(), slabs.end(), reused[0]));
+
+    EXPECT_TRUE(de_fragment(2, 1, true, &cmdu));
+    EXPECT_EQ(make_de_fragmented_cmdu(2, 2), cmdu);
+}
+
+TEST_F(Ieee1905TransportTest, de_fragmentation_should_drop_out_of_order_and_duplicate_fragments)
+{
+    // A reassembly is only started by the first fragment
+    EXPECT_FALSE(de_fragment(1, 1, false));
+    EXPECT_TRUE(de_fragmentation_slabs(1).empty());
+    EXPECT_EQ(size_t(kDeFragmentationPoolSlabs), de_fragmentation_free_slabs());
+
+    EXPECT_FALSE(de_fragment(1, 0, false));
+    EXPECT_FALSE(de_fragment(1, 0, false)); // duplicate
+    EXPECT_FALSE(de_fragment(1, 2, true));  // out of order
+    EXPECT_EQ(1U, de_fragmentation_slabs(1).size());
+    EXPECT_EQ(size_t(kDeFragmentationPoolSlabs - 1), de_fragmentation_free_slabs());
+
+    // The dropped fragments do not end up in the reassembled CMDU
+    std::vector<uint8_t> cmdu;
+    EXPECT_FALSE(de_fragment(1, 1, false));
+    EXPECT_FALSE(de_fragment(1, 1, false)); // duplicate
+    EXPECT_TRUE(de_fragment(1, 2, true, &cmdu));
+    EXPECT_EQ(make_de_fragmented_cmdu(1, 3), cmdu);
+    EXPECT_EQ(0U, counter(CounterId::DEFRAGMENTATION_FAILURE));
+}
+
+TEST_F(Ieee1905TransportTest, de_fragmentation_should_drop_timed_out_reassemblies)
+{
+    EXPECT_FALSE(de_fragment(1, 0, false));
+    EXPECT_FALSE(de_fragment(1, 1, false));
+    EXPECT_FALSE(de_fragment(2, 0, false));
+    EXPECT_EQ(size_t(kDeFragmentationPoolSlabs - 3), de_fragmentation_free_slabs());
+
+    // The timed out reassemblies are dropped, so the last fragment cannot complete its CMDU
+    expire_de_fragmentation_entries();
+    EXPECT_FALSE(de_fragment(1, 2, true));
+    EXPECT_TRUE(de_fragmentation_slabs(1).empty());
+    EXPECT_TRUE(de_fragmentation_slabs(2).empty());
+    EXPECT_EQ(size_t(kDeFragmentationPoolSlabs), de_fragmentation_free_slabs());
+    EXPECT_EQ(2U, counter(CounterId::DEFRAGMENTATION_FAILURE));
+
+    // The CMDU can be received again, in the released slabs
+    std::vector<uint8_t> cmdu;
+    EXPECT_FALSE(de_fragment(1, 0, false));
+    EXPECT_FALSE(de_fragment(1, 1, false));
+    EXPECT_TRUE(de_fragment(1, 2, true, &cmdu));
+    EXPECT_EQ(make_de_fragmented_cmdu(1, 3), cmdu);
+}
+
+TEST_F(Ieee1905TransportTest, telemetry_report_should_snapshot_counters)
+{
+    receive_frame(make_frame(1));
+    receive_frame(make_frame(1));
+    receive_frame(make_frame(2));
+    query_telemetry();
+
+    // Only the message types that were seen are reported
+    ASSERT_EQ(1U, m_broker->telemetry_reports.size());
+    const auto &report = m_broker->telemetry_reports[0];
+    EXPECT_EQ(0U, report.more);
+    EXPECT_EQ(0U, report.subscriber_count);
+    ASSERT_EQ(1U, report.entry_count);
+    EXPECT_EQ(uint16_t(kMessageType), report.entries[0].msg_type);
+    EXPECT_EQ(3U, report.entries[0].rx_packets);
+    EXPECT_EQ(1U, report.entries[0].duplicates);
+    EXPECT_EQ(2U, report.entries[0].publish_latency.count);
+    EXPECT_EQ(0U, report.entries[0].tx_packets);
+
+    // Each report holds the counters at the time of its query
+    receive_frame(make_frame(3));
+    query_telemetry();
+    ASSERT_EQ(2U, m_broker->telemetry_reports.size());
+    EXPECT_EQ(3U, m_broker->telemetry_reports[0].entries[0].rx_packets);
+    ASSERT_EQ(1U, m_broker->telemetry_reports[1].entry_count);
+    EXPECT_EQ(4U, m_broker->telemetry_reports[1].entries[0].rx_packets);
+    EXPECT_EQ(3U, m_broker->telemetry_reports[1].entries[0].publish_latency.count);
+}
+
+TEST_F(Ieee1905TransportTest, telemetry_report_should_snapshot_rx_pipeline_counters)
+{
+    ASSERT_TRUE(start_rx_pipeline());
+
+    // The receive counters are updated on the RX thread, the publish ones on the broker thread
+    receive_frame(make_frame(1));
+    receive_frame(make_frame(1));
+    receive_frame(make_frame(2));
+    run_event_loop();
+    query_telemetry();
+
+    ASSERT_EQ(1U, m_broker->telemetry_reports.size());
+    const auto &report = m_broker->telemetry_reports[0];
+    ASSERT_EQ(1U, report.entry_count);
+    EXPECT_EQ(3U, report.entries[0].rx_packets);
+    EXPECT_EQ(1U, report.entries[0].duplicates);
+    EXPECT_EQ(2U, report.entries[0].publish_latency.count);
+}
+
+TEST_F(Ieee1905TransportTest, telemetry_report_should_be_split_when_entries_do_not_fit)
+{
+    const size_t max_entries = messages::TransportTelemetryReportMessage::kMaxEntries;
+    fill_telemetry();
+    query_telemetry();
+
+    // All the entries are reported once, in order, and only the last message is not flagged
+    auto &reports = m_broker->telemetry_reports;
+    ASSERT_LT(1U, reports.size());
+    uint64_t rx_packets = 0;
+    for (size_t i = 0; i < reports.size(); i++) {
+        bool last = (i == reports.size() - 1);
+        EXPECT_EQ(last ? 0U : 1U, reports[i].more);
+        if (!last) {
+            EXPECT_EQ(max_entries, reports[i].entry_count);
+        }
+        for (size_t entry = 0; entry < reports[i].entry_count; entry++) {
+            EXPECT_EQ(++rx_packets, reports[i].entries[entry].rx_packets);
+        }
+    }
+    EXPECT_EQ(uint64_t(kTelemetryEntries), rx_packets);
+
+    // The IEEE1905.1 message types come first
+    EXPECT_EQ(uint16_t(kMessageType), reports[0].entries[uint16_t(kMessageType)].msg_type);
+}
+
+} // namespace transport
+} // namespace beerocks
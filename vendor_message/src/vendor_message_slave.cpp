@@ -75,10 +75,11 @@ bool VendorMessageSlave::thread_init()
 
     /**  Broker Client  **/
 
-    // Create broker client factory to create broker clients when requested
+    // Create broker client factory to create broker clients when requested (the clients receive
+    // CMDUs through the broker shared memory if the transport supports it)
     std::string broker_uds_path = config.temp_path + std::string(BEEROCKS_BROKER_UDS);
     m_broker_client_factory =
-        beerocks::btl::create_broker_client_factory(broker_uds_path, m_event_loop);
+        beerocks::btl::create_broker_client_factory(broker_uds_path, m_event_loop, true);
     LOG_IF(!m_broker_client_factory, FATAL) << "Unable to create broker client factory!";
 
     // Create an instance of a broker client connected to the broker server that is running in the